@@ -246,6 +246,9 @@ static const char *afi_state_to_str(vtss_afi_entry_state_t state)
     case VTSS_AFI_ENTRY_STATE_STARTED:
         return "Started";
 
+    case VTSS_AFI_ENTRY_STATE_REMOVING:
+        return "Removing";
+
     default:
         VTSS_E("Unknown state (%u)", state);
         return "Unknown";
@@ -1132,6 +1135,229 @@ static vtss_rc afi_dti_inj_start(vtss_state_t *vtss_state, vtss_afi_fastid_t fas
     return rc;
 }
 
+/******************************************************************************/
+//
+// Internal AIL: Frame removal
+//
+/******************************************************************************/
+
+/*
+ * afi_rm_event_add()
+ */
+static void afi_rm_event_add(vtss_state_t *const vtss_state, BOOL fast, u32 idx, BOOL removed)
+{
+    vtss_afi_state_t *afi = &vtss_state->afi;
+
+    if (afi->rm_event_cnt == VTSS_AFI_RM_EVENT_CNT) {
+        // Overwrite the oldest event
+        afi->rm_event_rd = (afi->rm_event_rd + 1) % VTSS_AFI_RM_EVENT_CNT;
+        afi->rm_event_cnt--;
+        afi->rm_event_lost++;
+    }
+
+    afi->rm_events[(afi->rm_event_rd + afi->rm_event_cnt) % VTSS_AFI_RM_EVENT_CNT] =
+        (fast ? VTSS_AFI_RM_EVENT_FAST : 0) | (removed ? VTSS_AFI_RM_EVENT_REMOVED : 0) | (idx & VTSS_AFI_RM_EVENT_ID_MASK);
+    afi->rm_event_cnt++;
+}
+
+/*
+ * afi_rm_done()
+ *
+ * Free the resources of a flow, whose frames are gone, and remove it from the
+ * pending list. If removal failed, the flow goes back to the stopped state.
+ */
+static vtss_rc afi_rm_done(vtss_state_t *const vtss_state, u32 rm_idx, BOOL removed)
+{
+    vtss_afi_state_t *afi = &vtss_state->afi;
+    vtss_afi_rm_t    *rm = &afi->rm_tbl[rm_idx];
+    vtss_afi_dti_t   *dti;
+    vtss_afi_tti_t   *tti;
+    vtss_rc          rc = VTSS_RC_OK;
+
+    VTSS_I("%s_idx = %u on port %d: %s", rm->fast ? "dti" : "tti", rm->idx, rm->port_no, removed ? "Removed" : "Not removed");
+
+    if (rm->fast) {
+        dti = &afi->dti_tbl[rm->idx];
+        dti->state = VTSS_AFI_ENTRY_STATE_STOPPED;
+        if (removed && (rc = afi_dti_frm_free(vtss_state, dti, FALSE)) == VTSS_RC_OK) {
+            rc = afi_dti_free(vtss_state, rm->idx);
+        }
+    } else {
+        tti = &afi->tti_tbl[rm->idx];
+        tti->state = VTSS_AFI_ENTRY_STATE_STOPPED;
+        if (removed && (rc = afi_frm_free(vtss_state, tti->frm_idx)) == VTSS_RC_OK) {
+            rc = afi_tti_free(vtss_state, rm->idx);
+        }
+    }
+
+    afi_rm_event_add(vtss_state, rm->fast, rm->idx, removed && rc == VTSS_RC_OK);
+
+    // Move the last pending flow into this entry
+    *rm = afi->rm_tbl[--afi->rm_cnt];
+
+    return rc;
+}
+
+/*
+ * afi_rm_check()
+ *
+ * Poll FRM_GONE for a pending flow. If gone, the flow is removed from the
+ * pending list.
+ */
+static vtss_rc afi_rm_check(vtss_state_t *const vtss_state, u32 rm_idx, BOOL *const gone)
+{
+    vtss_afi_state_t *afi = &vtss_state->afi;
+    vtss_afi_rm_t    *rm = &afi->rm_tbl[rm_idx];
+
+    VTSS_RC(afi->frm_gone_get(vtss_state, rm->frm_idx, gone));
+    if (*gone) {
+        return afi_rm_done(vtss_state, rm_idx, TRUE);
+    }
+    rm->poll_cnt++;
+    return VTSS_RC_OK;
+}
+
+/*
+ * afi_rm_start()
+ *
+ * Start removal injection for a stopped flow. If the frame is not gone at
+ * once, the flow enters the removing state and is freed by vtss_afi_rm_poll().
+ */
+static vtss_rc afi_rm_start(vtss_state_t *const vtss_state, BOOL fast, u32 idx, i32 frm_idx, vtss_port_no_t port_no)
+{
+    vtss_afi_state_t *afi = &vtss_state->afi;
+    vtss_afi_rm_t    *rm;
+    BOOL             gone;
+
+    if (afi->rm_cnt >= VTSS_ARRSZ(afi->rm_tbl)) {
+        VTSS_E("Too many pending removals");
+        return VTSS_RC_ERROR;
+    }
+
+    VTSS_RC(fast ? afi->dti_frm_rm_inj(vtss_state, idx) : afi->tti_frm_rm_inj(vtss_state, idx));
+
+    if (fast) {
+        afi->dti_tbl[idx].state = VTSS_AFI_ENTRY_STATE_REMOVING;
+    } else {
+        afi->tti_tbl[idx].state = VTSS_AFI_ENTRY_STATE_REMOVING;
+    }
+
+    rm = &afi->rm_tbl[afi->rm_cnt];
+    rm->fast     = fast;
+    rm->idx      = idx;
+    rm->frm_idx  = frm_idx;
+    rm->port_no  = port_no;
+    rm->poll_cnt = 0;
+    VTSS_MTIMER_START(&rm->timer, VTSS_AFI_RM_ESCALATE_MSEC);
+
+    return afi_rm_check(vtss_state, afi->rm_cnt++, &gone);
+}
+
+/*
+ * afi_rm_port_escalate()
+ *
+ * Escalate removal of the pending flows on a port like this:
+ * 1) Stop forwarding into and out of the port and poll the flows again.
+ * 2) Since other AFI frames injected on the port may still starve the flows,
+ *    stop all other AFI flows on the port and poll the flows again.
+ * Each method polls FRM_GONE at most VTSS_AFI_RM_POLL_CNT times in total, so
+ * the time the port is held does not grow with the number of pending flows.
+ * Then the port is restored. Timed out flows, which are still not gone, are
+ * given up.
+ */
+static vtss_rc afi_rm_port_escalate(vtss_state_t *const vtss_state, vtss_port_no_t port_no)
+{
+    vtss_afi_state_t *afi = &vtss_state->afi;
+    vtss_afi_rm_t    *rm;
+    u32              method, poll_cnt, rm_idx, pending = 1;
+    BOOL             gone;
+    vtss_rc          rc = VTSS_RC_OK, rc2;
+
+    VTSS_I("Escalating removal on port %d", port_no);
+
+    for (method = 2; method < 4 && pending && rc == VTSS_RC_OK; method++) {
+        if ((rc = afi->rm_port_hold(vtss_state, port_no, method, TRUE)) != VTSS_RC_OK) {
+            break;
+        }
+
+        for (poll_cnt = 0; poll_cnt < VTSS_AFI_RM_POLL_CNT && pending && rc == VTSS_RC_OK; ) {
+            pending = 0;
+            for (rm_idx = 0; rm_idx < afi->rm_cnt && rc == VTSS_RC_OK; ) {
+                if (afi->rm_tbl[rm_idx].port_no != port_no) {
+                    rm_idx++;
+                } else if (poll_cnt == VTSS_AFI_RM_POLL_CNT) {
+                    // Out of polls, the remaining flows are still pending
+                    pending++;
+                    break;
+                } else {
+                    poll_cnt++;
+                    if ((rc = afi_rm_check(vtss_state, rm_idx, &gone)) == VTSS_RC_OK && !gone) {
+                        pending++;
+                        rm_idx++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Restore the port
+    if ((rc2 = afi->rm_port_hold(vtss_state, port_no, method - 1, FALSE)) != VTSS_RC_OK && rc == VTSS_RC_OK) {
+        rc = rc2;
+    }
+
+    // Give up the timed out flows on the port
+    for (rm_idx = 0; rm_idx < afi->rm_cnt; ) {
+        rm = &afi->rm_tbl[rm_idx];
+        if (rm->port_no == port_no && VTSS_MTIMER_TIMEOUT(&rm->timer)) {
+            VTSS_E("%s_idx = %u on port %d: Polled %u times using method %u. FRM_GONE = 0", rm->fast ? "dti" : "tti", rm->idx, port_no, rm->poll_cnt, method - 1);
+            if ((rc2 = afi_rm_done(vtss_state, rm_idx, FALSE)) != VTSS_RC_OK && rc == VTSS_RC_OK) {
+                rc = rc2;
+            }
+        } else {
+            rm_idx++;
+        }
+    }
+
+    return rc;
+}
+
+/*
+ * vtss_afi_rm_poll()
+ *
+ * Advance the pending frame removals. Each pending flow is polled once, and
+ * the ports with flows that have been pending for too long are escalated one
+ * at a time. Called from vtss_poll_1sec() and vtss_afi_rm_event_get().
+ */
+vtss_rc vtss_afi_rm_poll(vtss_state_t *vtss_state)
+{
+    vtss_afi_state_t *afi = &vtss_state->afi;
+    u32              rm_idx;
+    BOOL             gone;
+
+    if (afi->rm_cnt == 0 || afi->frm_gone_get == NULL) {
+        return VTSS_RC_OK;
+    }
+
+    for (rm_idx = 0; rm_idx < afi->rm_cnt; ) {
+        VTSS_RC(afi_rm_check(vtss_state, rm_idx, &gone));
+        if (!gone) {
+            rm_idx++;
+        }
+    }
+
+    // Escalation completes or gives up all timed out flows on the port, so the search starts over
+    for (rm_idx = 0; rm_idx < afi->rm_cnt; ) {
+        if (VTSS_MTIMER_TIMEOUT(&afi->rm_tbl[rm_idx].timer)) {
+            VTSS_RC(afi_rm_port_escalate(vtss_state, afi->rm_tbl[rm_idx].port_no));
+            rm_idx = 0;
+        } else {
+            rm_idx++;
+        }
+    }
+
+    return VTSS_RC_OK;
+}
+
 /******************************************************************************/
 //
 // External AIL: Fast injections
@@ -1243,6 +1469,7 @@ vtss_rc vtss_afi_fast_inj_free(const vtss_inst_t inst, vtss_afi_fastid_t fastid)
     vtss_state_t   *vtss_state;
     vtss_afi_dti_t *dti;
     vtss_rc        rc;
+    i32            frm_idx, last_frm_idx = 0;
 #if VTSS_OPT_TRACE
     vtss_port_no_t port_no = -2;
 #endif
@@ -1273,6 +1500,17 @@ vtss_rc vtss_afi_fast_inj_free(const vtss_inst_t inst, vtss_afi_fastid_t fastid)
 
     // Inject frames for removal - if any
     if (dti->frm_cnt) {
+        if (vtss_state->afi.frm_gone_get != NULL) {
+            // The resources are freed when the frames are gone
+            for (frm_idx = dti->first_frm_idx; frm_idx > 0; frm_idx = vtss_state->afi.frm_tbl[frm_idx].next_ptr) {
+                if (vtss_state->afi.frm_tbl[frm_idx].entry_type == 0) {
+                    last_frm_idx = frm_idx;
+                }
+            }
+            rc = afi_rm_start(vtss_state, TRUE, fastid, last_frm_idx, dti->port_no);
+            goto do_exit;
+        }
+
         if ((rc = vtss_state->afi.dti_frm_rm_inj(vtss_state, fastid)) != VTSS_RC_OK) {
             goto do_exit;
         }
@@ -1284,7 +1522,9 @@ vtss_rc vtss_afi_fast_inj_free(const vtss_inst_t inst, vtss_afi_fastid_t fastid)
     }
 
     // Free resources from DTI_TBL[]
-    rc = afi_dti_free(vtss_state, fastid);
+    if ((rc = afi_dti_free(vtss_state, fastid)) == VTSS_RC_OK && vtss_state->afi.frm_gone_get != NULL) {
+        afi_rm_event_add(vtss_state, TRUE, fastid, TRUE);
+    }
 
 do_exit:
     VTSS_EXIT();
@@ -1322,6 +1562,12 @@ vtss_rc vtss_afi_fast_inj_frm_hijack(const vtss_inst_t inst, vtss_afi_fastid_t f
     // Check to see that this function is not called more times than allowed to.
     dti = &vtss_state->afi.dti_tbl[fastid];
 
+    if (dti->state == VTSS_AFI_ENTRY_STATE_REMOVING) {
+        VTSS_E("fastid = %u is being removed", fastid);
+        rc = VTSS_RC_ERROR;
+        goto do_exit;
+    }
+
     if (dti->frm_cnt >= VTSS_AFI_FAST_INJ_FRM_CNT_MAX) {
         VTSS_E("Frame count is already at its max of %u", VTSS_AFI_FAST_INJ_FRM_CNT_MAX);
         rc = VTSS_RC_ERROR;
@@ -1599,6 +1845,12 @@ vtss_rc vtss_afi_slow_inj_free(const vtss_inst_t inst, vtss_afi_slowid_t slowid)
 
     // Inject frame for removal - if any
     if (tti->hijacked) {
+        if (vtss_state->afi.frm_gone_get != NULL) {
+            // The resources are freed when the frame is gone
+            rc = afi_rm_start(vtss_state, FALSE, slowid, tti->frm_idx, tti->port_no);
+            goto do_exit;
+        }
+
         if ((rc = vtss_state->afi.tti_frm_rm_inj(vtss_state, slowid)) != VTSS_RC_OK) {
             goto do_exit;
         }
@@ -1609,7 +1861,9 @@ vtss_rc vtss_afi_slow_inj_free(const vtss_inst_t inst, vtss_afi_slowid_t slowid)
         goto do_exit;
     }
 
-    rc = afi_tti_free(vtss_state, slowid);
+    if ((rc = afi_tti_free(vtss_state, slowid)) == VTSS_RC_OK && vtss_state->afi.frm_gone_get != NULL) {
+        afi_rm_event_add(vtss_state, FALSE, slowid, TRUE);
+    }
 
 do_exit:
     VTSS_EXIT();
@@ -1636,6 +1890,12 @@ vtss_rc vtss_afi_slow_inj_frm_hijack(const vtss_inst_t inst, vtss_afi_slowid_t s
         goto do_exit;
     }
 
+    if (vtss_state->afi.tti_tbl[slowid].state == VTSS_AFI_ENTRY_STATE_REMOVING) {
+        VTSS_E("slowid = %u is being removed", slowid);
+        rc = VTSS_RC_ERROR;
+        goto do_exit;
+    }
+
     if ((rc = vtss_state->afi.tti_frm_hijack(vtss_state, slowid)) == VTSS_RC_OK) {
         // Frame is now transferred to H/W
         vtss_state->afi.tti_tbl[slowid].hijacked = TRUE;
@@ -1870,6 +2130,35 @@ do_exit:
     return rc;
 }
 
+/*
+ * vtss_afi_rm_event_get()
+ */
+vtss_rc vtss_afi_rm_event_get(const vtss_inst_t inst, vtss_afi_rm_event_t *const event)
+{
+    vtss_state_t     *vtss_state;
+    vtss_afi_state_t *afi;
+    vtss_rc          rc;
+    u32              ev;
+
+    VTSS_ENTER();
+    VTSS_MEMSET(event, 0, sizeof(*event));
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        afi = &vtss_state->afi;
+        rc = vtss_afi_rm_poll(vtss_state);
+        if (afi->rm_event_cnt) {
+            ev = afi->rm_events[afi->rm_event_rd];
+            afi->rm_event_rd = (afi->rm_event_rd + 1) % VTSS_AFI_RM_EVENT_CNT;
+            afi->rm_event_cnt--;
+            event->valid   = TRUE;
+            event->fast    = (ev & VTSS_AFI_RM_EVENT_FAST ? TRUE : FALSE);
+            event->removed = (ev & VTSS_AFI_RM_EVENT_REMOVED ? TRUE : FALSE);
+            event->id      = (ev & VTSS_AFI_RM_EVENT_ID_MASK);
+        }
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 /*
  * vtss_afi_debug_print()
  */
@@ -1959,6 +2248,9 @@ void vtss_afi_debug_print(vtss_state_t *vtss_state, const vtss_debug_printf_t pr
         pr("%4d %4s\n", port_no == VTSS_ARRSZ(vtss_state->afi.port_tbl) - 1 ? (u32)(-1) : port_no, afi_port->link ? "Yes" : "No");
     }
 
+    pr("\nFrame Removal\n");
+    pr("Pending: %u, Events: %u, Lost events: %u\n", afi->rm_cnt, afi->rm_event_cnt, afi->rm_event_lost);
+
     pr("\n");
 }
 
@@ -315,6 +315,7 @@ typedef enum {
     VTSS_AFI_ENTRY_STATE_FREE,      /**< Entry is not in use                                  */
     VTSS_AFI_ENTRY_STATE_STOPPED,   /**< Entry is allocated and hijacked, but stopped by user */
     VTSS_AFI_ENTRY_STATE_STARTED,   /**< Entry is allocated and hijacked, and started by user */
+    VTSS_AFI_ENTRY_STATE_REMOVING,  /**< Entry is freed by user, waiting for frame removal   */
 } vtss_afi_entry_state_t;
 
 // DTI_TBL entry
@@ -408,8 +409,35 @@ typedef struct {
 #if !defined(VTSS_ARCH_JAGUAR_2_B)
     u8  frm_rm_only;
 #endif
+
+    // Forwarding state saved while frame removal is escalated. Maintained by CIL.
+    BOOL rm_old_fwd;
 } vtss_afi_port_t;
 
+// Pending frame removal
+typedef struct {
+    BOOL           fast;     // TRUE for DTI, FALSE for TTI
+    u32            idx;      // DTI or TTI index
+    i32            frm_idx;  // FRM_GONE is polled for this frame, which is the last frame in the sequence
+    vtss_port_no_t port_no;  // Port where the frame is removed, VTSS_PORT_NO_NONE for VD1
+    u32            poll_cnt; // Number of polls without FRM_GONE
+    vtss_mtimer_t  timer;    // Removal is escalated when this timer expires
+} vtss_afi_rm_t;
+
+// Number of frame removal events, which may be queued for vtss_afi_rm_event_get()
+#define VTSS_AFI_RM_EVENT_CNT (VTSS_AFI_FAST_INJ_CNT + VTSS_AFI_SLOW_INJ_CNT)
+
+// Layout of the queued removal events
+#define VTSS_AFI_RM_EVENT_FAST    0x80000000
+#define VTSS_AFI_RM_EVENT_REMOVED 0x40000000
+#define VTSS_AFI_RM_EVENT_ID_MASK 0xffff
+
+// Max number of FRM_GONE polls on a port for each escalation method
+#define VTSS_AFI_RM_POLL_CNT 1000
+
+// Time from removal injection until removal is escalated
+#define VTSS_AFI_RM_ESCALATE_MSEC 10
+
 typedef struct {
     // CIL function pointers
     vtss_rc (*afi_enable)(      struct vtss_state_s *const vtss_state);
@@ -426,6 +454,16 @@ typedef struct {
     vtss_rc (*dti_frm_rm_inj)(  struct vtss_state_s *const vtss_state, u32 dti_idx);
     vtss_rc (*dti_cnt_get)(     struct vtss_state_s *const vtss_state, u32 dti_idx, u32 *const cnt);
 
+    // Asynchronous frame removal, may be NULL.
+    // If frm_gone_get is non-NULL, tti_frm_rm_inj and dti_frm_rm_inj only start the removal
+    // injection and the AIL polls for FRM_GONE. Otherwise, they wait until the frame is gone.
+    vtss_rc (*frm_gone_get)(    struct vtss_state_s *const vtss_state, i32 frm_idx, BOOL *const gone);
+
+    // Escalate frame removal on a port.
+    // Method 2 stops forwarding into and out of the port, method 3 also stops other AFI flows on the port.
+    // When hold is FALSE, the given method and the methods below it are undone.
+    vtss_rc (*rm_port_hold)(    struct vtss_state_s *const vtss_state, vtss_port_no_t port_no, u32 method, BOOL hold);
+
     // Administrative port start/stop
     vtss_rc (*port_admin_start)(struct vtss_state_s *const vtss_state, vtss_port_no_t port_no);
     vtss_rc (*port_admin_stop)( struct vtss_state_s *const vtss_state, vtss_port_no_t port_no);
@@ -476,10 +514,21 @@ typedef struct {
 
     // Switch core's clock period in picoseconds
     u64 clk_period_ps;
+
+    // Pending frame removals
+    vtss_afi_rm_t rm_tbl[VTSS_AFI_FAST_INJ_CNT + VTSS_AFI_SLOW_INJ_CNT];
+    u32           rm_cnt;
+
+    // Frame removal events, circular buffer
+    u32 rm_events[VTSS_AFI_RM_EVENT_CNT];
+    u32 rm_event_rd;   // Index of oldest event
+    u32 rm_event_cnt;  // Number of events
+    u32 rm_event_lost; // Number of events overwritten before being read
 } vtss_afi_state_t;
 
 vtss_rc vtss_afi_inst_create(struct vtss_state_s *vtss_state);
 void vtss_afi_debug_print(struct vtss_state_s *vtss_state, const vtss_debug_printf_t pr, const vtss_debug_info_t *const info);
+vtss_rc vtss_afi_rm_poll(struct vtss_state_s *vtss_state);
 
 // ========================================
 // Functions shared with CIL
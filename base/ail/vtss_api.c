@@ -190,6 +190,7 @@ vtss_rc vtss_inst_get(const vtss_target_type_t target,
                       vtss_inst_create_t       *const create)
 {
     VTSS_D("enter");
+    VTSS_MEMSET(create, 0, sizeof(*create));
     create->target = target;
     VTSS_D("exit");
 
@@ -216,16 +217,146 @@ static vtss_rc vtss_inst_default_set(vtss_state_t *vtss_state)
     return VTSS_RC_OK;
 }
 
+/* - Persistent state ---------------------------------------------- */
+
+static u32 vtss_persist_chksum(const vtss_persist_hdr_t *hdr)
+{
+    const u8 *p = (const u8 *)hdr;
+    u32      i, n = ((const u8 *)&hdr->chksum - p), chksum = 0;
+
+    for (i = 0; i < n; i++) {
+        chksum = ((chksum << 5) + chksum + p[i]);
+    }
+    return chksum;
+}
+
+static void vtss_persist_hdr_update(vtss_persist_hdr_t *hdr, BOOL valid)
+{
+    hdr->valid = valid;
+    hdr->chksum = vtss_persist_chksum(hdr);
+}
+
+/* Check if the state in a persistent region can be adopted */
+static BOOL vtss_persist_adoptable(const vtss_persist_hdr_t *hdr, const vtss_inst_create_t *create)
+{
+    const char *txt = NULL;
+
+    if (hdr->magic != VTSS_PERSIST_MAGIC) {
+        txt = "no previous state";
+    } else if (hdr->chksum != vtss_persist_chksum(hdr)) {
+        txt = "header checksum";
+    } else if (hdr->version != VTSS_PERSIST_VERSION || hdr->api_version != VTSS_API_VERSION ||
+               hdr->state_size != sizeof(vtss_state_t)) {
+        txt = "layout mismatch";
+    } else if (hdr->target != create->target) {
+        txt = "target mismatch";
+    } else if (hdr->base != (size_t)((u8 *)hdr + VTSS_PERSIST_HDR_SIZE)) {
+        txt = "region address changed";
+    } else if (hdr->code != (size_t)vtss_inst_create) {
+        txt = "code address changed";
+    } else if (!hdr->valid) {
+        txt = "state not released";
+    }
+    if (txt != NULL) {
+        VTSS_I("not adopting state: %s", txt);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+vtss_rc vtss_inst_persist_size_get(u32 *const size)
+{
+    *size = (VTSS_PERSIST_HDR_SIZE + sizeof(vtss_state_t));
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_inst_persist_status_get(const vtss_inst_t          inst,
+                                     vtss_inst_persist_status_t *const status)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_D("enter");
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        status->persistent = (vtss_state->persist != NULL);
+        status->adopted = vtss_state->persist_adopted;
+    }
+    VTSS_D("exit");
+
+    return rc;
+}
+
+/* Clear the parts of an adopted state supplied by the previous application */
+static void vtss_persist_app_clear(vtss_state_t *vtss_state)
+{
+    vtss_init_conf_t *conf = &vtss_state->init_conf;
+
+    /* The callouts point into the previous process, they are set again by vtss_init_conf_set() */
+    conf->reg_read = NULL;
+    conf->reg_write = NULL;
+#if defined(VTSS_FEATURE_CLOCK)
+    conf->clock_read = NULL;
+    conf->clock_write = NULL;
+#endif /* VTSS_FEATURE_CLOCK */
+    conf->miim_read = NULL;
+    conf->miim_write = NULL;
+    conf->mmd_read = NULL;
+    conf->mmd_read_inc = NULL;
+    conf->mmd_write = NULL;
+    conf->spi_read_write = NULL;
+    conf->spi_32bit_read_write = NULL;
+    conf->spi_64bit_read_write = NULL;
+#if defined(VTSS_GPIOS)
+    conf->gpio_func_info_get = NULL;
+#endif
+    conf->serdes_tap_get = NULL;
+    vtss_state->app_data = NULL;
+
+#if defined(VTSS_FEATURE_TIMESTAMP)
+    /* Pending Tx timestamps would call back into the previous process */
+    vtss_ts_inst_adopt(vtss_state);
+#endif /* VTSS_FEATURE_TIMESTAMP */
+}
+
 vtss_rc vtss_inst_create(const vtss_inst_create_t *const create,
                          vtss_inst_t              *const inst)
 {
-    vtss_state_t *vtss_state;
-    vtss_arch_t  arch;
+    vtss_state_t       *vtss_state;
+    vtss_persist_hdr_t *hdr = NULL;
+    vtss_arch_t        arch;
 
     VTSS_D("enter, sizeof(*vtss_state): %zu", sizeof(*vtss_state));
 
-    if ((vtss_state = VTSS_OS_MALLOC(sizeof(*vtss_state), VTSS_MEM_FLAGS_NONE)) == NULL)
-        return VTSS_RC_ERROR;
+    if (create->state_mem == NULL) {
+        if ((vtss_state = VTSS_OS_MALLOC(sizeof(*vtss_state), VTSS_MEM_FLAGS_NONE)) == NULL)
+            return VTSS_RC_ERROR;
+    } else {
+        if (create->state_size < (VTSS_PERSIST_HDR_SIZE + sizeof(*vtss_state)) ||
+            ((size_t)create->state_mem & 7) != 0) {
+            VTSS_E("illegal state region: %p, size: %u", create->state_mem, create->state_size);
+            return VTSS_RC_ERROR;
+        }
+        hdr = create->state_mem;
+        vtss_state = (vtss_state_t *)((u8 *)hdr + VTSS_PERSIST_HDR_SIZE);
+        if (vtss_persist_adoptable(hdr, create)) {
+            /* The state is kept, except for the parts owned by the new application */
+            vtss_persist_hdr_update(hdr, FALSE);
+            vtss_state->create = *create;
+            vtss_state->persist = hdr;
+            vtss_state->persist_adopted = TRUE;
+#if defined(VTSS_FEATURE_MISC)
+            /* Register access profiling is not active in the new process */
+            vtss_state->misc.reg_profile_conf.enable = FALSE;
+#endif /* VTSS_FEATURE_MISC */
+            vtss_persist_app_clear(vtss_state);
+            if (vtss_default_inst == NULL)
+                vtss_default_inst = vtss_state;
+            if (inst != NULL)
+                *inst = vtss_state;
+            VTSS_I("adopted state at %p", vtss_state);
+            return VTSS_RC_OK;
+        }
+    }
 
     VTSS_MEMSET(vtss_state, 0, sizeof(*vtss_state));
     vtss_state->cookie = VTSS_STATE_COOKIE;
@@ -353,6 +484,19 @@ vtss_rc vtss_inst_create(const vtss_inst_create_t *const create,
     VTSS_RC(vtss_ts_inst_create(vtss_state));
 #endif /* VTSS_FEATURE_TIMESTAMP */
 
+    if (hdr != NULL) {
+        /* The header is only valid after the instance is released */
+        hdr->magic = VTSS_PERSIST_MAGIC;
+        hdr->version = VTSS_PERSIST_VERSION;
+        hdr->api_version = VTSS_API_VERSION;
+        hdr->state_size = sizeof(*vtss_state);
+        hdr->target = create->target;
+        hdr->base = (size_t)vtss_state;
+        hdr->code = (size_t)vtss_inst_create;
+        vtss_persist_hdr_update(hdr, FALSE);
+        vtss_state->persist = hdr;
+    }
+
     /* Setup default instance */
     if (vtss_default_inst == NULL)
         vtss_default_inst = vtss_state;
@@ -375,7 +519,12 @@ vtss_rc vtss_inst_destroy(const vtss_inst_t inst)
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
         if (vtss_state == vtss_default_inst)
             vtss_default_inst = NULL;
-        VTSS_OS_FREE(vtss_state, VTSS_MEM_FLAGS_NONE);
+        if (vtss_state->persist == NULL) {
+            VTSS_OS_FREE(vtss_state, VTSS_MEM_FLAGS_NONE);
+        } else {
+            /* Release the state for adoption by the next owner of the region */
+            vtss_persist_hdr_update(vtss_state->persist, TRUE);
+        }
     }
     VTSS_D("exit");
 
@@ -407,8 +556,17 @@ vtss_rc vtss_init_conf_set(const vtss_inst_t              inst,
     VTSS_D("enter");
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
         vtss_state->init_conf = *conf;
-        rc = VTSS_FUNC_0(cil.init_conf_set);
-        vtss_state->warm_start_prev = vtss_state->warm_start_cur;
+        if (vtss_state->persist_adopted) {
+            /* The hardware is already initialized, only the callbacks are updated */
+            VTSS_I("adopted state, skipping initialization");
+#if defined(VTSS_FEATURE_TIMESTAMP)
+            /* Release the timestamp ids reserved by the previous application */
+            vtss_timestamp_flush(vtss_state);
+#endif /* VTSS_FEATURE_TIMESTAMP */
+        } else {
+            rc = VTSS_FUNC_0(cil.init_conf_set);
+            vtss_state->warm_start_prev = vtss_state->warm_start_cur;
+        }
     } else {
         VTSS_E("Initialization check failed");
     }
@@ -669,3 +669,137 @@ err:
     return VTSS_RC_ERROR;
 }
 
+
+/* - Port sets ----------------------------------------------------- */
+
+static u32 vtss_port_set_word_cnt(u32 w)
+{
+    w = w - ((w >> 1) & 0x55555555);
+    w = (w & 0x33333333) + ((w >> 2) & 0x33333333);
+    return ((((w + (w >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24);
+}
+
+/* Word i of the bit field with port (i * 32 + n) in bit n, independent of the CPU byte order */
+static u32 vtss_port_set_word(const vtss_port_set_t *set, u32 i)
+{
+    const u8 *b = &set->bf[i * 4];
+
+    return (b[0] | (b[1] << 8) | (b[2] << 16) | ((u32)b[3] << 24));
+}
+
+void vtss_port_set_from_bool(vtss_port_set_t *set, const BOOL member[], u32 port_count)
+{
+    vtss_port_no_t port_no;
+
+    VTSS_PORT_SET_CLR(set);
+    for (port_no = VTSS_PORT_NO_START; port_no < port_count; port_no++) {
+        if (member[port_no]) {
+            VTSS_PORT_SET_ADD(set, port_no);
+        }
+    }
+}
+
+/* Build a set from a port member bit field, ignoring the ports at or above port_count (at most VTSS_PORTS) */
+void vtss_port_set_from_bf(vtss_port_set_t *set, const u8 bf[VTSS_PORT_BF_SIZE], u32 port_count)
+{
+    u32 n = VTSS_BF_SIZE(port_count);
+
+    VTSS_PORT_SET_CLR(set);
+    VTSS_MEMCPY(set->bf, bf, n);
+    if (port_count % 8) {
+        set->bf[n - 1] &= ((1U << (port_count % 8)) - 1);
+    }
+}
+
+void vtss_port_set_to_bool(const vtss_port_set_t *set, BOOL member[VTSS_PORT_ARRAY_SIZE])
+{
+    vtss_port_no_t port_no;
+
+    VTSS_MEMSET(member, 0, VTSS_PORT_ARRAY_SIZE * sizeof(BOOL));
+    VTSS_PORT_SET_FOREACH(set, port_no) {
+        member[port_no] = TRUE;
+    }
+}
+
+void vtss_port_set_or(vtss_port_set_t *set, const vtss_port_set_t *other)
+{
+    u32 i;
+
+    for (i = 0; i < VTSS_PORT_SET_WORDS; i++) {
+        set->w[i] |= other->w[i];
+    }
+}
+
+void vtss_port_set_and(vtss_port_set_t *set, const vtss_port_set_t *other)
+{
+    u32 i;
+
+    for (i = 0; i < VTSS_PORT_SET_WORDS; i++) {
+        set->w[i] &= other->w[i];
+    }
+}
+
+void vtss_port_set_andnot(vtss_port_set_t *set, const vtss_port_set_t *other)
+{
+    u32 i;
+
+    for (i = 0; i < VTSS_PORT_SET_WORDS; i++) {
+        set->w[i] &= ~other->w[i];
+    }
+}
+
+/* Check if two sets have common members */
+BOOL vtss_port_set_overlap(const vtss_port_set_t *set, const vtss_port_set_t *other)
+{
+    u32 i;
+
+    for (i = 0; i < VTSS_PORT_SET_WORDS; i++) {
+        if (set->w[i] & other->w[i]) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Number of members */
+u32 vtss_port_set_cnt(const vtss_port_set_t *set)
+{
+    u32 i, cnt = 0;
+
+    for (i = 0; i < VTSS_PORT_SET_WORDS; i++) {
+        cnt += vtss_port_set_word_cnt(set->w[i]);
+    }
+    return cnt;
+}
+
+/* Number of members below a port number */
+u32 vtss_port_set_rank(const vtss_port_set_t *set, vtss_port_no_t port_no)
+{
+    u32 i, cnt = 0, n = (port_no / 32);
+
+    for (i = 0; i < n && i < VTSS_PORT_SET_WORDS; i++) {
+        cnt += vtss_port_set_word_cnt(set->w[i]);
+    }
+    if (i == n && i < VTSS_PORT_SET_WORDS && (port_no % 32) != 0) {
+        cnt += vtss_port_set_word_cnt(vtss_port_set_word(set, i) & (0xffffffff >> (32 - (port_no % 32))));
+    }
+    return cnt;
+}
+
+/* First member at or above a port number, VTSS_PORT_NO_NONE if none */
+vtss_port_no_t vtss_port_set_next(const vtss_port_set_t *set, vtss_port_no_t port_no)
+{
+    u32 i = (port_no / 32), w;
+
+    if (i >= VTSS_PORT_SET_WORDS) {
+        return VTSS_PORT_NO_NONE;
+    }
+    w = (vtss_port_set_word(set, i) & (0xffffffff << (port_no % 32)));
+    while (w == 0) {
+        if (++i == VTSS_PORT_SET_WORDS) {
+            return VTSS_PORT_NO_NONE;
+        }
+        w = vtss_port_set_word(set, i);
+    }
+    return (i * 32 + VTSS_OS_CTZ(w));
+}
@@ -71,6 +71,18 @@ void vtss_debug_print_reg(const vtss_debug_printf_t pr, const char *name, u32 va
 
 vtss_rc vtss_cmn_bit_from_one_hot_mask64(u64 mask, u32 *bit_pos);
 
+/* Port set operations */
+void vtss_port_set_from_bool(vtss_port_set_t *set, const BOOL member[], u32 port_count);
+void vtss_port_set_from_bf(vtss_port_set_t *set, const u8 bf[VTSS_PORT_BF_SIZE], u32 port_count);
+void vtss_port_set_to_bool(const vtss_port_set_t *set, BOOL member[VTSS_PORT_ARRAY_SIZE]);
+void vtss_port_set_or(vtss_port_set_t *set, const vtss_port_set_t *other);
+void vtss_port_set_and(vtss_port_set_t *set, const vtss_port_set_t *other);
+void vtss_port_set_andnot(vtss_port_set_t *set, const vtss_port_set_t *other);
+BOOL vtss_port_set_overlap(const vtss_port_set_t *set, const vtss_port_set_t *other);
+u32 vtss_port_set_cnt(const vtss_port_set_t *set);
+u32 vtss_port_set_rank(const vtss_port_set_t *set, vtss_port_no_t port_no);
+vtss_port_no_t vtss_port_set_next(const vtss_port_set_t *set, vtss_port_no_t port_no);
+
 vtss_rc srvl_pll5g_read(vtss_state_t *vtss_state, u32 lcpll_mask);
 vtss_rc srvl_pll5g_write(vtss_state_t *vtss_state, u32 lcpll_mask, u32 nsec);
 
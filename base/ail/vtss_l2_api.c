@@ -30,6 +30,20 @@ void vtss_port_mask_get(vtss_state_t *vtss_state,
     }
 }
 
+void vtss_port_set_mask_get(vtss_state_t *vtss_state,
+                            const vtss_port_set_t *set,
+                            vtss_port_mask_t *pmask)
+{
+    vtss_port_no_t port_no;
+    u32            port;
+
+    vtss_port_mask_clear(pmask);
+    VTSS_PORT_SET_FOREACH(set, port_no) {
+        port = VTSS_CHIP_PORT(port_no);
+        pmask->m[port / 32] |= (1 << (port % 32));
+    }
+}
+
 void vtss_port_mask_port(vtss_state_t *vtss_state,
                          vtss_port_no_t port_no,
                          vtss_port_mask_t *pmask)
@@ -40,6 +54,20 @@ void vtss_port_mask_port(vtss_state_t *vtss_state,
     pmask->m[port / 32] |= (1 << (port % 32));
 }
 
+/* Get the port set of each aggregation */
+static void vtss_aggr_sets_get(vtss_state_t *vtss_state, vtss_port_set_t aggr_set[VTSS_AGGR_NO_END])
+{
+    vtss_port_no_t port_no;
+    vtss_aggr_no_t aggr_no;
+
+    VTSS_MEMSET(aggr_set, 0, VTSS_AGGR_NO_END * sizeof(vtss_port_set_t));
+    for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+        if ((aggr_no = vtss_state->l2.port_aggr_no[port_no]) < VTSS_AGGR_NO_END) {
+            VTSS_PORT_SET_ADD(&aggr_set[aggr_no], port_no);
+        }
+    }
+}
+
 /* Determine port membership considering aggregations etc. */
 static void vtss_pgid_members_get(vtss_state_t *vtss_state,
                                   u32 pgid, BOOL member[VTSS_PORT_ARRAY_SIZE])
@@ -49,38 +77,52 @@ static void vtss_pgid_members_get(vtss_state_t *vtss_state,
     vtss_port_no_t    port_no, port;
     vtss_aggr_no_t    aggr_no;
     vtss_dgroup_no_t  dgroup_no;
+    vtss_port_set_t   pset, peers, aggr_set[VTSS_AGGR_NO_END], dgroup_set[VTSS_PORT_ARRAY_SIZE];
 
     /* Store raw port members */
     pgid_entry = &vtss_state->l2.pgid_table[pgid];
-    for (port_no = VTSS_PORT_NO_START; port_no < VTSS_PORT_NO_END; port_no++)
-        member[port_no] = (port_no < vtss_state->port_count ? pgid_entry->member[port_no] : 0);
+    vtss_port_set_from_bool(&pset, pgid_entry->member, vtss_state->port_count);
 
     /* Reserved entries are used direcly (e.g. GLAG masks) */
-    if (pgid_entry->resv)
+    if (pgid_entry->resv) {
+        vtss_port_set_to_bool(&pset, member);
         return;
+    }
+
+    vtss_aggr_sets_get(vtss_state, aggr_set);
+    VTSS_MEMSET(dgroup_set, 0, sizeof(dgroup_set));
+    for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+        if ((dgroup_no = vtss_state->l2.dgroup_port_conf[port_no].dgroup_no) < VTSS_PORT_ARRAY_SIZE) {
+            VTSS_PORT_SET_ADD(&dgroup_set[dgroup_no], port_no);
+        }
+    }
 
     for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
         /* Check if 1+1 protected port is member */
         protect = &vtss_state->l2.port_protect[port_no];
         if ((port = protect->conf.port_no) != VTSS_PORT_NO_NONE &&
             protect->conf.type == VTSS_EPS_PORT_1_PLUS_1) {
-            if (member[port])    /* Include working port if protection port is member */
-                member[port_no] = 1;
-            if (member[port_no]) /* Include protection port if working port is member */
-                member[port] = 1;
+            if (VTSS_PORT_SET_GET(&pset, port))    /* Include working port if protection port is member */
+                VTSS_PORT_SET_ADD(&pset, port_no);
+            if (VTSS_PORT_SET_GET(&pset, port_no)) /* Include protection port if working port is member */
+                VTSS_PORT_SET_ADD(&pset, port);
         }
 
         /* Check if aggregated ports or destination group members are port members */
         aggr_no = vtss_state->l2.port_aggr_no[port_no];
         dgroup_no = vtss_state->l2.dgroup_port_conf[port_no].dgroup_no;
-        for (port = VTSS_PORT_NO_START; port < vtss_state->port_count; port++) {
-            if (member[port] &&
-                ((aggr_no != VTSS_AGGR_NO_NONE && vtss_state->l2.port_aggr_no[port] == aggr_no) ||
-                 vtss_state->l2.dgroup_port_conf[port].dgroup_no == dgroup_no)) {
-                member[port_no] = 1;
-            }
+        VTSS_PORT_SET_CLR(&peers);
+        if (aggr_no < VTSS_AGGR_NO_END) {
+            peers = aggr_set[aggr_no];
+        }
+        if (dgroup_no < VTSS_PORT_ARRAY_SIZE) {
+            vtss_port_set_or(&peers, &dgroup_set[dgroup_no]);
+        }
+        if (vtss_port_set_overlap(&pset, &peers)) {
+            VTSS_PORT_SET_ADD(&pset, port_no);
         }
     }
+    vtss_port_set_to_bool(&pset, member);
 }
 
 /* - MAC address table --------------------------------------------- */
@@ -414,8 +456,10 @@ vtss_rc vtss_update_masks(vtss_state_t *vtss_state,
     vtss_rc             rc;
     vtss_port_no_t      i_port, e_port, port_p;
     vtss_aggr_no_t      aggr_no;
-    BOOL                member[VTSS_PORT_ARRAY_SIZE], learn[VTSS_PORT_ARRAY_SIZE], chg, *fwd;
-    BOOL                rx_forward[VTSS_PORT_ARRAY_SIZE], tx_forward[VTSS_PORT_ARRAY_SIZE];
+    BOOL                member[VTSS_PORT_ARRAY_SIZE], chg, *fwd, rx_fwd, tx_fwd;
+    vtss_port_set_t     learn, rx_forward, tx_forward, tx_enabled, protect_set, pset, apvlan;
+    vtss_port_set_t     aggr_set[VTSS_AGGR_NO_END], pvlan_set[VTSS_PVLAN_ARRAY_SIZE];
+    vtss_pvlan_no_t     pvlan_no;
     u32                 pgid;
     u32                 port_count = vtss_state->port_count;
     u32                 ac, aggr_count[VTSS_PORT_ARRAY_SIZE];
@@ -430,56 +474,78 @@ vtss_rc vtss_update_masks(vtss_state_t *vtss_state,
         VTSS_D("warm start, returning");
         return VTSS_RC_OK;
     }
-    VTSS_MEMSET(rx_forward, 0, sizeof(rx_forward));
-    VTSS_MEMSET(tx_forward, 0, sizeof(tx_forward));
+    VTSS_PORT_SET_CLR(&learn);
+    VTSS_PORT_SET_CLR(&rx_forward);
+    VTSS_PORT_SET_CLR(&tx_forward);
+    VTSS_PORT_SET_CLR(&tx_enabled);
+    VTSS_PORT_SET_CLR(&protect_set);
+    vtss_aggr_sets_get(vtss_state, aggr_set);
 
     /* Determine learning, Rx and Tx forwarding state per port */
     for (i_port = VTSS_PORT_NO_START; i_port < port_count; i_port++) {
         protect = &vtss_state->l2.port_protect[i_port];
 
         /* Learning */
-        learn[i_port] = (vtss_state->l2.port_state[i_port] &&
-                         vtss_state->l2.stp_state[i_port] != VTSS_STP_STATE_DISCARDING &&
-                         VTSS_PORT_RX_FORWARDING(vtss_state->port.forward[i_port]) &&
-                         vtss_state->l2.auth_state[i_port] == VTSS_AUTH_STATE_BOTH &&
-                         (protect->conf.port_no == VTSS_PORT_NO_NONE ||
-                          protect->conf.type == VTSS_EPS_PORT_1_FOR_1 ||
-                          protect->selector == VTSS_EPS_SELECTOR_WORKING));
-
-        /* Rx forwarding */
-        rx_forward[i_port] = (learn[i_port] &&
-                              vtss_state->l2.stp_state[i_port] == VTSS_STP_STATE_FORWARDING);
+        if (vtss_state->l2.port_state[i_port] &&
+            vtss_state->l2.stp_state[i_port] != VTSS_STP_STATE_DISCARDING &&
+            VTSS_PORT_RX_FORWARDING(vtss_state->port.forward[i_port]) &&
+            vtss_state->l2.auth_state[i_port] == VTSS_AUTH_STATE_BOTH &&
+            (protect->conf.port_no == VTSS_PORT_NO_NONE ||
+             protect->conf.type == VTSS_EPS_PORT_1_FOR_1 ||
+             protect->selector == VTSS_EPS_SELECTOR_WORKING)) {
+            VTSS_PORT_SET_ADD(&learn, i_port);
+
+            /* Rx forwarding */
+            if (vtss_state->l2.stp_state[i_port] == VTSS_STP_STATE_FORWARDING) {
+                VTSS_PORT_SET_ADD(&rx_forward, i_port);
+            }
+        }
 
         /* Tx forwarding */
-        tx_forward[i_port] = (vtss_state->l2.port_state[i_port] &&
-                              vtss_state->l2.stp_state[i_port] == VTSS_STP_STATE_FORWARDING &&
-                              VTSS_PORT_TX_FORWARDING(vtss_state->port.forward[i_port]) &&
-                              vtss_state->l2.auth_state[i_port] != VTSS_AUTH_STATE_NONE);
+        tx_fwd = (vtss_state->l2.port_state[i_port] &&
+                  vtss_state->l2.stp_state[i_port] == VTSS_STP_STATE_FORWARDING &&
+                  VTSS_PORT_TX_FORWARDING(vtss_state->port.forward[i_port]) &&
+                  vtss_state->l2.auth_state[i_port] != VTSS_AUTH_STATE_NONE);
+        if (tx_fwd) {
+            VTSS_PORT_SET_ADD(&tx_forward, i_port);
+        }
 
         /* Store Tx forward information */
-        if (vtss_state->l2.tx_forward[i_port] != tx_forward[i_port]) {
-            vtss_state->l2.tx_forward[i_port] = tx_forward[i_port];
+        if (vtss_state->l2.tx_forward[i_port] != tx_fwd) {
+            vtss_state->l2.tx_forward[i_port] = tx_fwd;
             vtss_state->l2.vlan_filter_changed = TRUE;
         }
+
+        /* Egress forwarding enabled */
+        if (VTSS_PORT_TX_FORWARDING(vtss_state->port.forward[i_port])) {
+            VTSS_PORT_SET_ADD(&tx_enabled, i_port);
+        }
+
+        /* Ports with a protection port */
+        if (protect->conf.port_no != VTSS_PORT_NO_NONE) {
+            VTSS_PORT_SET_ADD(&protect_set, i_port);
+        }
     }
 
     /* Determine state for protection ports */
-    for (i_port = VTSS_PORT_NO_START; i_port < port_count; i_port++) {
+    VTSS_PORT_SET_FOREACH(&protect_set, i_port) {
         protect = &vtss_state->l2.port_protect[i_port];
         port_p = protect->conf.port_no;
 
         /* If 1+1 working port is active, discard on Rx */
-        if (port_p != VTSS_PORT_NO_NONE &&
-            protect->conf.type == VTSS_EPS_PORT_1_PLUS_1 &&
+        if (protect->conf.type == VTSS_EPS_PORT_1_PLUS_1 &&
             protect->selector == VTSS_EPS_SELECTOR_WORKING) {
-            learn[port_p] = 0;
-            rx_forward[port_p] = 0;
+            VTSS_PORT_SET_DEL(&learn, port_p);
+            VTSS_PORT_SET_DEL(&rx_forward, port_p);
         }
     }
 
     /* Update learn mask */
-    if (src_update && (rc = VTSS_FUNC(l2.learn_state_set, learn)) != VTSS_RC_OK)
-        return rc;
+    if (src_update) {
+        vtss_port_set_to_bool(&learn, member);
+        if ((rc = VTSS_FUNC(l2.learn_state_set, member)) != VTSS_RC_OK)
+            return rc;
+    }
 
 #if defined(VTSS_FEATURE_PACKET)
     if (vtss_state->packet.npi_conf.enable) {
@@ -487,64 +553,63 @@ vtss_rc vtss_update_masks(vtss_state_t *vtss_state,
     }
 #endif
 
+    /* PVLAN members */
+    for (pvlan_no = VTSS_PVLAN_NO_START; src_update && pvlan_no < VTSS_PVLAN_NO_END; pvlan_no++) {
+        vtss_port_set_from_bool(&pvlan_set[pvlan_no], vtss_state->l2.pvlan_table[pvlan_no].member, port_count);
+    }
+
     /* Update source masks */
     for (i_port = VTSS_PORT_NO_START; src_update && i_port < port_count; i_port++) {
         /* Exclude all ports by default */
-        VTSS_MEMSET(member, 0, sizeof(member));
+        VTSS_PORT_SET_CLR(&pset);
 
         /* Store Rx forward information */
-        if (vtss_state->l2.rx_forward[i_port] != rx_forward[i_port]) {
-            vtss_state->l2.rx_forward[i_port] = rx_forward[i_port];
+        rx_fwd = VTSS_PORT_SET_GET(&rx_forward, i_port);
+        if (vtss_state->l2.rx_forward[i_port] != rx_fwd) {
+            vtss_state->l2.rx_forward[i_port] = rx_fwd;
             vtss_state->l2.vlan_filter_changed = TRUE;
         }
-        vtss_state->l2.learn[i_port] = learn[i_port];
+        vtss_state->l2.learn[i_port] = VTSS_PORT_SET_GET(&learn, i_port);
 
         /* Special case - NPI port */
         if (i_port == npi_port) {
             // Allow all forwarding ports but myself
-            VTSS_MEMCPY(member, tx_forward, sizeof(member));
-            member[i_port] = FALSE;
-        } else if (rx_forward[i_port]) {
-            /* Check if ingress forwarding is allowed */
-            vtss_pvlan_no_t     pvlan_no;
-
+            pset = tx_forward;
+            VTSS_PORT_SET_DEL(&pset, i_port);
+        } else if (rx_fwd) {
             /* Include members of the same PVLAN */
             for (pvlan_no = VTSS_PVLAN_NO_START; pvlan_no < VTSS_PVLAN_NO_END; pvlan_no++) {
-                if (vtss_state->l2.pvlan_table[pvlan_no].member[i_port] == 0)
-                    continue;
-                /* The ingress port is a member of this PVLAN */
-                for (e_port = VTSS_PORT_NO_START; e_port < port_count; e_port++)
-                    if (vtss_state->l2.pvlan_table[pvlan_no].member[e_port])
-                        member[e_port] = 1; /* Egress port also member */
+                if (VTSS_PORT_SET_GET(&pvlan_set[pvlan_no], i_port)) {
+                    /* The ingress port is a member of this PVLAN */
+                    vtss_port_set_or(&pset, &pvlan_set[pvlan_no]);
+                }
             }
 
             /* Exclude protection port if it exists */
             if ((port_p = vtss_state->l2.port_protect[i_port].conf.port_no) != VTSS_PORT_NO_NONE)
-                member[port_p] = 0;
+                VTSS_PORT_SET_DEL(&pset, port_p);
 
-            member[i_port] = 0;
-            aggr_no = vtss_state->l2.port_aggr_no[i_port];
-            for (e_port = VTSS_PORT_NO_START; e_port < port_count; e_port++) {
-                /* Exclude members of the same aggregation */
-                if (aggr_no != VTSS_AGGR_NO_NONE &&
-                    vtss_state->l2.port_aggr_no[e_port] == aggr_no)
-                    member[e_port] = 0;
+            VTSS_PORT_SET_DEL(&pset, i_port);
 
-                /* Exclude working port if it exists */
+            /* Exclude members of the same aggregation */
+            if ((aggr_no = vtss_state->l2.port_aggr_no[i_port]) < VTSS_AGGR_NO_END)
+                vtss_port_set_andnot(&pset, &aggr_set[aggr_no]);
+
+            /* Exclude working port if it exists */
+            VTSS_PORT_SET_FOREACH(&protect_set, e_port) {
                 if (vtss_state->l2.port_protect[e_port].conf.port_no == i_port)
-                    member[e_port] = 0;
-                VTSS_N("i_port: %u %sforwarding to e_port %u",
-                       i_port, member[e_port] ? "" : "NOT ", e_port);
+                    VTSS_PORT_SET_DEL(&pset, e_port);
+            }
 
-                /* Exclude ports, which are not egress forwarding */
-                if (!VTSS_PORT_TX_FORWARDING(vtss_state->port.forward[e_port]))
-                    member[e_port] = 0;
+            /* Exclude ports, which are not egress forwarding */
+            vtss_port_set_and(&pset, &tx_enabled);
 
-                /* Exclude ports not allowed by assymmetric PVLANs */
-                if (!vtss_state->l2.apvlan_table[i_port][e_port])
-                    member[e_port] = 0;
-            }
+            /* Exclude ports not allowed by assymmetric PVLANs */
+            vtss_port_set_from_bool(&apvlan, vtss_state->l2.apvlan_table[i_port], port_count);
+            vtss_port_set_and(&pset, &apvlan);
+            VTSS_N("i_port: %u forwarding to %u ports", i_port, vtss_port_set_cnt(&pset));
         }
+        vtss_port_set_to_bool(&pset, member);
         if ((rc = VTSS_FUNC(l2.src_table_write, i_port, member)) != VTSS_RC_OK)
             return rc;
     } /* src_update */
@@ -567,25 +632,23 @@ vtss_rc vtss_update_masks(vtss_state_t *vtss_state,
             aggr_index[i_port] = 0;
 
             /* If port is not forwarding, continue */
-            if (!tx_forward[i_port])
+            if (!VTSS_PORT_SET_GET(&tx_forward, i_port))
                 continue;
 
             aggr_no = vtss_state->l2.port_aggr_no[i_port];
             VTSS_D("port_no: %u, aggr_no: %u is forwarding", i_port, aggr_no);
 
-            if (aggr_no == VTSS_AGGR_NO_NONE) {
+            if (aggr_no >= VTSS_AGGR_NO_END) {
                 /* Not aggregated */
                 aggr_count[i_port]++;
                 continue;
             }
-            for (e_port = VTSS_PORT_NO_START; e_port < port_count; e_port++) {
-                if (tx_forward[e_port] && vtss_state->l2.port_aggr_no[e_port] == aggr_no) {
-                    /* Port is forwarding and member of the same aggregation */
-                    aggr_count[i_port]++;
-                    if (e_port < i_port && i_port < VTSS_PORT_ARRAY_SIZE)
-                        aggr_index[i_port]++;
-                }
-            }
+
+            /* Forwarding ports in the same aggregation */
+            pset = aggr_set[aggr_no];
+            vtss_port_set_and(&pset, &tx_forward);
+            aggr_count[i_port] = vtss_port_set_cnt(&pset);
+            aggr_index[i_port] = vtss_port_set_rank(&pset, i_port);
         }
 
         for (ac = 0; ac < vtss_state->l2.ac_count; ac++) {
@@ -2117,25 +2180,25 @@ vtss_rc vtss_aggr_port_members_get(const vtss_inst_t     inst,
 
 vtss_rc vtss_aggr_port_members_set(const vtss_inst_t     inst,
                                    const vtss_aggr_no_t  aggr_no,
-                                   const BOOL            member[VTSS_PORT_ARRAY_SIZE])
+                                   const vtss_port_bf_t  *const member)
 {
-    vtss_state_t   *vtss_state;
-    vtss_rc        rc;
-    vtss_port_no_t port_no;
+    vtss_state_t    *vtss_state;
+    vtss_rc         rc;
+    vtss_port_no_t  port_no;
+    vtss_port_set_t set;
 
     VTSS_D("aggr_no: %u", aggr_no);
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK &&
         (rc = vtss_aggr_no_check(vtss_state, aggr_no)) == VTSS_RC_OK) {
-        {
-            for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
-                if (member[port_no])
-                    vtss_state->l2.port_aggr_no[port_no] = aggr_no;
-                else if (vtss_state->l2.port_aggr_no[port_no] == aggr_no)
-                    vtss_state->l2.port_aggr_no[port_no] = VTSS_AGGR_NO_NONE;
-            }
-            rc = vtss_update_masks(vtss_state, 1, 1, 1);
+        vtss_port_set_from_bf(&set, member->bf, vtss_state->port_count);
+        for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+            if (VTSS_PORT_SET_GET(&set, port_no))
+                vtss_state->l2.port_aggr_no[port_no] = aggr_no;
+            else if (vtss_state->l2.port_aggr_no[port_no] == aggr_no)
+                vtss_state->l2.port_aggr_no[port_no] = VTSS_AGGR_NO_NONE;
         }
+        rc = vtss_update_masks(vtss_state, 1, 1, 1);
     }
     VTSS_EXIT();
     return rc;
@@ -2248,24 +2311,22 @@ vtss_rc vtss_mirror_ingress_ports_get(const vtss_inst_t  inst,
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
         for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++)
-            member[port_no] = vtss_state->l2.mirror_ingress[port_no];
+            member[port_no] = VTSS_PORT_SET_GET(&vtss_state->l2.mirror_ingress, port_no);
     }
     VTSS_EXIT();
     return rc;
 }
 
-vtss_rc vtss_mirror_ingress_ports_set(const vtss_inst_t  inst,
-                                      const BOOL         member[VTSS_PORT_ARRAY_SIZE])
+vtss_rc vtss_mirror_ingress_ports_set(const vtss_inst_t     inst,
+                                      const vtss_port_bf_t  *const member)
 {
     vtss_state_t   *vtss_state;
     vtss_rc        rc;
-    vtss_port_no_t port_no;
 
     VTSS_D("enter");
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
-        for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++)
-            vtss_state->l2.mirror_ingress[port_no] = VTSS_BOOL(member[port_no]);
+        vtss_port_set_from_bf(&vtss_state->l2.mirror_ingress, member->bf, vtss_state->port_count);
         rc = VTSS_FUNC_COLD_0(l2.mirror_ingress_set);
     }
     VTSS_EXIT();
@@ -2283,24 +2344,22 @@ vtss_rc vtss_mirror_egress_ports_get(const vtss_inst_t  inst,
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
         for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++)
-            member[port_no] = vtss_state->l2.mirror_egress[port_no];
+            member[port_no] = VTSS_PORT_SET_GET(&vtss_state->l2.mirror_egress, port_no);
     }
     VTSS_EXIT();
     return rc;
 }
 
-vtss_rc vtss_mirror_egress_ports_set(const vtss_inst_t  inst,
-                                     const BOOL         member[VTSS_PORT_ARRAY_SIZE])
+vtss_rc vtss_mirror_egress_ports_set(const vtss_inst_t     inst,
+                                     const vtss_port_bf_t  *const member)
 {
     vtss_state_t   *vtss_state;
     vtss_rc        rc;
-    vtss_port_no_t port_no;
 
     VTSS_D("enter");
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
-        for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++)
-            vtss_state->l2.mirror_egress[port_no] = VTSS_BOOL(member[port_no]);
+        vtss_port_set_from_bf(&vtss_state->l2.mirror_egress, member->bf, vtss_state->port_count);
         rc = VTSS_FUNC_COLD_0(l2.mirror_egress_set);
     }
     VTSS_EXIT();
@@ -2994,6 +3053,107 @@ vtss_rc vtss_psfp_filter_status_get(const vtss_inst_t           inst,
 #endif
 
 #if defined(VTSS_EVC_STAT_CNT)
+/* - ISDX references ------------------------------------------------ */
+
+/* Each policer/statistics/mstream index has a list of the ISDX entries using it */
+static u16 *vtss_sdx_ref_head(vtss_state_t *vtss_state, vtss_sdx_ref_type_t type, u16 idx)
+{
+    vtss_sdx_info_t *sdx_info = &vtss_state->l2.sdx_info;
+
+    switch (type) {
+    case VTSS_SDX_REF_POL:
+        return (idx < VTSS_EVC_POL_CNT ? &sdx_info->pol_ref[idx] : NULL);
+    case VTSS_SDX_REF_STAT:
+        return (idx < VTSS_EVC_STAT_CNT ? &sdx_info->stat_ref[idx] : NULL);
+#if defined(VTSS_FEATURE_FRER)
+    case VTSS_SDX_REF_MS:
+        return (idx < VTSS_MSTREAM_CNT ? &sdx_info->ms_ref[idx] : NULL);
+#endif
+    default:
+        return NULL;
+    }
+}
+
+/* Resource index used by ISDX, NULL if unused */
+static u16 *vtss_sdx_ref_idx(vtss_sdx_entry_t *sdx, vtss_sdx_ref_type_t type)
+{
+    switch (type) {
+    case VTSS_SDX_REF_POL:
+        return (sdx->pol_cnt ? &sdx->pol_idx : NULL);
+    case VTSS_SDX_REF_STAT:
+        return (sdx->stat_cnt ? &sdx->stat_idx : NULL);
+#if defined(VTSS_FEATURE_FRER)
+    case VTSS_SDX_REF_MS:
+        return (sdx->conf.frer.mstream_enable ? &sdx->ms_idx : NULL);
+#endif
+    default:
+        return NULL;
+    }
+}
+
+static void vtss_sdx_ref_add(vtss_state_t *vtss_state, vtss_sdx_entry_t *sdx)
+{
+    vtss_sdx_ref_type_t type;
+    u16                 *idx, *head;
+
+    for (type = 0; type < VTSS_SDX_REF_CNT; type++) {
+        sdx->ref_next[type] = 0;
+        if ((idx = vtss_sdx_ref_idx(sdx, type)) != NULL &&
+            (head = vtss_sdx_ref_head(vtss_state, type, *idx)) != NULL) {
+            sdx->ref_next[type] = *head;
+            *head = (sdx - vtss_state->l2.sdx_info.isdx.table + 1);
+        }
+    }
+}
+
+static void vtss_sdx_ref_del(vtss_state_t *vtss_state, vtss_sdx_entry_t *sdx)
+{
+    vtss_sdx_ref_type_t type;
+    vtss_sdx_entry_t    *cur;
+    u16                 *idx, *p;
+
+    for (type = 0; type < VTSS_SDX_REF_CNT; type++) {
+        if ((idx = vtss_sdx_ref_idx(sdx, type)) == NULL ||
+            (p = vtss_sdx_ref_head(vtss_state, type, *idx)) == NULL) {
+            continue;
+        }
+        while (*p != 0) {
+            cur = &vtss_state->l2.sdx_info.isdx.table[*p - 1];
+            if (cur == sdx) {
+                *p = cur->ref_next[type];
+                break;
+            }
+            p = &cur->ref_next[type];
+        }
+        sdx->ref_next[type] = 0;
+    }
+}
+
+/* Move the ISDX entries using a resource index to a new index */
+static vtss_rc vtss_sdx_ref_move(vtss_state_t *vtss_state, vtss_sdx_ref_type_t type, u16 idx_old, u16 idx_new)
+{
+    vtss_sdx_entry_t *sdx;
+    u16              *old = vtss_sdx_ref_head(vtss_state, type, idx_old);
+    u16              *new = vtss_sdx_ref_head(vtss_state, type, idx_new);
+    u16              i, *idx;
+
+    if (old == NULL || new == NULL) {
+        VTSS_E("illegal move, type: %u, idx_old: %u, idx_new: %u", type, idx_old, idx_new);
+        return VTSS_RC_ERROR;
+    }
+    while ((i = *old) != 0) {
+        sdx = &vtss_state->l2.sdx_info.isdx.table[i - 1];
+        *old = sdx->ref_next[type];
+        sdx->ref_next[type] = *new;
+        *new = i;
+        if ((idx = vtss_sdx_ref_idx(sdx, type)) != NULL) {
+            *idx = idx_new;
+        }
+        VTSS_FUNC_RC(l2.isdx_update, sdx);
+    }
+    return VTSS_RC_OK;
+}
+
 static void vtss_cmn_cnt_copy(vtss_chip_counter_pair_t *old, vtss_chip_counter_pair_t *new)
 {
     new->frames.value = old->frames.value;
@@ -3002,9 +3162,7 @@ static void vtss_cmn_cnt_copy(vtss_chip_counter_pair_t *old, vtss_chip_counter_p
 
 static vtss_rc vtss_cmn_pol_move(vtss_state_t *vtss_state, u16 idx_old, u16 idx_new, u16 count)
 {
-    vtss_sdx_info_t  *sdx_info = &vtss_state->l2.sdx_info;
-    vtss_sdx_entry_t *sdx;
-    u16              i, *idx;
+    u16 i;
 
     VTSS_I("move idx_old: %u to idx_new: %u", idx_old, idx_new);
 
@@ -3015,15 +3173,7 @@ static vtss_rc vtss_cmn_pol_move(vtss_state_t *vtss_state, u16 idx_old, u16 idx_
     }
 
     /* Update ISDX entries referring to the old index */
-    for (i = 0; i < sdx_info->max_count; i++) {
-        sdx = &sdx_info->isdx.table[i];
-        idx = &sdx->pol_idx;
-        if (sdx->port_no != VTSS_PORT_NO_NONE && *idx == idx_old) {
-            *idx = idx_new;
-            VTSS_FUNC_RC(l2.isdx_update, sdx);
-        }
-    }
-    return VTSS_RC_OK;
+    return vtss_sdx_ref_move(vtss_state, VTSS_SDX_REF_POL, idx_old, idx_new);
 }
 
 static vtss_rc vtss_cmn_pol_clear(vtss_state_t *vtss_state, u16 idx)
@@ -3039,9 +3189,8 @@ static vtss_rc vtss_cmn_pol_clear(vtss_state_t *vtss_state, u16 idx)
 static vtss_rc vtss_cmn_istat_move(vtss_state_t *vtss_state, u16 idx_old, u16 idx_new, u16 count)
 {
     vtss_sdx_info_t  *sdx_info = &vtss_state->l2.sdx_info;
-    vtss_sdx_entry_t *sdx;
     vtss_stat_idx_t  stat_idx;
-    u16              i, *idx;
+    u16              i;
 
     VTSS_I("move idx_old: %u to idx_new: %u", idx_old, idx_new);
 
@@ -3065,15 +3214,7 @@ static vtss_rc vtss_cmn_istat_move(vtss_state_t *vtss_state, u16 idx_old, u16 id
     }
 
     /* Update ISDX entries referring to the old index */
-    for (i = 0; i < sdx_info->max_count; i++) {
-        sdx = &sdx_info->isdx.table[i];
-        idx = &sdx->stat_idx;
-        if (sdx->port_no != VTSS_PORT_NO_NONE && *idx == idx_old) {
-            *idx = idx_new;
-            VTSS_FUNC_RC(l2.isdx_update, sdx);
-        }
-    }
-    return VTSS_RC_OK;
+    return vtss_sdx_ref_move(vtss_state, VTSS_SDX_REF_STAT, idx_old, idx_new);
 }
 
 static vtss_rc vtss_cmn_istat_clear(vtss_state_t *vtss_state, u16 idx)
@@ -3109,6 +3250,9 @@ static vtss_rc vtss_cmn_estat_move(vtss_state_t *vtss_state, u16 idx_old, u16 id
         vtss_cmn_cnt_copy(&c_old->tx_green, &c_new->tx_green);
         vtss_cmn_cnt_copy(&c_old->tx_yellow, &c_new->tx_yellow);
     }
+
+    /* ESDX users are not tracked like the ISDX users. The ES0 row of an entry is its
+       position in the used list, so the update walks the list and only accesses matching rows */
     return VTSS_FUNC(vcap.es0_esdx_update, idx_old, idx_new);
 }
 
@@ -3122,6 +3266,73 @@ static vtss_rc vtss_cmn_estat_clear(vtss_state_t *vtss_state, u16 idx)
     return VTSS_FUNC(l2.counters_update, &stat_idx, TRUE);
 }
 
+/* Rows are kept in a list per entry size. Rows with free columns are in the list
+   of their size and free rows are in list zero, so allocation is O(1). */
+static void vtss_xrow_link(vtss_xrow_header_t *hdr, u16 row_idx)
+{
+    vtss_xrow_entry_t *row = (hdr->row + row_idx);
+    u16               *head = &hdr->list[row->size];
+
+    row->prev = VTSS_XROW_NONE;
+    row->next = *head;
+    if (*head != VTSS_XROW_NONE) {
+        hdr->row[*head].prev = row_idx;
+    }
+    *head = row_idx;
+}
+
+static void vtss_xrow_unlink(vtss_xrow_header_t *hdr, u16 row_idx)
+{
+    vtss_xrow_entry_t *row = (hdr->row + row_idx);
+
+    if (row->prev == VTSS_XROW_NONE) {
+        hdr->list[row->size] = row->next;
+    } else {
+        hdr->row[row->prev].next = row->next;
+    }
+    if (row->next != VTSS_XROW_NONE) {
+        hdr->row[row->next].prev = row->prev;
+    }
+    row->prev = VTSS_XROW_NONE;
+    row->next = VTSS_XROW_NONE;
+}
+
+static void vtss_xrow_init(vtss_xrow_header_t *hdr)
+{
+    u16 i, row_max = (hdr->max_count / 8);
+
+    for (i = 0; i < 9; i++) {
+        hdr->list[i] = VTSS_XROW_NONE;
+    }
+
+    /* Link free rows, lowest index first */
+    for (i = row_max; i > 0; i--) {
+        VTSS_MEMSET(&hdr->row[i - 1], 0, sizeof(vtss_xrow_entry_t));
+        vtss_xrow_link(hdr, i - 1);
+    }
+    hdr->row_count[0] = row_max;
+}
+
+/* Make row free, it must be in the list of its size */
+static void vtss_xrow_release(vtss_xrow_header_t *hdr, u16 row_idx)
+{
+    vtss_xrow_entry_t *row = (hdr->row + row_idx);
+
+    vtss_xrow_unlink(hdr, row_idx);
+    hdr->row_count[row->size]--;
+    row->size = 0;
+    hdr->row_count[0]++;
+    vtss_xrow_link(hdr, row_idx);
+}
+
+static u16 *vtss_xrow_ref(vtss_state_t *vtss_state, u16 *idx)
+{
+    char *p1 = (char *)idx, *p2 = (char *)vtss_state;
+
+    /* Only references into the state can be updated when entries are moved */
+    return (p1 > p2 && p1 < (p2 + sizeof(*vtss_state)) ? idx : NULL);
+}
+
 static vtss_rc vtss_xrow_free(vtss_state_t *vtss_state, vtss_xrow_header_t *hdr, u16 *idx)
 {
     vtss_xrow_entry_t  *row;
@@ -3157,9 +3368,13 @@ static vtss_rc vtss_xrow_free(vtss_state_t *vtss_state, vtss_xrow_header_t *hdr,
     col->used = FALSE;
     hdr->count -= size;
     hdr->count_size[size] -= size;
+    if (row->count == 8) {
+        /* Full row gets a free column */
+        vtss_xrow_link(hdr, row_idx);
+    }
     row->count -= size;
     if (row->count == 0) {
-        row->size = 0;
+        vtss_xrow_release(hdr, row_idx);
     }
     VTSS_I("%s, free idx: %u, row_idx: %u, col_idx: %u", hdr->name, *idx, row_idx, col_idx);
     *idx = VTSS_POL_STAT_NONE;
@@ -3167,26 +3382,94 @@ static vtss_rc vtss_xrow_free(vtss_state_t *vtss_state, vtss_xrow_header_t *hdr,
     return VTSS_RC_OK;
 }
 
+/* Free a row by moving its entries to other rows of the same size.
+   The move hook sets up the new entries before the users are moved to them,
+   so traffic is not affected. */
+static vtss_rc vtss_xrow_compact(vtss_state_t *vtss_state, vtss_xrow_header_t *hdr, u16 *row_free)
+{
+    vtss_xrow_entry_t *row, *src;
+    u16               row_idx, src_idx = VTSS_XROW_NONE, src_col, dst_col, idx_old, idx_new;
+    u8                size, src_size = 0;
+    u32               free_count;
+
+    if (hdr->move == NULL) {
+        return VTSS_RC_ERROR;
+    }
+
+    /* Find the row with fewest used entries, which fit in other rows of the same size */
+    for (size = 1; size < 8; size++) {
+        /* Free entries in rows of this size */
+        free_count = (hdr->row_count[size] * 8 - hdr->count_size[size]);
+        for (row_idx = hdr->list[size]; row_idx != VTSS_XROW_NONE; row_idx = row->next) {
+            row = (hdr->row + row_idx);
+            if (row_idx != 0 && (free_count - (8 - row->count)) >= row->count &&
+                (src_idx == VTSS_XROW_NONE || row->count < hdr->row[src_idx].count)) {
+                /* The first row is never moved, it may hold reserved entries */
+                src_idx = row_idx;
+                src_size = size;
+            }
+        }
+    }
+    if (src_idx == VTSS_XROW_NONE) {
+        return VTSS_RC_ERROR;
+    }
+
+    size = src_size;
+    src = (hdr->row + src_idx);
+    VTSS_I("%s, freeing row_idx: %u, size: %u, count: %u", hdr->name, src_idx, size, src->count);
+    for (src_col = 0; src_col < 8; src_col += size) {
+        if (!src->col[src_col].used) {
+            continue;
+        }
+
+        /* Find destination row and column */
+        if ((row_idx = hdr->list[size]) == src_idx) {
+            row_idx = src->next;
+        }
+        if (row_idx == VTSS_XROW_NONE) {
+            VTSS_E("%s, no row for moving", hdr->name);
+            return VTSS_RC_ERROR;
+        }
+        row = (hdr->row + row_idx);
+        dst_col = 0;
+        while (dst_col < 8 && row->col[dst_col].used) {
+            dst_col += size;
+        }
+        if (dst_col >= 8) {
+            VTSS_E("%s, no column in row_idx: %u", hdr->name, row_idx);
+            return VTSS_RC_ERROR;
+        }
+
+        idx_old = (src_idx * 8 + src_col);
+        idx_new = (row_idx * 8 + dst_col);
+        VTSS_I("%s, move idx: %u to idx: %u", hdr->name, idx_old, idx_new);
+        VTSS_RC(hdr->move(vtss_state, idx_old, idx_new, size));
+        row->col[dst_col] = src->col[src_col];
+        if (row->col[dst_col].ref != NULL) {
+            *(row->col[dst_col].ref) = idx_new;
+        }
+        row->count += size;
+        if (row->count == 8) {
+            vtss_xrow_unlink(hdr, row_idx);
+        }
+        src->col[src_col].used = FALSE;
+        src->col[src_col].ref = NULL;
+        src->count -= size;
+    }
+    vtss_xrow_release(hdr, src_idx);
+    *row_free = src_idx;
+    return VTSS_RC_OK;
+}
+
 static vtss_rc vtss_xrow_alloc(vtss_state_t *vtss_state, vtss_xrow_header_t *hdr, u8 count, u16 *idx)
 {
 #if VTSS_OPT_TRACE
     const              char *txt;
 #endif
-    vtss_xrow_entry_t  *row, *row_free;
+    vtss_xrow_entry_t  *row;
     vtss_xcol_entry_t  *col;
-    u16                row_idx, row_max = (hdr->max_count / 8), row_new = row_max;
-    u16                col_idx, idx_new, idx_old, i;
+    u16                row_idx, col_idx, i;
     u8                 size;
-    BOOL               clear = TRUE;
-    char               *p1, *p2;
-    struct {
-        u16 free_count; /* Number of free entries */
-        u16 row_idx;    /* Index of row with smallest number of used entries */
-        u16 col_idx;    /* Index of column of next used entry */
-        u16 row_count;  /* Smallest number of used entries */
-    } info[8 + 1], *pi; /* Info per size (1/2/4/8), allow 1-based indexing */
-
-    VTSS_MEMSET(info, 0, sizeof(info));
 
     if (count == 0) {
         /* Silently ignore if no allocation required */
@@ -3194,22 +3477,29 @@ static vtss_rc vtss_xrow_alloc(vtss_state_t *vtss_state, vtss_xrow_header_t *hdr
         return VTSS_RC_OK;
     }
 
+    if (count > 8) {
+        VTSS_E("%s, illegal count: %u", hdr->name, count);
+        return VTSS_RC_ERROR;
+    }
+
+    /* Columns are aligned to the size, which is 1/2/4/8 */
+    size = 1;
+    while (size < count) {
+        size *= 2;
+    }
+
     if (*idx != VTSS_POL_STAT_NONE) {
         /* Try to reallocate index */
         if (*idx < hdr->max_count) {
             row_idx = (*idx / 8);
             col_idx = (*idx % 8);
             row = (hdr->row + row_idx);
-            if (row->size == count && row->col[col_idx].used) {
+            col = &row->col[col_idx];
+            if (row->size == size && col->used) {
                 /* Reuse row and column */
-                hdr->count -= count;
-                hdr->count_size[count] -= count;
-                row->count -= count;
-#if VTSS_OPT_TRACE
-                txt = "reallocate";
-#endif
-                clear = FALSE;
-                goto alloc_ok;
+                col->ref = vtss_xrow_ref(vtss_state, idx);
+                VTSS_I("%s, reallocate, row: %u, col: %u, idx: %u, count: %u", hdr->name, row_idx, col_idx, *idx, count);
+                return VTSS_RC_OK;
             }
         }
 
@@ -3217,115 +3507,53 @@ static vtss_rc vtss_xrow_alloc(vtss_state_t *vtss_state, vtss_xrow_header_t *hdr
         VTSS_RC(vtss_xrow_free(vtss_state, hdr, idx));
     }
 
-    /* Reuse row or find free row or free columns */
-    for (row_idx = 0; row_idx < row_max; row_idx++) {
-        row = (hdr->row + row_idx);
-        if ((size = row->size) != 0) {
-            pi = &info[size];
-            if (pi->row_count == 0 || row->count < pi->row_count) {
-                /* Row with fewer used entries found */
-                pi->row_count = row->count;
-                pi->row_idx = row_idx;
-            }
-            for (col_idx = 0; col_idx < 8; col_idx += size) {
-                if (row->col[col_idx].used) {
-                    /* Skip used column */
-                } else if (size == count) {
+    if ((row_idx = hdr->list[size]) != VTSS_XROW_NONE) {
+        /* Row with free column */
 #if VTSS_OPT_TRACE
-                    txt = "new column";
+        txt = "new column";
 #endif
-                            goto alloc_ok;
-                } else {
-                    pi->free_count += size;
-                }
-            }
-        } else if (row_new == row_max) {
-            /* First free row found */
-            row_new = row_idx;
-        }
-    }
-
-    /* Allocate new row and column */
-    if (row_new < row_max) {
-        row_idx = row_new;
-        col_idx = 0;
+    } else if ((row_idx = hdr->list[0]) != VTSS_XROW_NONE) {
+        /* Free row */
 #if VTSS_OPT_TRACE
         txt = "new row";
 #endif
-        goto alloc_ok;
-    }
-
-    /* Last resort, check if allocations can be moved to free up a row */
-    for (size = 4; size > 0; size--) {
-        pi = &info[size];
-        if (pi->free_count > 7) {
-            break;
-        }
-    }
-    if (size > 0 && pi->row_idx != 0) {
-        VTSS_I("%s, freeing row_idx: %u, size: %u", hdr->name, pi->row_idx, size);
-        row_free = (hdr->row + pi->row_idx);
-        pi->col_idx = 8;
-        for (col_idx = 0; col_idx < 8; col_idx += size) {
-            if (row_free->col[col_idx].used) {
-                /* Found first used column to be moved */
-                VTSS_I("freeing col: %u", col_idx);
-                pi->col_idx = col_idx;
-                break;
-            }
-        }
-        for (row_idx = 0; row_idx < row_max && pi->col_idx < 8; row_idx++) {
-            row = (hdr->row + row_idx);
-            if (row->size != size || row_idx == pi->row_idx) {
-                continue;
-            }
-            for (col_idx = 0; col_idx < 8 && pi->col_idx < 8; col_idx += size) {
-                col = &row->col[col_idx];
-                if (col->used) {
-                    continue;
-                }
-                VTSS_I("%s, move row/col: %u/%u to row/col: %u/%u", hdr->name, pi->row_idx, pi->col_idx, row_idx, col_idx);
-                idx_old = (pi->row_idx * 8 + pi->col_idx);
-                idx_new = (row_idx * 8 + col_idx);
-                VTSS_RC(hdr->move(vtss_state, idx_old, idx_new, size));
-                *col = row_free->col[pi->col_idx];
-                if (col->ref != NULL) {
-                    *(col->ref) = idx_new;
-                }
-                row->count += size;
-                for (pi->col_idx++; pi->col_idx < 8; pi->col_idx++) {
-                    if (row_free->col[col_idx].used) {
-                        break;
-                    }
-                }
-            }
-        }
+    } else if (vtss_xrow_compact(vtss_state, hdr, &row_idx) == VTSS_RC_OK) {
+        /* Last resort, allocations have been moved to free up a row */
 #if VTSS_OPT_TRACE
         txt = "freed row";
 #endif
-        row_free->count = 0;
-        row_idx = pi->row_idx;
-        col_idx = 0;
-        goto alloc_ok;
+    } else {
+        VTSS_E("%s, no free idx", hdr->name);
+        return VTSS_RC_ERROR;
     }
 
-    VTSS_E("%s, no free idx", hdr->name);
-    return VTSS_RC_ERROR;
-
-alloc_ok:
-    hdr->count += count;
-    hdr->count_size[count] += count;
     row = (hdr->row + row_idx);
-    row->size = count;
-    row->count += count;
+    if (row->size == 0) {
+        /* Move free row to list of the size */
+        vtss_xrow_unlink(hdr, row_idx);
+        hdr->row_count[0]--;
+        row->size = size;
+        hdr->row_count[size]++;
+        vtss_xrow_link(hdr, row_idx);
+    }
+    col_idx = 0;
+    while (row->col[col_idx].used) {
+        col_idx += size;
+    }
+
+    hdr->count += size;
+    hdr->count_size[size] += size;
+    row->count += size;
+    if (row->count == 8) {
+        /* Row is full */
+        vtss_xrow_unlink(hdr, row_idx);
+    }
     col = &row->col[col_idx];
     col->used = TRUE;
-    p1 = (char *)idx;
-    p2 = (char *)vtss_state;
-    col->ref = (p1 > p2 && p1 < (p2 + sizeof(*vtss_state)) ? idx : NULL);
+    col->ref = vtss_xrow_ref(vtss_state, idx);
     *idx = (row_idx * 8 + col_idx);
     VTSS_I("%s, %s, row: %u, col: %u, idx: %u, count: %u", hdr->name, txt, row_idx, col_idx, *idx, count);
-    for (i = 0; clear && i < count; i++) {
+    for (i = 0; i < size; i++) {
         if (hdr->clear) {
             VTSS_RC(hdr->clear(vtss_state, *idx + i));
         }
@@ -3366,9 +3594,7 @@ vtss_rc vtss_cmn_estat_free(vtss_state_t *vtss_state, u16 *idx)
 #if defined(VTSS_FEATURE_FRER)
 static vtss_rc vtss_mstream_move(vtss_state_t *vtss_state, u16 idx_old, u16 idx_new, u16 count)
 {
-    vtss_sdx_info_t  *sdx_info = &vtss_state->l2.sdx_info;
-    vtss_sdx_entry_t *sdx;
-    u16              i, *idx;
+    u16 i;
 
     VTSS_I("move idx_old: %u to idx_new: %u", idx_old, idx_new);
 
@@ -3379,15 +3605,7 @@ static vtss_rc vtss_mstream_move(vtss_state_t *vtss_state, u16 idx_old, u16 idx_
     }
 
     /* Update ISDX entries referring to the old index */
-    for (i = 0; i < sdx_info->max_count; i++) {
-        sdx = &sdx_info->isdx.table[i];
-        idx = &sdx->ms_idx;
-        if (sdx->port_no != VTSS_PORT_NO_NONE && *idx == idx_old) {
-            *idx = idx_new;
-            VTSS_FUNC_RC(l2.isdx_update, sdx);
-        }
-    }
-    return VTSS_RC_OK;
+    return vtss_sdx_ref_move(vtss_state, VTSS_SDX_REF_MS, idx_old, idx_new);
 }
 
 static vtss_rc vtss_mstream_clear(vtss_state_t *vtss_state, u16 idx)
@@ -3418,6 +3636,7 @@ static vtss_rc vtss_l2_pol_stat_create(vtss_state_t *vtss_state)
     hdr->name = "policer";
     hdr->max_count = VTSS_EVC_POL_CNT;
     hdr->row = state->pol_table.row;
+    vtss_xrow_init(hdr);
     dummy = VTSS_POL_STAT_NONE;
     VTSS_RC(vtss_xrow_alloc(vtss_state, hdr, cnt, &dummy));
     hdr->move = vtss_cmn_pol_move;
@@ -3427,6 +3646,7 @@ static vtss_rc vtss_l2_pol_stat_create(vtss_state_t *vtss_state)
     hdr->name = "istat";
     hdr->max_count = VTSS_EVC_STAT_CNT;
     hdr->row = state->istat_table.row;
+    vtss_xrow_init(hdr);
     dummy = VTSS_POL_STAT_NONE;
     VTSS_RC(vtss_xrow_alloc(vtss_state, hdr, cnt, &dummy));
     hdr->move = vtss_cmn_istat_move;
@@ -3439,6 +3659,7 @@ static vtss_rc vtss_l2_pol_stat_create(vtss_state_t *vtss_state)
     hdr->name = "estat";
     hdr->max_count = VTSS_EVC_STAT_CNT;
     hdr->row = state->estat_table.row;
+    vtss_xrow_init(hdr);
     dummy = VTSS_POL_STAT_NONE;
     VTSS_RC(vtss_xrow_alloc(vtss_state, hdr, cnt, &dummy));
     hdr->move = vtss_cmn_estat_move;
@@ -3450,6 +3671,7 @@ static vtss_rc vtss_l2_pol_stat_create(vtss_state_t *vtss_state)
     hdr->name = "mstream";
     hdr->max_count = VTSS_MSTREAM_CNT;
     hdr->row = state->ms_table.row;
+    vtss_xrow_init(hdr);
     dummy = VTSS_POL_STAT_NONE;
     VTSS_RC(vtss_xrow_alloc(vtss_state, hdr, cnt, &dummy));
     hdr->move = vtss_mstream_move;
@@ -3846,29 +4068,25 @@ vtss_rc vtss_frer_cstream_cnt_clear(const vtss_inst_t            inst,
 #endif
 
 vtss_rc vtss_frer_mstream_alloc(const vtss_inst_t      inst,
-                                const BOOL             port_list[VTSS_PORTS],
+                                const vtss_port_bf_t   *const port_list,
                                 vtss_frer_mstream_id_t *const id)
 {
     vtss_state_t     *vtss_state;
     vtss_xms_entry_t *ms;
     vtss_rc          rc;
-    vtss_port_no_t   port_no;
-    u8               cnt = 0;
+    vtss_port_set_t  set;
+    u32              cnt;
     u16              i;
 
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
         rc = VTSS_RC_ERROR;
+        vtss_port_set_from_bf(&set, port_list->bf, vtss_state->port_count);
+        cnt = vtss_port_set_cnt(&set);
         for (i = 0; i < VTSS_MSTREAM_CNT; i++) {
             ms = &vtss_state->l2.ms.table[i];
             if (ms->cnt == 0) {
-                VTSS_PORT_BF_CLR(ms->port_list);
-                for (port_no = 0; port_no < vtss_state->port_count; port_no++) {
-                    if (port_list[port_no]) {
-                        VTSS_PORT_BF_SET(ms->port_list, port_no, 1);
-                        cnt++;
-                    }
-                }
+                VTSS_MEMCPY(ms->port_list, set.bf, VTSS_PORT_BF_SIZE);
                 if (cnt == 0 || cnt > VTSS_FRER_EGR_PORT_CNT) {
                     VTSS_E("illegal port count: %u", cnt)
                 } else if ((rc = vtss_xrow_alloc(vtss_state, &vtss_state->l2.ms_table.hdr, cnt, &ms->idx)) == VTSS_RC_OK) {
@@ -4037,7 +4255,7 @@ vtss_rc vtss_iflow_alloc(const vtss_inst_t inst,
 {
     vtss_state_t      *vtss_state;
     vtss_rc           rc;
-    vtss_sdx_entry_t  *sdx, **list, *cur, *prev = NULL;
+    vtss_sdx_entry_t  *sdx, **list;
     vtss_iflow_conf_t *conf;
 
     VTSS_ENTER();
@@ -4045,20 +4263,15 @@ vtss_rc vtss_iflow_alloc(const vtss_inst_t inst,
         if ((sdx = vtss_cmn_sdx_alloc(vtss_state, 0, 0, TRUE)) == NULL) {
             rc = VTSS_RC_ERROR;
         } else {
-            /* Insert allocated entry in sorted list */
+            /* Insert allocated entry first in list */
             list = &vtss_state->l2.sdx_info.iflow;
-            for (cur = *list; cur != NULL; prev = cur, cur = cur->next) {
-                if (cur->sdx > sdx->sdx) {
-                    break;
-                }
-            }
-            if (prev == NULL) {
-                sdx->next = *list;
-                *list = sdx;
-            } else {
-                sdx->next = prev->next;
-                prev->next = sdx;
+            sdx->prev = NULL;
+            sdx->next = *list;
+            if (*list != NULL) {
+                (*list)->prev = sdx;
             }
+            *list = sdx;
+            sdx->iflow = TRUE;
             conf = &sdx->conf;
             VTSS_MEMSET(conf, 0, sizeof(*conf));
 #if defined(VTSS_FEATURE_VOP)
@@ -4079,33 +4292,34 @@ vtss_rc vtss_iflow_free(const vtss_inst_t     inst,
 {
     vtss_state_t     *vtss_state;
     vtss_rc          rc;
-    vtss_sdx_entry_t **list, *cur, *prev = NULL;
+    vtss_sdx_entry_t *cur;
 
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
-        rc = VTSS_RC_ERROR;
-        list = &vtss_state->l2.sdx_info.iflow;
-        for (cur = *list; cur != NULL; prev = cur, cur = cur->next) {
-            if (cur->sdx == id) {
-                if (prev == NULL) {
-                    *list = cur->next;
-                } else {
-                    prev->next = cur->next;
-                }
+        if ((cur = vtss_iflow_lookup(vtss_state, id)) == NULL) {
+            rc = VTSS_RC_ERROR;
+        } else {
+            if (cur->prev == NULL) {
+                vtss_state->l2.sdx_info.iflow = cur->next;
+            } else {
+                cur->prev->next = cur->next;
+            }
+            if (cur->next != NULL) {
+                cur->next->prev = cur->prev;
+            }
+            cur->prev = NULL;
+            cur->iflow = FALSE;
 #if defined(VTSS_ARCH_LAN966X)
-                if (cur->conf.cnt_enable) {
-                    vtss_xstat_entry_t *stat = vtss_istat_lookup(vtss_state, cur->conf.cnt_id, 0);
+            if (cur->conf.cnt_enable) {
+                vtss_xstat_entry_t *stat = vtss_istat_lookup(vtss_state, cur->conf.cnt_id, 0);
 
-                    if (stat != NULL) {
-                        // Remove reference from ingress counters to flow
-                        stat->sdx = 0;
-                    }
+                if (stat != NULL) {
+                    // Remove reference from ingress counters to flow
+                    stat->sdx = 0;
                 }
-#endif
-                vtss_cmn_sdx_free(vtss_state, cur, TRUE);
-                rc = VTSS_RC_OK;
-                break;
             }
+#endif
+            vtss_cmn_sdx_free(vtss_state, cur, TRUE);
         }
     }
     VTSS_EXIT();
@@ -4114,14 +4328,15 @@ vtss_rc vtss_iflow_free(const vtss_inst_t     inst,
 
 vtss_sdx_entry_t *vtss_iflow_lookup(vtss_state_t *vtss_state, vtss_iflow_id_t id)
 {
-    vtss_sdx_entry_t *cur;
+    vtss_sdx_info_t  *sdx_info = &vtss_state->l2.sdx_info;
+    vtss_sdx_entry_t *sdx;
 
-    for (cur = vtss_state->l2.sdx_info.iflow; cur != NULL; cur = cur->next) {
-        if (cur->sdx == id) {
-            break;
-        }
+    /* The ISDX table is indexed in reverse order of SDX values */
+    if (id == 0 || id > sdx_info->max_count) {
+        return NULL;
     }
-    return cur;
+    sdx = &sdx_info->isdx.table[sdx_info->max_count - id];
+    return (sdx->iflow ? sdx : NULL);
 }
 
 vtss_rc vtss_iflow_conf_get(const vtss_inst_t     inst,
@@ -4144,82 +4359,122 @@ vtss_rc vtss_iflow_conf_get(const vtss_inst_t     inst,
     return rc;
 }
 
-vtss_rc vtss_iflow_conf_set(const vtss_inst_t       inst,
-                            const vtss_iflow_id_t   id,
-                            const vtss_iflow_conf_t *const conf)
+static vtss_rc vtss_iflow_conf_update(vtss_state_t            *vtss_state,
+                                      const vtss_iflow_id_t   id,
+                                      const vtss_iflow_conf_t *const conf)
 {
-    vtss_state_t     *vtss_state;
-    vtss_rc          rc;
+    vtss_rc          rc = VTSS_RC_OK;
     vtss_sdx_entry_t *sdx;
     u16              stat_idx = 0, pol_idx = 0, ms_idx = 0;
     u8               stat_cnt = 0, pol_cnt = 0, clear = 0;
 
-    VTSS_ENTER();
-    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
-        if ((sdx = vtss_iflow_lookup(vtss_state, id)) == NULL) {
-            rc = VTSS_RC_ERROR;
-        } else {
+    if ((sdx = vtss_iflow_lookup(vtss_state, id)) == NULL) {
+        rc = VTSS_RC_ERROR;
+    } else {
 #if defined(VTSS_FEATURE_XDLB)
-            if (conf->dlb_enable) {
-                vtss_xpol_entry_t *pol = vtss_pol_lookup(vtss_state, conf->dlb_id);
+        if (conf->dlb_enable) {
+            vtss_xpol_entry_t *pol = vtss_pol_lookup(vtss_state, conf->dlb_id);
 
-                if (pol == NULL) {
-                    rc = VTSS_RC_ERROR;
-                } else {
-                    pol_idx = pol->idx;
-                    pol_cnt = pol->cnt;
-                }
+            if (pol == NULL) {
+                rc = VTSS_RC_ERROR;
+            } else {
+                pol_idx = pol->idx;
+                pol_cnt = pol->cnt;
             }
+        }
 #endif
 #if defined(VTSS_FEATURE_FRER)
-            if (conf->frer.mstream_enable) {
-                vtss_xms_entry_t *ms = vtss_ms_lookup(vtss_state, conf->frer.mstream_id);
+        if (conf->frer.mstream_enable) {
+            vtss_xms_entry_t *ms = vtss_ms_lookup(vtss_state, conf->frer.mstream_id);
 
-                if (ms == NULL) {
-                    rc = VTSS_RC_ERROR;
-                } else {
-                    ms_idx = ms->idx;
-                }
+            if (ms == NULL) {
+                rc = VTSS_RC_ERROR;
+            } else {
+                ms_idx = ms->idx;
             }
+        }
 #endif
 #if defined(VTSS_FEATURE_XSTAT)
-            if (conf->cnt_enable && rc == VTSS_RC_OK) {
-                vtss_xstat_entry_t *stat = vtss_istat_lookup(vtss_state, conf->cnt_id, 1);
+        if (conf->cnt_enable && rc == VTSS_RC_OK) {
+            vtss_xstat_entry_t *stat = vtss_istat_lookup(vtss_state, conf->cnt_id, 1);
 
-                if (stat == NULL) {
-                    rc = VTSS_RC_ERROR;
-                } else {
-                    stat_idx = stat->idx;
-                    stat_cnt = stat->cnt;
+            if (stat == NULL) {
+                rc = VTSS_RC_ERROR;
+            } else {
+                stat_idx = stat->idx;
+                stat_cnt = stat->cnt;
 #if defined(VTSS_ARCH_LAN966X)
-                    // Ingress counters can only be mapped to one flow
-                    if (stat->sdx == 0) {
-                        clear = 1;
-                        stat->sdx = sdx->sdx;
-                    } else if (stat->sdx != sdx->sdx) {
-                        VTSS_E("cnt_id %u already mapped to iflow %u", conf->cnt_id, sdx->sdx);
-                        rc = VTSS_RC_ERROR;
-                    }
-#endif
+                // Ingress counters can only be mapped to one flow
+                if (stat->sdx == 0) {
+                    clear = 1;
+                    stat->sdx = sdx->sdx;
+                } else if (stat->sdx != sdx->sdx) {
+                    VTSS_E("cnt_id %u already mapped to iflow %u", conf->cnt_id, sdx->sdx);
+                    rc = VTSS_RC_ERROR;
                 }
+#endif
             }
+        }
 #endif
-            if (rc == VTSS_RC_OK) {
-                sdx->conf = *conf;
-                sdx->stat_idx = stat_idx;
-                sdx->stat_cnt = stat_cnt;
-                sdx->pol_idx = pol_idx;
-                sdx->pol_cnt = pol_cnt;
-                sdx->ms_idx = ms_idx;
-                rc = VTSS_FUNC(l2.iflow_conf_set, id);
-                if (rc == VTSS_RC_OK && clear) {
+        if (rc == VTSS_RC_OK) {
+#if defined(VTSS_EVC_STAT_CNT)
+            vtss_sdx_ref_del(vtss_state, sdx);
+#endif
+            sdx->conf = *conf;
+            sdx->stat_idx = stat_idx;
+            sdx->stat_cnt = stat_cnt;
+            sdx->pol_idx = pol_idx;
+            sdx->pol_cnt = pol_cnt;
+            sdx->ms_idx = ms_idx;
+#if defined(VTSS_EVC_STAT_CNT)
+            vtss_sdx_ref_add(vtss_state, sdx);
+#endif
+            rc = VTSS_FUNC(l2.iflow_conf_set, id);
+            if (rc == VTSS_RC_OK && clear) {
 #if defined(VTSS_FEATURE_XSTAT)
-                    rc = vtss_cmn_istat_clear(vtss_state, sdx->sdx);
+                rc = vtss_cmn_istat_clear(vtss_state, sdx->sdx);
 #endif
-                }
             }
         }
     }
+    return rc;
+}
+
+vtss_rc vtss_iflow_conf_set(const vtss_inst_t       inst,
+                            const vtss_iflow_id_t   id,
+                            const vtss_iflow_conf_t *const conf)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        rc = vtss_iflow_conf_update(vtss_state, id, conf);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_iflow_conf_bulk_set(const vtss_inst_t        inst,
+                                 const u32                cnt,
+                                 const vtss_iflow_entry_t *entry,
+                                 u32                      *const set_cnt)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+    u32          i;
+
+    *set_cnt = 0;
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        for (i = 0; i < cnt; i++) {
+            if ((rc = vtss_iflow_conf_update(vtss_state, entry[i].id, &entry[i].conf)) != VTSS_RC_OK) {
+                VTSS_I("iflow %u failed, %u of %u flows set", entry[i].id, i, cnt);
+                break;
+            }
+            (*set_cnt)++;
+        }
+    }
     VTSS_EXIT();
     return rc;
 }
@@ -6285,15 +6540,74 @@ static void vtss_debug_print_w6(const vtss_debug_printf_t pr, BOOL enable, u32 v
     }
 }
 
+#if defined(VTSS_EVC_STAT_CNT)
+/* Check that each resource used by an ingress flow refers back to it */
+static void vtss_debug_print_sdx_ref(vtss_state_t *vtss_state,
+                                     const vtss_debug_printf_t pr)
+{
+    vtss_sdx_info_t     *sdx_info = &vtss_state->l2.sdx_info;
+    vtss_sdx_entry_t    *sdx;
+    vtss_sdx_ref_type_t type;
+    u16                 *idx, *head, i;
+    u32                 j, n, count = 0, list_count = 0, errors = 0;
+    const char          *txt[VTSS_SDX_REF_CNT] = { "policer", "stat", "mstream" };
+    u32                 max[VTSS_SDX_REF_CNT] = { VTSS_EVC_POL_CNT, VTSS_EVC_STAT_CNT, 0 };
+
+#if defined(VTSS_FEATURE_FRER)
+    max[VTSS_SDX_REF_MS] = VTSS_MSTREAM_CNT;
+#endif
+    for (sdx = sdx_info->iflow; sdx != NULL; sdx = sdx->next) {
+        for (type = 0; type < VTSS_SDX_REF_CNT; type++) {
+            if ((idx = vtss_sdx_ref_idx(sdx, type)) == NULL) {
+                continue;
+            }
+            count++;
+            head = vtss_sdx_ref_head(vtss_state, type, *idx);
+            for (i = (head == NULL ? 0 : *head), n = 0; i != 0 && n < sdx_info->max_count; n++) {
+                if (&sdx_info->isdx.table[i - 1] == sdx) {
+                    break;
+                }
+                i = sdx_info->isdx.table[i - 1].ref_next[type];
+            }
+            if (i == 0 || n == sdx_info->max_count) {
+                pr("ISDX %u missing in %s %u references\n", sdx->sdx, txt[type], *idx);
+                errors++;
+            }
+        }
+    }
+
+    /* Count all list entries, the lists must not hold stale entries */
+    for (type = 0; type < VTSS_SDX_REF_CNT; type++) {
+        for (j = 0; j < max[type]; j++) {
+            head = vtss_sdx_ref_head(vtss_state, type, j);
+            for (i = *head, n = 0; i != 0 && n < sdx_info->max_count; n++) {
+                list_count++;
+                i = sdx_info->isdx.table[i - 1].ref_next[type];
+            }
+        }
+    }
+    if (list_count != count) {
+        pr("ISDX references: %u, list entries: %u\n", count, list_count);
+        errors++;
+    }
+    pr("ISDX reference check: %s\n\n", errors ? "Failed" : "OK");
+}
+#endif
+
 static void vtss_debug_print_iflow(vtss_state_t *vtss_state,
                                    const vtss_debug_printf_t pr,
                                    const vtss_debug_info_t   *const info)
 {
     vtss_sdx_entry_t  *sdx;
     vtss_iflow_conf_t *conf;
+    vtss_iflow_id_t   id;
     BOOL              first = TRUE;
 
-    for (sdx = vtss_state->l2.sdx_info.iflow; sdx != NULL; sdx = sdx->next) {
+    /* The flow list is unordered, so walk the flows in ISDX order */
+    for (id = 1; id <= vtss_state->l2.sdx_info.max_count; id++) {
+        if ((sdx = vtss_iflow_lookup(vtss_state, id)) == NULL) {
+            continue;
+        }
         if (first) {
             first = FALSE;
             pr("Ingress Flows:\n\n");
@@ -6356,6 +6670,9 @@ static void vtss_debug_print_iflow(vtss_state_t *vtss_state,
     if (!first) {
         pr("\n");
     }
+#if defined(VTSS_EVC_STAT_CNT)
+    vtss_debug_print_sdx_ref(vtss_state, pr);
+#endif
 }
 
 static void vtss_debug_print_eflow(vtss_state_t *vtss_state,
@@ -6421,6 +6738,9 @@ static void vtss_debug_print_xrow(vtss_state_t *vtss_state,
         if ((count = hdr->count_size[size]) != 0) {
             pr("count[%u]  : %u\n", size, count);
         }
+        if ((count = hdr->row_count[size]) != 0) {
+            pr("rows[%u]   : %u\n", size, count);
+        }
     }
     pr("\n");
 
@@ -7808,12 +8128,19 @@ void vtss_cmn_sdx_free(vtss_state_t *vtss_state, vtss_sdx_entry_t *sdx, BOOL isd
 {
     vtss_sdx_list_t *list = (isdx ? &vtss_state->l2.sdx_info.isdx : &vtss_state->l2.sdx_info.esdx);
 
+#if defined(VTSS_EVC_STAT_CNT)
+    if (isdx) {
+        vtss_sdx_ref_del(vtss_state, sdx);
+    }
+#endif
     sdx->port_no = VTSS_PORT_NO_NONE;
     sdx->id = 0;
     sdx->pol_idx = 0;
     sdx->pol_cnt = 0;
     sdx->stat_idx = 0;
     sdx->stat_cnt = 0;
+    sdx->ms_idx = 0;
+    sdx->iflow = FALSE;
     sdx->next = list->free;
     list->free = sdx;
     list->count--;
@@ -8400,11 +8727,11 @@ static void vtss_debug_print_mirror(vtss_state_t *vtss_state,
     pr(" CPU\n");
 
     pr("Ingress: ");
-    vtss_debug_print_port_members(vtss_state, pr, vtss_state->l2.mirror_ingress, 0);
+    vtss_debug_print_ports(vtss_state, pr, vtss_state->l2.mirror_ingress.bf, 0);
     pr(" %u\n", vtss_state->l2.mirror_cpu_ingress);
 
     pr("Egress : ");
-    vtss_debug_print_port_members(vtss_state, pr, vtss_state->l2.mirror_egress, 0);
+    vtss_debug_print_ports(vtss_state, pr, vtss_state->l2.mirror_egress.bf, 0);
     pr(" %u\n\n", vtss_state->l2.mirror_cpu_egress);
 
     vtss_debug_print_port_none(pr, "Mirror Port      ", conf->port_no);
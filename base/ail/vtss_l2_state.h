@@ -388,9 +388,19 @@ typedef enum {
 #endif /* VTSS_FEATURE_IPV4_MC_SIP || VTSS_FEATURE_IPV6_MC_SIP */
 
 #if defined(VTSS_SDX_CNT)
+/* Resources referenced by ISDX entries */
+typedef enum {
+    VTSS_SDX_REF_POL,  /* Policer */
+    VTSS_SDX_REF_STAT, /* Statistics */
+    VTSS_SDX_REF_MS,   /* Member stream */
+    VTSS_SDX_REF_CNT
+} vtss_sdx_ref_type_t;
+
 /* SDX entry */
 typedef struct vtss_sdx_entry_t {
     struct vtss_sdx_entry_t *next;    /* next in list */
+    struct vtss_sdx_entry_t *prev;    /* previous in ingress flow list */
+    BOOL                    iflow;    /* Allocated as ingress flow */
     vtss_port_no_t          port_no;  /* UNI/NNI port number */
     u16                     id;       /* ID number, used for E-tree leaf/root indication */
     u16                     sdx;      /* SDX value */
@@ -399,6 +409,7 @@ typedef struct vtss_sdx_entry_t {
     u8                      pol_cnt;  /* Policer count */
     u8                      stat_cnt; /* Statistics count */
     u16                     ms_idx;   /* Member stream index */
+    u16                     ref_next[VTSS_SDX_REF_CNT]; /* Next ISDX using the same resource (table index + 1) */
     vtss_iflow_conf_t       conf;     /* Ingress flow configuration */
 } vtss_sdx_entry_t;
 
@@ -429,9 +440,13 @@ typedef struct {
     u16  *ref; /* Reference to allocated value */
 } vtss_xcol_entry_t;
 
+#define VTSS_XROW_NONE 0xffff /* Row list end */
+
 typedef struct {
     u8                size;   /* Entry size, 1/2/4/8 or 0 (free) */
     u8                count;  /* Number of used columns */
+    u16               prev;   /* Previous row in list */
+    u16               next;   /* Next row in list */
     vtss_xcol_entry_t col[8]; /* Columns */
 } vtss_xrow_entry_t;
 
@@ -439,6 +454,8 @@ typedef struct {
     u32               max_count;         /* Maximum number of entries */
     u32               count;             /* Actual number of allocated entries */
     u32               count_size[8 + 1]; /* Actual number per size (0-8) */
+    u16               row_count[8 + 1];  /* Number of rows per size (0-8) */
+    u16               list[8 + 1];       /* Rows with free columns per size, list[0] holds free rows */
     const             char *name;        /* Name for debugging */
     vtss_rc (* move)(struct vtss_state_s *vtss_state, u16 idx_old, u16 idx_new, u16 count);
     vtss_rc (* clear)(struct vtss_state_s *vtss_state, u16 idx);
@@ -507,6 +524,14 @@ typedef struct {
     vtss_sdx_list_t     isdx;      /* ISDX list */
     vtss_sdx_list_t     esdx;      /* ESDX list */
     vtss_sdx_entry_t    *iflow;    /* List of allocated ingress flow entries */
+#if defined(VTSS_EVC_STAT_CNT)
+    /* First ISDX using each resource index (table index + 1, zero means none) */
+    u16                 pol_ref[VTSS_EVC_POL_CNT];
+    u16                 stat_ref[VTSS_EVC_STAT_CNT];
+#if defined(VTSS_FEATURE_FRER)
+    u16                 ms_ref[VTSS_MSTREAM_CNT];
+#endif
+#endif
 } vtss_sdx_info_t;
 #endif /* VTSS_SDX_CNT */
 
@@ -715,8 +740,8 @@ typedef struct {
     vtss_dgroup_port_conf_t       dgroup_port_conf[VTSS_PORT_ARRAY_SIZE];
     vtss_mirror_conf_t            mirror_conf;
 
-    BOOL                          mirror_ingress[VTSS_PORT_ARRAY_SIZE];
-    BOOL                          mirror_egress[VTSS_PORT_ARRAY_SIZE];
+    vtss_port_set_t               mirror_ingress;
+    vtss_port_set_t               mirror_egress;
     BOOL                          mirror_cpu_ingress;
     BOOL                          mirror_cpu_egress;
     vtss_vlan_conf_t              vlan_conf;
@@ -928,6 +953,9 @@ void vtss_port_mask_clear(vtss_port_mask_t *pmask);
 void vtss_port_mask_get(struct vtss_state_s *vtss_state,
                         const BOOL member[],
                         vtss_port_mask_t *pmask);
+void vtss_port_set_mask_get(struct vtss_state_s *vtss_state,
+                            const vtss_port_set_t *set,
+                            vtss_port_mask_t *pmask);
 void vtss_port_mask_port(struct vtss_state_s *vtss_state,
                          vtss_port_no_t port_no,
                          vtss_port_mask_t *pmask);
@@ -69,6 +69,64 @@ vtss_rc vtss_reg_write_masked(const vtss_inst_t    inst,
     return rc;
 }
 
+vtss_rc vtss_reg_profile_conf_get(const vtss_inst_t       inst,
+                                  vtss_reg_profile_conf_t *const conf)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        *conf = vtss_state->misc.reg_profile_conf;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_reg_profile_conf_set(const vtss_inst_t             inst,
+                                  const vtss_reg_profile_conf_t *const conf)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK &&
+        (rc = VTSS_FUNC(misc.reg_profile_enable, conf->enable)) == VTSS_RC_OK) {
+        vtss_state->misc.reg_profile_conf = *conf;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_reg_profile_clear(const vtss_inst_t inst)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        rc = VTSS_FUNC(misc.reg_profile_clear);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_reg_profile_get(const vtss_inst_t             inst,
+                             const vtss_reg_profile_type_t type,
+                             const u32                     idx,
+                             vtss_reg_profile_entry_t      *const entry)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        rc = VTSS_FUNC(misc.reg_profile_get, type, idx, entry);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 vtss_rc vtss_chip_id_get(const vtss_inst_t  inst,
                          vtss_chip_id_t     *const chip_id)
 {
@@ -102,6 +160,12 @@ vtss_rc vtss_poll_1sec(const vtss_inst_t  inst)
         if (rc == VTSS_RC_OK) {
             rc = rc2;
         }
+#if defined(VTSS_FEATURE_AFI_SWC) && defined(VTSS_AFI_V2)
+        rc2 = vtss_afi_rm_poll(vtss_state);
+        if (rc == VTSS_RC_OK) {
+            rc = rc2;
+        }
+#endif
     }
     VTSS_EXIT();
     return rc;
@@ -27,6 +27,11 @@ typedef struct {
                            const vtss_chip_no_t chip_no, const u64 addr, u32 * const value);
     vtss_rc (* reg_write64)(struct vtss_state_s *vtss_state,
                             const vtss_chip_no_t chip_no, const u64 addr, const u32 value);
+    vtss_rc (* reg_profile_enable)(struct vtss_state_s *vtss_state, BOOL enable);
+    vtss_rc (* reg_profile_clear)(struct vtss_state_s *vtss_state);
+    vtss_rc (* reg_profile_get)(struct vtss_state_s *vtss_state,
+                                const vtss_reg_profile_type_t type, const u32 idx,
+                                vtss_reg_profile_entry_t *const entry);
 
     vtss_rc (* chip_id_get)(struct vtss_state_s *vtss_state, vtss_chip_id_t *const chip_id);
     vtss_rc (* intr_sticky_clear)(const struct vtss_state_s *const state, u32 ext);
@@ -104,6 +109,7 @@ typedef struct {
 #endif  /* VTSS_FEATURE_IRQ_CONTROL */
     /* Configuration/state */
     vtss_chip_id_t                chip_id;
+    vtss_reg_profile_conf_t       reg_profile_conf;
     BOOL                          jr2_a; /* Jaguar-2 revision A */
     u32                           gpio_count;
 #if defined(VTSS_FEATURE_SERIAL_GPIO)
@@ -384,6 +384,8 @@ typedef struct {
 #define VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW     (VTSS_QOS_TAS_GCL_LEN_MAX / VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK)    /* Number of blocks per row. A list must be able to fit into one row. So a row must have blocks to contain the maximum GCL */
 #define VTSS_TAS_NUMBER_OF_ENTRIES_PER_ROW    VTSS_QOS_TAS_GCL_LEN_MAX    /* Number of entries per row. This is also the maximum lengt of a list as a list mist be in one row */
 #define VTSS_TAS_NUMBER_OF_ROWS               (VTSS_TAS_NUMBER_OF_ENTRIES/VTSS_TAS_NUMBER_OF_ENTRIES_PER_ROW)   /* Number of rows */
+#define VTSS_TAS_NUMBER_OF_BLOCKS             (VTSS_TAS_NUMBER_OF_ROWS * VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW)   /* Number of blocks */
+#define VTSS_TAS_NUMBER_OF_ORDERS             4     /* Number of buddy orders. A buddy of order N has (1 << N) blocks, the largest is a full row */
 #endif
 
 #if defined(VTSS_ARCH_LAN966X)
@@ -410,14 +412,11 @@ typedef struct {
 } vtss_tas_profile_t;
 
 typedef struct {
-    BOOL in_use;
+    BOOL in_use;    /* First block of a buddy allocated to a list */
+    BOOL free;      /* First block of a free buddy */
+    u8   order;     /* Order of the buddy starting in this block */
 } vtss_tas_entry_block_t;
 
-typedef struct {
-    u16  in_use;
-    u16  slot_size;
-} vtss_tas_entry_row_t;
-
 typedef struct {
     BOOL stop_ongoing;
     BOOL new_list_scheduled;
@@ -433,8 +432,8 @@ typedef struct {
 #if defined(VTSS_FEATURE_QOS_TAS_LIST_LINKED)
     vtss_tas_list_entry      tas_entries[VTSS_TAS_NUMBER_OF_ENTRIES];
 #else
-    vtss_tas_entry_block_t   tas_entry_blocks[VTSS_TAS_NUMBER_OF_ROWS][VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW];
-    vtss_tas_entry_row_t     tas_entry_rows[VTSS_TAS_NUMBER_OF_ROWS];
+    vtss_tas_entry_block_t   tas_entry_blocks[VTSS_TAS_NUMBER_OF_BLOCKS];
+    u32                      tas_free_cnt[VTSS_TAS_NUMBER_OF_ORDERS];    /* Number of free buddies of each order */
 #endif
     vtss_tas_gcl_state_t     tas_gcl_state[VTSS_PORT_ARRAY_SIZE];
 
@@ -26,6 +26,23 @@
 #define VTSS_PORT_BF_SET(a, port_no, v)  VTSS_BF_SET(a, (port_no) - VTSS_PORT_NO_START, v)
 #define VTSS_PORT_BF_CLR(a)              VTSS_BF_CLR(a, VTSS_PORTS)
 
+/* Port set, a port member bit field padded to whole 32-bit words for set operations */
+#define VTSS_PORT_SET_WORDS              ((VTSS_PORT_BF_SIZE + 3) / 4)
+#define VTSS_PORT_SET_GET(s, port_no)    VTSS_PORT_BF_GET((s)->bf, port_no)
+#define VTSS_PORT_SET_ADD(s, port_no)    VTSS_PORT_BF_SET((s)->bf, port_no, 1)
+#define VTSS_PORT_SET_DEL(s, port_no)    VTSS_PORT_BF_SET((s)->bf, port_no, 0)
+#define VTSS_PORT_SET_CLR(s)             VTSS_MEMSET(s, 0, sizeof(vtss_port_set_t))
+
+/* Iterate over the port numbers in a set */
+#define VTSS_PORT_SET_FOREACH(s, port_no)                                       \
+    for (port_no = vtss_port_set_next(s, VTSS_PORT_NO_START);                   \
+         port_no != VTSS_PORT_NO_NONE; port_no = vtss_port_set_next(s, port_no + 1))
+
+typedef union {
+    u8  bf[VTSS_PORT_SET_WORDS * 4]; /* Port member bit field, see VTSS_PORT_BF_xxx */
+    u32 w[VTSS_PORT_SET_WORDS];      /* Word view of the bit field, for set operations */
+} vtss_port_set_t;
+
 #if defined(VTSS_FEATURE_MISC)
 #include "vtss_misc_state.h"
 #endif
@@ -70,6 +87,10 @@
 #include "vtss_ts_state.h"
 #endif
 
+#if defined(VTSS_FEATURE_HW_PROT) || defined(VTSS_FEATURE_TUPE)
+#include "vtss_tupe_state.h"
+#endif
+
 #if defined(VTSS_FEATURE_CLOCK)
 #include "vtss_clock_state.h"
 #endif
@@ -230,6 +251,23 @@ typedef struct {
 /* State cookie */
 #define VTSS_STATE_COOKIE 0x53727910
 
+/* Persistent state region, the header is followed by the state structure */
+#define VTSS_PERSIST_MAGIC    0x50455253 /* Region signature */
+#define VTSS_PERSIST_VERSION  1          /* Header and adoption rules version */
+#define VTSS_PERSIST_HDR_SIZE 64         /* Space reserved for the header */
+
+typedef struct {
+    u32 magic;       /* VTSS_PERSIST_MAGIC */
+    u32 version;     /* VTSS_PERSIST_VERSION */
+    u32 api_version; /* VTSS_API_VERSION */
+    u32 state_size;  /* Size of the state structure */
+    u32 target;      /* Target type */
+    u32 valid;       /* The state was released by vtss_inst_destroy() */
+    u64 base;        /* Address of the state structure */
+    u64 code;        /* Address of vtss_inst_create() */
+    u32 chksum;      /* Header checksum */
+} vtss_persist_hdr_t;
+
 /* State structure */
 typedef struct vtss_state_s {
     /* Initialization */
@@ -237,6 +275,8 @@ typedef struct vtss_state_s {
     vtss_arch_t                   arch;            /* Architecture */
     vtss_inst_create_t            create;
     vtss_init_conf_t              init_conf;
+    vtss_persist_hdr_t            *persist;        /* Persistent region header or NULL */
+    BOOL                          persist_adopted; /* State adopted from the previous owner of the region */
     BOOL                          restart_updated; /* Restart has been detected */
     BOOL                          warm_start_cur;  /* Current warm start status */
     BOOL                          warm_start_prev; /* Previous warm start status */
@@ -319,6 +359,10 @@ typedef struct vtss_state_s {
     vtss_afi_state_t              afi;
 #endif /* VTSS_FEATURE_AFI_SWC */
 
+#if defined(VTSS_FEATURE_HW_PROT) || defined(VTSS_FEATURE_TUPE)
+    vtss_tupe_state_t             tupe;
+#endif /* VTSS_FEATURE_HW_PROT || VTSS_FEATURE_TUPE */
+
     struct {
         u8   vcore_cfg;         /* If supported by target */
         BOOL using_vcoreiii;    /* If supported by target */
@@ -397,8 +441,20 @@ extern vtss_trace_conf_t vtss_trace_conf[];
 #define VTSS_D_HEX(_byte_p, _byte_cnt) VTSS_DG_HEX(VTSS_TRACE_GROUP, _byte_p, _byte_cnt)
 #define VTSS_N_HEX(_byte_p, _byte_cnt) VTSS_NG_HEX(VTSS_TRACE_GROUP, _byte_p, _byte_cnt)
 
+/* Binary trace of debug and noise levels, see vtss_trace.c */
+extern BOOL vtss_trace_bin_enable;
+void vtss_trace_bin_printf(const vtss_trace_layer_t  layer,
+                           const vtss_trace_group_t  group,
+                           const vtss_trace_level_t  level,
+                           const char                *file,
+                           const int                 line,
+                           const char                *function,
+                           const char                *format,
+                           ...) VTSS_ATTR_PRINTF(7, 8);
+#define VTSS_TRACE_BIN(_lvl) ((_lvl) >= VTSS_TRACE_LEVEL_DEBUG && vtss_trace_bin_enable)
+
 /* For files with multiple trace groups: */
-#define VTSS_T(_grp, _lvl, ...) { if (vtss_trace_conf[_grp].level[VTSS_TRACE_LAYER] >= _lvl) vtss_callout_trace_printf(VTSS_TRACE_LAYER, _grp, _lvl, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__); }
+#define VTSS_T(_grp, _lvl, ...) { if (vtss_trace_conf[_grp].level[VTSS_TRACE_LAYER] >= _lvl) { if (VTSS_TRACE_BIN(_lvl)) vtss_trace_bin_printf(VTSS_TRACE_LAYER, _grp, _lvl, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__); else vtss_callout_trace_printf(VTSS_TRACE_LAYER, _grp, _lvl, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__); } }
 #define VTSS_EG(_grp, ...) VTSS_T(_grp, VTSS_TRACE_LEVEL_ERROR, __VA_ARGS__)
 #define VTSS_IG(_grp, ...) VTSS_T(_grp, VTSS_TRACE_LEVEL_INFO,  __VA_ARGS__)
 #define VTSS_DG(_grp, ...) VTSS_T(_grp, VTSS_TRACE_LEVEL_DEBUG, __VA_ARGS__)
@@ -0,0 +1,568 @@
+// Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+// SPDX-License-Identifier: MIT
+
+
+#include <stdarg.h>
+#include "vtss_api.h"
+#include "vtss_state.h"
+
+/* ================================================================= *
+ *  Binary trace
+ * ================================================================= */
+
+/* Debug and noise trace points are recorded as (time stamp, layer, group, level, location,
+   format pointer, raw arguments) in a ring buffer owned by the calling thread. The writer
+   never blocks and never takes a lock. Each entry has a sequence number, which is odd while
+   the entry is being written, so the reader can detect entries overwritten while reading.
+   Formatting is deferred to vtss_trace_bin_print(). */
+
+#if VTSS_OPT_TRACE && defined(VTSS_OS_TIMESTAMP_NS) && defined(__GNUC__)
+#define VTSS_TRACE_BIN_SUPPORT
+#endif
+
+BOOL vtss_trace_bin_enable;
+
+#if defined(VTSS_TRACE_BIN_SUPPORT)
+
+#define TRACE_BIN_RING_SIZE 1024 /* Entries per thread, must be a power of two */
+#define TRACE_BIN_ARG_CNT   10   /* Argument words per entry */
+#define TRACE_BIN_SPEC_MAX  32   /* Maximum length of one conversion specification */
+
+typedef struct {
+    u32        seq;       /* Write sequence, odd while the entry is being written */
+    u8         layer;
+    u8         group;
+    u8         level;
+    u8         truncated; /* Arguments did not fit in the entry */
+    u64        time_ns;
+    const char *file;
+    const char *function;
+    const char *format;
+    u32        line;
+    u32        arg_cnt;   /* Number of argument words used */
+    u64        arg[TRACE_BIN_ARG_CNT];
+} trace_bin_entry_t;
+
+typedef struct trace_bin_ring_s {
+    struct trace_bin_ring_s *next;
+    u32                     thread_idx;
+    u32                     wr;   /* Number of entries written, only updated by the owner */
+    u32                     rd;   /* Number of entries consumed, only updated by the reader */
+    trace_bin_entry_t       entry[TRACE_BIN_RING_SIZE];
+} trace_bin_ring_t;
+
+static trace_bin_ring_t *trace_bin_ring_list;
+static u32              trace_bin_thread_cnt;
+static __thread trace_bin_ring_t *trace_bin_ring;
+
+/* Argument type of one conversion specification */
+typedef enum {
+    TRACE_BIN_ARG_NONE,   /* '%%' or '%n' */
+    TRACE_BIN_ARG_INT,
+    TRACE_BIN_ARG_LONG,
+    TRACE_BIN_ARG_LLONG,
+    TRACE_BIN_ARG_SIZE,
+    TRACE_BIN_ARG_PTR,
+    TRACE_BIN_ARG_DOUBLE,
+    TRACE_BIN_ARG_LDOUBLE,
+    TRACE_BIN_ARG_STR
+} trace_bin_arg_t;
+
+typedef struct {
+    const char      *start;    /* The '%' character */
+    u32             len;       /* Length including the conversion character */
+    u32             star_cnt;  /* Number of '*' width/precision arguments */
+    trace_bin_arg_t type;
+} trace_bin_spec_t;
+
+/* Parse conversion specification starting at '%' */
+static void trace_bin_spec_parse(const char *p, trace_bin_spec_t *spec)
+{
+    int lng = 0, size = 0, ldbl = 0;
+
+    spec->start = p++;
+    spec->star_cnt = 0;
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+        p++;
+    }
+    for ( ; (*p >= '0' && *p <= '9') || *p == '.' || *p == '*'; p++) {
+        if (*p == '*') {
+            spec->star_cnt++;
+        }
+    }
+    for ( ; *p == 'h' || *p == 'l' || *p == 'q' || *p == 'j' || *p == 'z' || *p == 't' || *p == 'L'; p++) {
+        if (*p == 'l') {
+            lng++;
+        } else if (*p == 'q' || *p == 'j') {
+            lng = 2;
+        } else if (*p == 'z' || *p == 't') {
+            size = 1;
+        } else if (*p == 'L') {
+            ldbl = 1;
+        }
+    }
+    switch (*p) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+        spec->type = (size ? TRACE_BIN_ARG_SIZE : lng > 1 ? TRACE_BIN_ARG_LLONG : lng ? TRACE_BIN_ARG_LONG : TRACE_BIN_ARG_INT);
+        break;
+    case 'c':
+        spec->type = TRACE_BIN_ARG_INT;
+        break;
+    case 'p':
+        spec->type = TRACE_BIN_ARG_PTR;
+        break;
+    case 's':
+        spec->type = TRACE_BIN_ARG_STR;
+        break;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        spec->type = (ldbl ? TRACE_BIN_ARG_LDOUBLE : TRACE_BIN_ARG_DOUBLE);
+        break;
+    case 'n':
+        /* Not supported, the argument is skipped */
+        spec->type = TRACE_BIN_ARG_PTR;
+        break;
+    default:
+        /* '%%' or unknown conversion */
+        spec->type = TRACE_BIN_ARG_NONE;
+        if (*p == 0) {
+            p--;
+        }
+        break;
+    }
+    spec->len = (p - spec->start + 1);
+}
+
+/* Store arguments in entry */
+static void trace_bin_args_put(trace_bin_entry_t *e, const char *format, va_list args)
+{
+    trace_bin_spec_t spec;
+    const char       *p, *str;
+    u32              i, cnt = 0, len, max;
+    double           dbl;
+    u64              val;
+
+    for (p = format; *p != 0; p++) {
+        if (*p != '%') {
+            continue;
+        }
+        trace_bin_spec_parse(p, &spec);
+        p += (spec.len - 1);
+        if (spec.type == TRACE_BIN_ARG_NONE) {
+            continue;
+        }
+        for (i = 0; i < spec.star_cnt; i++) {
+            val = va_arg(args, int);
+            if (cnt < TRACE_BIN_ARG_CNT) {
+                e->arg[cnt++] = val;
+            }
+        }
+        if (spec.type == TRACE_BIN_ARG_STR) {
+            /* The string is copied, as it may not exist when the entry is printed */
+            if ((str = va_arg(args, const char *)) == NULL) {
+                str = "(null)";
+            }
+            max = ((TRACE_BIN_ARG_CNT - cnt) * sizeof(u64));
+            if (max == 0) {
+                e->truncated = 1;
+                break;
+            }
+            for (len = 0; len < (max - 1) && str[len] != 0; len++) {
+            }
+            memcpy(&e->arg[cnt], str, len);
+            ((char *)&e->arg[cnt])[len] = 0;
+            cnt += ((len + sizeof(u64)) / sizeof(u64));
+            continue;
+        }
+        switch (spec.type) {
+        case TRACE_BIN_ARG_LONG:
+            val = va_arg(args, long);
+            break;
+        case TRACE_BIN_ARG_LLONG:
+            val = va_arg(args, long long);
+            break;
+        case TRACE_BIN_ARG_SIZE:
+            val = va_arg(args, size_t);
+            break;
+        case TRACE_BIN_ARG_PTR:
+            val = (uintptr_t)va_arg(args, void *);
+            break;
+        case TRACE_BIN_ARG_DOUBLE:
+        case TRACE_BIN_ARG_LDOUBLE:
+            dbl = (spec.type == TRACE_BIN_ARG_DOUBLE ? va_arg(args, double) : (double)va_arg(args, long double));
+            memcpy(&val, &dbl, sizeof(val));
+            break;
+        default:
+            val = va_arg(args, int);
+            break;
+        }
+        if (cnt == TRACE_BIN_ARG_CNT) {
+            e->truncated = 1;
+            break;
+        }
+        e->arg[cnt++] = val;
+    }
+    e->arg_cnt = cnt;
+}
+
+static trace_bin_ring_t *trace_bin_ring_alloc(void)
+{
+    trace_bin_ring_t *ring;
+
+    if ((ring = VTSS_OS_MALLOC(sizeof(*ring), VTSS_MEM_FLAGS_NONE)) == NULL) {
+        return NULL;
+    }
+    memset(ring, 0, sizeof(*ring));
+    ring->thread_idx = __atomic_fetch_add(&trace_bin_thread_cnt, 1, __ATOMIC_RELAXED);
+
+    /* Lock-free push on the global list, rings are never freed */
+    ring->next = __atomic_load_n(&trace_bin_ring_list, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&trace_bin_ring_list, &ring->next, ring, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+    }
+    return ring;
+}
+
+static void trace_bin_record(trace_bin_ring_t *ring,
+                             const vtss_trace_layer_t layer,
+                             const vtss_trace_group_t group,
+                             const vtss_trace_level_t level,
+                             const char *file,
+                             const int line,
+                             const char *function,
+                             const char *format,
+                             va_list args)
+{
+    u32               wr = ring->wr;
+    trace_bin_entry_t *e = &ring->entry[wr & (TRACE_BIN_RING_SIZE - 1)];
+
+    __atomic_store_n(&e->seq, 2 * wr + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    e->time_ns = VTSS_OS_TIMESTAMP_NS();
+    e->layer = layer;
+    e->group = group;
+    e->level = level;
+    e->truncated = 0;
+    e->file = file;
+    e->line = line;
+    e->function = function;
+    e->format = format;
+    trace_bin_args_put(e, format, args);
+    __atomic_store_n(&e->seq, 2 * wr + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->wr, wr + 1, __ATOMIC_RELEASE);
+}
+
+void vtss_trace_bin_printf(const vtss_trace_layer_t layer,
+                           const vtss_trace_group_t group,
+                           const vtss_trace_level_t level,
+                           const char *file,
+                           const int line,
+                           const char *function,
+                           const char *format,
+                           ...)
+{
+    trace_bin_ring_t *ring = trace_bin_ring;
+    va_list          args;
+
+    if (ring == NULL && (ring = trace_bin_ring = trace_bin_ring_alloc()) == NULL) {
+        return;
+    }
+    va_start(args, format);
+    trace_bin_record(ring, layer, group, level, file, line, function, format, args);
+    va_end(args);
+}
+
+/* Copy entry 'idx' from ring, returns FALSE if it has been overwritten */
+static BOOL trace_bin_entry_get(trace_bin_ring_t *ring, u32 idx, trace_bin_entry_t *e)
+{
+    trace_bin_entry_t *src = &ring->entry[idx & (TRACE_BIN_RING_SIZE - 1)];
+    u32               seq = (2 * idx + 2);
+
+    if (__atomic_load_n(&src->seq, __ATOMIC_ACQUIRE) != seq) {
+        return FALSE;
+    }
+    memcpy(e, src, sizeof(*e));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return (__atomic_load_n(&src->seq, __ATOMIC_RELAXED) == seq);
+}
+
+/* Format entry using the stored arguments */
+static void trace_bin_format(const trace_bin_entry_t *e, char *buf, u32 size)
+{
+    trace_bin_spec_t spec;
+    const char       *p;
+    char             fmt[TRACE_BIN_SPEC_MAX + 32], *q;
+    u32              i, j, n = 0, cnt = 0;
+    u64              val;
+    double           dbl;
+
+    buf[0] = 0;
+    for (p = e->format; *p != 0 && n < size; p++) {
+        if (*p != '%') {
+            buf[n++] = *p;
+            continue;
+        }
+        trace_bin_spec_parse(p, &spec);
+        p += (spec.len - 1);
+        if (spec.type == TRACE_BIN_ARG_NONE) {
+            if (spec.start[spec.len - 1] == '%') {
+                buf[n++] = '%';
+            }
+            continue;
+        }
+        if ((cnt + spec.star_cnt + (spec.type == TRACE_BIN_ARG_STR ? 0 : 1)) > e->arg_cnt ||
+            (spec.type == TRACE_BIN_ARG_STR && cnt + spec.star_cnt >= e->arg_cnt) ||
+            spec.len > TRACE_BIN_SPEC_MAX) {
+            n += snprintf(buf + n, size - n, "<truncated>");
+            break;
+        }
+
+        /* Build specification with '*' replaced by the stored value and without length modifiers */
+        for (i = 0, q = fmt; i < (spec.len - 1); i++) {
+            if (spec.start[i] == '*') {
+                q += sprintf(q, "%d", (int)e->arg[cnt++]);
+            } else if (strchr("hlqjztL", spec.start[i]) == NULL) {
+                *q++ = spec.start[i];
+            }
+        }
+        if (spec.type == TRACE_BIN_ARG_LONG || spec.type == TRACE_BIN_ARG_LLONG || spec.type == TRACE_BIN_ARG_SIZE) {
+            /* All integers are printed as long long */
+            *q++ = 'l';
+            *q++ = 'l';
+        }
+        *q++ = spec.start[spec.len - 1];
+        *q = 0;
+
+        if (spec.type == TRACE_BIN_ARG_STR) {
+            j = snprintf(buf + n, size - n, fmt, (const char *)&e->arg[cnt]);
+            cnt += ((strlen((const char *)&e->arg[cnt]) + sizeof(u64)) / sizeof(u64));
+        } else {
+            val = e->arg[cnt++];
+            switch (spec.type) {
+            case TRACE_BIN_ARG_LONG:
+            case TRACE_BIN_ARG_LLONG:
+            case TRACE_BIN_ARG_SIZE:
+                j = snprintf(buf + n, size - n, fmt, (long long)val);
+                break;
+            case TRACE_BIN_ARG_PTR:
+                j = snprintf(buf + n, size - n, fmt, (void *)(uintptr_t)val);
+                break;
+            case TRACE_BIN_ARG_DOUBLE:
+            case TRACE_BIN_ARG_LDOUBLE:
+                memcpy(&dbl, &val, sizeof(dbl));
+                j = snprintf(buf + n, size - n, fmt, dbl);
+                break;
+            default:
+                j = snprintf(buf + n, size - n, fmt, (int)val);
+                break;
+            }
+        }
+        n += j;
+    }
+    if (n >= size) {
+        n = (size - 1);
+    }
+    buf[n] = 0;
+    if (e->truncated && n < (size - 12)) {
+        strcpy(buf + n, "<truncated>");
+    }
+}
+
+#elif VTSS_OPT_TRACE
+
+/* Binary trace can not be enabled */
+void vtss_trace_bin_printf(const vtss_trace_layer_t layer,
+                           const vtss_trace_group_t group,
+                           const vtss_trace_level_t level,
+                           const char *file,
+                           const int line,
+                           const char *function,
+                           const char *format,
+                           ...)
+{
+}
+#endif /* VTSS_TRACE_BIN_SUPPORT */
+
+vtss_rc vtss_trace_bin_conf_get(vtss_trace_bin_conf_t *const conf)
+{
+    conf->enable = vtss_trace_bin_enable;
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_trace_bin_conf_set(const vtss_trace_bin_conf_t *const conf)
+{
+#if defined(VTSS_TRACE_BIN_SUPPORT)
+    vtss_trace_bin_enable = conf->enable;
+    return VTSS_RC_OK;
+#else
+    return (conf->enable ? VTSS_RC_ERROR : VTSS_RC_OK);
+#endif
+}
+
+#if defined(VTSS_TRACE_BIN_SUPPORT)
+static void trace_bin_bench_record(trace_bin_ring_t *ring, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    trace_bin_record(ring, VTSS_TRACE_LAYER_AIL, VTSS_TRACE_GROUP_DEFAULT, VTSS_TRACE_LEVEL_DEBUG,
+                     __FILE__, __LINE__, __FUNCTION__, format, args);
+    va_end(args);
+}
+
+static void trace_bin_bench_vsnprintf(char *buf, u32 size, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    (void)vsnprintf(buf, size, format, args);
+    va_end(args);
+}
+#endif /* VTSS_TRACE_BIN_SUPPORT */
+
+vtss_rc vtss_trace_bin_bench(const u32 cnt, vtss_trace_bin_bench_t *const bench)
+{
+#if defined(VTSS_TRACE_BIN_SUPPORT)
+    trace_bin_ring_t *ring;
+    u64              start, bin_ns, printf_ns;
+    u32              i;
+    char             buf[256];
+    const char       *fmt = "port_no: %u, chip_port: %d, addr: 0x%08x, name: %s";
+
+    if (cnt == 0 || (ring = VTSS_OS_MALLOC(sizeof(*ring), VTSS_MEM_FLAGS_NONE)) == NULL) {
+        return VTSS_RC_ERROR;
+    }
+    memset(ring, 0, sizeof(*ring));
+    start = VTSS_OS_TIMESTAMP_NS();
+    for (i = 0; i < cnt; i++) {
+        trace_bin_bench_record(ring, fmt, i, i + 1, i * 4, "bench");
+    }
+    bin_ns = (VTSS_OS_TIMESTAMP_NS() - start);
+    start = VTSS_OS_TIMESTAMP_NS();
+    for (i = 0; i < cnt; i++) {
+        trace_bin_bench_vsnprintf(buf, sizeof(buf), fmt, i, i + 1, i * 4, "bench");
+    }
+    printf_ns = (VTSS_OS_TIMESTAMP_NS() - start);
+    VTSS_OS_FREE(ring, VTSS_MEM_FLAGS_NONE);
+    bench->cnt = cnt;
+    bench->bin_ns = VTSS_DIV64(bin_ns, cnt);
+    bench->printf_ns = VTSS_DIV64(printf_ns, cnt);
+    return VTSS_RC_OK;
+#else
+    return VTSS_RC_ERROR;
+#endif
+}
+
+#if VTSS_OPT_DEBUG_PRINT
+vtss_rc vtss_trace_bin_print(const vtss_debug_printf_t pr, const BOOL clear)
+{
+#if defined(VTSS_TRACE_BIN_SUPPORT)
+    trace_bin_ring_t  *first, *ring, *ring_min, **rings;
+    trace_bin_entry_t *head, *e;
+    u32               i, cnt = 0, idx_min, wr, *rd, *lost;
+    char              buf[256];
+
+    /* Count rings. Rings are added first in the list, so rings added while printing are ignored */
+    first = __atomic_load_n(&trace_bin_ring_list, __ATOMIC_ACQUIRE);
+    for (ring = first; ring != NULL; ring = ring->next) {
+        cnt++;
+    }
+    if (cnt == 0) {
+        return VTSS_RC_OK;
+    }
+    if ((head = VTSS_OS_MALLOC(cnt * (sizeof(*head) + sizeof(*rings) + 2 * sizeof(u32)), VTSS_MEM_FLAGS_NONE)) == NULL) {
+        return VTSS_RC_ERROR;
+    }
+    rings = (trace_bin_ring_t **)&head[cnt];
+    rd = (u32 *)&rings[cnt];
+    lost = &rd[cnt];
+
+    /* Snapshot the rings, so all passes below use the same ring for each index */
+    for (i = 0, ring = first; i < cnt; i++, ring = ring->next) {
+        rings[i] = ring;
+    }
+
+    /* Load the oldest entry of each ring. The head time stamp is zero if the ring is empty */
+    for (i = 0; i < cnt; i++) {
+        ring = rings[i];
+        wr = __atomic_load_n(&ring->wr, __ATOMIC_ACQUIRE);
+        rd[i] = ring->rd;
+        lost[i] = 0;
+        if ((wr - rd[i]) > TRACE_BIN_RING_SIZE) {
+            lost[i] = (wr - rd[i] - TRACE_BIN_RING_SIZE);
+            rd[i] = (wr - TRACE_BIN_RING_SIZE);
+        }
+        head[i].time_ns = 0;
+        while (rd[i] != wr) {
+            if (trace_bin_entry_get(ring, rd[i], &head[i])) {
+                break;
+            }
+            lost[i]++;
+            rd[i]++;
+            head[i].time_ns = 0;
+        }
+    }
+
+    /* Print entries in time stamp order */
+    while (1) {
+        ring_min = NULL;
+        idx_min = 0;
+        for (i = 0; i < cnt; i++) {
+            ring = rings[i];
+            if (rd[i] != __atomic_load_n(&ring->wr, __ATOMIC_ACQUIRE) && head[i].time_ns != 0 &&
+                (ring_min == NULL || head[i].time_ns < head[idx_min].time_ns)) {
+                ring_min = ring;
+                idx_min = i;
+            }
+        }
+        if (ring_min == NULL) {
+            break;
+        }
+        e = &head[idx_min];
+        trace_bin_format(e, buf, sizeof(buf));
+        pr("%u.%09u T%u %s/%u/%s %s(%u): %s\n",
+           (u32)VTSS_DIV64(e->time_ns, 1000000000), (u32)VTSS_MOD64(e->time_ns, 1000000000),
+           ring_min->thread_idx,
+           e->layer == VTSS_TRACE_LAYER_AIL ? "ail" : "cil",
+           e->group,
+           e->level == VTSS_TRACE_LEVEL_DEBUG ? "debug" : "noise",
+           e->function, e->line, buf);
+
+        /* Load next entry */
+        e->time_ns = 0;
+        wr = __atomic_load_n(&ring_min->wr, __ATOMIC_ACQUIRE);
+        for (rd[idx_min]++; rd[idx_min] != wr; rd[idx_min]++) {
+            if (trace_bin_entry_get(ring_min, rd[idx_min], e)) {
+                break;
+            }
+            lost[idx_min]++;
+            e->time_ns = 0;
+        }
+    }
+
+    for (i = 0; i < cnt; i++) {
+        ring = rings[i];
+        if (lost[i]) {
+            pr("T%u: %u entries lost\n", ring->thread_idx, lost[i]);
+        }
+        if (clear) {
+            ring->rd = rd[i];
+        }
+    }
+    VTSS_OS_FREE(head, VTSS_MEM_FLAGS_NONE);
+    return VTSS_RC_OK;
+#else
+    return VTSS_RC_ERROR;
+#endif
+}
+#endif /* VTSS_OPT_DEBUG_PRINT */
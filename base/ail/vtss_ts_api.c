@@ -918,7 +918,7 @@ vtss_rc vtss_ts_internal_mode_get(const vtss_inst_t              inst,
 }
 
 /* Flush the timestamp FIFO  */
-static void vtss_timestamp_flush(vtss_state_t *vtss_state)
+void vtss_timestamp_flush(vtss_state_t *vtss_state)
 {
     int     id;
     (void) VTSS_FUNC_0(ts.timestamp_get);
@@ -930,59 +930,93 @@ static void vtss_timestamp_flush(vtss_state_t *vtss_state)
         vtss_state->ts.status[id].age = 0;
         (void) VTSS_FUNC(ts.timestamp_id_release, id);
     }
+    vtss_state->ts.active_mask = 0LL;
 }
                                    
 
+/* Deliver timestamp callbacks, must be called outside the API lock */
+static void vtss_ts_cb_deliver(vtss_ts_cb_entry_t *entry, u32 cnt)
+{
+    u32 i;
+
+    for (i = 0; i < cnt; i++) {
+        entry[i].cb(entry[i].context, entry[i].port_no, &entry[i].ts);
+    }
+}
+
 /* Update the internal timestamp table, from HW */
 vtss_rc vtss_tx_timestamp_update(const vtss_inst_t              inst)
 {
-    vtss_state_t *vtss_state;
-    vtss_rc rc;
-    u64 port_mask;
-    vtss_ts_timestamp_t ts;
-    vtss_state_t *my_vtss_state;
-    int port_idx = 0;
-    int ts_idx = 0;
-    void (*cb)(void *context, u32 port_no, vtss_ts_timestamp_t *ts);
-    void *cx;
+    vtss_state_t               *vtss_state;
+    vtss_rc                    rc;
+    vtss_ts_timestamp_status_t *status;
+    vtss_ts_tx_cnt_t           *cnt;
+    vtss_ts_cb_entry_t         entry[VTSS_TS_CB_BATCH], *e;
+    u64                        port_mask;
+    u32                        ts_idx, port_idx, entry_cnt, drain_cnt = 0;
+    BOOL                       more = TRUE;
 
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
-        rc = VTSS_FUNC_0(ts.timestamp_get);
-        VTSS_D("rc = %d", rc);
-        while ((port_idx < VTSS_PORT_ARRAY_SIZE) && (ts_idx < TS_IDS_RESERVED_FOR_SW)) {
-            if (vtss_state->ts.status[ts_idx].valid_mask != 0) {   /* We just check if any TS on this TS index */
-                port_mask = 1LL<<port_idx;
-                if ((vtss_state->ts.status[ts_idx].valid_mask & port_mask) && (vtss_state->ts.status[ts_idx].reserved_mask & port_mask)) {  /* There is a TS and this TS index is reserved */
-                    vtss_state->ts.status[ts_idx].valid_mask &= ~port_mask;
-                    vtss_state->ts.status[ts_idx].reserved_mask &= ~port_mask;
-                    ts.id = vtss_state->ts.status[ts_idx].tx_id[port_idx];
-                    ts.ts = vtss_state->ts.status[ts_idx].tx_tc[port_idx];
-                    ts.ts_valid = TRUE;
-                    if (vtss_state->ts.status[ts_idx].cb[port_idx] && vtss_state->ts.status[ts_idx].context[port_idx]) {
-                        my_vtss_state = vtss_state; /* save context */
-                        /* avoid using vtss_state while outside the API lock, as the API may be called from an other thread */
-                        cb = vtss_state->ts.status[ts_idx].cb[port_idx];
-                        cx = vtss_state->ts.status[ts_idx].context[port_idx];
-                        vtss_state->ts.status[ts_idx].cb[port_idx] = NULL;
-                        vtss_state->ts.status[ts_idx].context[port_idx] = NULL;
-                        VTSS_EXIT();
-                        /* call out of the API */
-                        cb(cx, port_idx, &ts);
-                        VTSS_ENTER();
-                        vtss_state = my_vtss_state; /* restore context */
-                    } else {
-                        VTSS_E("undefined TS callback port_idx %d, ts_idx %d", port_idx, ts_idx);
+        while (more) {
+            /* The CIL stops draining the HW FIFO when its budget is used. The remaining
+               timestamps are read after delivering the callbacks and releasing the API
+               lock, up to VTSS_TS_DRAIN_MAX drains. The rest is left for the next call. */
+            rc = VTSS_FUNC_0(ts.timestamp_get);
+            VTSS_D("rc = %d", rc);
+            more = (rc == VTSS_RC_INCOMPLETE && ++drain_cnt < VTSS_TS_DRAIN_MAX);
+            if (rc == VTSS_RC_INCOMPLETE) {
+                rc = VTSS_RC_OK;
+            }
+            do {
+                /* Collect a batch of callbacks, the table entries are released while holding the API lock */
+                entry_cnt = 0;
+                for (ts_idx = 0; ts_idx < TS_IDS_RESERVED_FOR_SW && entry_cnt < VTSS_TS_CB_BATCH; ts_idx++) {
+                    status = &vtss_state->ts.status[ts_idx];
+                    /* Only visit the ports with a TS on this reserved TS index */
+                    port_mask = status->valid_mask & status->reserved_mask;
+                    while (port_mask != 0 && entry_cnt < VTSS_TS_CB_BATCH) {
+                        port_idx = VTSS_OS_CTZ64(port_mask);
+                        port_mask &= ~(1LL<<port_idx);
+                        status->valid_mask &= ~(1LL<<port_idx);
+                        status->reserved_mask &= ~(1LL<<port_idx);
+                        if (port_idx >= VTSS_PORT_ARRAY_SIZE) {
+                            continue;
+                        }
+                        e = &entry[entry_cnt];
+                        e->ts.id = status->tx_id[port_idx];
+                        e->ts.ts = status->tx_tc[port_idx];
+                        e->ts.ts_valid = TRUE;
+                        cnt = &vtss_state->ts.tx_cnt[port_idx];
+                        cnt->tx_cnt++;
+#if defined(VTSS_OS_TIMESTAMP_NS)
+                        /* Measured from the id allocation, the injection time is not known here */
+                        cnt->latency_last = (u32)((VTSS_OS_TIMESTAMP_NS() - status->alloc_ns) / 1000);
+                        if (cnt->latency_last > cnt->latency_max) {
+                            cnt->latency_max = cnt->latency_last;
+                        }
+#endif
+                        if (status->cb[port_idx] && status->context[port_idx]) {
+                            /* avoid using vtss_state while outside the API lock, as the API may be called from an other thread */
+                            e->cb = status->cb[port_idx];
+                            e->context = status->context[port_idx];
+                            e->port_no = port_idx;
+                            status->cb[port_idx] = NULL;
+                            status->context[port_idx] = NULL;
+                            entry_cnt++;
+                        } else {
+                            VTSS_E("undefined TS callback port_idx %u, ts_idx %u", port_idx, ts_idx);
+                        }
+                        VTSS_D("port_no %u, ts_id %u, ts %" PRIu64 "(%d)", port_idx, e->ts.id, e->ts.ts, e->ts.ts_valid);
                     }
-                    VTSS_D("port_no %d, ts_id %d, ts %" PRIu64 "(%d)", port_idx, ts.id, ts.ts, ts.ts_valid);
                 }
-            } else {
-                port_idx = VTSS_PORT_ARRAY_SIZE;    /* No TS on this TS index - skip all ports */
-            }
-            if (++port_idx >= VTSS_PORT_ARRAY_SIZE) {
-                port_idx = 0;
-                ++ts_idx;
-            }
+                if (entry_cnt != 0 || more) {
+                    VTSS_EXIT();
+                    /* call out of the API */
+                    vtss_ts_cb_deliver(entry, entry_cnt);
+                    VTSS_ENTER();
+                }
+            } while (entry_cnt == VTSS_TS_CB_BATCH);
         }
     }
     VTSS_EXIT();
@@ -999,6 +1033,10 @@ vtss_rc _vtss_rx_timestamp_get(const vtss_inst_t              inst,
 
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
         rc = VTSS_FUNC_0(ts.timestamp_get);
+        if (rc == VTSS_RC_INCOMPLETE) {
+            /* FIFO drain budget used, the remaining entries are read by vtss_tx_timestamp_update() */
+            rc = VTSS_RC_OK;
+        }
         if (ts_id->ts_id >= VTSS_TS_ID_SIZE) {
             /* invalid timestamp id indicates FIFO overflow */
             vtss_timestamp_flush(vtss_state);
@@ -1110,6 +1148,10 @@ vtss_rc vtss_tx_timestamp_idx_alloc(const vtss_inst_t          inst,
                     }
                 }
                 vtss_state->ts.status[id].age = 0;
+#if defined(VTSS_OS_TIMESTAMP_NS)
+                vtss_state->ts.status[id].alloc_ns = VTSS_OS_TIMESTAMP_NS();
+#endif
+                vtss_state->ts.active_mask |= 1LL<<id;
                 ts_id->ts_id = id;
                 VTSS_I("portmask = %" PRIx64 ", reserved_mask = %" PRIx64 " id = %u", alloc_parm->port_mask, vtss_state->ts.status[id].reserved_mask, ts_id->ts_id);
                 rc = VTSS_RC_OK;
@@ -1127,14 +1169,12 @@ vtss_rc vtss_tx_timestamp_idx_alloc(const vtss_inst_t          inst,
 /* Age the FIFO timestamps */
 vtss_rc vtss_timestamp_age(const vtss_inst_t              inst)
 {
-    vtss_state_t *vtss_state;
-    int id;
-    u64 port_mask;
-    vtss_ts_timestamp_t ts;
-    vtss_state_t *my_vtss_state;
-    vtss_rc rc;
-    void (*cb)(void *context, u32 port_no, vtss_ts_timestamp_t *ts);
-    void *cx;
+    vtss_state_t               *vtss_state;
+    vtss_ts_timestamp_status_t *status;
+    vtss_ts_cb_entry_t         entry[VTSS_TS_CB_BATCH], *e;
+    vtss_rc                    rc;
+    u64                        id_mask, port_mask;
+    u32                        id, port_idx, max_age, entry_cnt = 0;
 
 #if defined(VTSS_MISSING_TX_TIMESTAMP_INTERRUPT)
     // Luton26 does not generate tx timestamp interrupt, so first check if
@@ -1148,12 +1188,20 @@ vtss_rc vtss_timestamp_age(const vtss_inst_t              inst)
         goto do_exit;
     }
 
-    for (id = 0; id < VTSS_TS_ID_SIZE; id++) {
-       vtss_ts_timestamp_status_t *status = &vtss_state->ts.status[id];
-       u32                        max_age;
-       int                        port_idx;
+    // Only visit the timestamp ids which have been allocated or have
+    // received an Rx timestamp since they were last released
+    id_mask = vtss_state->ts.active_mask;
+    while (id_mask != 0) {
+        id = VTSS_OS_CTZ64(id_mask);
+        id_mask &= ~(1LL << id);
+        if (id >= VTSS_TS_ID_SIZE) {
+            break;
+        }
+        status = &vtss_state->ts.status[id];
 
         if (status->reserved_mask == 0LL && !status->rx_tc_valid) {
+            // Released by the API
+            vtss_state->ts.active_mask &= ~(1LL << id);
             continue;
         }
 
@@ -1167,50 +1215,60 @@ vtss_rc vtss_timestamp_age(const vtss_inst_t              inst)
             continue;
         }
 
-        VTSS_D("Aging timestamp ts_id = %d, reserved_mask = %" PRIx64 "", id, status->reserved_mask);
-        port_idx = 0;
-
-        while (status->reserved_mask && port_idx < VTSS_PORT_ARRAY_SIZE) {
-            port_mask = 1LL << port_idx;
-
-            if ((status->reserved_mask & port_mask)) {
-                status->reserved_mask &= ~port_mask;
-                ts.id = id;
-                ts.ts = 0;
-                ts.ts_valid = FALSE;
-                if (status->cb[port_idx] && status->context[port_idx]) {
-                    // Avoid using vtss_state while outside the API lock, as the
-                    // API may be called from an other thread
-                    my_vtss_state = vtss_state;
-                    cb = status->cb[port_idx];
-                    cx = status->context[port_idx];
-                    status->cb[port_idx] = NULL;
-                    status->context[port_idx] = NULL;
+        VTSS_D("Aging timestamp ts_id = %u, reserved_mask = %" PRIx64 "", id, status->reserved_mask);
+        port_mask = status->reserved_mask;
+
+        while (port_mask != 0) {
+            port_idx = VTSS_OS_CTZ64(port_mask);
+            port_mask &= ~(1LL << port_idx);
+            if (port_idx >= VTSS_PORT_ARRAY_SIZE) {
+                break;
+            }
+            vtss_state->ts.tx_cnt[port_idx].timeout_cnt++;
+            if (status->cb[port_idx] && status->context[port_idx]) {
+                if (entry_cnt == VTSS_TS_CB_BATCH) {
+                    // Batch full, call out of the API to indicate timeout
                     VTSS_EXIT();
-                    // Call out of the API, to indicate timeout
-                    cb(cx, port_idx, &ts);
+                    vtss_ts_cb_deliver(entry, entry_cnt);
                     VTSS_ENTER();
-                    vtss_state = my_vtss_state; /* restore context */
-                } else {
-                    VTSS_D("Undefined TS callback port_idx %d, ts_idx %d", port_idx, id);
+                    entry_cnt = 0;
                 }
-
-                VTSS_D("port_no %d, ts_id %d, ts %" PRIu64 "(%d)", port_idx, ts.id, ts.ts, ts.ts_valid);
+                // Avoid using vtss_state while outside the API lock, as the
+                // API may be called from an other thread
+                e = &entry[entry_cnt++];
+                e->cb = status->cb[port_idx];
+                e->context = status->context[port_idx];
+                e->port_no = port_idx;
+                e->ts.id = id;
+                e->ts.ts = 0;
+                e->ts.ts_valid = FALSE;
+                status->cb[port_idx] = NULL;
+                status->context[port_idx] = NULL;
+            } else {
+                VTSS_D("Undefined TS callback port_idx %u, ts_idx %u", port_idx, id);
             }
 
-            port_idx++;
+            VTSS_D("port_no %u, ts_id %u timed out", port_idx, id);
         }
 
         status->reserved_mask = 0LL;
         status->valid_mask    = 0LL;
         status->rx_tc_valid   = FALSE;
         status->age           = 0;
+        vtss_state->ts.active_mask &= ~(1LL << id);
 
         if ((rc = VTSS_FUNC(ts.timestamp_id_release, id)) != VTSS_RC_OK) {
-            goto do_exit;
+            break;
         }
     }
 
+    if (entry_cnt != 0) {
+        // Call out of the API, to indicate timeout
+        VTSS_EXIT();
+        vtss_ts_cb_deliver(entry, entry_cnt);
+        VTSS_ENTER();
+    }
+
 do_exit:
     VTSS_EXIT();
     return rc;
@@ -1348,6 +1406,14 @@ vtss_rc vtss_ts_inst_create(vtss_state_t *vtss_state)
     return VTSS_RC_OK;
 }
 
+/* Adopt the state of a previous application. The Tx timestamp callbacks and
+   contexts belong to the previous process, so the timestamp table is discarded */
+void vtss_ts_inst_adopt(vtss_state_t *vtss_state)
+{
+    VTSS_MEMSET(vtss_state->ts.status, 0, sizeof(vtss_state->ts.status));
+    vtss_state->ts.active_mask = 0LL;
+}
+
 
 #if VTSS_OPT_DEBUG_PRINT
 
@@ -1398,8 +1464,20 @@ void vtss_ts_debug_print(vtss_state_t *vtss_state,
            VTSS_INTERVAL_NS(ts_port_conf->egress_latency),
            ts_port_conf->mode.mode);
     }
-    
-    
+    pr("\nTx timestamp delivery (latency in us from id allocation):\n");
+    pr("Port  Delivered   Aged        LatencyLast  LatencyMax  FifoOverflow\n");
+    for (i = 0; i < VTSS_PORT_ARRAY_SIZE; i++) {
+        vtss_ts_tx_cnt_t *cnt = &vtss_state->ts.tx_cnt[i];
+        if (cnt->tx_cnt == 0 && cnt->timeout_cnt == 0 && cnt->ovfl_cnt == 0) {
+            continue;
+        }
+        pr("%-4u  %-10u  %-10u  %-11u  %-10u  %u\n",
+           i, cnt->tx_cnt, cnt->timeout_cnt, cnt->latency_last, cnt->latency_max, cnt->ovfl_cnt);
+    }
+    pr("Active timestamp ids: 0x%" PRIx64 "\n", vtss_state->ts.active_mask);
+    pr("Timestamp FIFO: overflows %u, budget stops %u, max drained %u\n\n",
+       vtss_state->ts.fifo_cnt.ovfl_cnt, vtss_state->ts.fifo_cnt.budget_cnt, vtss_state->ts.fifo_cnt.drain_max);
+
     (void)VTSS_FUNC_0(ts.timestamp_get);
     pr("Timestamp fifo data:\n");
     
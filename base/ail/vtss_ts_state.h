@@ -65,6 +65,7 @@ typedef struct {
     u64 reserved_mask;                      /* port mask indicating which ports this tx idx is reserved for */
     u64 valid_mask;                         /* indication pr. port if there is a valid timestamp in the table  */
     u32 age;                                /* ageing counter */
+    u64 alloc_ns;                           /* monotonic time of the Tx id allocation in ns, for the delivery latency */
     u64 tx_tc [VTSS_PORT_ARRAY_SIZE];       /* actual transmit time counter for the [idx][port] */
     u32 tx_id [VTSS_PORT_ARRAY_SIZE];       /* actual transmit time stamp id read from HW [idx][port] */
     u32 tx_sq [VTSS_PORT_ARRAY_SIZE];       /* actual transmit sequence number read from HW [idx][port] (Serval)*/
@@ -74,6 +75,38 @@ typedef struct {
     void (*cb  [VTSS_PORT_ARRAY_SIZE]) (void *context, u32 port_no, vtss_ts_timestamp_t *ts); /* timestamp callback functions */
 } vtss_ts_timestamp_status_t;
 
+/* Max number of timestamp callbacks delivered pr. API lock release */
+#define VTSS_TS_CB_BATCH 16
+
+/* Max number of FIFO drains pr. vtss_tx_timestamp_update() call, each drain is bounded by the CIL budget */
+#define VTSS_TS_DRAIN_MAX 8
+
+/* Timestamp callback to be delivered outside the API lock */
+typedef struct {
+    void (*cb)(void *context, u32 port_no, vtss_ts_timestamp_t *ts); /* Callback function */
+    void                *context;           /* Callback context */
+    u32                 port_no;            /* Port number */
+    vtss_ts_timestamp_t ts;                 /* Timestamp */
+} vtss_ts_cb_entry_t;
+
+/* Tx timestamp delivery counters pr. port.
+   The latency starts when the application allocates the timestamp id, not when the frame is injected,
+   so it includes the time the application takes to send the frame. */
+typedef struct {
+    u32 tx_cnt;                             /* Number of delivered Tx timestamps */
+    u32 timeout_cnt;                        /* Number of aged Tx timestamps */
+    u32 latency_last;                       /* Microseconds from id allocation to delivery, last timestamp */
+    u32 latency_max;                        /* Microseconds from id allocation to delivery, maximum */
+    u32 ovfl_cnt;                           /* Number of timestamp FIFO overflows seen on this port */
+} vtss_ts_tx_cnt_t;
+
+/* Timestamp FIFO drain counters */
+typedef struct {
+    u32 ovfl_cnt;                           /* Number of FIFO overflows */
+    u32 budget_cnt;                         /* Number of drains stopped by the budget */
+    u32 drain_max;                          /* Max number of timestamps read in one drain */
+} vtss_ts_fifo_cnt_t;
+
 #if defined (VTSS_ARCH_OCELOT)
 /* Serval OAM timestamp table structure
  * When an OAM timestamp is registered in HW, it is saved in this table
@@ -199,6 +232,9 @@ typedef struct {
     vtss_ts_internal_mode_t     int_mode;
     vtss_ts_port_conf_t         port_conf[VTSS_PORT_ARRAY_SIZE];
     vtss_ts_timestamp_status_t  status[VTSS_TS_ID_SIZE];
+    u64                         active_mask;                    /* Timestamp ids which may need ageing */
+    vtss_ts_tx_cnt_t            tx_cnt[VTSS_PORT_ARRAY_SIZE];   /* Tx timestamp delivery counters */
+    vtss_ts_fifo_cnt_t          fifo_cnt;                       /* Timestamp FIFO drain counters */
 #if defined (VTSS_ARCH_OCELOT) && defined (VTSS_FEATURE_VOP)
     vtss_oam_timestamp_status_t oam_ts_status[VTSS_VOE_ID_SIZE];
 #endif /* VTSS_ARCH_OCELOT && VTSS_FEATURE_VOP */
@@ -231,6 +267,8 @@ vtss_rc _vtss_rx_timestamp_id_release(const vtss_inst_t              inst,
                                      const vtss_ts_id_t             *const ts_id);
 
 vtss_rc vtss_ts_inst_create(struct vtss_state_s *vtss_state);
+void vtss_ts_inst_adopt(struct vtss_state_s *vtss_state);
+void vtss_timestamp_flush(struct vtss_state_s *vtss_state);
 
 #if VTSS_OPT_DEBUG_PRINT
 void vtss_ts_debug_print(struct vtss_state_s *vtss_state,
@@ -5,14 +5,16 @@
 #ifndef _VTSS_TUPE_STATE_H_
 #define _VTSS_TUPE_STATE_H_
 
-#if defined (VTSS_FEATURE_MPLS)
-
-#if defined(VTSS_ARCH_JAGUAR_2)
+#if defined(VTSS_FEATURE_HW_PROT) || defined(VTSS_FEATURE_TUPE)
 
 /*-------------------------------------------------------------
  * CIL Function Pointers, State Variables
  *-----------------------------------------------------------*/
 
+/* The free value bitmaps are kept in the state, so they are kept in a persistent state region */
+#define VTSS_TUPE_VALS_FREE_SIZE     ((1 << 16) / 32) /* Up to 16 bits for linear protection values */
+#define VTSS_AFI_TUPE_VALS_FREE_SIZE ((1 << 8) / 32)  /* 8 bits for AFI TUPE values */
+
 typedef struct {
     /* Number of bits used for TUPE values (linear protection) and
      * TUPE bitmask values (ring protection) */
@@ -24,15 +26,26 @@ typedef struct {
 
     /* Free TUPE values (for linear protection) */
     u32 tupe_vals_next;
-    u32 *tupe_vals_free;
+    u32 tupe_vals_free[VTSS_TUPE_VALS_FREE_SIZE];
 
     /* Free AFI TUPE values */
     u32 afi_tupe_vals_next;
-    u32 *afi_tupe_vals_free;
+    u32 afi_tupe_vals_free[VTSS_AFI_TUPE_VALS_FREE_SIZE];
+
+#if defined(VTSS_FEATURE_TUPE)
+    /* VLAN table shadow, used to check if a protection switch can be done by one TUPE command */
+    u8  vlan_member[VTSS_VIDS][VTSS_PORT_BF_SIZE]; /* Port mask written to the VLAN table */
+    u32 vlan_val[VTSS_VIDS];                       /* TUPE value of VLAN, zero if none */
+
+    /* TUPE values allocated for protection */
+#if defined(VTSS_FEATURE_L2_ERPS)
+    u32 erps_val[VTSS_ERPIS];                      /* Ring protection bit per ERPS instance */
+#endif
+    u32 eps_val[VTSS_PORT_ARRAY_SIZE];             /* Linear protection value per working port */
+    u32 sweep_cnt;                                 /* Protection switches done by TUPE */
+#endif /* VTSS_FEATURE_TUPE */
 } vtss_tupe_state_t;
 
-#endif /* VTSS_ARCH_JAGUAR_2 */
-
-#endif /* VTSS_FEATURE_MPLS */
+#endif /* VTSS_FEATURE_HW_PROT || VTSS_FEATURE_TUPE */
 
-#endif /* _VTSS_MPLS_STATE_H_ */
+#endif /* _VTSS_TUPE_STATE_H_ */
@@ -38,8 +38,18 @@ typedef struct {
     vtss_oam_voe_internal_counters_t counters;       /* Chip counters for a VOE */
     u32                              tx_next_lbm_transaction_id;
     u32                              rx_lbr_transaction_id;
+#if defined(VTSS_ARCH_SPARX5)
+    u16                              poll_period;    /* Counter poll period in seconds, zero if not scheduled */
+    u16                              poll_next;      /* Next VOE in the same poll wheel slot */
+    u16                              poll_prev;      /* Previous VOE in the same poll wheel slot */
+    u32                              poll_deadline;  /* Poll tick where the counters must be read */
+#endif
 } vtss_voe_internal_t;
 
+#if defined(VTSS_ARCH_SPARX5)
+#define VTSS_VOE_POLL_WHEEL 512 /* One second slots, must exceed the longest poll period */
+#endif
+
 typedef struct {
     BOOL                   allocated;
     vtss_port_no_t         port;
@@ -117,6 +127,12 @@ typedef struct {
     /* Internal */
     vtss_voe_internal_t   voe_internal[VTSS_VOE_CNT];
     vtss_voe_idx_t        voe_poll_idx;
+#if defined(VTSS_ARCH_SPARX5)
+    u32                   voe_poll_tick;                        /* Number of one second polls */
+    u32                   voe_poll_load;                        /* Sum of VOE poll rates in 1/65536 VOEs pr. second */
+    u32                   voe_poll_max;                         /* Max number of VOEs read in one poll */
+    u16                   voe_poll_wheel[VTSS_VOE_POLL_WHEEL];  /* First VOE due in each slot */
+#endif
 } vtss_oam_state_t;
 
 vtss_rc vtss_oam_inst_create(struct vtss_state_s *vtss_state);
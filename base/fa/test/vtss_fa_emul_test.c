@@ -0,0 +1,409 @@
+// Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+// SPDX-License-Identifier: MIT
+
+/* Tests running against the FA register emulation (VTSS_OPT_EMUL).
+   Built by the BUILD_FA_EMUL_TEST option and run by ctest. */
+
+#define VTSS_TRACE_GROUP VTSS_TRACE_GROUP_EMUL
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "../vtss_fa_cil.h"
+#include "../vtss_fa_tupe.h"
+
+#if !defined(VTSS_OPT_EMUL)
+#error "The FA emulation tests must be built with VTSS_OPT_EMUL"
+#endif
+
+/* Ports with special roles in the tests */
+#define EMUL_PORT_UNUSED_0 5  /* Not mapped to a chip port */
+#define EMUL_PORT_UNUSED_1 6  /* Not mapped to a chip port */
+#define EMUL_PORT_WORKING  1  /* Protection working port */
+#define EMUL_PORT_PROTECT  2  /* Protection port */
+#define EMUL_PORT_OTHER    3  /* Other VLAN member port */
+#define EMUL_PORT_EPS_W    0  /* EPS working port */
+#define EMUL_PORT_EPS_P    4  /* EPS protection port */
+
+static vtss_trace_level_t emul_trace_level = VTSS_TRACE_LEVEL_ERROR;
+static u32                emul_test_errors;
+
+#define EMUL_CHECK(expr, ...) do { if (!(expr)) { emul_test_errors++; printf("%s:%d: ", __FUNCTION__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+/* - Callouts ------------------------------------------------------ */
+
+void vtss_callout_trace_printf(const vtss_trace_layer_t layer,
+                               const vtss_trace_group_t group,
+                               const vtss_trace_level_t level,
+                               const char               *file,
+                               const int                line,
+                               const char               *function,
+                               const char               *format,
+                               ...)
+{
+    va_list args;
+
+    if (level > emul_trace_level) {
+        return;
+    }
+    printf("%s(%u): ", function, line);
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+}
+
+void vtss_callout_trace_hex_dump(const vtss_trace_layer_t layer,
+                                 const vtss_trace_group_t group,
+                                 const vtss_trace_level_t level,
+                                 const char               *file,
+                                 const int                line,
+                                 const char               *function,
+                                 const unsigned char      *byte_p,
+                                 const int                byte_cnt)
+{
+}
+
+void vtss_callout_lock(const vtss_api_lock_t *const lock)
+{
+}
+
+void vtss_callout_unlock(const vtss_api_lock_t *const lock)
+{
+}
+
+/* - Instance ------------------------------------------------------ */
+
+static vtss_rc emul_inst_create(vtss_state_t **inst)
+{
+    vtss_inst_create_t create;
+    vtss_init_conf_t   conf;
+    vtss_port_map_t    map[VTSS_PORT_ARRAY_SIZE];
+    vtss_port_no_t     port_no;
+
+    VTSS_RC(vtss_inst_get(VTSS_TARGET_7558TSN, &create));
+    VTSS_RC(vtss_inst_create(&create, inst));
+    VTSS_RC(vtss_init_conf_get(*inst, &conf));
+
+    /* No register access functions, the emulation is used */
+    conf.reg_read = NULL;
+    conf.reg_write = NULL;
+    VTSS_RC(vtss_init_conf_set(*inst, &conf));
+
+    /* One 1G port per chip port, except for a few unused ports */
+    memset(map, 0, sizeof(map));
+    for (port_no = VTSS_PORT_NO_START; port_no < VTSS_PORT_NO_END; port_no++) {
+        if (port_no == EMUL_PORT_UNUSED_0 || port_no == EMUL_PORT_UNUSED_1) {
+            map[port_no].chip_port = CHIP_PORT_UNUSED;
+        } else {
+            map[port_no].chip_port = port_no;
+            map[port_no].max_bw = VTSS_BW_1G;
+            map[port_no].miim_controller = VTSS_MIIM_CONTROLLER_0;
+            map[port_no].miim_addr = port_no;
+        }
+    }
+    return vtss_port_map_set(*inst, map);
+}
+
+/* - TUPE ---------------------------------------------------------- */
+
+#define EMUL_TUPE_VID_START 10   /* First VLAN */
+#define EMUL_TUPE_VID_CNT   1000 /* Number of VLANs */
+
+/* Expected VLAN port mask: Protected VLANs use one of the protection ports */
+static void emul_tupe_pmask(vtss_state_t *vtss_state, u32 vid, BOOL protect, vtss_port_mask_t *pmask)
+{
+    BOOL member[VTSS_PORT_ARRAY_SIZE];
+
+    memset(member, 0, sizeof(member));
+    member[EMUL_PORT_OTHER] = TRUE;
+    member[(vid & 1) == 0 && protect ? EMUL_PORT_PROTECT : EMUL_PORT_WORKING] = TRUE;
+    vtss_port_mask_get(vtss_state, member, pmask);
+}
+
+static vtss_rc emul_tupe_check(vtss_state_t *vtss_state, BOOL protect, const char *txt)
+{
+    vtss_port_mask_t pmask, exp;
+    u32              vid, err = 0;
+
+    for (vid = EMUL_TUPE_VID_START; vid < (EMUL_TUPE_VID_START + EMUL_TUPE_VID_CNT); vid++) {
+        REG_RDX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, vid, &pmask);
+        emul_tupe_pmask(vtss_state, vid, protect, &exp);
+        if (memcmp(&pmask, &exp, sizeof(pmask)) != 0) {
+            err++;
+        }
+    }
+    EMUL_CHECK(err == 0, "%s: %u VLANs with unexpected port mask", txt, err);
+    return VTSS_RC_OK;
+}
+
+/* Linear protection switchover: One TUPE command moves all protected VLANs between
+   the working and protection port. The even VLANs are protected, the odd VLANs are not. */
+static vtss_rc emul_tupe_switchover_test(vtss_state_t *vtss_state)
+{
+    vtss_tupe_val_t      val, bit, v;
+    vtss_tupe_val_type_t type;
+    vtss_tupe_parms_t    parms;
+    vtss_port_mask_t     pmask;
+    u32                  vid;
+
+    VTSS_RC(fa_tupe_init(vtss_state, 8));
+    VTSS_RC(fa_tupe_alloc(vtss_state, VTSS_TUPE_TYPE_VALUE, &val));
+    VTSS_RC(fa_tupe_alloc(vtss_state, VTSS_TUPE_TYPE_BITS, &bit));
+    EMUL_CHECK(val != 0 && bit != val, "val: 0x%x, bit: 0x%x", val, bit);
+
+    for (vid = EMUL_TUPE_VID_START; vid < (EMUL_TUPE_VID_START + EMUL_TUPE_VID_CNT); vid++) {
+        emul_tupe_pmask(vtss_state, vid, FALSE, &pmask);
+        REG_WRX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, vid, pmask);
+        if ((vid & 1) == 0) {
+            VTSS_RC(fa_tupe_vlan_set(vtss_state, vid, VTSS_TUPE_TYPE_VALUE, val));
+        } else {
+            VTSS_RC(fa_tupe_vlan_clr(vtss_state, vid));
+        }
+    }
+    VTSS_RC(fa_tupe_vlan_get(vtss_state, EMUL_TUPE_VID_START, &type, &v));
+    EMUL_CHECK(type == VTSS_TUPE_TYPE_VALUE && v == val, "type: %u, val: 0x%x", type, v);
+    EMUL_CHECK(fa_tupe_vlan_get(vtss_state, EMUL_TUPE_VID_START + 1, &type, &v) == VTSS_RC_ERROR, "untagged VLAN has a value");
+    VTSS_RC(fa_tupe_vlan_set(vtss_state, EMUL_TUPE_VID_START + 1, VTSS_TUPE_TYPE_BITS, bit));
+    VTSS_RC(fa_tupe_vlan_get(vtss_state, EMUL_TUPE_VID_START + 1, &type, &v));
+    EMUL_CHECK(type == VTSS_TUPE_TYPE_BITS && v == bit, "type: %u, bit: 0x%x", type, v);
+    VTSS_RC(fa_tupe_vlan_clr(vtss_state, EMUL_TUPE_VID_START + 1));
+    VTSS_RC(emul_tupe_check(vtss_state, FALSE, "initial"));
+
+    /* Switch to the protection port */
+    memset(&parms, 0, sizeof(parms));
+    parms.start_addr = 0;
+    parms.end_addr = (VTSS_VIDS - 1);
+    parms.value = val;
+    parms.set_port_list[EMUL_PORT_PROTECT] = TRUE;
+    parms.clr_port_list[EMUL_PORT_WORKING] = TRUE;
+    EMUL_CHECK(fa_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_BLOCKING, &parms) == VTSS_RC_OK, "switchover failed");
+    EMUL_CHECK(fa_tupe_cmd(vtss_state, VTSS_TUPE_CMD_QUERY, NULL) == VTSS_RC_OK, "TUPE busy");
+    VTSS_RC(emul_tupe_check(vtss_state, TRUE, "protect"));
+
+    /* Switch back to the working port */
+    parms.set_port_list[EMUL_PORT_PROTECT] = FALSE;
+    parms.clr_port_list[EMUL_PORT_WORKING] = FALSE;
+    parms.set_port_list[EMUL_PORT_WORKING] = TRUE;
+    parms.clr_port_list[EMUL_PORT_PROTECT] = TRUE;
+    EMUL_CHECK(fa_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_BLOCKING, &parms) == VTSS_RC_OK, "switchback failed");
+    VTSS_RC(emul_tupe_check(vtss_state, FALSE, "working"));
+
+    /* Unallocated values and invalid ranges are rejected */
+    parms.value = bit;
+    parms.start_addr = 1;
+    parms.end_addr = 0;
+    EMUL_CHECK(fa_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_BLOCKING, &parms) == VTSS_RC_ERR_PARM, "invalid range accepted");
+    VTSS_RC(fa_tupe_free(vtss_state, bit));
+    VTSS_RC(fa_tupe_free(vtss_state, val));
+    parms.start_addr = 0;
+    parms.value = val;
+    EMUL_CHECK(fa_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_BLOCKING, &parms) == VTSS_RC_ERR_PARM, "free value accepted");
+
+    /* Leave the VLAN table as the API configured it */
+    vtss_port_mask_clear(&pmask);
+    for (vid = EMUL_TUPE_VID_START; vid < (EMUL_TUPE_VID_START + EMUL_TUPE_VID_CNT); vid++) {
+        REG_WRX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, vid, pmask);
+        VTSS_RC(fa_tupe_vlan_clr(vtss_state, vid));
+    }
+    return VTSS_RC_OK;
+}
+
+/* Check the VLAN port masks against the expected members */
+static vtss_rc emul_vlan_check(vtss_state_t *vtss_state, vtss_vid_t vid_start, const BOOL member[], const char *txt)
+{
+    vtss_port_mask_t pmask, exp;
+    vtss_vid_t       vid;
+    u32              err = 0;
+
+    vtss_port_mask_get(vtss_state, member, &exp);
+    for (vid = vid_start; vid < (vid_start + EMUL_TUPE_VID_CNT); vid++) {
+        REG_RDX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, vid, &pmask);
+        if (memcmp(&pmask, &exp, sizeof(pmask)) != 0) {
+            err++;
+        }
+    }
+    EMUL_CHECK(err == 0, "%s: %u VLANs with unexpected port mask", txt, err);
+    return VTSS_RC_OK;
+}
+
+#define EMUL_ERPS_VID_START 1100 /* First ring VLAN */
+#define EMUL_ERPS_VID_MULTI 2100 /* VLAN in two rings */
+
+/* Ring protection through the ERPS API: A ring port state change is done by one TUPE command */
+static vtss_rc emul_tupe_erps_test(vtss_state_t *vtss_state)
+{
+    BOOL           member[VTSS_PORT_ARRAY_SIZE];
+    vtss_vid_t     vid;
+    vtss_port_no_t port_no;
+    u32            sweep_cnt;
+
+    for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+        VTSS_RC(vtss_erps_port_state_set(vtss_state, 0, port_no, VTSS_ERPS_STATE_FORWARDING));
+        VTSS_RC(vtss_erps_port_state_set(vtss_state, 1, port_no, VTSS_ERPS_STATE_FORWARDING));
+    }
+    memset(member, 0, sizeof(member));
+    member[EMUL_PORT_WORKING] = TRUE;
+    member[EMUL_PORT_PROTECT] = TRUE;
+    member[EMUL_PORT_OTHER] = TRUE;
+    for (vid = EMUL_ERPS_VID_START; vid < (EMUL_ERPS_VID_START + EMUL_TUPE_VID_CNT); vid++) {
+        VTSS_RC(vtss_vlan_port_members_set(vtss_state, vid, member));
+        VTSS_RC(vtss_erps_vlan_member_set(vtss_state, 0, vid, TRUE));
+    }
+    VTSS_RC(emul_vlan_check(vtss_state, EMUL_ERPS_VID_START, member, "initial"));
+
+    /* Block and unblock the ring port */
+    sweep_cnt = vtss_state->tupe.sweep_cnt;
+    VTSS_RC(vtss_erps_port_state_set(vtss_state, 0, EMUL_PORT_PROTECT, VTSS_ERPS_STATE_DISCARDING));
+    EMUL_CHECK(vtss_state->tupe.sweep_cnt == sweep_cnt + 1, "block not done by TUPE");
+    member[EMUL_PORT_PROTECT] = FALSE;
+    VTSS_RC(emul_vlan_check(vtss_state, EMUL_ERPS_VID_START, member, "block"));
+    VTSS_RC(vtss_erps_port_state_set(vtss_state, 0, EMUL_PORT_PROTECT, VTSS_ERPS_STATE_FORWARDING));
+    EMUL_CHECK(vtss_state->tupe.sweep_cnt == sweep_cnt + 2, "unblock not done by TUPE");
+    member[EMUL_PORT_PROTECT] = TRUE;
+    VTSS_RC(emul_vlan_check(vtss_state, EMUL_ERPS_VID_START, member, "unblock"));
+
+    /* A VLAN in two rings is not tagged, so the ring VLANs are updated one by one */
+    VTSS_RC(vtss_vlan_port_members_set(vtss_state, EMUL_ERPS_VID_MULTI, member));
+    VTSS_RC(vtss_erps_vlan_member_set(vtss_state, 0, EMUL_ERPS_VID_MULTI, TRUE));
+    VTSS_RC(vtss_erps_vlan_member_set(vtss_state, 1, EMUL_ERPS_VID_MULTI, TRUE));
+    VTSS_RC(vtss_erps_port_state_set(vtss_state, 0, EMUL_PORT_PROTECT, VTSS_ERPS_STATE_DISCARDING));
+    EMUL_CHECK(vtss_state->tupe.sweep_cnt == sweep_cnt + 2, "multi-ring block done by TUPE");
+    member[EMUL_PORT_PROTECT] = FALSE;
+    VTSS_RC(emul_vlan_check(vtss_state, EMUL_ERPS_VID_START, member, "multi-ring block"));
+    VTSS_RC(emul_vlan_check(vtss_state, EMUL_ERPS_VID_MULTI - EMUL_TUPE_VID_CNT + 1, member, "multi-ring VLAN"));
+    VTSS_RC(vtss_erps_port_state_set(vtss_state, 0, EMUL_PORT_PROTECT, VTSS_ERPS_STATE_FORWARDING));
+    return VTSS_RC_OK;
+}
+
+#define EMUL_EPS_VID_START 2200 /* First VLAN with EPS ports */
+
+/* Linear protection through the EPS API: A selector change is done by one TUPE command */
+static vtss_rc emul_tupe_eps_test(vtss_state_t *vtss_state)
+{
+    BOOL                 member[VTSS_PORT_ARRAY_SIZE];
+    vtss_eps_port_conf_t conf;
+    vtss_vid_t           vid;
+    u32                  sweep_cnt;
+
+    memset(member, 0, sizeof(member));
+    member[EMUL_PORT_EPS_W] = TRUE;
+    member[EMUL_PORT_OTHER] = TRUE;
+    for (vid = EMUL_EPS_VID_START; vid < (EMUL_EPS_VID_START + EMUL_TUPE_VID_CNT); vid++) {
+        VTSS_RC(vtss_vlan_port_members_set(vtss_state, vid, member));
+    }
+    memset(&conf, 0, sizeof(conf));
+    conf.type = VTSS_EPS_PORT_1_FOR_1;
+    conf.port_no = EMUL_PORT_EPS_P;
+    VTSS_RC(vtss_eps_port_conf_set(vtss_state, EMUL_PORT_EPS_W, &conf));
+    VTSS_RC(emul_vlan_check(vtss_state, EMUL_EPS_VID_START, member, "working"));
+
+    sweep_cnt = vtss_state->tupe.sweep_cnt;
+    VTSS_RC(vtss_eps_port_selector_set(vtss_state, EMUL_PORT_EPS_W, VTSS_EPS_SELECTOR_PROTECTION));
+    EMUL_CHECK(vtss_state->tupe.sweep_cnt == sweep_cnt + 1, "switchover not done by TUPE");
+    member[EMUL_PORT_EPS_W] = FALSE;
+    member[EMUL_PORT_EPS_P] = TRUE;
+    VTSS_RC(emul_vlan_check(vtss_state, EMUL_EPS_VID_START, member, "protection"));
+
+    VTSS_RC(vtss_eps_port_selector_set(vtss_state, EMUL_PORT_EPS_W, VTSS_EPS_SELECTOR_WORKING));
+    EMUL_CHECK(vtss_state->tupe.sweep_cnt == sweep_cnt + 2, "switchback not done by TUPE");
+    member[EMUL_PORT_EPS_W] = TRUE;
+    member[EMUL_PORT_EPS_P] = FALSE;
+    VTSS_RC(emul_vlan_check(vtss_state, EMUL_EPS_VID_START, member, "working again"));
+    return VTSS_RC_OK;
+}
+
+/* - AFI ----------------------------------------------------------- */
+
+#define EMUL_AFI_FLOW_CNT 1000 /* Number of slow injections */
+
+/* Allocate, hijack and free the flows, then collect the removal events */
+static vtss_rc emul_afi_flows_free(vtss_state_t *vtss_state, BOOL stuck, u32 *removed, u32 *failed)
+{
+    vtss_afi_slow_inj_alloc_cfg_t cfg;
+    vtss_afi_slowid_t             id[EMUL_AFI_FLOW_CNT];
+    vtss_afi_rm_event_t           event;
+    u32                           i;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.port_no = EMUL_PORT_OTHER;
+    for (i = 0; i < EMUL_AFI_FLOW_CNT; i++) {
+        VTSS_RC(vtss_afi_slow_inj_alloc(vtss_state, &cfg, &id[i]));
+        VTSS_RC(vtss_afi_slow_inj_frm_hijack(vtss_state, id[i]));
+    }
+    vtss_fa_emul_afi_rm_stuck_set(stuck);
+    for (i = 0; i < EMUL_AFI_FLOW_CNT; i++) {
+        VTSS_RC(vtss_afi_slow_inj_free(vtss_state, id[i]));
+    }
+    if (stuck) {
+        /* Let the removals time out, so the next poll escalates the port */
+        EMUL_CHECK(vtss_state->afi.rm_cnt == EMUL_AFI_FLOW_CNT, "%u removals pending", vtss_state->afi.rm_cnt);
+        EMUL_CHECK(vtss_afi_slow_inj_frm_hijack(vtss_state, id[0]) != VTSS_RC_OK, "flow being removed was hijacked");
+        VTSS_MSLEEP(2 * VTSS_AFI_RM_ESCALATE_MSEC);
+    }
+    (void)vtss_fa_emul_afi_frm_rd_cnt_get(TRUE);
+    *removed = 0;
+    *failed = 0;
+    do {
+        VTSS_RC(vtss_afi_rm_event_get(vtss_state, &event));
+        if (event.valid && event.removed) {
+            (*removed)++;
+        } else if (event.valid) {
+            (*failed)++;
+        }
+    } while (event.valid);
+    vtss_fa_emul_afi_rm_stuck_set(FALSE);
+    return VTSS_RC_OK;
+}
+
+/* Escalating the removal of many flows on a port polls FRM_GONE a bounded number of times */
+static vtss_rc emul_afi_rm_test(vtss_state_t *vtss_state)
+{
+    u32 removed, failed, rd_cnt;
+
+    VTSS_RC(emul_afi_flows_free(vtss_state, FALSE, &removed, &failed));
+    EMUL_CHECK(removed == EMUL_AFI_FLOW_CNT && failed == 0, "removed: %u, failed: %u", removed, failed);
+
+    VTSS_RC(emul_afi_flows_free(vtss_state, TRUE, &removed, &failed));
+    rd_cnt = vtss_fa_emul_afi_frm_rd_cnt_get(TRUE);
+    EMUL_CHECK(removed == 0 && failed == EMUL_AFI_FLOW_CNT, "removed: %u, failed: %u", removed, failed);
+    EMUL_CHECK(vtss_state->afi.rm_cnt == 0, "%u removals pending", vtss_state->afi.rm_cnt);
+    EMUL_CHECK(rd_cnt <= EMUL_AFI_FLOW_CNT + 2 * VTSS_AFI_RM_POLL_CNT, "%u frame entry reads", rd_cnt);
+    VTSS_I("%u frame entry reads", rd_cnt);
+    return VTSS_RC_OK;
+}
+
+/* - Main ---------------------------------------------------------- */
+
+typedef struct {
+    const char *name;
+    vtss_rc    (*func)(vtss_state_t *vtss_state);
+} emul_test_t;
+
+static const emul_test_t emul_tests[] = {
+    { "tupe_switchover", emul_tupe_switchover_test },
+    { "tupe_erps",       emul_tupe_erps_test },
+    { "tupe_eps",        emul_tupe_eps_test },
+    { "afi_rm",          emul_afi_rm_test },
+};
+
+int main(int argc, char **argv)
+{
+    vtss_state_t *vtss_state;
+    u32          i, errors;
+
+    if (argc > 1 && strcmp(argv[1], "-v") == 0) {
+        emul_trace_level = VTSS_TRACE_LEVEL_INFO;
+    }
+    if (emul_inst_create(&vtss_state) != VTSS_RC_OK) {
+        printf("FAIL: instance creation\n");
+        return 1;
+    }
+    for (i = 0; i < sizeof(emul_tests) / sizeof(emul_tests[0]); i++) {
+        errors = emul_test_errors;
+        if (emul_tests[i].func(vtss_state) != VTSS_RC_OK) {
+            emul_test_errors++;
+        }
+        printf("%s: %s\n", emul_test_errors == errors ? "PASS" : "FAIL", emul_tests[i].name);
+    }
+    return (emul_test_errors ? 1 : 0);
+}
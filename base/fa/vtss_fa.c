@@ -35,6 +35,279 @@ static inline vtss_rc reg_wr_direct(vtss_state_t *vtss_state, u32 reg, u32 value
 vtss_rc (*vtss_fa_wr)(vtss_state_t *vtss_state, u32 addr, u32 value) = reg_wr_direct;
 vtss_rc (*vtss_fa_rd)(vtss_state_t *vtss_state, u32 addr, u32 *value) = reg_rd_direct;
 
+/* - Register access profiling ------------------------------------- */
+
+// While profiling is enabled, the register access functions are replaced by functions counting
+// accesses and access time per register group and per API function. The register groups are
+// taken from the symbolic register tables and looked up using address ranges sorted by start
+// address. Replications of a target share counters.
+
+#if defined(VTSS_OS_TIMESTAMP_NS)
+#define FA_PROF_NS() VTSS_OS_TIMESTAMP_NS()
+#else
+#define FA_PROF_NS() 0
+#endif
+
+typedef struct {
+    const char *name;  // Target or API function name
+    const char *group; // Register group name
+    u32        rd_cnt;
+    u32        wr_cnt;
+    u64        nsec;
+} fa_prof_cnt_t;
+
+typedef struct {
+    u32 start; // First address
+    u32 end;   // Last address
+    u32 idx;   // Group counter index
+} fa_prof_range_t;
+
+#define FA_PROF_FUNC_CNT 1024 // API function hash table size, must be a power of two
+
+static struct {
+    fa_prof_cnt_t   *grp;       // Group counters, the last entry counts unknown addresses
+    u32             grp_cnt;
+    fa_prof_range_t *range;     // Group address ranges
+    u32             range_cnt;
+    fa_prof_cnt_t   func[FA_PROF_FUNC_CNT]; // API function counters hashed by name pointer
+} fa_prof;
+
+static fa_prof_cnt_t *fa_prof_grp_lookup(u32 addr)
+{
+    u32             lo = 0, hi = fa_prof.range_cnt, mid;
+    fa_prof_range_t *range;
+
+    // Find the last range starting at or before the address
+    while (lo < hi) {
+        mid = ((lo + hi) / 2);
+        if (fa_prof.range[mid].start <= addr) {
+            lo = (mid + 1);
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo != 0 && addr <= (range = &fa_prof.range[lo - 1])->end) {
+        return &fa_prof.grp[range->idx];
+    }
+    return &fa_prof.grp[fa_prof.grp_cnt - 1];
+}
+
+static fa_prof_cnt_t *fa_prof_func_lookup(void)
+{
+    const char    *name = (vtss_func == NULL ? "-" : vtss_func);
+    u32           i, idx = ((((size_t)name >> 2) * 2654435761U) & (FA_PROF_FUNC_CNT - 1));
+    fa_prof_cnt_t *cnt;
+
+    for (i = 0; i < FA_PROF_FUNC_CNT; i++, idx = ((idx + 1) & (FA_PROF_FUNC_CNT - 1))) {
+        cnt = &fa_prof.func[idx];
+        if (cnt->name == name) {
+            return cnt;
+        }
+        if (cnt->name == NULL) {
+            cnt->name = name;
+            return cnt;
+        }
+    }
+    return NULL;
+}
+
+static void fa_prof_update(u32 addr, u64 nsec, BOOL wr)
+{
+    fa_prof_cnt_t *cnt[2];
+    u32           i;
+
+    cnt[0] = fa_prof_grp_lookup(addr);
+    cnt[1] = fa_prof_func_lookup();
+    for (i = 0; i < 2; i++) {
+        if (cnt[i] != NULL) {
+            if (wr) {
+                cnt[i]->wr_cnt++;
+            } else {
+                cnt[i]->rd_cnt++;
+            }
+            cnt[i]->nsec += nsec;
+        }
+    }
+}
+
+static vtss_rc reg_rd_prof(vtss_state_t *vtss_state, u32 addr, u32 *value)
+{
+    u64     start = FA_PROF_NS();
+    vtss_rc rc = reg_rd_direct(vtss_state, addr, value);
+
+    fa_prof_update(addr, FA_PROF_NS() - start, 0);
+    return rc;
+}
+
+static vtss_rc reg_wr_prof(vtss_state_t *vtss_state, u32 addr, u32 value)
+{
+    u64     start = FA_PROF_NS();
+    vtss_rc rc = reg_wr_direct(vtss_state, addr, value);
+
+    fa_prof_update(addr, FA_PROF_NS() - start, 1);
+    return rc;
+}
+
+// Replications of a target are numbered from zero and share counters
+static BOOL fa_prof_tgt_first(const vtss_symreg_data_t *data, u32 i)
+{
+    const vtss_symreg_target_t *tgt = &data->targets[i];
+
+    return (i == 0 || tgt->repl_number <= 0 || tgt->reggrps != tgt[-1].reggrps);
+}
+
+static vtss_rc fa_prof_init(void)
+{
+    vtss_symreg_data_t         data;
+    const vtss_symreg_target_t *tgt;
+    const vtss_symreg_reggrp_t *grp;
+    fa_prof_range_t            *range, tmp;
+    u32                        i, j, gap, base, grp_base = 0, grp_cnt = 0, range_cnt = 0;
+
+    if (vtss_symreg_data_get(NULL, &data) != VTSS_RC_OK) {
+        data.targets_cnt = 0;
+    }
+    for (i = 0; i < data.targets_cnt; i++) {
+        tgt = &data.targets[i];
+        for (grp = tgt->reggrps; grp->name != NULL; grp++) {
+            range_cnt++;
+            if (fa_prof_tgt_first(&data, i)) {
+                grp_cnt++;
+            }
+        }
+    }
+
+    // One extra counter for unknown addresses
+    grp_cnt++;
+    if ((fa_prof.grp = VTSS_OS_MALLOC(grp_cnt * sizeof(fa_prof_cnt_t), VTSS_MEM_FLAGS_NONE)) == NULL ||
+        (range_cnt != 0 &&
+         (fa_prof.range = VTSS_OS_MALLOC(range_cnt * sizeof(fa_prof_range_t), VTSS_MEM_FLAGS_NONE)) == NULL)) {
+        if (fa_prof.grp != NULL) {
+            VTSS_OS_FREE(fa_prof.grp, VTSS_MEM_FLAGS_NONE);
+            fa_prof.grp = NULL;
+        }
+        return VTSS_RC_ERROR;
+    }
+    VTSS_MEMSET(fa_prof.grp, 0, grp_cnt * sizeof(fa_prof_cnt_t));
+    fa_prof.grp_cnt = 0;
+    fa_prof.range_cnt = 0;
+    for (i = 0; i < data.targets_cnt; i++) {
+        tgt = &data.targets[i];
+        if (fa_prof_tgt_first(&data, i)) {
+            // New target, allocate group counters
+            grp_base = fa_prof.grp_cnt;
+            for (grp = tgt->reggrps; grp->name != NULL; grp++) {
+                fa_prof.grp[fa_prof.grp_cnt].name = tgt->name;
+                fa_prof.grp[fa_prof.grp_cnt].group = grp->name;
+                fa_prof.grp_cnt++;
+            }
+        }
+        base = ((tgt->base_addr - VTSS_IO_CPU) >> 2);
+        for (grp = tgt->reggrps, j = grp_base; grp->name != NULL; grp++, j++) {
+            range = &fa_prof.range[fa_prof.range_cnt++];
+            range->start = (base + grp->base_addr);
+            range->end = (range->start + grp->repl_cnt * grp->repl_width - 1);
+            range->idx = j;
+        }
+    }
+    fa_prof.grp[fa_prof.grp_cnt].name = "-";
+    fa_prof.grp[fa_prof.grp_cnt].group = "-";
+    fa_prof.grp_cnt++;
+
+    // Shell sort ranges by start address
+    for (gap = (range_cnt / 2); gap > 0; gap /= 2) {
+        for (i = gap; i < range_cnt; i++) {
+            tmp = fa_prof.range[i];
+            for (j = i; j >= gap && fa_prof.range[j - gap].start > tmp.start; j -= gap) {
+                fa_prof.range[j] = fa_prof.range[j - gap];
+            }
+            fa_prof.range[j] = tmp;
+        }
+    }
+    VTSS_I("groups: %u, ranges: %u", fa_prof.grp_cnt, fa_prof.range_cnt);
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_fa_reg_profile_clear(vtss_state_t *vtss_state)
+{
+    u32 i;
+
+    for (i = 0; i < fa_prof.grp_cnt; i++) {
+        fa_prof.grp[i].rd_cnt = 0;
+        fa_prof.grp[i].wr_cnt = 0;
+        fa_prof.grp[i].nsec = 0;
+    }
+    VTSS_MEMSET(fa_prof.func, 0, sizeof(fa_prof.func));
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_fa_reg_profile_enable(vtss_state_t *vtss_state, BOOL enable)
+{
+    if (enable && fa_prof.grp == NULL) {
+        VTSS_RC(fa_prof_init());
+    }
+    vtss_fa_rd = (enable ? reg_rd_prof : reg_rd_direct);
+    vtss_fa_wr = (enable ? reg_wr_prof : reg_wr_direct);
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_fa_reg_profile_get(vtss_state_t *vtss_state,
+                                const vtss_reg_profile_type_t type, const u32 idx,
+                                vtss_reg_profile_entry_t *const entry)
+{
+    fa_prof_cnt_t *cnt;
+
+    if (type == VTSS_REG_PROFILE_TYPE_GROUP && idx < fa_prof.grp_cnt) {
+        cnt = &fa_prof.grp[idx];
+    } else if (type == VTSS_REG_PROFILE_TYPE_FUNC && idx < FA_PROF_FUNC_CNT) {
+        cnt = &fa_prof.func[idx];
+    } else {
+        return VTSS_RC_ERROR;
+    }
+    entry->name = cnt->name;
+    entry->group = cnt->group;
+    entry->rd_cnt = cnt->rd_cnt;
+    entry->wr_cnt = cnt->wr_cnt;
+    entry->nsec = cnt->nsec;
+    return VTSS_RC_OK;
+}
+
+static void fa_prof_cnt_print(const vtss_debug_printf_t pr, const char *name, fa_prof_cnt_t *cnt)
+{
+    u32 total = (cnt->rd_cnt + cnt->wr_cnt);
+
+    if (total != 0) {
+        pr("%-40s  %-10u  %-10u  %-12" PRIu64 "  %" PRIu64 "\n",
+           name, cnt->rd_cnt, cnt->wr_cnt, cnt->nsec, cnt->nsec / total);
+    }
+}
+
+void vtss_fa_debug_reg_profile(vtss_state_t *vtss_state, const vtss_debug_printf_t pr)
+{
+    fa_prof_cnt_t *cnt;
+    u32           i;
+    char          buf[80];
+
+    if (!vtss_state->misc.reg_profile_conf.enable && fa_prof.grp == NULL) {
+        return;
+    }
+    pr("Register Profiling: %s\n\n", vtss_state->misc.reg_profile_conf.enable ? "Enabled" : "Disabled");
+    pr("%-40s  %-10s  %-10s  %-12s  %s\n", "Target:Group", "Reads", "Writes", "Time [nsec]", "Avg [nsec]");
+    for (i = 0; i < fa_prof.grp_cnt; i++) {
+        cnt = &fa_prof.grp[i];
+        VTSS_SNPRINTF(buf, sizeof(buf), "%s:%s", cnt->name, cnt->group);
+        fa_prof_cnt_print(pr, buf, cnt);
+    }
+    pr("\n%-40s  %-10s  %-10s  %-12s  %s\n", "Function", "Reads", "Writes", "Time [nsec]", "Avg [nsec]");
+    for (i = 0; i < FA_PROF_FUNC_CNT; i++) {
+        cnt = &fa_prof.func[i];
+        if (cnt->name != NULL) {
+            fa_prof_cnt_print(pr, cnt->name, cnt);
+        }
+    }
+    pr("\n");
+}
+
 /* Read-modify-write target register using current CPU interface */
 vtss_rc vtss_fa_wrm(vtss_state_t *vtss_state, u32 addr, u32 value, u32 mask)
 {
@@ -458,7 +458,7 @@ static vtss_rc fa_afi_set_frm_rm(vtss_state_t *vtss_state, i32 frm_idx)
     return VTSS_RC_OK;
 }
 
-static vtss_rc fa_afi_frm_gone_get(vtss_state_t *vtss_state, u8 *const frm_gone, i32 frm_idx)
+static vtss_rc fa_afi_frm_gone_get(vtss_state_t *vtss_state, i32 frm_idx, BOOL *const frm_gone)
 {
     u32 part1;
 
@@ -582,87 +582,62 @@ static vtss_rc fa_afi_port_fwd_set(vtss_state_t *vtss_state, vtss_port_no_t port
     return VTSS_RC_OK;
 }
 
-static vtss_rc fa_afi_frm_gone_wait(vtss_state_t *vtss_state, u32 idx, vtss_port_no_t port_no, i32 frm_idx, BOOL is_dti)
+// A removal injection from the AFI tells the QSYS to free the frame. This is an
+// injection like any other AFI injection. The AFI can only have frm_out_max
+// outstanding frames on a given port, and if the flows out of the port get
+// starved due to other higher priority flows or other higher priority frames
+// coming from other front ports, it may happen that the AFI can't get rid of
+// the removal injected frame, so that FRM_GONE never gets set.
+// The AIL polls FRM_GONE for the removed frames, and if they are not gone in
+// time, it escalates the removal on the port like this:
+// 2) Stop forwarding into and out of the port in question and poll again.
+// 3) Since other AFI frames injected on the port in question may still
+//    starve the flow we are currently removing (because the AFI injects
+//    directly into the port and doesn't obey the forwarding, we set in step
+//    2), stop all other AFI flows on the port and poll again.
+// Method 1 is simply to poll without doing anything special.
+//
+// It has been considered to stop both all up-flows (through VD1) and all
+// flows on the port in question and waiting for FRM_OUT_CNT to go to 0
+// before waiting for FRM_GONE. This has the unfortunate side-effect that
+// e.g. CCM frames may be delayed more than 10 ms, causing the remote end
+// to raise an alarm. This may still happen for up-flows if step #2 and #3
+// takes more than 10 ms, and for down-flows if step #3 takes more than 10
+// ms.
+//
+// Notice, if QLIM is enabled (at the time of writing, it isn't), one has to
+// change the queue number before removing a flow (see MESA-320).
+// When doing so, there's no guarantee that frames will be acknowledged
+// by the QSYS in the same order as they are injected by the AFI, so
+// when removing a frame with QLIM enabled, the port needs to be stopped and
+// flushed before starting the removal injection. Otherwise, we could end up
+// freeing the frame from the QSYS before all references to it were out.
+static vtss_rc fa_afi_rm_port_hold(vtss_state_t *vtss_state, vtss_port_no_t port_no, u32 method, BOOL hold)
 {
-    u32             poll_cnt, poll_cnt_max, method;
-    BOOL            frm_gone = FALSE, old_fwd = TRUE;
     vtss_afi_port_t *port = fa_afi_port_tbl_entry(vtss_state, port_no);
 
-    VTSS_I("Enter. %s_idx = %u on port %d", is_dti ? "dti" : "tti", idx, port_no);
-
-    if (is_dti) {
-        poll_cnt_max = 1000;
-    } else {
-        // Assumption:
-        // Each poll takes at least 50 clk cycles.
-        // One TTI is processed every 4 clk cycles.
-        poll_cnt_max = (VTSS_AFI_SLOW_INJ_CNT * 4) / 50;
-    }
+    VTSS_I("port %d: %s method %u", port_no, hold ? "Apply" : "Undo", method);
 
-    // We're now ready for removal injection. A removal injection from the AFI
-    // tells the QSYS to free the frame. This is an injection like any other AFI
-    // injection. The AFI can only have frm_out_max outstanding frames on a
-    // given port, and if the flows out of the port get starved due to other
-    // higher priority flows or other higher priority frames coming from other
-    // front ports, it may happen that the AFI can't get rid of the removal
-    // injected frame, so that FRM_GONE never gets set.
-    // The following code attempts to wait for FRM_GONE in three rounds:
-    // 1) Simply wait for FRM_GONE by polling up to poll_cnt_max times.
-    // 2) If not gone, stop forwarding into and out of the port in question and
-    //    wait for FRM_GONE again by polling up to poll_cnt_max times.
-    // 3) Since other AFI frames injected on the port in question may still
-    //    starve the flow we are currently removing (because the AFI injects
-    //    directly into the port and doesn't obey the forwarding, we set in step
-    //    2), stop all other AFI flows on the port and wait for FRM_GONE again
-    //    by polling up to poll_cnt_max times.
-    //
-    // It has been considered to stop both all up-flows (through VD1) and all
-    // flows on the port in question and waiting for FRM_OUT_CNT to go to 0
-    // before waiting for FRM_GONE. This has the unfortunate side-effect that
-    // e.g. CCM frames may be delayed more than 10 ms, causing the remote end
-    // to raise an alarm. This may still happen for up-flows if step #2 and #3
-    // takes more than 10 ms, and for down-flows if step #3 takes more than 10
-    // ms.
-
-    // Notice, if QLIM is enabled (at the time of writing, it isn't), one has to
-    // change the queue number before removing a flow (see MESA-320).
-    // When doing so, there's no guarantee that frames will be acknowledged
-    // by the QSYS in the same order as they are injected by the AFI, so
-    // when removing a frame with QLIM enabled, the port needs to be stopped and
-    // flushed before starting the removal injection. Otherwise, we could end up
-    // freeing the frame from the QSYS before all references to it were out.
-
-    for (method = 1; method < 4; method++) {
+    if (hold) {
         switch (method) {
-        case 1:
-            // Simply poll without doing anything special
-            break;
-
         case 2:
             // Stop port forwarding before polling again.
-            VTSS_RC(fa_afi_port_fwd_set(vtss_state, port_no, 0, &old_fwd));
+            VTSS_RC(fa_afi_port_fwd_set(vtss_state, port_no, 0, &port->rm_old_fwd));
             break;
 
         case 3:
             // Stop and flush other AFI flows on this port before polling again.
             VTSS_RC(fa_afi_port_stop(vtss_state, port_no));
             break;
-        }
-
-        // Poll for FRM_GONE == 1 for last frame
-        poll_cnt = 0;
-        while (!frm_gone && poll_cnt++ < poll_cnt_max) {
-            VTSS_RC(fa_afi_frm_gone_get(vtss_state, &frm_gone, frm_idx));
-        }
 
-        if (frm_gone) {
+        default:
             break;
         }
+        return VTSS_RC_OK;
     }
 
     // Clean up.
     switch (method) {
-    case 4:
     case 3:
         // Restart other AFI flows on this port if they were started at all
         if (port->link && port->started) {
@@ -673,23 +648,16 @@ static vtss_rc fa_afi_frm_gone_wait(vtss_state_t *vtss_state, u32 idx, vtss_port
 
     case 2:
         // Set port forwarding back to what is was
-        VTSS_RC(fa_afi_port_fwd_set(vtss_state, port_no, old_fwd, NULL));
+        VTSS_RC(fa_afi_port_fwd_set(vtss_state, port_no, port->rm_old_fwd, NULL));
 
         // Fallthrough
 
-    case 1:
+    default:
         // Nothing more to do
         break;
     }
 
-    if (frm_gone) {
-        VTSS_I("%s_idx = %u on port %d: Polled %u times out of %u using method %u. FRM_GONE = %d", is_dti ? "dti" : "tti", idx, port_no, poll_cnt, poll_cnt_max, method, frm_gone);
-        return VTSS_RC_OK;
-    } else {
-        VTSS_E("%s_idx = %u on port %d: Polled %u times out of %u using method %u. FRM_GONE = %d", is_dti ? "dti" : "tti", idx, port_no, poll_cnt, poll_cnt_max, method, frm_gone);
-        return VTSS_RC_ERROR;
-
-    }
+    return VTSS_RC_OK;
 }
 
 /******************************************************************************/
@@ -965,13 +933,12 @@ static vtss_rc fa_afi_dti_frm_rm_inj(vtss_state_t *vtss_state, u32 dti_idx)
 
     REG_WR(VTSS_AFI_DTI_CNT_DOWN(dti_idx), 0);
 
-    // Start removal injection!
+    // Start removal injection! The AIL polls for the last frame to be gone.
     REG_WR(VTSS_AFI_DTI_CTRL(dti_idx),
            VTSS_F_AFI_DTI_CTRL_ENA(1) |
            VTSS_F_AFI_DTI_CTRL_BW(0));
 
-    // Wait until the frame is gone.
-    VTSS_RC(fa_afi_frm_gone_wait(vtss_state, dti_idx, dti->port_no, last_frm_idx, TRUE));
+    VTSS_I("dti_idx = %u: last_frm_idx = %d", dti_idx, last_frm_idx);
 
     return VTSS_RC_OK;
 }
@@ -1101,14 +1068,11 @@ static vtss_rc fa_afi_tti_frm_rm_inj(vtss_state_t *vtss_state, u32 tti_idx)
             VTSS_F_AFI_TTI_TIMER_TIMER_LEN((1 << VTSS_AFI_TTI_TBL_TIMER_LEN_WID) - 1),
             VTSS_M_AFI_TTI_TIMER_TIMER_LEN);
 
-    // Make sure timer is started
+    // Make sure timer is started. The AIL polls for the frame to be gone.
     REG_WRM(VTSS_AFI_TTI_TIMER(tti_idx),
             VTSS_F_AFI_TTI_TIMER_TIMER_ENA(1),
             VTSS_M_AFI_TTI_TIMER_TIMER_ENA);
 
-    // Wait until the frame is gone.
-    VTSS_RC(fa_afi_frm_gone_wait(vtss_state, tti_idx, tti->port_no, tti->frm_idx, FALSE));
-
     VTSS_I("Exit(%u)", tti_idx);
     return VTSS_RC_OK;
 }
@@ -1327,6 +1291,8 @@ vtss_rc vtss_fa_afi_init(vtss_state_t *vtss_state, const vtss_init_cmd_t cmd)
         state->dti_stop          = fa_afi_dti_stop;
         state->dti_frm_hijack    = fa_afi_dti_frm_hijack;
         state->dti_frm_rm_inj    = fa_afi_dti_frm_rm_inj;
+        state->frm_gone_get      = fa_afi_frm_gone_get;
+        state->rm_port_hold      = fa_afi_rm_port_hold;
         state->dti_cnt_get       = fa_afi_dti_cnt_get;
 
         state->port_admin_start  = fa_afi_port_admin_start;
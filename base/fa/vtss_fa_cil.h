@@ -111,10 +111,19 @@
 extern vtss_rc vtss_fa_emul_rd(u32 addr, u32 *value);
 extern vtss_rc vtss_fa_emul_wr(u32 addr, u32 value);
 extern vtss_rc vtss_fa_emul_init(vtss_state_t *vtss_state);
+#if defined(VTSS_OPT_EMUL)
+extern void vtss_fa_emul_afi_rm_stuck_set(BOOL stuck);
+extern u32 vtss_fa_emul_afi_frm_rd_cnt_get(BOOL clear);
+#endif
 
 extern vtss_rc (*vtss_fa_wr)(vtss_state_t *vtss_state, u32 addr, u32 value);
 extern vtss_rc (*vtss_fa_rd)(vtss_state_t *vtss_state, u32 addr, u32 *value);
 vtss_rc vtss_fa_wrm(vtss_state_t *vtss_state, u32 addr, u32 value, u32 mask);
+vtss_rc vtss_fa_reg_profile_enable(vtss_state_t *vtss_state, BOOL enable);
+vtss_rc vtss_fa_reg_profile_clear(vtss_state_t *vtss_state);
+vtss_rc vtss_fa_reg_profile_get(vtss_state_t *vtss_state,
+                                const vtss_reg_profile_type_t type, const u32 idx,
+                                vtss_reg_profile_entry_t *const entry);
 vtss_rc vtss_fa_isdx_update(vtss_state_t *vtss_state, vtss_sdx_entry_t *sdx);
 vtss_rc vtss_fa_sdx_counters_update(vtss_state_t *vtss_state, vtss_stat_idx_t *stat_idx, vtss_evc_counters_t *const cnt, BOOL clr);
 BOOL vtss_fa_port_is_high_speed(vtss_state_t *vtss_state, u32 port);
@@ -201,6 +210,7 @@ void vtss_fa_debug_print_port_header(vtss_state_t *vtss_state,
                                      const vtss_debug_printf_t pr, const char *txt);
 void vtss_fa_debug_print_pmask(const vtss_debug_printf_t pr, vtss_port_mask_t *pmask);
 void vtss_fa_debug_reg_header(const vtss_debug_printf_t pr, const char *name);
+void vtss_fa_debug_reg_profile(vtss_state_t *vtss_state, const vtss_debug_printf_t pr);
 void vtss_fa_debug_reg(vtss_state_t *vtss_state,
                        const vtss_debug_printf_t pr, u32 addr, const char *name);
 void vtss_fa_debug_reg_inst(vtss_state_t *vtss_state,
@@ -73,12 +73,111 @@ static BOOL vtss_reg_exc_static(u32 addr, u32 *value, BOOL write)
     return FALSE;
 }
 
+/* - TUPE model ---------------------------------------------------- */
+
+/* Switch core register memory */
+#define EMUL_REG(addr) vtss_reg_mem[(addr) - VTSS_IOREG(VTSS_IO_SWC, 0)]
+
+/* Update VLAN port mask word for TUPE match */
+#define EMUL_TUPE_PMASK(_cfg, _clr, _set) EMUL_REG(_cfg) = ((EMUL_REG(_cfg) & ~EMUL_REG(_clr)) | EMUL_REG(_set))
+
+/* Table Update Engine: Sweep the VLAN table when TUPE_START is set */
+static BOOL vtss_reg_exc_tupe(u32 addr, u32 *value, BOOL write)
+{
+    u32 misc = *value, start, end, i, ctrl, val, val_mask, bit_mask, cnt = 0;
+
+    if (!write || addr != VTSS_ANA_L3_TUPE_MISC || VTSS_X_ANA_L3_TUPE_MISC_TUPE_START(misc) == 0) {
+        return FALSE;
+    }
+
+    start = VTSS_X_ANA_L3_TUPE_ADDR_TUPE_START_ADDR(EMUL_REG(VTSS_ANA_L3_TUPE_ADDR));
+    end = VTSS_X_ANA_L3_TUPE_ADDR_TUPE_END_ADDR(EMUL_REG(VTSS_ANA_L3_TUPE_ADDR));
+    val = VTSS_X_ANA_L3_TUPE_CTRL_VAL_TUPE_CTRL_VAL(EMUL_REG(VTSS_ANA_L3_TUPE_CTRL_VAL));
+    val_mask = VTSS_X_ANA_L3_TUPE_CTRL_VAL_MASK_TUPE_CTRL_VAL_MASK(EMUL_REG(VTSS_ANA_L3_TUPE_CTRL_VAL_MASK));
+    bit_mask = VTSS_X_ANA_L3_TUPE_CTRL_BIT_MASK_TUPE_CTRL_BIT_MASK(EMUL_REG(VTSS_ANA_L3_TUPE_CTRL_BIT_MASK));
+    for (i = start; i <= end; i++) {
+        ctrl = VTSS_X_ANA_L3_TUPE_CTRL_TUPE_CTRL(EMUL_REG(VTSS_ANA_L3_TUPE_CTRL(i)));
+        if ((VTSS_X_ANA_L3_TUPE_MISC_TUPE_CTRL_VAL_ENA(misc) && (ctrl & val_mask) == val) ||
+            (VTSS_X_ANA_L3_TUPE_MISC_TUPE_CTRL_BIT_ENA(misc) && (ctrl & bit_mask) != 0)) {
+            EMUL_TUPE_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG(i), VTSS_ANA_L3_TUPE_CMD_PORT_MASK_CLR, VTSS_ANA_L3_TUPE_CMD_PORT_MASK_SET);
+            EMUL_TUPE_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG1(i), VTSS_ANA_L3_TUPE_CMD_PORT_MASK_CLR1, VTSS_ANA_L3_TUPE_CMD_PORT_MASK_SET1);
+            EMUL_TUPE_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG2(i), VTSS_ANA_L3_TUPE_CMD_PORT_MASK_CLR2, VTSS_ANA_L3_TUPE_CMD_PORT_MASK_SET2);
+            cnt++;
+        }
+    }
+    VTSS_I("TUPE addr %u-%u, %u entries updated", start, end, cnt);
+
+    /* The sweep is done, TUPE_START is cleared */
+    *value = (misc & ~VTSS_M_ANA_L3_TUPE_MISC_TUPE_START);
+    EMUL_REG(VTSS_ANA_L3_TUPE_MISC) = *value;
+    return TRUE;
+}
+
+/* - AFI model ----------------------------------------------------- */
+
+#define EMUL_AFI_PART1_STRIDE (VTSS_AFI_FRM_ENTRY_PART1(1) - VTSS_AFI_FRM_ENTRY_PART1(0))
+
+/* Test controls: Removal never completes while stuck, and frame entry reads are counted */
+static BOOL emul_afi_rm_stuck;
+static u32  emul_afi_frm_rd_cnt;
+
+void vtss_fa_emul_afi_rm_stuck_set(BOOL stuck)
+{
+    emul_afi_rm_stuck = stuck;
+}
+
+u32 vtss_fa_emul_afi_frm_rd_cnt_get(BOOL clear)
+{
+    u32 cnt = emul_afi_frm_rd_cnt;
+
+    if (clear) {
+        emul_afi_frm_rd_cnt = 0;
+    }
+    return cnt;
+}
+
+/* TTI initialization is done at once, frames are always ready for hijacking, and a frame
+   marked for removal is gone after the first read of the frame entry following the removal request */
+static BOOL vtss_reg_exc_afi(u32 addr, u32 *value, BOOL write)
+{
+    u32 offs;
+
+    if (write) {
+        return FALSE;
+    }
+
+    if (addr == VTSS_AFI_TTI_CTRL) {
+        *value &= ~VTSS_M_AFI_TTI_CTRL_TTI_INIT;
+        EMUL_REG(addr) = *value;
+        return TRUE;
+    }
+
+    if (addr == VTSS_AFI_NEW_FRM_CTRL) {
+        *value |= VTSS_M_AFI_NEW_FRM_CTRL_VLD;
+        return TRUE;
+    }
+
+    offs = (addr - VTSS_AFI_FRM_ENTRY_PART1(0));
+    if (addr < VTSS_AFI_FRM_ENTRY_PART1(0) || (offs % EMUL_AFI_PART1_STRIDE) != 0 ||
+        (offs / EMUL_AFI_PART1_STRIDE) >= VTSS_AFI_FRM_CNT) {
+        return FALSE;
+    }
+    emul_afi_frm_rd_cnt++;
+    if (!emul_afi_rm_stuck && VTSS_EXTRACT_BITFIELD(*value, VTSS_AFI_FRM_TBL_PART1_RM_POS, 1) &&
+        !VTSS_EXTRACT_BITFIELD(*value, VTSS_AFI_FRM_TBL_PART1_GONE_POS, 1)) {
+        EMUL_REG(addr) = (*value | (1 << VTSS_AFI_FRM_TBL_PART1_GONE_POS));
+    }
+    return TRUE;
+}
+
 /* - Exception function table -------------------------------------- */
 
 typedef BOOL (* vtss_reg_exc_func_t)(u32 addr, u32 *value, BOOL write);
 
 static vtss_reg_exc_func_t vtss_reg_exc_func_table[] = {
     vtss_reg_exc_static,
+    vtss_reg_exc_tupe,
+    vtss_reg_exc_afi,
     NULL
 };
 
@@ -7,6 +7,10 @@
 
 #if defined(VTSS_ARCH_FA)
 
+#if defined(VTSS_FEATURE_TUPE)
+#include "vtss_fa_tupe.h"
+#endif
+
 /* - CIL functions ------------------------------------------------- */
 
 /* Convert from chip PGID to AIL PGID */
@@ -529,6 +533,70 @@ vtss_rc vtss_fa_vlan_update(vtss_state_t *vtss_state, vtss_vid_t vid)
     return VTSS_RC_OK;
 }
 
+#if defined(VTSS_FEATURE_TUPE)
+/* TUPE value of VLAN: The ring protection bit if the VLAN is in one ring, otherwise
+   the linear protection value if the ports of one protection group are VLAN members */
+static vtss_tupe_val_t fa_vlan_tupe_val(vtss_state_t *vtss_state, vtss_vid_t vid, vtss_tupe_val_type_t *type)
+{
+    vtss_vlan_entry_t *vlan_entry = &vtss_state->l2.vlan_table[vid];
+    vtss_tupe_state_t *tupe = &vtss_state->tupe;
+    vtss_tupe_val_t   val = 0;
+    u32               cnt = 0;
+    vtss_port_no_t    port_no, port_p;
+#if defined(VTSS_FEATURE_L2_ERPS)
+    vtss_erpi_t       erpi;
+#endif
+
+    if (!(vlan_entry->flags & VLAN_FLAGS_ENABLED)) {
+        return 0;
+    }
+
+#if defined(VTSS_FEATURE_L2_ERPS)
+    *type = VTSS_TUPE_TYPE_BITS;
+    for (erpi = VTSS_ERPI_START; erpi < VTSS_ERPI_END; erpi++) {
+        if (VTSS_BF_GET(vtss_state->l2.erps_table[erpi].vlan_member, vid)) {
+            val = tupe->erps_val[erpi];
+            cnt++;
+        }
+    }
+    if (cnt) {
+        return (cnt == 1 ? val : 0);
+    }
+#endif
+
+    *type = VTSS_TUPE_TYPE_VALUE;
+    for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+        if (tupe->eps_val[port_no] == 0) {
+            continue;
+        }
+        port_p = vtss_state->l2.port_protect[port_no].conf.port_no;
+        if (VTSS_PORT_BF_GET(vlan_entry->member, port_no) || VTSS_PORT_BF_GET(vlan_entry->member, port_p)) {
+            val = tupe->eps_val[port_no];
+            cnt++;
+        }
+    }
+    return (cnt == 1 ? val : 0);
+}
+
+/* Update VLAN table shadow and TUPE value */
+static vtss_rc fa_vlan_tupe_update(vtss_state_t *vtss_state, vtss_vid_t vid, BOOL member[VTSS_PORTS])
+{
+    vtss_tupe_state_t    *tupe = &vtss_state->tupe;
+    vtss_tupe_val_type_t type = VTSS_TUPE_TYPE_VALUE;
+    vtss_tupe_val_t      val;
+    vtss_port_no_t       port_no;
+
+    for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+        VTSS_PORT_BF_SET(tupe->vlan_member[vid], port_no, member[port_no]);
+    }
+    if ((val = fa_vlan_tupe_val(vtss_state, vid, &type)) == tupe->vlan_val[vid]) {
+        return VTSS_RC_OK;
+    }
+    tupe->vlan_val[vid] = val;
+    return (val == 0 ? fa_tupe_vlan_clr(vtss_state, vid) : fa_tupe_vlan_set(vtss_state, vid, type, val));
+}
+#endif /* VTSS_FEATURE_TUPE */
+
 static vtss_rc fa_vlan_mask_update(vtss_state_t *vtss_state,
                                    vtss_vid_t   vid,
                                    BOOL         member[VTSS_PORTS])
@@ -537,10 +605,148 @@ static vtss_rc fa_vlan_mask_update(vtss_state_t *vtss_state,
 
     vtss_port_mask_get(vtss_state, member, &pmask);
     REG_WRX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, vid, pmask);
+#if defined(VTSS_FEATURE_TUPE)
+    VTSS_RC(fa_vlan_tupe_update(vtss_state, vid, member));
+#endif
 
     return vtss_fa_vlan_update(vtss_state, vid);
 }
 
+#if defined(VTSS_FEATURE_TUPE)
+/* Do a protection switch by one TUPE command for the VLANs with the TUPE value.
+   This is only done if all these VLANs get the same port changes, and no other VLANs change */
+static vtss_rc fa_vlan_tupe_switch(vtss_state_t *vtss_state, vtss_tupe_val_t val, BOOL *done)
+{
+    vtss_tupe_state_t *tupe = &vtss_state->tupe;
+    vtss_tupe_parms_t parms;
+    BOOL              member[VTSS_PORT_ARRAY_SIZE], old, change = FALSE;
+    vtss_vid_t        vid;
+    vtss_port_no_t    port_no;
+    u32               pass;
+
+    *done = FALSE;
+    if (val == 0) {
+        return VTSS_RC_OK;
+    }
+
+    /* The first pass finds the port changes, the second pass checks them for each VLAN */
+    VTSS_MEMSET(&parms, 0, sizeof(parms));
+    for (pass = 0; pass < 2; pass++) {
+        for (vid = VTSS_VID_NULL; vid < VTSS_VIDS; vid++) {
+            if (!(vtss_state->l2.vlan_table[vid].flags & VLAN_FLAGS_ENABLED)) {
+                continue;
+            }
+            VTSS_RC(vtss_cmn_vlan_members_get(vtss_state, vid, member));
+            for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+                old = VTSS_PORT_BF_GET(tupe->vlan_member[vid], port_no);
+                if (tupe->vlan_val[vid] != val) {
+                    if (member[port_no] != old) {
+                        return VTSS_RC_OK;
+                    }
+                } else if (pass == 0) {
+                    if (member[port_no] != old) {
+                        change = TRUE;
+                        parms.set_port_list[port_no] |= member[port_no];
+                        parms.clr_port_list[port_no] |= old;
+                    }
+                } else if (member[port_no] != ((old && !parms.clr_port_list[port_no]) || parms.set_port_list[port_no])) {
+                    return VTSS_RC_OK;
+                }
+            }
+        }
+    }
+
+    if (change) {
+        parms.start_addr = VTSS_VID_NULL;
+        parms.end_addr = (VTSS_VIDS - 1);
+        parms.value = val;
+        VTSS_RC(fa_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_BLOCKING, &parms));
+        for (vid = VTSS_VID_NULL; vid < VTSS_VIDS; vid++) {
+            if (tupe->vlan_val[vid] != val) {
+                continue;
+            }
+            for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+                if (parms.set_port_list[port_no]) {
+                    VTSS_PORT_BF_SET(tupe->vlan_member[vid], port_no, 1);
+                } else if (parms.clr_port_list[port_no]) {
+                    VTSS_PORT_BF_SET(tupe->vlan_member[vid], port_no, 0);
+                }
+            }
+        }
+        vtss_state->l2.vlan_filter_changed = TRUE;
+        tupe->sweep_cnt++;
+    }
+    *done = TRUE;
+    return VTSS_RC_OK;
+}
+
+#if defined(VTSS_FEATURE_L2_ERPS)
+static vtss_rc fa_erps_vlan_member_set(vtss_state_t *vtss_state,
+                                       const vtss_erpi_t erpi,
+                                       const vtss_vid_t  vid)
+{
+    vtss_erps_entry_t *erps_entry = &vtss_state->l2.erps_table[erpi];
+    vtss_tupe_val_t   *val = &vtss_state->tupe.erps_val[erpi];
+    u32               i;
+
+    if (VTSS_BF_GET(erps_entry->vlan_member, vid)) {
+        if (*val == 0 && fa_tupe_alloc(vtss_state, VTSS_TUPE_TYPE_BITS, val) != VTSS_RC_OK) {
+            /* No ring protection bits left, the ring VLANs are updated one by one */
+            *val = 0;
+        }
+    } else if (*val != 0) {
+        for (i = 0; i < sizeof(erps_entry->vlan_member); i++) {
+            if (erps_entry->vlan_member[i]) {
+                break;
+            }
+        }
+        if (i == sizeof(erps_entry->vlan_member)) {
+            /* Last VLAN removed from ring */
+            VTSS_RC(fa_tupe_free(vtss_state, *val));
+            *val = 0;
+        }
+    }
+    return vtss_cmn_erps_vlan_member_set(vtss_state, erpi, vid);
+}
+
+static vtss_rc fa_erps_port_state_set(vtss_state_t *vtss_state,
+                                      const vtss_erpi_t    erpi,
+                                      const vtss_port_no_t port_no)
+{
+    vtss_vid_t vid;
+    BOOL       done;
+
+    VTSS_RC(fa_vlan_tupe_switch(vtss_state, vtss_state->tupe.erps_val[erpi], &done));
+    if (!done) {
+        return vtss_cmn_erps_port_state_set(vtss_state, erpi, port_no);
+    }
+    for (vid = VTSS_VID_NULL; vid < VTSS_VIDS; vid++) {
+        vtss_state->l2.vlan_table[vid].flags &= ~VLAN_FLAGS_UPDATE;
+    }
+    return VTSS_RC_OK;
+}
+#endif /* VTSS_FEATURE_L2_ERPS */
+
+static vtss_rc fa_eps_port_set(vtss_state_t *vtss_state, const vtss_port_no_t port_w)
+{
+    vtss_eps_port_conf_t *conf = &vtss_state->l2.port_protect[port_w].conf;
+    vtss_tupe_val_t      *val = &vtss_state->tupe.eps_val[port_w];
+    BOOL                 done;
+
+    if (conf->type == VTSS_EPS_PORT_1_FOR_1 && conf->port_no != VTSS_PORT_NO_NONE) {
+        if (*val == 0 && fa_tupe_alloc(vtss_state, VTSS_TUPE_TYPE_VALUE, val) != VTSS_RC_OK) {
+            /* No linear protection values left, the VLANs are updated one by one */
+            *val = 0;
+        }
+    } else if (*val != 0) {
+        VTSS_RC(fa_tupe_free(vtss_state, *val));
+        *val = 0;
+    }
+    VTSS_RC(fa_vlan_tupe_switch(vtss_state, *val, &done));
+    return (done ? VTSS_RC_OK : vtss_cmn_eps_port_set(vtss_state, port_w));
+}
+#endif /* VTSS_FEATURE_TUPE */
+
 static vtss_rc fa_vlan_port_conf_update(vtss_state_t *vtss_state,
                                         vtss_port_no_t port_no, vtss_vlan_port_conf_t *conf)
 {
@@ -955,20 +1161,17 @@ static vtss_rc fa_mirror_conf_set(vtss_state_t *vtss_state)
             vtss_port_mask_clear(&pmask);
         } else if (probe == FA_MIRROR_PROBE_RX) {
             /* Ingress probe */
-            vtss_port_mask_get(vtss_state, vtss_state->l2.mirror_ingress, &pmask);
+            vtss_port_set_mask_get(vtss_state, &vtss_state->l2.mirror_ingress, &pmask);
             if (vtss_state->l2.mirror_cpu_ingress) {
                 rx_cpu = 0x3; /* Enable Rx mirror from both CPU ports */
             }
         } else if (probe == FA_MIRROR_PROBE_TX) {
             /* Egress probe */
             dir = 1;
-            vtss_port_mask_get(vtss_state, vtss_state->l2.mirror_egress, &pmask);
-            for (port_no = 0; port_no < vtss_state->port_count; port_no++) {
-                if (vtss_state->l2.mirror_egress[port_no]) {
-                    /* The first egress port is used in the rewriter */
-                    tx_port = VTSS_CHIP_PORT(port_no);
-                    break;
-                }
+            vtss_port_set_mask_get(vtss_state, &vtss_state->l2.mirror_egress, &pmask);
+            if ((port_no = vtss_port_set_next(&vtss_state->l2.mirror_egress, VTSS_PORT_NO_START)) != VTSS_PORT_NO_NONE) {
+                /* The first egress port is used in the rewriter */
+                tx_port = VTSS_CHIP_PORT(port_no);
             }
             if (vtss_state->l2.mirror_cpu_egress) {
                 cpu_set = 0xff;
@@ -2057,6 +2260,12 @@ static vtss_rc fa_l2_port_map_set(vtss_state_t *vtss_state)
 
 static vtss_rc fa_l2_init(vtss_state_t *vtss_state)
 {
+#if defined(VTSS_FEATURE_TUPE)
+    if (vtss_state->tupe.tupe_bits_bits == 0) {
+        /* 8 bits for linear protection values, 8 bits for ring protection */
+        VTSS_RC(fa_tupe_init(vtss_state, 8));
+    }
+#endif
     return VTSS_RC_OK;
 }
 
@@ -2153,8 +2362,13 @@ vtss_rc vtss_fa_l2_init(vtss_state_t *vtss_state, vtss_init_cmd_t cmd)
         state->learn_state_set             = fa_learn_state_set;
         state->mstp_state_set              = fa_mstp_state_set;
         state->mstp_vlan_msti_set          = vtss_cmn_vlan_members_set;
+#if defined(VTSS_FEATURE_TUPE)
+        state->erps_vlan_member_set        = fa_erps_vlan_member_set;
+        state->erps_port_state_set         = fa_erps_port_state_set;
+#else
         state->erps_vlan_member_set        = vtss_cmn_erps_vlan_member_set;
         state->erps_port_state_set         = vtss_cmn_erps_port_state_set;
+#endif
         state->pgid_table_write            = fa_pgid_table_write;
         state->src_table_write             = fa_src_table_write;
         state->aggr_table_write            = fa_aggr_table_write;
@@ -2179,7 +2393,11 @@ vtss_rc vtss_fa_l2_init(vtss_state_t *vtss_state, vtss_init_cmd_t cmd)
         state->mirror_egress_set           = fa_mirror_egress_set;
         state->mirror_cpu_ingress_set      = fa_mirror_cpu_ingress_set;
         state->mirror_cpu_egress_set       = fa_mirror_cpu_egress_set;
+#if defined(VTSS_FEATURE_TUPE)
+        state->eps_port_set                = fa_eps_port_set;
+#else
         state->eps_port_set                = vtss_cmn_eps_port_set;
+#endif
         state->sflow_port_conf_set         = fa_sflow_port_conf_set;
         state->sflow_sampling_rate_convert = fa_sflow_sampling_rate_convert;
 #if defined(VTSS_FEATURE_VLAN_COUNTERS)
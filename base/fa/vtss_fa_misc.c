@@ -1023,6 +1023,8 @@ static vtss_rc fa_debug_misc(vtss_state_t *vtss_state,
 {
     u32  i, g;
     char name[32];
+
+    vtss_fa_debug_reg_profile(vtss_state, pr);
     pr("Name          Target\n");
 
     vtss_fa_debug_reg_header(pr, "GPIOs");
@@ -1098,6 +1100,9 @@ vtss_rc vtss_fa_misc_init(vtss_state_t *vtss_state, vtss_init_cmd_t cmd)
     if (cmd == VTSS_INIT_CMD_CREATE) {
         state->reg_read = fa_reg_read;
         state->reg_write = fa_reg_write;
+        state->reg_profile_enable = vtss_fa_reg_profile_enable;
+        state->reg_profile_clear = vtss_fa_reg_profile_clear;
+        state->reg_profile_get = vtss_fa_reg_profile_get;
         state->chip_id_get = vtss_fa_chip_id_get;
         state->poll_1sec = fa_poll_1sec;
         state->gpio_mode = vtss_fa_gpio_mode;
@@ -2236,13 +2236,109 @@ static vtss_rc tas_profile_free(vtss_state_t *vtss_state,  u32 profile_idx)
     return VTSS_RC_OK;
 }
 
+/* GCL entries are allocated in aligned buddies of (1 << order) blocks.
+   A free buddy is split when a smaller buddy is needed, and is merged
+   with its free neighbour buddy when it is freed, so free entries always
+   form the largest possible buddies. */
+static void tas_buddy_free_set(vtss_state_t *vtss_state, u32 block, u32 order, BOOL free)
+{
+    vtss_tas_entry_block_t *blk = &vtss_state->qos.tas.tas_entry_blocks[block];
+
+    blk->free = free;
+    blk->order = order;
+    if (free) {
+        vtss_state->qos.tas.tas_free_cnt[order]++;
+    } else {
+        vtss_state->qos.tas.tas_free_cnt[order]--;
+    }
+}
+
+static void tas_buddy_init(vtss_state_t *vtss_state)
+{
+    u32 row;
+
+    VTSS_MEMSET(&vtss_state->qos.tas.tas_entry_blocks, 0, sizeof(vtss_state->qos.tas.tas_entry_blocks));
+    VTSS_MEMSET(&vtss_state->qos.tas.tas_free_cnt, 0, sizeof(vtss_state->qos.tas.tas_free_cnt));
+    for (row = 0; row < VTSS_TAS_NUMBER_OF_ROWS; row++) {
+        tas_buddy_free_set(vtss_state, row * VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW, VTSS_TAS_NUMBER_OF_ORDERS - 1, TRUE);
+    }
+}
+
+/* Number of free entries and the longest list that can currently be allocated */
+static void tas_buddy_free_get(vtss_state_t *vtss_state, u32 *free_entries, u32 *max_length)
+{
+    u32 order, *cnt = vtss_state->qos.tas.tas_free_cnt;
+
+    *free_entries = 0;
+    *max_length = 0;
+    for (order = 0; order < VTSS_TAS_NUMBER_OF_ORDERS; order++) {
+        *free_entries += (cnt[order] << order) * VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK;
+        if (cnt[order]) {
+            *max_length = (1 << order) * VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK;
+        }
+    }
+}
+
+static u32 tas_buddy_alloc(vtss_state_t *vtss_state, u32 order)
+{
+    vtss_tas_entry_block_t *blocks = vtss_state->qos.tas.tas_entry_blocks;
+    u32                    block, k;
+
+    /* Use the smallest free buddy, so larger buddies are kept for long lists */
+    for (k = order; k < VTSS_TAS_NUMBER_OF_ORDERS && vtss_state->qos.tas.tas_free_cnt[k] == 0; k++) {
+    }
+    if (k == VTSS_TAS_NUMBER_OF_ORDERS) {
+        return VTSS_TAS_NUMBER_OF_BLOCKS;
+    }
+    for (block = 0; block < VTSS_TAS_NUMBER_OF_BLOCKS; block += (1 << k)) {
+        if (blocks[block].free && blocks[block].order == k) {
+            break;
+        }
+    }
+    if (block == VTSS_TAS_NUMBER_OF_BLOCKS) {
+        VTSS_E("free buddy of order %u not found", k);
+        return VTSS_TAS_NUMBER_OF_BLOCKS;
+    }
+    tas_buddy_free_set(vtss_state, block, k, FALSE);
+
+    /* Split the buddy, the upper halves are returned as free buddies */
+    while (k > order) {
+        k--;
+        tas_buddy_free_set(vtss_state, block + (1 << k), k, TRUE);
+    }
+    blocks[block].in_use = TRUE;
+    blocks[block].order = order;
+    return block;
+}
+
+static void tas_buddy_free(vtss_state_t *vtss_state, u32 block)
+{
+    vtss_tas_entry_block_t *blocks = vtss_state->qos.tas.tas_entry_blocks;
+    u32                    buddy, order = blocks[block].order;
+
+    if (!blocks[block].in_use) {
+        VTSS_E("block %u is not in use", block);
+        return;
+    }
+    blocks[block].in_use = FALSE;
+
+    /* Merge with the neighbour buddy as long as it is free */
+    while (order < (VTSS_TAS_NUMBER_OF_ORDERS - 1)) {
+        buddy = (block ^ (1 << order));
+        if (!blocks[buddy].free || blocks[buddy].order != order) {
+            break;
+        }
+        tas_buddy_free_set(vtss_state, buddy, order, FALSE);
+        block = (block & buddy);
+        order++;
+    }
+    tas_buddy_free_set(vtss_state, block, order, TRUE);
+}
+
 static u32 tas_list_allocate(vtss_state_t *vtss_state,  u32 length)
 {
-    u32                     blocks, req_blocks, list_idx, row_idx, slot_cnt, block_idx = VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW;
-    vtss_tas_entry_row_t    *row;
+    u32                     req_blocks, order, list_idx, block, free_entries, max_length;
     vtss_tas_list_t         *tas_lists = vtss_state->qos.tas.tas_lists;
-    vtss_tas_entry_row_t    *tas_entry_rows = vtss_state->qos.tas.tas_entry_rows;
-    vtss_tas_entry_block_t  (*tas_entry_blocks)[VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW] = vtss_state->qos.tas.tas_entry_blocks;
 
     VTSS_D("Enter length %u", length);
 
@@ -2261,45 +2357,17 @@ static u32 tas_list_allocate(vtss_state_t *vtss_state,  u32 length)
 
     /* Calculate the required allocated entries in blocks. Minimum 1 block. Maximum VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW blocks */
     req_blocks = (length/VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK) + (((length%VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK) != 0) ? 1 : 0);
-    /* Required blocks must be the size of a slot in a row. This must be 1-2-4 - ... - VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW blocks */
-    for (blocks = 1; blocks <= VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW; blocks <<= 1) {
-        if (req_blocks <= blocks) {
-            req_blocks = blocks;
-            break;
-        }
-    }
-    if (blocks > VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW) {
-        req_blocks = VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW;
+    /* The buddy order is the smallest with room for the required blocks */
+    for (order = 0; order < (VTSS_TAS_NUMBER_OF_ORDERS - 1) && (1U << order) < req_blocks; order++) {
     }
 
-    /* Find the empty slot in a row */
-    for (row_idx = 0; row_idx < VTSS_TAS_NUMBER_OF_ROWS; ++row_idx) {   /* Find a suitable row of blocks */
-        row = &tas_entry_rows[row_idx];
-        slot_cnt = (row->slot_size == 0) ? 0 : VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW/row->slot_size; /* Number of slots in this row */
-        if ((row->in_use == 0) || ((row->in_use < slot_cnt) && (row->slot_size == req_blocks))) { /* A row can be used if empty or not full and the slot size match the required allocate blocks */
-            if (row->in_use == 0) { /* This row is empty, take first slot */
-                block_idx = 0;  /* Indicate that the first slot in in this row is in use */
-            } else {    /* This row is not empty, find an empty slot */
-                for (block_idx = 0; block_idx < VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW; ++block_idx) {   /* Find an empty slot in the row */
-                    if (!tas_entry_blocks[row_idx][block_idx].in_use) {
-                        break;
-                    }
-                }
-            }
-            break; /* The empty slot is found - break */
-        }
-    }
-
-    if (block_idx < VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW) { /* An empty slot was found */
-        tas_entry_blocks[row_idx][block_idx].in_use = TRUE; /* Indicate that the slot in the row is in use */
-        row->in_use += 1;               /* Increment number of slots in use in the row */
-        row->slot_size = req_blocks;    /* Give row its slot size */
-        tas_lists[list_idx].in_use = TRUE; /* The found list is now in use */
-        tas_lists[list_idx].entry_idx = ((row_idx * VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW) + block_idx) * VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK; /* Calculate entry index for this list */
-    } else {
-        VTSS_D("No free entry slot was found in any row");
+    if ((block = tas_buddy_alloc(vtss_state, order)) == VTSS_TAS_NUMBER_OF_BLOCKS) {
+        tas_buddy_free_get(vtss_state, &free_entries, &max_length);
+        VTSS_D("No free entry block of order %u was found, free entries %u, max length %u", order, free_entries, max_length);
         return TAS_LIST_IDX_NONE;
     }
+    tas_lists[list_idx].in_use = TRUE; /* The found list is now in use */
+    tas_lists[list_idx].entry_idx = block * VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK; /* Calculate entry index for this list */
 
     VTSS_D("Exit list_idx %u", list_idx);
 
@@ -2308,10 +2376,7 @@ static u32 tas_list_allocate(vtss_state_t *vtss_state,  u32 length)
 
 static vtss_rc tas_list_free(vtss_state_t *vtss_state,  u32 list_idx)
 {
-    u32                     entry_idx, row_idx, block_idx, block_num;
     vtss_tas_list_t         *tas_lists = vtss_state->qos.tas.tas_lists;
-    vtss_tas_entry_row_t    *tas_entry_rows = vtss_state->qos.tas.tas_entry_rows;
-    vtss_tas_entry_block_t  (*tas_entry_blocks)[VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW] = vtss_state->qos.tas.tas_entry_blocks;
 
     if (list_idx >= VTSS_TAS_NUMBER_OF_LISTS) {
         return VTSS_RC_ERROR;
@@ -2320,18 +2385,7 @@ static vtss_rc tas_list_free(vtss_state_t *vtss_state,  u32 list_idx)
     VTSS_D("Enter list_idx %u  entry_idx %u", list_idx, tas_lists[list_idx].entry_idx);
 
     if (tas_lists[list_idx].entry_idx < VTSS_TAS_NUMBER_OF_ENTRIES) { /* Check if the list has entries */
-        entry_idx = tas_lists[list_idx].entry_idx;
-        block_num = (entry_idx / VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK);
-        row_idx = block_num / VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW;
-        block_idx = block_num % VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW;
-
-        tas_entry_blocks[row_idx][block_idx].in_use = FALSE; /* Free the slot in the row */
-        if (tas_entry_rows[row_idx].in_use > 0) {
-            tas_entry_rows[row_idx].in_use -= 1;    /* Decrement the number of used slots in the row */
-            if (tas_entry_rows[row_idx].in_use == 0) {
-                tas_entry_rows[row_idx].slot_size = 0;  /* The slot size of this empty row is unknown */
-            }
-        }
+        tas_buddy_free(vtss_state, tas_lists[list_idx].entry_idx / VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK); /* Free the entry blocks */
     }
 
     if (!tas_lists[list_idx].inherit_profile) {   /* Inherit profiles are not freed */
@@ -4287,25 +4341,26 @@ static vtss_rc fa_debug_qos(vtss_state_t *vtss_state,
             pr("\n");
 
             pr("Entry blocks:\n");
-            pr("Row   Block  in_use\n");
-            pr("-------------------\n");
-            for (i = 0; i < VTSS_TAS_NUMBER_OF_ROWS; i++) {
-                for (j = 0; j < VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW; j++) {
-                    if (vtss_state->qos.tas.tas_entry_blocks[i][j].in_use) {
-                        pr("%-6u%-7u%-6u\n", i, j, vtss_state->qos.tas.tas_entry_blocks[i][j].in_use);
-                    }
+            pr("Row   Block  Entries\n");
+            pr("--------------------\n");
+            for (i = 0; i < VTSS_TAS_NUMBER_OF_BLOCKS; i++) {
+                vtss_tas_entry_block_t *blk = &vtss_state->qos.tas.tas_entry_blocks[i];
+
+                if (blk->in_use) {
+                    pr("%-6u%-7u%-7u\n", i / VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW, i % VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW,
+                       (1 << blk->order) * VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK);
                 }
             }
             pr("\n");
 
-            pr("Entry rows:\n");
-            pr("Row   in_use  slot_size\n");
-            pr("-----------------------\n");
-            for (i = 0; i < VTSS_TAS_NUMBER_OF_ROWS; i++) {
-                if (vtss_state->qos.tas.tas_entry_rows[i].in_use) {
-                    pr("%-6u%-7u%-9u\n", i, vtss_state->qos.tas.tas_entry_rows[i].in_use, vtss_state->qos.tas.tas_entry_rows[i].slot_size);
-                }
+            pr("Free buddies:\n");
+            pr("Entries  Count\n");
+            pr("--------------\n");
+            for (i = 0; i < VTSS_TAS_NUMBER_OF_ORDERS; i++) {
+                pr("%-9u%-5u\n", (1 << i) * VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK, vtss_state->qos.tas.tas_free_cnt[i]);
             }
+            tas_buddy_free_get(vtss_state, &i, &j);
+            pr("Free entries: %u, max list length: %u\n", i, j);
             pr("\n");
         }
         pr("GCL register configuration:\n");
@@ -4717,6 +4772,10 @@ static vtss_rc fa_qos_init(vtss_state_t *vtss_state)
     if (VTSS_QOS_TAS_GCL_LEN_MAX % VTSS_TAS_NUMBER_OF_ENTRIES_PER_BLOCK) {
         VTSS_E("VTSS_QOS_TAS_GCL_LEN_MAX %u is invalid", VTSS_QOS_TAS_GCL_LEN_MAX);
     }
+    // The largest buddy must be a row of blocks
+    if ((1 << (VTSS_TAS_NUMBER_OF_ORDERS - 1)) != VTSS_TAS_NUMBER_OF_BLOCKS_PER_ROW) {
+        VTSS_E("VTSS_TAS_NUMBER_OF_ORDERS %u is invalid", VTSS_TAS_NUMBER_OF_ORDERS);
+    }
 
     for (u32 port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
         vtss_state->qos.tas.tas_gcl_state[port_no].stop_ongoing = FALSE;
@@ -4734,8 +4793,7 @@ static vtss_rc fa_qos_init(vtss_state_t *vtss_state)
     }
     VTSS_MEMSET(&vtss_state->qos.tas.tas_lists, 0, sizeof(vtss_state->qos.tas.tas_lists));
     VTSS_MEMSET(&vtss_state->qos.tas.tas_profiles, 0, sizeof(vtss_state->qos.tas.tas_profiles));
-    VTSS_MEMSET(&vtss_state->qos.tas.tas_entry_blocks, 0, sizeof(vtss_state->qos.tas.tas_entry_blocks));
-    VTSS_MEMSET(&vtss_state->qos.tas.tas_entry_rows, 0, sizeof(vtss_state->qos.tas.tas_entry_rows));
+    tas_buddy_init(vtss_state);
 
     for (i = 0; i < VTSS_TAS_NUMBER_OF_LISTS; i++) {
         vtss_state->qos.tas.tas_lists[i].profile_idx = TAS_PROFILE_IDX_NONE;
@@ -562,17 +562,37 @@ static u32 api_port(vtss_state_t *vtss_state, u32 chip_port)
     return port_no;
 }
 
+/* Max number of two-step timestamps drained from the FIFO pr. call */
+#define FA_TS_FIFO_BUDGET 64
+
+/* Count a FIFO overflow flagged in the Tx or Rx part of the entry for 'tx_port' */
+static void fa_ts_fifo_ovfl(vtss_state_t *vtss_state, u32 tx_port)
+{
+    vtss_state->ts.fifo_cnt.ovfl_cnt++;
+    if (tx_port < VTSS_PORT_ARRAY_SIZE) {
+        vtss_state->ts.tx_cnt[tx_port].ovfl_cnt++;
+    }
+}
+
 static vtss_rc fa_ts_timestamp_get(vtss_state_t *vtss_state)
 {
+    vtss_ts_fifo_cnt_t *cnt = &vtss_state->ts.fifo_cnt;
     u32  value;
     u32  delay;
     u32  tx_port;
     u32  mess_id;
-    BOOL overflow = FALSE;
     u32  sub_ns;
+    u32  entries = 0;
+    BOOL overflow;
 
     REG_RD(VTSS_REW_PTP_TWOSTEP_CTRL, &value);
     while (VTSS_X_REW_PTP_TWOSTEP_CTRL_PTP_VLD(value)) {
+        if (entries == FA_TS_FIFO_BUDGET) {
+            /* Leave the rest for the next call, so the API lock is not held for too long */
+            cnt->budget_cnt++;
+            cnt->drain_max = entries;
+            return VTSS_RC_INCOMPLETE;
+        }
         /* Read TX timestamp */
         if (!VTSS_X_REW_PTP_TWOSTEP_CTRL_STAMP_TX(value)) {
             VTSS_E("TX timestamp expected but RX timestamp found");
@@ -580,9 +600,9 @@ static vtss_rc fa_ts_timestamp_get(vtss_state_t *vtss_state)
             REG_RD(VTSS_REW_PTP_TWOSTEP_CTRL, &value);
             continue;
         }
-        overflow |= VTSS_X_REW_PTP_TWOSTEP_CTRL_PTP_OVFL(value);
-        REG_RD(VTSS_REW_PTP_TWOSTEP_STAMP, &delay);
         tx_port = api_port(vtss_state, VTSS_X_REW_PTP_TWOSTEP_CTRL_STAMP_PORT(value));
+        overflow = VTSS_X_REW_PTP_TWOSTEP_CTRL_PTP_OVFL(value);
+        REG_RD(VTSS_REW_PTP_TWOSTEP_STAMP, &delay);
         REG_RD(VTSS_REW_PTP_TWOSTEP_STAMP_SUBNS, &sub_ns);
         /* Read RX timestamp */
         REG_WR(VTSS_REW_PTP_TWOSTEP_CTRL, VTSS_F_REW_PTP_TWOSTEP_CTRL_PTP_NXT(1));
@@ -590,12 +610,18 @@ static vtss_rc fa_ts_timestamp_get(vtss_state_t *vtss_state)
         if (!VTSS_X_REW_PTP_TWOSTEP_CTRL_PTP_VLD(value) ||
             VTSS_X_REW_PTP_TWOSTEP_CTRL_STAMP_TX(value)) {
             VTSS_E("RX timestamp not found");
+            if (overflow) {
+                fa_ts_fifo_ovfl(vtss_state, tx_port);
+            }
             REG_WR(VTSS_REW_PTP_TWOSTEP_CTRL, VTSS_F_REW_PTP_TWOSTEP_CTRL_PTP_NXT(1));
             REG_RD(VTSS_REW_PTP_TWOSTEP_CTRL, &value);
             continue;
         }
-        overflow |= VTSS_X_REW_PTP_TWOSTEP_CTRL_PTP_OVFL(value);
+        if (overflow || VTSS_X_REW_PTP_TWOSTEP_CTRL_PTP_OVFL(value)) {
+            fa_ts_fifo_ovfl(vtss_state, tx_port);
+        }
         REG_RD(VTSS_REW_PTP_TWOSTEP_STAMP, &mess_id);
+        entries++;
 
         if (mess_id >= VTSS_TS_ID_SIZE) {
             VTSS_D("skip mess_id %u", mess_id);
@@ -611,8 +637,8 @@ static vtss_rc fa_ts_timestamp_get(vtss_state_t *vtss_state)
         REG_WR(VTSS_REW_PTP_TWOSTEP_CTRL, VTSS_F_REW_PTP_TWOSTEP_CTRL_PTP_NXT(1));
         REG_RD(VTSS_REW_PTP_TWOSTEP_CTRL, &value);
     }
-    if (overflow) {
-        VTSS_E("Timestamp fifo overflow occurred");
+    if (entries > cnt->drain_max) {
+        cnt->drain_max = entries;
     }
     return VTSS_RC_OK;
 }
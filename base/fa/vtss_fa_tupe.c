@@ -6,7 +6,7 @@
 #include "vtss_fa_cil.h"
 
 #if defined(VTSS_ARCH_FA)
-#if defined(VTSS_FEATURE_HW_PROT)
+#if defined(VTSS_FEATURE_TUPE)
 
 #include "vtss_fa_tupe.h"
 
@@ -14,48 +14,385 @@
 
 /* - CIL functions ------------------------------------------------- */
 
+#define TUPE_BITS_MAX     (vtss_state->tupe.tupe_bits_bits)
+#define TUPE_VALS_MAX     ((1 << vtss_state->tupe.tupe_vals_bits) & ~1)
+#define AFI_TUPE_VALS_MAX (1 << AFI_TUPE_CTRL_MAX)
+
+/* Chip port bit in port mask */
+#define TUPE_PMASK_SET(_m, _p) (_m).m[(_p) / 32] |= VTSS_BIT((_p) % 32)
+#define TUPE_PMASK_CLR(_m, _p) (_m).m[(_p) / 32] &= ~VTSS_BIT((_p) % 32)
+#define TUPE_PMASK_GET(_m, _p) ((_m).m[(_p) / 32] & VTSS_BIT((_p) % 32))
+
+/* Chip ports not mapped to any port, their port mask bits may be used for TUPE bits */
+static void tupe_unused_pmask(vtss_state_t *vtss_state, vtss_port_mask_t *unused)
+{
+    vtss_port_no_t port_no;
+    u32            chip_port;
+
+    vtss_port_mask_clear(unused);
+    for (chip_port = 0; chip_port < VTSS_CHIP_PORTS; chip_port++) {
+        TUPE_PMASK_SET(*unused, chip_port);
+    }
+    for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+        if (VTSS_CHIP_PORT(port_no) != CHIP_PORT_UNUSED) {
+            TUPE_PMASK_CLR(*unused, VTSS_CHIP_PORT(port_no));
+        }
+    }
+}
+
+/* check that 'val' has one and only one bit set */
+static BOOL check_bit(vtss_tupe_val_t val, u32 *bit)
+{
+    u32 i, cnt;
+
+    for (i = 0, cnt = 0; i < 32; ++i) {
+        if (val & (1 << i)) {
+            cnt++;
+            *bit = i;
+        }
+    }
+    return (cnt == 1);
+}
+
+/* check TUPE value is valid */
+static BOOL check_tupe_value(vtss_state_t *vtss_state,
+                             vtss_tupe_val_t val)
+{
+    u32 i = 0;
+
+    if (val < TUPE_VALS_MAX &&
+        !(vtss_state->tupe.tupe_vals_free[val / 32] & (1 << (val % 32)))) {
+        return val != 0;
+    }
+    if (check_bit(val / TUPE_VALS_MAX, &i) &&
+        i < TUPE_BITS_MAX &&
+        !(vtss_state->tupe.tupe_bits_free & (1 << i))) {
+        return TRUE;
+    }
+    return FALSE;
+}
+
 /* Perform a TUPE command */
 vtss_rc fa_tupe_cmd(vtss_state_t *vtss_state,
-                    vtss_tupe_cmd_t cmd, vtss_tupe_parms_t *parms)
+                     vtss_tupe_cmd_t cmd, vtss_tupe_parms_t *parms)
 {
+    const u32 max_addr = VTSS_VIDS + VTSS_VSI_CNT;
+    u32 v, cnt;
+    vtss_port_mask_t pmask;
+    u8  use_bits, use_comb;
+    u16 mask;
+    vtss_port_mask_t unused;
+    u32 chip_port;
+    vtss_mtimer_t timer;
+
+    VTSS_D("Enter cmd=%u", cmd);
+
+    if (cmd == VTSS_TUPE_CMD_QUERY) { // Query if TUPE is ready
+        REG_RD(VTSS_ANA_L3_TUPE_MISC, &v);
+        return VTSS_X_ANA_L3_TUPE_MISC_TUPE_START(v) == 0 ? VTSS_RC_OK : VTSS_RC_INCOMPLETE;
+    } else if (cmd == VTSS_TUPE_CMD_START_NONBLOCKING || // Start TUPE (nonblocking)
+               cmd == VTSS_TUPE_CMD_START_BLOCKING) {    // Start TUPE and wait for completion (blocking)
+        if (parms) {
+            VTSS_D("parms start_addr=%u end_addr=%u value=0x%08x", parms->start_addr, parms->end_addr, parms->value);
+        }
+        if (!parms || !check_tupe_value(vtss_state, parms->value) ||
+            parms->start_addr > parms->end_addr ||
+            parms->start_addr > max_addr ||
+            parms->end_addr > max_addr) {
+            VTSS_D("Invalid parameters");
+            return VTSS_RC_ERR_PARM; // invalid parameters
+        }
+
+        // check if ready:
+        REG_RD(VTSS_ANA_L3_TUPE_MISC, &v);
+        if (VTSS_X_ANA_L3_TUPE_MISC_TUPE_START(v) != 0) {
+            VTSS_D("TUPE not ready");
+            return VTSS_RC_INCOMPLETE; // TUPE not ready
+        }
+
+        v = VTSS_F_ANA_L3_TUPE_ADDR_TUPE_END_ADDR(parms->end_addr) |
+            VTSS_F_ANA_L3_TUPE_ADDR_TUPE_START_ADDR(parms->start_addr);
+        REG_WR(VTSS_ANA_L3_TUPE_ADDR, v);
+
+        vtss_port_mask_get(vtss_state, parms->set_port_list, &pmask);
+        REG_WR_PMASK(VTSS_ANA_L3_TUPE_CMD_PORT_MASK_SET, pmask);
+
+        vtss_port_mask_get(vtss_state, parms->clr_port_list, &pmask);
+        REG_WR_PMASK(VTSS_ANA_L3_TUPE_CMD_PORT_MASK_CLR, pmask);
+
+        use_bits = (parms->value < TUPE_VALS_MAX) ? 0 : 1;
+        use_comb = (vtss_state->tupe.tupe_bits_bits + vtss_state->tupe.tupe_vals_bits) > TUPE_CTRL_MAX ? 1 : 0;
+        if (use_bits == 0) {
+            REG_WR(VTSS_ANA_L3_TUPE_CTRL_VAL, parms->value);
+            REG_WR(VTSS_ANA_L3_TUPE_CTRL_VAL_MASK, TUPE_VALS_MAX - 1);
+        } else {
+            REG_WR(VTSS_ANA_L3_TUPE_CTRL_BIT_MASK, parms->value);
+            if (use_comb) {
+                vtss_port_mask_clear(&pmask);
+                mask = parms->value >> TUPE_CTRL_MAX;
+                if (mask) {
+                    // must use portmask bit, look through tupe_bits_bits+tupe_vals_bits-TUPE_CTRL_MAX unused ports:
+                    cnt = vtss_state->tupe.tupe_bits_bits - (TUPE_CTRL_MAX - vtss_state->tupe.tupe_vals_bits);
+                    tupe_unused_pmask(vtss_state, &unused);
+                    for (chip_port = 0; chip_port < VTSS_CHIP_PORTS && cnt < vtss_state->tupe.tupe_bits_bits; chip_port++) {
+                        if (!TUPE_PMASK_GET(unused, chip_port)) {
+                            continue;
+                        }
+                        if (mask & 1) {
+                            TUPE_PMASK_SET(pmask, chip_port);
+                            break;
+                        }
+                        cnt++;
+                        mask >>= 1;
+                    }
+                }
+                REG_WR_PMASK(VTSS_ANA_L3_TUPE_PORT_MASK_A, pmask);
+            }
+        }
+
+        v = VTSS_F_ANA_L3_TUPE_MISC_TUPE_COMB_MASK_ENA(use_comb)    |
+            VTSS_F_ANA_L3_TUPE_MISC_TUPE_PORT_MASK_B_ENA(0)         |
+            VTSS_F_ANA_L3_TUPE_MISC_TUPE_PORT_MASK_A_ENA(use_comb)  |
+            VTSS_F_ANA_L3_TUPE_MISC_TUPE_CTRL_BIT_ENA(use_bits)     |
+            VTSS_F_ANA_L3_TUPE_MISC_TUPE_CTRL_VAL_ENA(use_bits ^ 1) |
+            VTSS_F_ANA_L3_TUPE_MISC_TUPE_START(1); // initiate TUPE
+        REG_WR(VTSS_ANA_L3_TUPE_MISC, v);
+
+        if (cmd == VTSS_TUPE_CMD_START_BLOCKING) { // wait for completion
+            VTSS_MTIMER_START(&timer, TUPE_WAIT_MSEC);
+            while (1) {
+                REG_RD(VTSS_ANA_L3_TUPE_MISC, &v);
+                if (VTSS_X_ANA_L3_TUPE_MISC_TUPE_START(v) == 0) {
+                    break;
+                }
+                if (VTSS_MTIMER_TIMEOUT(&timer)) {
+                    VTSS_E("Timeout waiting for TUPE completion");
+                    return VTSS_RC_ERROR;
+                }
+            }
+        }
+    } else {
+        VTSS_D("Invalid cmd");
+        return VTSS_RC_ERR_PARM;
+    }
+    VTSS_D("Exit ok");
     return VTSS_RC_OK;
 }
 
 /* Allocate a TUPE value (bits or value) */
 vtss_rc fa_tupe_alloc(vtss_state_t *vtss_state,
-                      vtss_tupe_val_type_t type, vtss_tupe_val_t *val)
+                       vtss_tupe_val_type_t type, vtss_tupe_val_t *val)
 {
-    return VTSS_RC_OK;
+    u32 i;
+
+    VTSS_D("Enter type=%u", type);
+
+    if (vtss_state->tupe.tupe_vals_next == 0) {
+        vtss_state->tupe.tupe_vals_next = 1; // 0 is reserved
+    }
+    if (type == VTSS_TUPE_TYPE_BITS) {
+        for (i = 0; i < TUPE_BITS_MAX; ++i) {
+            if (vtss_state->tupe.tupe_bits_free & (1 << i)) {
+                vtss_state->tupe.tupe_bits_free &= ~(1 << i);
+                *val = (1 << i) * TUPE_VALS_MAX;
+                VTSS_D("Exit ok, *val=0x%08x", *val);
+                return VTSS_RC_OK;
+            }
+        }
+    } else if (type == VTSS_TUPE_TYPE_VALUE) {
+        for (i = 0; i < TUPE_VALS_MAX; ++i) {
+            if (vtss_state->tupe.tupe_vals_free[vtss_state->tupe.tupe_vals_next / 32] & (1 << (vtss_state->tupe.tupe_vals_next % 32))) {
+                *val = vtss_state->tupe.tupe_vals_next;
+                vtss_state->tupe.tupe_vals_free[vtss_state->tupe.tupe_vals_next / 32] &= ~(1 << (vtss_state->tupe.tupe_vals_next % 32));
+                VTSS_D("Exit ok, *val=0x%08x", *val);
+                return VTSS_RC_OK;
+            }
+            vtss_state->tupe.tupe_vals_next++;
+            if (vtss_state->tupe.tupe_vals_next >= TUPE_VALS_MAX) {
+                vtss_state->tupe.tupe_vals_next = 1; // 0 is reserved
+            }
+        }
+    }
+    VTSS_D("Failed");
+    return VTSS_RC_ERR_NO_RES;
 }
 
 /* Free a TUPE value (bits or value) */
 vtss_rc fa_tupe_free(vtss_state_t *vtss_state,
-                     vtss_tupe_val_t val)
+                      vtss_tupe_val_t val)
 {
-    return VTSS_RC_OK;
-}
+    u32 i = 0;
+    vtss_tupe_val_type_t type = (val < TUPE_VALS_MAX) ? VTSS_TUPE_TYPE_VALUE : VTSS_TUPE_TYPE_BITS;
+
+    VTSS_D("Enter type=%u val=0x%08x", type, val);
+
+    if (type == VTSS_TUPE_TYPE_BITS) {
+        if (check_bit(val / TUPE_VALS_MAX, &i) &&
+            i < TUPE_BITS_MAX &&
+            !(vtss_state->tupe.tupe_bits_free & (1 << i))) {
+            vtss_state->tupe.tupe_bits_free |= 1 << i;
+            VTSS_D("Exit ok");
+            return VTSS_RC_OK;
+        }
+    } else if (type == VTSS_TUPE_TYPE_VALUE) {
+        if (val < TUPE_VALS_MAX &&
+            !(vtss_state->tupe.tupe_vals_free[val / 32] & (1 << (val % 32)))) {
+            vtss_state->tupe.tupe_vals_free[val / 32] |= (1 << (val % 32));
+            VTSS_D("Exit ok");
+            return VTSS_RC_OK;
+        }
+    }
+    VTSS_D("Failed");
+    return VTSS_RC_ERROR;
 }
 
 /* Configure VLAN/VSI entry with TUPE value */
 vtss_rc fa_tupe_vlan_set(vtss_state_t *vtss_state,
-                         u32 addr, // VLAN/VSI address
-                         vtss_tupe_val_type_t type, vtss_tupe_val_t val)
+                          u32 addr, // VLAN/VSI address
+                          vtss_tupe_val_type_t type, vtss_tupe_val_t val)
 {
-    return VTSS_RC_OK;
+    const u32 max_addr = VTSS_VIDS + VTSS_VSI_CNT;
+    u8 use_comb;
+    u32 mask, cnt, i = 0;
+    vtss_port_mask_t pmask;
+    vtss_port_mask_t unused;
+    u32 chip_port;
+
+    VTSS_D("Enter addr=0x%08x type=%u val=0x%08x", addr, type, val);
+
+    if (addr > max_addr) {
+        VTSS_D("Invalid addr");
+        return VTSS_RC_ERR_PARM; // invalid parameter
+    }
+
+    if (type == VTSS_TUPE_TYPE_BITS) {
+        if (check_bit(val / TUPE_VALS_MAX, &i) &&
+            i < TUPE_BITS_MAX &&
+            !(vtss_state->tupe.tupe_bits_free & (1 << i))) {
+            use_comb = (vtss_state->tupe.tupe_bits_bits + vtss_state->tupe.tupe_vals_bits) > TUPE_CTRL_MAX ? 1 : 0;
+            if (use_comb) {
+                mask = val >> TUPE_CTRL_MAX;
+                if (mask) {
+                    // must use portmask bit, look through tupe_bits_bits+tupe_vals_bits-TUPE_CTRL_MAX unused ports:
+                    REG_RDX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, addr, &pmask);
+                    cnt = vtss_state->tupe.tupe_bits_bits - (TUPE_CTRL_MAX - vtss_state->tupe.tupe_vals_bits);
+                    tupe_unused_pmask(vtss_state, &unused);
+                    for (chip_port = 0; chip_port < VTSS_CHIP_PORTS && cnt < vtss_state->tupe.tupe_bits_bits; chip_port++) {
+                        if (!TUPE_PMASK_GET(unused, chip_port)) {
+                            continue;
+                        }
+                        if (mask & 1) {
+                            TUPE_PMASK_SET(pmask, chip_port);
+                            break;
+                        }
+                        cnt++;
+                        mask >>= 1;
+                    }
+                    REG_WRX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, addr, pmask);
+                }
+            }
+            REG_WR(VTSS_ANA_L3_TUPE_CTRL(addr), VTSS_F_ANA_L3_TUPE_CTRL_TUPE_CTRL(val & 0xffff));
+            VTSS_D("Exit ok");
+            return VTSS_RC_OK;
+        }
+    } else if (type == VTSS_TUPE_TYPE_VALUE) {
+        if (val < TUPE_VALS_MAX &&
+            !(vtss_state->tupe.tupe_vals_free[val / 32] & (1 << (val % 32)))) {
+            REG_WR(VTSS_ANA_L3_TUPE_CTRL(addr), VTSS_F_ANA_L3_TUPE_CTRL_TUPE_CTRL(val & 0xffff));
+            VTSS_D("Exit ok");
+            return VTSS_RC_OK;
+        }
+    }
+    VTSS_D("Failed");
+    return VTSS_RC_ERROR;
 }
 
 /* Get VLAN/VSI entry TUPE value */
 vtss_rc fa_tupe_vlan_get(vtss_state_t *vtss_state,
-                         u32 addr, // VLAN/VSI address
-                         vtss_tupe_val_type_t *type, vtss_tupe_val_t *val)
+                          u32 addr, // VLAN/VSI address
+                          vtss_tupe_val_type_t *type, vtss_tupe_val_t *val)
 {
-    return VTSS_RC_OK;
+    const u32 max_addr = VTSS_VIDS + VTSS_VSI_CNT;
+    u8 use_comb;
+    u32 cnt, i = 0, v, bit;
+    vtss_port_mask_t pmask;
+    vtss_port_mask_t unused;
+    u32 chip_port;
+
+    VTSS_D("Enter addr=0x%08x", addr);
+
+    if (addr > max_addr) {
+        VTSS_D("Invalid addr");
+        return VTSS_RC_ERR_PARM; // invalid parameter
+    }
+
+    REG_RD(VTSS_ANA_L3_TUPE_CTRL(addr), &v);
+    if (v != 0 && v < TUPE_VALS_MAX) {
+        *type = VTSS_TUPE_TYPE_VALUE;
+        *val  = v;
+        VTSS_D("Exit ok");
+        return VTSS_RC_OK;
+    }
+    use_comb = (vtss_state->tupe.tupe_bits_bits + vtss_state->tupe.tupe_vals_bits) > TUPE_CTRL_MAX ? 1 : 0;
+    if (v == 0 && use_comb) {
+        // using portmask bit, look through tupe_bits_bits+tupe_vals_bits-TUPE_CTRL_MAX unused ports:
+        bit = 1 << TUPE_CTRL_MAX;
+        REG_RDX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, addr, &pmask);
+        cnt = vtss_state->tupe.tupe_bits_bits - (TUPE_CTRL_MAX - vtss_state->tupe.tupe_vals_bits);
+        tupe_unused_pmask(vtss_state, &unused);
+        for (chip_port = 0; chip_port < VTSS_CHIP_PORTS && cnt < vtss_state->tupe.tupe_bits_bits; chip_port++) {
+            if (!TUPE_PMASK_GET(unused, chip_port)) {
+                continue;
+            }
+            if (TUPE_PMASK_GET(pmask, chip_port)) {
+                v = bit;
+                break;
+            }
+            bit <<= 1;
+            cnt++;
+        }
+    }
+    if (v != 0 && check_bit(v / TUPE_VALS_MAX, &i) && i < TUPE_BITS_MAX) {
+        *type = VTSS_TUPE_TYPE_BITS;
+        *val  = v;
+        VTSS_D("Exit ok");
+        return VTSS_RC_OK;
+    }
+    VTSS_D("Failed");
+    return VTSS_RC_ERROR;
 }
 
 /* Clear VLAN/VSI entry TUPE value */
 vtss_rc fa_tupe_vlan_clr(vtss_state_t *vtss_state,
-                         u32 addr) // VLAN/VSI address
+                          u32 addr) // VLAN/VSI address
 {
+    const u32 max_addr = VTSS_VIDS + VTSS_VSI_CNT;
+    u8 use_comb;
+    vtss_port_mask_t pmask;
+    vtss_port_mask_t unused;
+    u32 chip_port;
+
+    VTSS_D("Enter addr=0x%08x", addr);
+
+    if (addr > max_addr) {
+        VTSS_D("Invalid addr");
+        return VTSS_RC_ERR_PARM; // invalid parameter
+    }
+
+    use_comb = (vtss_state->tupe.tupe_bits_bits + vtss_state->tupe.tupe_vals_bits) > TUPE_CTRL_MAX ? 1 : 0;
+    if (use_comb) {
+        // clear unused ports:
+        REG_RDX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, addr, &pmask);
+        tupe_unused_pmask(vtss_state, &unused);
+        for (chip_port = 0; chip_port < VTSS_CHIP_PORTS; chip_port++) {
+            if (TUPE_PMASK_GET(unused, chip_port)) {
+                TUPE_PMASK_CLR(pmask, chip_port);
+            }
+        }
+        REG_WRX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, addr, pmask);
+    }
+    REG_WR(VTSS_ANA_L3_TUPE_CTRL(addr), 0); // 0 is reserved as 'no match value'
+    VTSS_D("Exit ok");
     return VTSS_RC_OK;
 }
 
@@ -76,20 +413,195 @@ void fa_tupe_cb_register(fa_tupe_cb_t cb)
 /* realloc existing entries to fit new scheme */
 static vtss_rc tupe_realloc(vtss_state_t *vtss_state, u8 tupe_linear_prot_bits)
 {
+    const u32            max_addr = VTSS_VIDS + VTSS_VSI_CNT;
+    u32                  new_tupe_bits_max, new_tupe_vals_max, i, j, k = 0;
+    u32                  *from_vals;
+    u8                   tmp1, tmp2;
+    vtss_tupe_val_type_t tupe_type;
+    vtss_tupe_val_t      tupe_val, new_tupe_val;
+
+    from_vals = VTSS_OS_MALLOC(4 * (TUPE_VALS_MAX + TUPE_BITS_MAX), VTSS_MEM_FLAGS_NONE);
+    if (!from_vals) {
+        return VTSS_RC_ERROR;
+    }
+    VTSS_MEMSET(from_vals, 0, 4 * (TUPE_VALS_MAX + TUPE_BITS_MAX));
+    new_tupe_bits_max = TUPE_CTRL_MAX + TUPE_PORTMASK_MAX - tupe_linear_prot_bits;
+    new_tupe_vals_max = (1 << tupe_linear_prot_bits) & ~1;
+    vtss_state->tupe.tupe_vals_next = 1;
+    vtss_state->tupe.tupe_bits_free = 0;
+    for (i = 0; i < new_tupe_bits_max; ++i) {
+        vtss_state->tupe.tupe_bits_free |= 1 << i;
+    }
+    VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0, sizeof(vtss_state->tupe.tupe_vals_free));
+    for (i = 0; i <= max_addr; ++i) {
+        if (fa_tupe_vlan_get(vtss_state, i, &tupe_type, &tupe_val) != VTSS_RC_OK) {
+            continue;
+        }
+        if (tupe_type == VTSS_TUPE_TYPE_VALUE) {
+            for (j = 1; j < vtss_state->tupe.tupe_vals_next; ++j) {
+                if (from_vals[j] == tupe_val) {
+                    break;
+                }
+            }
+            // update entry:
+            if (fa_tupe_vlan_set(vtss_state, i, tupe_type, j) != VTSS_RC_OK) {
+                // should not happen, but exit trying to revert changes so far:
+                goto exit_revert;
+            }
+            if (j >= vtss_state->tupe.tupe_vals_next) {
+                if (fa_tupe_cb) {
+                    fa_tupe_cb(vtss_state, VTSS_TUPE_TYPE_VALUE, tupe_val, j);
+                }
+                from_vals[j] = tupe_val;
+                vtss_state->tupe.tupe_vals_next++;
+            }
+        } else if (tupe_type == VTSS_TUPE_TYPE_BITS) {
+            for (j = 0; j < TUPE_BITS_MAX; ++j) {
+                if (from_vals[TUPE_VALS_MAX + j] == tupe_val) {
+                    break;
+                }
+            }
+            if (j >= TUPE_BITS_MAX) {
+                for (j = 0; j < TUPE_BITS_MAX; ++j) {
+                    if (vtss_state->tupe.tupe_bits_free & (1 << j)) {
+                        vtss_state->tupe.tupe_bits_free &= ~(1 << j);
+                        from_vals[TUPE_VALS_MAX + j] = tupe_val;
+                        break;
+                    }
+                }
+                new_tupe_val = (1 << j) * new_tupe_vals_max;
+                if (fa_tupe_cb) {
+                    fa_tupe_cb(vtss_state, VTSS_TUPE_TYPE_BITS, tupe_val, new_tupe_val);
+                }
+            } else
+                new_tupe_val = (1 << j) * new_tupe_vals_max;
+            // update entry (using new tupe_bits_bits and tupe_vals_bits values):
+            tmp1 = vtss_state->tupe.tupe_bits_bits;
+            vtss_state->tupe.tupe_bits_bits = (TUPE_CTRL_MAX + TUPE_PORTMASK_MAX) - tupe_linear_prot_bits;
+            tmp2 = vtss_state->tupe.tupe_vals_bits;
+            vtss_state->tupe.tupe_vals_bits = tupe_linear_prot_bits;
+            if (fa_tupe_vlan_set(vtss_state, i, tupe_type, new_tupe_val) != VTSS_RC_OK) {
+                // should not happen, but exit trying to revert changes so far:
+                goto exit_revert;
+            }
+            vtss_state->tupe.tupe_bits_bits = tmp1;
+            vtss_state->tupe.tupe_vals_bits = tmp2;
+        }
+    }
+    VTSS_OS_FREE(from_vals, VTSS_MEM_FLAGS_NONE);
+    vtss_state->tupe.tupe_vals_bits = tupe_linear_prot_bits;
+    vtss_state->tupe.tupe_bits_bits = (TUPE_CTRL_MAX + TUPE_PORTMASK_MAX) - tupe_linear_prot_bits;
+    for (i = vtss_state->tupe.tupe_vals_next; i < TUPE_VALS_MAX; ++i) {
+        vtss_state->tupe.tupe_vals_free[i / 32] |= (1 << (i % 32));
+    }
+    return VTSS_RC_OK;
+
+    exit_revert:
+    for (j = 0; j < i; ++j) {
+        if (fa_tupe_vlan_get(vtss_state, j, &tupe_type, &tupe_val) != VTSS_RC_OK) {
+            continue;
+        }
+        if (tupe_type == VTSS_TUPE_TYPE_VALUE) {
+            if (tupe_val < vtss_state->tupe.tupe_vals_next) {
+                new_tupe_val = from_vals[tupe_val]; // this is the old value
+                (void)fa_tupe_vlan_set(vtss_state, j, tupe_type, new_tupe_val);
+            }
+        } else if (tupe_type == VTSS_TUPE_TYPE_BITS) {
+            if (check_bit(tupe_val / new_tupe_vals_max, &k) &&
+                k < TUPE_BITS_MAX) {
+                new_tupe_val = from_vals[TUPE_VALS_MAX + k];
+                (void)fa_tupe_vlan_set(vtss_state, j, tupe_type, new_tupe_val);
+            }
+        }
+    }
+    for (j = 0; j < (TUPE_VALS_MAX + TUPE_BITS_MAX); ++j) {
+        if (from_vals[j] == 0) {
+            continue;
+        }
+        new_tupe_val = from_vals[j]; // this is the old value
+        if (fa_tupe_cb) {
+            fa_tupe_cb(vtss_state, j < TUPE_VALS_MAX ? VTSS_TUPE_TYPE_VALUE : VTSS_TUPE_TYPE_BITS, tupe_val, new_tupe_val);
+        }
+    }
+    VTSS_OS_FREE(from_vals, VTSS_MEM_FLAGS_NONE);
+    // fix vtss_state->tupe.tupe_bits_free + vtss_state->tupe.tupe_vals_free:
+    vtss_state->tupe.tupe_bits_free = 0;
+    for (i = 0; i < TUPE_BITS_MAX; ++i) {
+        vtss_state->tupe.tupe_bits_free |= 1 << i;
+    }
+    VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0, sizeof(vtss_state->tupe.tupe_vals_free));
+    if (vtss_state->tupe.tupe_vals_bits) {
+        VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0xff, 4 * ((31 + TUPE_VALS_MAX) / 32));
+        vtss_state->tupe.tupe_vals_next = 1; // 0 is reserved
+    }
+    for (i = 0; i <= max_addr; ++i) {
+        if (fa_tupe_vlan_get(vtss_state, i, &tupe_type, &tupe_val) != VTSS_RC_OK) {
+            continue;
+        }
+        if (tupe_type == VTSS_TUPE_TYPE_VALUE) {
+            if (tupe_val < TUPE_VALS_MAX && tupe_val != 0) {
+                vtss_state->tupe.tupe_vals_free[tupe_val / 32] &= ~(1 << (tupe_val % 32));
+            } else {
+                (void)fa_tupe_vlan_clr(vtss_state, i);
+                if (fa_tupe_cb) {
+                    fa_tupe_cb(vtss_state, VTSS_TUPE_TYPE_VALUE, tupe_val, 0);
+                }
+            }
+        } else if (tupe_type == VTSS_TUPE_TYPE_BITS) {
+            if (check_bit(tupe_val / TUPE_VALS_MAX, &k) &&
+                k < TUPE_BITS_MAX) {
+                vtss_state->tupe.tupe_bits_free &= ~(1 << k);
+            } else {
+                (void)fa_tupe_vlan_clr(vtss_state, i);
+                if (fa_tupe_cb) {
+                    fa_tupe_cb(vtss_state, VTSS_TUPE_TYPE_BITS, tupe_val, 0);
+                }
+            }
+        }
+    }
     return VTSS_RC_ERROR;
 }
 
 /* Allocate an AFI TUPE value (use is optional) */
 vtss_rc fa_afi_tupe_alloc(vtss_state_t *vtss_state,
-                          vtss_afi_tupe_val_t *val)
+                           vtss_afi_tupe_val_t *val)
 {
+    u32 i;
+
+    VTSS_D("Enter");
+
+    if (vtss_state->tupe.afi_tupe_vals_next == 0) {
+        vtss_state->tupe.afi_tupe_vals_next = 1; // 0 is reserved
+    }
+    for (i = 0; i < AFI_TUPE_VALS_MAX; ++i) {
+        if (vtss_state->tupe.afi_tupe_vals_free[vtss_state->tupe.afi_tupe_vals_next / 32] & (1 << (vtss_state->tupe.afi_tupe_vals_next % 32))) {
+            *val = vtss_state->tupe.afi_tupe_vals_next;
+            vtss_state->tupe.afi_tupe_vals_free[vtss_state->tupe.afi_tupe_vals_next / 32] &= ~(1 << (vtss_state->tupe.afi_tupe_vals_next % 32));
+            VTSS_D("Exit ok, *val=0x%08x", *val);
+            return VTSS_RC_OK;
+        }
+        vtss_state->tupe.afi_tupe_vals_next++;
+        if (vtss_state->tupe.afi_tupe_vals_next >= AFI_TUPE_VALS_MAX) {
+            vtss_state->tupe.afi_tupe_vals_next = 1; // 0 is reserved
+        }
+    }
+    VTSS_D("Failed");
     return VTSS_RC_ERR_NO_RES;
 }
 
 /* Free an AFI TUPE value (use is optional) */
 vtss_rc fa_afi_tupe_free(vtss_state_t *vtss_state,
-                         vtss_afi_tupe_val_t val)
+                          vtss_afi_tupe_val_t val)
 {
+    VTSS_D("Enter val=0x%08x", val);
+
+    if (val < AFI_TUPE_VALS_MAX &&
+        !(vtss_state->tupe.afi_tupe_vals_free[val / 32] & (1 << (val % 32)))) {
+        vtss_state->tupe.afi_tupe_vals_free[val / 32] |= (1 << (val % 32));
+        VTSS_D("Exit ok");
+        return VTSS_RC_OK;
+    }
+    VTSS_D("Failed");
     return VTSS_RC_ERROR;
 }
 
@@ -105,13 +617,155 @@ vtss_rc fa_afi_tupe_free(vtss_state_t *vtss_state,
  * TUPE values.
 */
 vtss_rc fa_afi_tupe_cmd(vtss_state_t *vtss_state,
-                        vtss_tupe_cmd_t cmd, vtss_afi_tupe_parms_t *parms)
+                         vtss_tupe_cmd_t cmd, vtss_afi_tupe_parms_t *parms)
 {
+    const u32 max_addr = VTSS_AFI_SLOW_INJ_CNT;
+    u32 v;
+    vtss_mtimer_t timer;
+
+    VTSS_D("Enter cmd=%u", cmd);
+
+    if (cmd == VTSS_TUPE_CMD_QUERY) { // Query if AFI TUPE is ready
+        REG_RD(VTSS_AFI_TUPE_MISC, &v);
+        return VTSS_X_AFI_TUPE_MISC_TUPE_START(v) == 0 ? VTSS_RC_OK : VTSS_RC_INCOMPLETE;
+    } else if (cmd == VTSS_TUPE_CMD_START_NONBLOCKING || // Start AFI TUPE (nonblocking)
+               cmd == VTSS_TUPE_CMD_START_BLOCKING) {    // Start AFI TUPE and wait for completion (blocking)
+        if (parms) {
+            VTSS_D("parms start_addr=%u end_addr=%u match={qu:%u, qu_en:%u, port:%u/%u, port_en:%u, 0x%02x, 0x%02x, 0x%02x} update={qu:%u, qu_en:%u, port:%u/%u, port_en:%u, %u, %u}",
+                   parms->start_addr, parms->end_addr, parms->match.qu_num, parms->match.qu_num_en, parms->match.port_no, VTSS_CHIP_PORT(parms->match.port_no),
+                   parms->match.port_no_en, parms->match.value[0], parms->match.value[1], parms->match.mask,
+                   parms->update.qu_num, parms->update.qu_num_en, parms->update.port_no, VTSS_CHIP_PORT(parms->update.port_no), parms->update.port_no_en,
+                   parms->update.timer_ena, parms->update.timer_ena_en);
+        }
+        if (!parms ||
+            parms->start_addr > parms->end_addr ||
+            parms->start_addr >= max_addr ||
+            parms->end_addr >= max_addr) {
+            VTSS_D("Invalid parameters");
+            return VTSS_RC_ERR_PARM; // invalid parameters
+        }
+
+        // check if ready:
+        REG_RD(VTSS_AFI_TUPE_MISC, &v);
+        if (VTSS_X_AFI_TUPE_MISC_TUPE_START(v) != 0) {
+            VTSS_D("TUPE not ready");
+            return VTSS_RC_INCOMPLETE; // TUPE not ready
+        }
+
+        v = VTSS_F_AFI_TUPE_ADDR_TUPE_END_ADDR(parms->end_addr) |
+            VTSS_F_AFI_TUPE_ADDR_TUPE_START_ADDR(parms->start_addr);
+        REG_WR(VTSS_AFI_TUPE_ADDR, v);
+
+        v = VTSS_F_AFI_TUPE_CRIT1_CRIT_QU_NUM_VAL(parms->match.qu_num) |
+            VTSS_F_AFI_TUPE_CRIT1_CRIT_PORT_NUM_VAL(VTSS_CHIP_PORT(parms->match.port_no));
+        REG_WR(VTSS_AFI_TUPE_CRIT1, v);
+
+        v = VTSS_F_AFI_TUPE_CRIT2_CRIT_TUPE_CTRL_MASK(parms->match.mask);
+        REG_WR(VTSS_AFI_TUPE_CRIT2, v);
+
+        v = VTSS_F_AFI_TUPE_CRIT3_CRIT_TUPE_CTRL_VAL(parms->match.value[0]);
+        REG_WR(VTSS_AFI_TUPE_CRIT3(0), v);
+        v = VTSS_F_AFI_TUPE_CRIT3_CRIT_TUPE_CTRL_VAL(parms->match.value[1]);
+        REG_WR(VTSS_AFI_TUPE_CRIT3(1), v);
+
+        v = VTSS_F_AFI_TUPE_CMD1_CMD_QU_NUM_VAL(parms->update.qu_num) |
+            VTSS_F_AFI_TUPE_CMD1_CMD_PORT_NUM_VAL(VTSS_CHIP_PORT(parms->update.port_no));
+        REG_WR(VTSS_AFI_TUPE_CMD1, v);
+
+        v = VTSS_F_AFI_TUPE_MISC_CMD_QU_NUM_ENA(parms->update.qu_num_en ? 1 : 0)       |
+            VTSS_F_AFI_TUPE_MISC_CMD_PORT_NUM_ENA(parms->update.port_no_en ? 1 : 0)    |
+            VTSS_F_AFI_TUPE_MISC_CMD_TIMER_ENA_VAL(parms->update.timer_ena ? 1 : 0)    |
+            VTSS_F_AFI_TUPE_MISC_CMD_TIMER_ENA_ENA(parms->update.timer_ena_en ? 1 : 0) |
+            VTSS_F_AFI_TUPE_MISC_CRIT_QU_NUM_ENA(parms->match.qu_num_en ? 1 : 0)       |
+            VTSS_F_AFI_TUPE_MISC_CRIT_PORT_NUM_ENA(parms->match.port_no_en ? 1 : 0)    |
+            VTSS_F_AFI_TUPE_MISC_TUPE_START(1); // initiate TUPE
+        REG_WR(VTSS_AFI_TUPE_MISC, v);
+
+        if (cmd == VTSS_TUPE_CMD_START_BLOCKING) { // wait for completion
+            VTSS_MTIMER_START(&timer, TUPE_WAIT_MSEC);
+            while (1) {
+                REG_RD(VTSS_AFI_TUPE_MISC, &v);
+                if (VTSS_X_AFI_TUPE_MISC_TUPE_START(v) == 0) {
+                    break;
+                }
+                if (VTSS_MTIMER_TIMEOUT(&timer)) {
+                    VTSS_E("Timeout waiting for TUPE completion");
+                    return VTSS_RC_ERROR;
+                }
+            }
+        }
+    } else {
+        VTSS_D("Invalid cmd");
+        return VTSS_RC_ERR_PARM;
+    }
+    VTSS_D("Exit ok");
     return VTSS_RC_OK;
 }
 
 vtss_rc fa_tupe_init(vtss_state_t *vtss_state, u8 tupe_linear_prot_bits)
 {
+    u32 i, cnt;
+    u8 realloc = 0;
+
+    VTSS_D("Enter tupe_linear_prot_bits=%u", tupe_linear_prot_bits);
+
+    if (tupe_linear_prot_bits > TUPE_CTRL_MAX) {
+        VTSS_D("Invalid parameters");
+        return VTSS_RC_ERR_PARM;
+    }
+    if (vtss_state->tupe.tupe_bits_bits) {
+        // re-init, check if ok
+        for (i = 0, cnt = 0; i < TUPE_BITS_MAX; ++i) {
+            if (!(vtss_state->tupe.tupe_bits_free & (1 << i))) {
+                cnt++;
+            }
+        }
+        realloc = cnt ? 1 : 0;
+        if (cnt > ((TUPE_CTRL_MAX + TUPE_PORTMASK_MAX) - tupe_linear_prot_bits)) {
+            VTSS_D("Not possible");
+            return VTSS_RC_INV_STATE;
+        }
+    }
+    if (vtss_state->tupe.tupe_vals_bits) {
+        // re-init, check if ok
+        for (i = 1, cnt = 0; i < TUPE_VALS_MAX; ++i) {
+            if (!(vtss_state->tupe.tupe_vals_free[i / 32] & (1 << (i % 32)))) {
+                cnt++;
+            }
+        }
+        realloc = cnt ? 1 : 0;
+        if (cnt > ((1 << tupe_linear_prot_bits) & ~1)) {
+            VTSS_D("Not possible");
+            return VTSS_RC_INV_STATE;
+        }
+    }
+    if (realloc) {
+        if (tupe_realloc(vtss_state, tupe_linear_prot_bits) != VTSS_RC_OK) {
+            VTSS_D("realloc failed");
+            return VTSS_RC_ERROR;
+        }
+    } else {
+        vtss_state->tupe.tupe_vals_bits = tupe_linear_prot_bits;
+        vtss_state->tupe.tupe_bits_bits = (TUPE_CTRL_MAX + TUPE_PORTMASK_MAX) - tupe_linear_prot_bits;
+        vtss_state->tupe.tupe_bits_free = 0;
+        for (i = 0; i < TUPE_BITS_MAX; ++i) {
+            vtss_state->tupe.tupe_bits_free |= 1 << i;
+        }
+        VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0, sizeof(vtss_state->tupe.tupe_vals_free));
+        if (vtss_state->tupe.tupe_vals_bits) {
+            VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0xff, 4 * ((31 + TUPE_VALS_MAX) / 32));
+            vtss_state->tupe.tupe_vals_next = 1; // 0 is reserved
+        }
+    }
+    if (vtss_state->tupe.afi_tupe_vals_next == 0) {
+        // first init, all AFI TUPE values are free
+        VTSS_MEMSET(vtss_state->tupe.afi_tupe_vals_free, 0xff, sizeof(vtss_state->tupe.afi_tupe_vals_free));
+        vtss_state->tupe.afi_tupe_vals_next = 1; // 0 is reserved
+    }
+    // Minium number of clock cycles between TUPE accessing TTI Table. Default 10.
+    // TUPE access to TTI Table takes precedence over both CSR accesses and normal TTI processing.
+    // REG_WR(VTSS_AFI_TTI_CTRL2, VTSS_F_AFI_TTI_CTRL2_TTI_TUPE_RSV(10));
+    VTSS_D("Exit ok");
     return VTSS_RC_OK;
 }
 
@@ -121,6 +775,23 @@ vtss_rc fa_tupe_init(vtss_state_t *vtss_state, u8 tupe_linear_prot_bits)
 // fa_tupe_init() must have been called first
 // warning: Will mess with the VLAN table!
 #ifdef TUPE_TEST
+/* The test code uses 64-bit port masks (chip ports 0-63) */
+#define TUPE_TEST_RDX_PMASK(x, p) { vtss_port_mask_t _pm; REG_RDX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, x, &_pm); *(p) = ((u64)_pm.m[1] << 32) | _pm.m[0]; }
+#define TUPE_TEST_WRX_PMASK(x, p) { vtss_port_mask_t _pm; _pm.m[0] = (u32)(p); _pm.m[1] = (u32)((u64)(p) >> 32); _pm.m[2] = 0; REG_WRX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, x, _pm); }
+
+static u64 tupe_test_pmask(u32 chip_port)
+{
+    return (chip_port < 64 ? (1ULL << chip_port) : 0);
+}
+
+static u64 tupe_test_port_mask(vtss_state_t *vtss_state, const BOOL member[])
+{
+    vtss_port_mask_t pmask;
+
+    vtss_port_mask_get(vtss_state, member, &pmask);
+    return ((u64)pmask.m[1] << 32) | pmask.m[0];
+}
+
 vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
 {
     const u32 max_addr = VTSS_VIDS + VTSS_VSI_CNT + 1;
@@ -130,7 +801,8 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
     u8   use_comb;
     BOOL ok = TRUE;
     u16 mask;
-    vtss_port_no_t    port_no;
+    vtss_port_mask_t  unused;
+    u32               chip_port;
     vtss_tupe_val_t   tupe_vals[TUPE_VALS_MAX], v;
     vtss_tupe_val_t   tupe_bits[TUPE_BITS_MAX];
     vtss_tupe_parms_t parms;
@@ -238,29 +910,31 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
             if (mask) {
                 // must use portmask bit, look through tupe_bits_bits+tupe_vals_bits-TUPE_CTRL_MAX unused ports:
                 cnt = vtss_state->tupe.tupe_bits_bits - (TUPE_CTRL_MAX - vtss_state->tupe.tupe_vals_bits);
-                for (port_no = VTSS_PORT_NO_START; port_no < VTSS_PORTS && cnt < vtss_state->tupe.tupe_bits_bits; port_no++) {
-                    if (VTSS_CHIP_PORT(port_no) == CHIP_PORT_UNUSED) {
-                        if (mask & 1) {
-                            pmask |= vtss_fa_pmask(VTSS_CHIP_PORT(port_no));
-                            break;
-                        }
-                        cnt++;
-                        mask >>= 1;
+                tupe_unused_pmask(vtss_state, &unused);
+                for (chip_port = 0; chip_port < VTSS_CHIP_PORTS && cnt < vtss_state->tupe.tupe_bits_bits; chip_port++) {
+                    if (!TUPE_PMASK_GET(unused, chip_port)) {
+                        continue;
+                    }
+                    if (mask & 1) {
+                        pmask |= tupe_test_pmask(chip_port);
+                        break;
                     }
+                    cnt++;
+                    mask >>= 1;
                 }
             }
         }
         do {
             set_port = rand() % VTSS_PORTS;
             clr_port = rand() % VTSS_PORTS;
-        } while ((pmask & vtss_fa_pmask(VTSS_CHIP_PORT(set_port))) ||
-                 (pmask & vtss_fa_pmask(VTSS_CHIP_PORT(clr_port))));
+        } while ((pmask & tupe_test_pmask(VTSS_CHIP_PORT(set_port))) ||
+                 (pmask & tupe_test_pmask(VTSS_CHIP_PORT(clr_port))));
         parms.set_port_list[set_port] = TRUE;
         parms.clr_port_list[clr_port] = TRUE;
         if (set_port != clr_port) {
-            pmask |= vtss_fa_port_mask(vtss_state, parms.clr_port_list);
+            pmask |= tupe_test_port_mask(vtss_state, parms.clr_port_list);
         } else {
-            pmask |= (rand() % 1024) < 512 ? 0 : vtss_fa_port_mask(vtss_state, parms.clr_port_list);
+            pmask |= (rand() % 1024) < 512 ? 0 : tupe_test_port_mask(vtss_state, parms.clr_port_list);
         }
         org_pmask = pmask;
         VTSS_MEMSET(vlan_change, 0, sizeof(vlan_change));
@@ -271,14 +945,14 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                     ok = FALSE;
                     break;
                 }
-                FA_WRX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, pmask);
+                TUPE_TEST_WRX_PMASK(i, pmask);
                 vlan_change[i / 32] |= (1 << (i % 32));
             } else {
                 if (fa_tupe_vlan_clr(vtss_state, i) != VTSS_RC_OK) {
                     printf("*** ERROR: tupe_vlan_clr failed, i=%u\n", i);
                     ok = FALSE;
                 }
-                FA_WRX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, (u64)0);
+                TUPE_TEST_WRX_PMASK(i, (u64)0);
             }
         }
         if (fa_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_BLOCKING, &parms) != VTSS_RC_OK) {
@@ -291,7 +965,7 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                 !(vlan_change[i / 32] & (1 << (i % 32)))) {
                 // expect no change
                 exp_pmask = 0;
-                FA_RD(VTSS_ANA_L3_VLAN_TUPE_CTRL(i), &val);
+                REG_RD(VTSS_ANA_L3_TUPE_CTRL(i), &val);
                 if (vlan_change[i / 32] & (1 << (i % 32))) {
                     if (val != (v & 0xffff)) {
                         printf("*** ERROR: VLAN table i=%u read TUPE_CTRL=0x%04x, expected 0x%04x\n", i, val, v & 0xffff);
@@ -302,7 +976,7 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                     printf("*** ERROR: VLAN table i=%u read TUPE_CTRL=0x%04x, expected 0x%04x\n", i, val, 0);
                     ok = FALSE;
                 }
-                FA_RDX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, &pmask);
+                TUPE_TEST_RDX_PMASK(i, &pmask);
                 if (pmask != exp_pmask) {
                     printf("*** ERROR: VLAN table i=%u read pmask=0x%08x%08x, expected 0x%08x%08x\n",
                            i, (u32)(pmask >> 32), (u32)(pmask), (u32)(exp_pmask >> 32), (u32)(exp_pmask));
@@ -310,18 +984,18 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                 }
             } else {
                 // expect change in portmask
-                FA_RD(VTSS_ANA_L3_VLAN_TUPE_CTRL(i), &val);
+                REG_RD(VTSS_ANA_L3_TUPE_CTRL(i), &val);
                 if (val != (v & 0xffff)) {
                     printf("*** ERROR: VLAN table i=%u read TUPE_CTRL=0x%04x, expected 0x%04x\n", i, val, v & 0xffff);
                     ok = FALSE;
                 }
                 if (set_port != clr_port) {
-                    exp_pmask = (org_pmask ^ vtss_fa_port_mask(vtss_state, parms.clr_port_list)) |
-                        vtss_fa_port_mask(vtss_state, parms.set_port_list);
+                    exp_pmask = (org_pmask ^ tupe_test_port_mask(vtss_state, parms.clr_port_list)) |
+                        tupe_test_port_mask(vtss_state, parms.set_port_list);
                 } else {
-                    exp_pmask = org_pmask ^ vtss_fa_port_mask(vtss_state, parms.set_port_list);
+                    exp_pmask = org_pmask ^ tupe_test_port_mask(vtss_state, parms.set_port_list);
                 }
-                FA_RDX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, &pmask);
+                TUPE_TEST_RDX_PMASK(i, &pmask);
                 if (pmask != exp_pmask) {
                     printf("*** ERROR: VLAN table i=%u read pmask=0x%08x%08x, expected 0x%08x%08x\n",
                            i, (u32)(pmask >> 32), (u32)(pmask), (u32)(exp_pmask >> 32), (u32)(exp_pmask));
@@ -335,7 +1009,7 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                 printf("*** ERROR: tupe_vlan_clr failed, i=%u\n", i);
                 ok = FALSE;
             }
-            FA_WRX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, (u64)0);
+            TUPE_TEST_WRX_PMASK(i, (u64)0);
         }
         printf("START_BLOCKING cmd loop %u/10 %s\n", loop + 1, ok ? "ok" : "FAILED!");
     }
@@ -363,29 +1037,31 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
             if (mask) {
                 // must use portmask bit, look through tupe_bits_bits+tupe_vals_bits-TUPE_CTRL_MAX unused ports:
                 cnt = vtss_state->tupe.tupe_bits_bits - (TUPE_CTRL_MAX - vtss_state->tupe.tupe_vals_bits);
-                for (port_no = VTSS_PORT_NO_START; port_no < VTSS_PORTS && cnt < vtss_state->tupe.tupe_bits_bits; port_no++) {
-                    if (VTSS_CHIP_PORT(port_no) == CHIP_PORT_UNUSED) {
-                        if (mask & 1) {
-                            pmask |= vtss_fa_pmask(VTSS_CHIP_PORT(port_no));
-                            break;
-                        }
-                        cnt++;
-                        mask >>= 1;
+                tupe_unused_pmask(vtss_state, &unused);
+                for (chip_port = 0; chip_port < VTSS_CHIP_PORTS && cnt < vtss_state->tupe.tupe_bits_bits; chip_port++) {
+                    if (!TUPE_PMASK_GET(unused, chip_port)) {
+                        continue;
+                    }
+                    if (mask & 1) {
+                        pmask |= tupe_test_pmask(chip_port);
+                        break;
                     }
+                    cnt++;
+                    mask >>= 1;
                 }
             }
         }
         do {
             set_port = rand() % VTSS_PORTS;
             clr_port = rand() % VTSS_PORTS;
-        } while ((pmask & vtss_fa_pmask(VTSS_CHIP_PORT(set_port))) ||
-                 (pmask & vtss_fa_pmask(VTSS_CHIP_PORT(clr_port))));
+        } while ((pmask & tupe_test_pmask(VTSS_CHIP_PORT(set_port))) ||
+                 (pmask & tupe_test_pmask(VTSS_CHIP_PORT(clr_port))));
         parms.set_port_list[set_port] = TRUE;
         parms.clr_port_list[clr_port] = TRUE;
         if (set_port != clr_port) {
-            pmask |= vtss_fa_port_mask(vtss_state, parms.clr_port_list);
+            pmask |= tupe_test_port_mask(vtss_state, parms.clr_port_list);
         } else {
-            pmask |= (rand() % 1024) < 512 ? 0 : vtss_fa_port_mask(vtss_state, parms.clr_port_list);
+            pmask |= (rand() % 1024) < 512 ? 0 : tupe_test_port_mask(vtss_state, parms.clr_port_list);
         }
         org_pmask = pmask;
         VTSS_MEMSET(vlan_change, 0, sizeof(vlan_change));
@@ -396,14 +1072,14 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                     ok = FALSE;
                     break;
                 }
-                FA_WRX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, pmask);
+                TUPE_TEST_WRX_PMASK(i, pmask);
                 vlan_change[i / 32] |= (1 << (i % 32));
             } else {
                 if (fa_tupe_vlan_clr(vtss_state, i) != VTSS_RC_OK) {
                     printf("*** ERROR: tupe_vlan_clr failed, i=%u\n", i);
                     ok = FALSE;
                 }
-                FA_WRX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, (u64)0);
+                TUPE_TEST_WRX_PMASK(i, (u64)0);
             }
         }
         if (fa_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_NONBLOCKING, &parms) != VTSS_RC_OK) {
@@ -419,7 +1095,7 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                 !(vlan_change[i / 32] & (1 << (i % 32)))) {
                 // expect no change
                 exp_pmask = 0;
-                FA_RD(VTSS_ANA_L3_VLAN_TUPE_CTRL(i), &val);
+                REG_RD(VTSS_ANA_L3_TUPE_CTRL(i), &val);
                 if (vlan_change[i / 32] & (1 << (i % 32))) {
                     if (val != (v & 0xffff)) {
                         printf("*** ERROR: VLAN table i=%u read TUPE_CTRL=0x%04x, expected 0x%04x\n", i, val, v & 0xffff);
@@ -430,7 +1106,7 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                     printf("*** ERROR: VLAN table i=%u read TUPE_CTRL=0x%04x, expected 0x%04x\n", i, val, 0);
                     ok = FALSE;
                 }
-                FA_RDX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, &pmask);
+                TUPE_TEST_RDX_PMASK(i, &pmask);
                 if (pmask != exp_pmask) {
                     printf("*** ERROR: VLAN table i=%u read pmask=0x%08x%08x, expected 0x%08x%08x\n",
                            i, (u32)(pmask >> 32), (u32)(pmask), (u32)(exp_pmask >> 32), (u32)(exp_pmask));
@@ -438,18 +1114,18 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                 }
             } else {
                 // expect change in portmask
-                FA_RD(VTSS_ANA_L3_VLAN_TUPE_CTRL(i), &val);
+                REG_RD(VTSS_ANA_L3_TUPE_CTRL(i), &val);
                 if (val != (v & 0xffff)) {
                     printf("*** ERROR: VLAN table i=%u read TUPE_CTRL=0x%04x, expected 0x%04x\n", i, val, v & 0xffff);
                     ok = FALSE;
                 }
                 if (set_port != clr_port) {
-                    exp_pmask = (org_pmask ^ vtss_fa_port_mask(vtss_state, parms.clr_port_list)) |
-                        vtss_fa_port_mask(vtss_state, parms.set_port_list);
+                    exp_pmask = (org_pmask ^ tupe_test_port_mask(vtss_state, parms.clr_port_list)) |
+                        tupe_test_port_mask(vtss_state, parms.set_port_list);
                 } else {
-                    exp_pmask = org_pmask ^ vtss_fa_port_mask(vtss_state, parms.set_port_list);
+                    exp_pmask = org_pmask ^ tupe_test_port_mask(vtss_state, parms.set_port_list);
                 }
-                FA_RDX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, &pmask);
+                TUPE_TEST_RDX_PMASK(i, &pmask);
                 if (pmask != exp_pmask) {
                     printf("*** ERROR: VLAN table i=%u read pmask=0x%08x%08x, expected 0x%08x%08x\n",
                            i, (u32)(pmask >> 32), (u32)(pmask), (u32)(exp_pmask >> 32), (u32)(exp_pmask));
@@ -463,7 +1139,7 @@ vtss_rc fa_tupe_test(vtss_state_t *vtss_state)
                 printf("*** ERROR: tupe_vlan_clr failed, i=%u\n", i);
                 ok = FALSE;
             }
-            FA_WRX_PMASK(VTSS_ANA_L3_VLAN_VLAN_MASK_CFG, i, (u64)0);
+            TUPE_TEST_WRX_PMASK(i, (u64)0);
         }
         printf("START_NONBLOCKING cmd loop %u/10 %s\n", loop + 1, ok ? "ok" : "FAILED!");
     }
@@ -792,39 +1468,39 @@ vtss_rc fa_afi_tupe_test(vtss_state_t *vtss_state)
         for (i = 0; i < max_addr; ++i) {
             if ((rand() % 1024) < 512) {
                 // make sure this entry does match
-                v = VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_QU_NUM(parms.match.qu_num_en ? parms.match.qu_num : rand() % 2048) |
-                    VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_PORT_NUM(VTSS_CHIP_PORT(parms.match.port_no_en ? parms.match.port_no : rand() % VTSS_PORTS));
-                vv = VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_QU_NUM(parms.update.qu_num_en ? parms.update.qu_num : VTSS_X_AFI_TTI_TBL_TTI_PORT_QU_QU_NUM(v)) |
-                    VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_PORT_NUM(parms.update.port_no_en ? VTSS_CHIP_PORT(parms.update.port_no) : VTSS_X_AFI_TTI_TBL_TTI_PORT_QU_PORT_NUM(v));
+                v = VTSS_F_AFI_TTI_PORT_QU_QU_NUM(parms.match.qu_num_en ? parms.match.qu_num : rand() % 2048) |
+                    VTSS_F_AFI_TTI_PORT_QU_PORT_NUM(VTSS_CHIP_PORT(parms.match.port_no_en ? parms.match.port_no : rand() % VTSS_PORTS));
+                vv = VTSS_F_AFI_TTI_PORT_QU_QU_NUM(parms.update.qu_num_en ? parms.update.qu_num : VTSS_X_AFI_TTI_PORT_QU_QU_NUM(v)) |
+                    VTSS_F_AFI_TTI_PORT_QU_PORT_NUM(parms.update.port_no_en ? VTSS_CHIP_PORT(parms.update.port_no) : VTSS_X_AFI_TTI_PORT_QU_PORT_NUM(v));
                 if (i < parms.start_addr || i > parms.end_addr || parms.match.mask == 0) {
                     tti_tbl[i][0] = v;  // expect no update
                 } else {
                     tti_tbl[i][0] = vv; // expect update
                 }
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_PORT_QU(i), v);
-                v = VTSS_F_AFI_TTI_TBL_TTI_TIMER_TIMER_ENA((rand() % 1024) < 512 ? 1 : 0);
-                vv = VTSS_F_AFI_TTI_TBL_TTI_TIMER_TIMER_ENA(parms.update.timer_ena_en ? parms.update.timer_ena : VTSS_X_AFI_TTI_TBL_TTI_TIMER_TIMER_ENA(v));
+                REG_WR(VTSS_AFI_TTI_PORT_QU(i), v);
+                v = VTSS_F_AFI_TTI_TIMER_TIMER_ENA((rand() % 1024) < 512 ? 1 : 0);
+                vv = VTSS_F_AFI_TTI_TIMER_TIMER_ENA(parms.update.timer_ena_en ? parms.update.timer_ena : VTSS_X_AFI_TTI_TIMER_TIMER_ENA(v));
                 if (i < parms.start_addr || i > parms.end_addr || parms.match.mask == 0) {
                     tti_tbl[i][1] = v;  // expect no update
                 } else {
                     tti_tbl[i][1] = vv; // expect update
                 }
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_TIMER(i), v);
-                v = VTSS_F_AFI_TTI_TBL_TTI_TUPE_CTRL_TUPE_CTRL(parms.match.mask ? parms.match.value[0] : rand() & 0xff);
+                REG_WR(VTSS_AFI_TTI_TIMER(i), v);
+                v = VTSS_F_AFI_TTI_TUPE_CTRL_TUPE_CTRL(parms.match.mask ? parms.match.value[0] : rand() & 0xff);
                 tti_tbl[i][2] = v;
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_TUPE_CTRL(i), v);
+                REG_WR(VTSS_AFI_TTI_TUPE_CTRL(i), v);
             } else {
                 // make sure this entry does not match
-                v = VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_QU_NUM(parms.match.qu_num_en ? parms.match.qu_num + 1 : parms.match.qu_num) |
-                    VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_PORT_NUM(parms.match.port_no_en ? 1 + VTSS_CHIP_PORT(parms.match.port_no) : VTSS_CHIP_PORT(parms.match.port_no));
+                v = VTSS_F_AFI_TTI_PORT_QU_QU_NUM(parms.match.qu_num_en ? parms.match.qu_num + 1 : parms.match.qu_num) |
+                    VTSS_F_AFI_TTI_PORT_QU_PORT_NUM(parms.match.port_no_en ? 1 + VTSS_CHIP_PORT(parms.match.port_no) : VTSS_CHIP_PORT(parms.match.port_no));
                 tti_tbl[i][0] = v;
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_PORT_QU(i), v);
-                v = VTSS_F_AFI_TTI_TBL_TTI_TIMER_TIMER_ENA((rand() % 1024) < 512 ? 1 : 0);
+                REG_WR(VTSS_AFI_TTI_PORT_QU(i), v);
+                v = VTSS_F_AFI_TTI_TIMER_TIMER_ENA((rand() % 1024) < 512 ? 1 : 0);
                 tti_tbl[i][1] = v;
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_TIMER(i), v);
-                v = VTSS_F_AFI_TTI_TBL_TTI_TUPE_CTRL_TUPE_CTRL(parms.match.mask ? parms.match.value[0] + 1 : parms.match.value[0]);
+                REG_WR(VTSS_AFI_TTI_TIMER(i), v);
+                v = VTSS_F_AFI_TTI_TUPE_CTRL_TUPE_CTRL(parms.match.mask ? parms.match.value[0] + 1 : parms.match.value[0]);
                 tti_tbl[i][2] = v;
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_TUPE_CTRL(i), v);
+                REG_WR(VTSS_AFI_TTI_TUPE_CTRL(i), v);
             }
         }
         if (fa_afi_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_BLOCKING, &parms) != VTSS_RC_OK) {
@@ -833,17 +1509,17 @@ vtss_rc fa_afi_tupe_test(vtss_state_t *vtss_state)
         }
         // check TTI table entries:
         for (i = 0; i < max_addr; ++i) {
-            FA_RD(VTSS_AFI_TTI_TBL_TTI_PORT_QU(i), &v);
+            REG_RD(VTSS_AFI_TTI_PORT_QU(i), &v);
             if (v != tti_tbl[i][0]) {
                 printf("*** ERROR: i=%u v=0x%08x != tti_tbl[0]=0x%08x\n", i, v, tti_tbl[i][0]);
                 ok = FALSE;
             }
-            FA_RD(VTSS_AFI_TTI_TBL_TTI_TIMER(i), &v);
+            REG_RD(VTSS_AFI_TTI_TIMER(i), &v);
             if (v != tti_tbl[i][1]) {
                 printf("*** ERROR: i=%u v=0x%08x != tti_tbl[1]=0x%08x\n", i, v, tti_tbl[i][1]);
                 ok = FALSE;
             }
-            FA_RD(VTSS_AFI_TTI_TBL_TTI_TUPE_CTRL(i), &v);
+            REG_RD(VTSS_AFI_TTI_TUPE_CTRL(i), &v);
             if (v != tti_tbl[i][2]) {
                 printf("*** ERROR: i=%u v=0x%08x != tti_tbl[2]=0x%08x\n", i, v, tti_tbl[i][2]);
                 ok = FALSE;
@@ -893,39 +1569,39 @@ vtss_rc fa_afi_tupe_test(vtss_state_t *vtss_state)
         for (i = 0; i < max_addr; ++i) {
             if ((rand() % 1024) < 512) {
                 // make sure this entry does match
-                v = VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_QU_NUM(parms.match.qu_num_en ? parms.match.qu_num : rand() % 2048) |
-                    VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_PORT_NUM(VTSS_CHIP_PORT(parms.match.port_no_en ? parms.match.port_no : rand() % VTSS_PORTS));
-                vv = VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_QU_NUM(parms.update.qu_num_en ? parms.update.qu_num : VTSS_X_AFI_TTI_TBL_TTI_PORT_QU_QU_NUM(v)) |
-                    VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_PORT_NUM(parms.update.port_no_en ? VTSS_CHIP_PORT(parms.update.port_no) : VTSS_X_AFI_TTI_TBL_TTI_PORT_QU_PORT_NUM(v));
+                v = VTSS_F_AFI_TTI_PORT_QU_QU_NUM(parms.match.qu_num_en ? parms.match.qu_num : rand() % 2048) |
+                    VTSS_F_AFI_TTI_PORT_QU_PORT_NUM(VTSS_CHIP_PORT(parms.match.port_no_en ? parms.match.port_no : rand() % VTSS_PORTS));
+                vv = VTSS_F_AFI_TTI_PORT_QU_QU_NUM(parms.update.qu_num_en ? parms.update.qu_num : VTSS_X_AFI_TTI_PORT_QU_QU_NUM(v)) |
+                    VTSS_F_AFI_TTI_PORT_QU_PORT_NUM(parms.update.port_no_en ? VTSS_CHIP_PORT(parms.update.port_no) : VTSS_X_AFI_TTI_PORT_QU_PORT_NUM(v));
                 if (i < parms.start_addr || i > parms.end_addr || parms.match.mask == 0) {
                     tti_tbl[i][0] = v;  // expect no update
                 } else {
                     tti_tbl[i][0] = vv; // expect update
                 }
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_PORT_QU(i), v);
-                v = VTSS_F_AFI_TTI_TBL_TTI_TIMER_TIMER_ENA((rand() % 1024) < 512 ? 1 : 0);
-                vv = VTSS_F_AFI_TTI_TBL_TTI_TIMER_TIMER_ENA(parms.update.timer_ena_en ? parms.update.timer_ena : VTSS_X_AFI_TTI_TBL_TTI_TIMER_TIMER_ENA(v));
+                REG_WR(VTSS_AFI_TTI_PORT_QU(i), v);
+                v = VTSS_F_AFI_TTI_TIMER_TIMER_ENA((rand() % 1024) < 512 ? 1 : 0);
+                vv = VTSS_F_AFI_TTI_TIMER_TIMER_ENA(parms.update.timer_ena_en ? parms.update.timer_ena : VTSS_X_AFI_TTI_TIMER_TIMER_ENA(v));
                 if (i < parms.start_addr || i > parms.end_addr || parms.match.mask == 0) {
                     tti_tbl[i][1] = v;  // expect no update
                 } else {
                     tti_tbl[i][1] = vv; // expect update
                 }
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_TIMER(i), v);
-                v = VTSS_F_AFI_TTI_TBL_TTI_TUPE_CTRL_TUPE_CTRL(parms.match.mask ? parms.match.value[0] : rand() & 0xff);
+                REG_WR(VTSS_AFI_TTI_TIMER(i), v);
+                v = VTSS_F_AFI_TTI_TUPE_CTRL_TUPE_CTRL(parms.match.mask ? parms.match.value[0] : rand() & 0xff);
                 tti_tbl[i][2] = v;
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_TUPE_CTRL(i), v);
+                REG_WR(VTSS_AFI_TTI_TUPE_CTRL(i), v);
             } else {
                 // make sure this entry does not match
-                v = VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_QU_NUM(parms.match.qu_num_en ? parms.match.qu_num + 1 : parms.match.qu_num) |
-                    VTSS_F_AFI_TTI_TBL_TTI_PORT_QU_PORT_NUM(parms.match.port_no_en ? 1 + VTSS_CHIP_PORT(parms.match.port_no) : VTSS_CHIP_PORT(parms.match.port_no));
+                v = VTSS_F_AFI_TTI_PORT_QU_QU_NUM(parms.match.qu_num_en ? parms.match.qu_num + 1 : parms.match.qu_num) |
+                    VTSS_F_AFI_TTI_PORT_QU_PORT_NUM(parms.match.port_no_en ? 1 + VTSS_CHIP_PORT(parms.match.port_no) : VTSS_CHIP_PORT(parms.match.port_no));
                 tti_tbl[i][0] = v;
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_PORT_QU(i), v);
-                v = VTSS_F_AFI_TTI_TBL_TTI_TIMER_TIMER_ENA((rand() % 1024) < 512 ? 1 : 0);
+                REG_WR(VTSS_AFI_TTI_PORT_QU(i), v);
+                v = VTSS_F_AFI_TTI_TIMER_TIMER_ENA((rand() % 1024) < 512 ? 1 : 0);
                 tti_tbl[i][1] = v;
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_TIMER(i), v);
-                v = VTSS_F_AFI_TTI_TBL_TTI_TUPE_CTRL_TUPE_CTRL(parms.match.mask ? parms.match.value[0] + 1 : parms.match.value[0]);
+                REG_WR(VTSS_AFI_TTI_TIMER(i), v);
+                v = VTSS_F_AFI_TTI_TUPE_CTRL_TUPE_CTRL(parms.match.mask ? parms.match.value[0] + 1 : parms.match.value[0]);
                 tti_tbl[i][2] = v;
-                FA_WR(VTSS_AFI_TTI_TBL_TTI_TUPE_CTRL(i), v);
+                REG_WR(VTSS_AFI_TTI_TUPE_CTRL(i), v);
             }
         }
         if (fa_afi_tupe_cmd(vtss_state, VTSS_TUPE_CMD_START_NONBLOCKING, &parms) != VTSS_RC_OK) {
@@ -937,17 +1613,17 @@ vtss_rc fa_afi_tupe_test(vtss_state_t *vtss_state)
         }
         // check TTI table entries:
         for (i = 0; i < max_addr; ++i) {
-            FA_RD(VTSS_AFI_TTI_TBL_TTI_PORT_QU(i), &v);
+            REG_RD(VTSS_AFI_TTI_PORT_QU(i), &v);
             if (v != tti_tbl[i][0]) {
                 printf("*** ERROR: i=%u v=0x%08x != tti_tbl[0]=0x%08x\n", i, v, tti_tbl[i][0]);
                 ok = FALSE;
             }
-            FA_RD(VTSS_AFI_TTI_TBL_TTI_TIMER(i), &v);
+            REG_RD(VTSS_AFI_TTI_TIMER(i), &v);
             if (v != tti_tbl[i][1]) {
                 printf("*** ERROR: i=%u v=0x%08x != tti_tbl[1]=0x%08x\n", i, v, tti_tbl[i][1]);
                 ok = FALSE;
             }
-            FA_RD(VTSS_AFI_TTI_TBL_TTI_TUPE_CTRL(i), &v);
+            REG_RD(VTSS_AFI_TTI_TUPE_CTRL(i), &v);
             if (v != tti_tbl[i][2]) {
                 printf("*** ERROR: i=%u v=0x%08x != tti_tbl[2]=0x%08x\n", i, v, tti_tbl[i][2]);
                 ok = FALSE;
@@ -967,7 +1643,7 @@ vtss_rc fa_afi_tupe_test(vtss_state_t *vtss_state)
 }
 #endif /* TUPE_TEST */
 
-#endif /* VTSS_FEATURE_HW_PROT */
+#endif /* VTSS_FEATURE_TUPE */
 #endif /* VTSS_ARCH_FA */
 
 /*****************************************************************************/
@@ -4,13 +4,16 @@
 #ifndef _VTSS_FA_TUPE_H_
 #define _VTSS_FA_TUPE_H_
 
-#if defined(VTSS_FEATURE_HW_PROT)
+#if defined(VTSS_FEATURE_TUPE)
 
 /****************************************************************************
  * TUPE (Table UPdate Engine) for linear/ring protection
  * Used to update VLAN/VSI table
  ****************************************************************************/
 
+#define TUPE_CTRL_MAX     16     // TUPE control field is 16 bits
+#define TUPE_WAIT_MSEC    100    // Max time for a blocking TUPE command to complete
+
 /* The TUPE supports using 16 bits for control. This is split in
  * use for linear protection and ring protection.
  * Linear protection will use N number of bits, e.g. 8, which gives 256 TUPE values.
@@ -91,7 +94,7 @@ vtss_rc fa_tupe_vlan_clr(vtss_state_t *vtss_state,
  *                      VTSS_RC_INCOMPLETE if not ready.
  *                      Note that while TUPE is running, VLAN table must not be changed
  * - START_BLOCKING:    Returns VTSS_RC_OK when TUPE command done, VTSS_RC_ERR_PARM if parms invalid,
- *                      VTSS_RC_INCOMPLETE if not ready.
+ *                      VTSS_RC_INCOMPLETE if not ready, VTSS_RC_ERROR if not done within TUPE_WAIT_MSEC.
 */
 vtss_rc fa_tupe_cmd(vtss_state_t *vtss_state,
                      vtss_tupe_cmd_t cmd, vtss_tupe_parms_t *parms);
@@ -111,6 +114,9 @@ void fa_tupe_cb_register(fa_tupe_cb_t cb);
  * Used to update the AFI TTI (Timer Triggered Injection) table
  ****************************************************************************/
 
+/* The AFI TUPE supports using 8 bits for control value: */
+#define AFI_TUPE_CTRL_MAX  8     // AFI TUPE control field is 8 bits
+
 /* AFI TUPE value */
 typedef u8 vtss_afi_tupe_val_t;
 
@@ -154,7 +160,7 @@ vtss_rc fa_afi_tupe_free(vtss_state_t *vtss_state,
  *                      VTSS_RC_INCOMPLETE if not ready.
  *                      Note that while TUPE is running, TTI table must not be changed
  * - START_BLOCKING:    Returns VTSS_RC_OK when TUPE command done, VTSS_RC_ERR_PARM if parms invalid,
- *                      VTSS_RC_INCOMPLETE if not ready.
+ *                      VTSS_RC_INCOMPLETE if not ready, VTSS_RC_ERROR if not done within TUPE_WAIT_MSEC.
  * Note that the AFI TUPE values used in parms are used directly, so it is optional to use
  * fa_afi_tupe_alloc() / fa_afi_tupe_free(). This is to allow other allocation schemes for the AFI
  * TUPE values.
@@ -170,7 +176,7 @@ vtss_rc fa_afi_tupe_cmd(vtss_state_t *vtss_state,
 */
 vtss_rc fa_tupe_init(vtss_state_t *vtss_state, u8 tupe_linear_prot_bits);
 
-#endif /* VTSS_FEATURE_HW_PROT */
+#endif /* VTSS_FEATURE_TUPE */
 
 #endif /* _VTSS_FA_TUPE_H_ */
 
@@ -179,6 +179,122 @@ static vtss_rc voe_counter_update(vtss_state_t         *vtss_state,
 #undef UPDATE16
 }
 
+/*
+ * VOE counter polling.
+ * The chip counters of a VOE must be read before any of them can wrap:
+ * - Frame counters are 32 bit. Their rate is bounded by the port bandwidth and 64 byte frames.
+ *   Rx frames of an Up-MEP may come from any port, so the original 20 second period is kept.
+ * - CCM Rx counters are 16 bit and only count when CC is enabled. The Rx rate is set by the peer,
+ *   so the fastest CCM period (3.3 ms) is assumed.
+ * Half the wrap time is used, as the one second poll may run late.
+ * Allocated VOEs are kept in a wheel of one second slots by deadline. Each poll reads the VOEs that
+ * are due and then the VOEs due in the following seconds, until a budget based on the sum of the
+ * poll rates is used.
+ */
+#define VOE_POLL_NONE           0xffff
+#define VOE_POLL_PERIOD_MAX     300  /* Seconds */
+#define VOE_POLL_PERIOD_UP      20   /* Seconds */
+#define VOE_POLL_LOOKAHEAD      16   /* Seconds, must be less than the shortest poll period */
+#define VOE_POLL_LOAD(period)   ((65536 + (period) - 1) / (period))
+
+static u32 voe_poll_port_mbps(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    i32 chip_port;
+
+    if (port_no >= vtss_state->port_count || (chip_port = VTSS_CHIP_PORT(port_no)) == CHIP_PORT_UNUSED) {
+        return 25000;
+    }
+    switch (vtss_state->port.map[port_no].max_bw) {
+    case VTSS_BW_1G:  return 1000;
+    case VTSS_BW_2G5: return 2500;
+    case VTSS_BW_5G:  return 5000;
+    case VTSS_BW_10G: return 10000;
+    case VTSS_BW_25G: return 25000;
+    default:
+        return (VTSS_PORT_IS_2G5(chip_port) ? 2500 : VTSS_PORT_IS_5G(chip_port) ? 5000 :
+                VTSS_PORT_IS_10G(chip_port) ? 10000 : 25000);
+    }
+}
+
+static u32 voe_poll_period(vtss_state_t *vtss_state, const vtss_voe_idx_t voe_idx)
+{
+    vtss_voe_alloc_t *alloc_data = &vtss_state->oam.voe_alloc_data[voe_idx];
+    u32              period;
+
+    if (!vtss_state->oam.voe_conf[voe_idx].enable) {
+        /* Disabled VOEs do not count */
+        return VOE_POLL_PERIOD_MAX;
+    }
+    if (alloc_data->direction == VTSS_OAM_DIRECTION_UP) {
+        period = VOE_POLL_PERIOD_UP;
+    } else {
+        /* 2^32 frames of 84 bytes including preamble and IFG */
+        period = (0x100000000ULL * 84 * 8) / (voe_poll_port_mbps(vtss_state, alloc_data->port) * 1000000ULL) / 2;
+    }
+    if (vtss_state->oam.voe_cc_conf[voe_idx].enable) {
+        /* 2^16 CCM PDUs at 3.3 ms */
+        period = MIN(period, (0x10000 * 3333 / 1000000) / 2);
+    }
+    return MIN(period, VOE_POLL_PERIOD_MAX);
+}
+
+static void voe_poll_unlink(vtss_state_t *vtss_state, const vtss_voe_idx_t voe_idx)
+{
+    vtss_oam_state_t    *oam = &vtss_state->oam;
+    vtss_voe_internal_t *vi = &oam->voe_internal[voe_idx];
+
+    if (vi->poll_period == 0) {
+        return;
+    }
+    if (vi->poll_prev == VOE_POLL_NONE) {
+        oam->voe_poll_wheel[vi->poll_deadline % VTSS_VOE_POLL_WHEEL] = vi->poll_next;
+    } else {
+        oam->voe_internal[vi->poll_prev].poll_next = vi->poll_next;
+    }
+    if (vi->poll_next != VOE_POLL_NONE) {
+        oam->voe_internal[vi->poll_next].poll_prev = vi->poll_prev;
+    }
+    oam->voe_poll_load -= VOE_POLL_LOAD(vi->poll_period);
+    vi->poll_period = 0;
+}
+
+static void voe_poll_link(vtss_state_t *vtss_state, const vtss_voe_idx_t voe_idx, u32 period, u32 deadline)
+{
+    vtss_oam_state_t    *oam = &vtss_state->oam;
+    vtss_voe_internal_t *vi = &oam->voe_internal[voe_idx];
+    u16                 *head = &oam->voe_poll_wheel[deadline % VTSS_VOE_POLL_WHEEL];
+
+    vi->poll_period = period;
+    vi->poll_deadline = deadline;
+    vi->poll_prev = VOE_POLL_NONE;
+    vi->poll_next = *head;
+    if (*head != VOE_POLL_NONE) {
+        oam->voe_internal[*head].poll_prev = voe_idx;
+    }
+    *head = voe_idx;
+    oam->voe_poll_load += VOE_POLL_LOAD(period);
+}
+
+/* Schedule the counter poll after allocation or configuration change.
+   The counters may have been counting at the old rate, so the deadline is never postponed */
+static void voe_poll_schedule(vtss_state_t *vtss_state, const vtss_voe_idx_t voe_idx)
+{
+    vtss_voe_internal_t *vi = &vtss_state->oam.voe_internal[voe_idx];
+    u32                 period, deadline;
+
+    if (!vtss_state->oam.voe_alloc_data[voe_idx].allocated) {
+        voe_poll_unlink(vtss_state, voe_idx);
+        return;
+    }
+    period = voe_poll_period(vtss_state, voe_idx);
+    deadline = vtss_state->oam.voe_poll_tick + period;
+    if (vi->poll_period != 0) {
+        deadline = MIN(deadline, vi->poll_deadline);
+        voe_poll_unlink(vtss_state, voe_idx);
+    }
+    voe_poll_link(vtss_state, voe_idx, period, deadline);
+}
+
 static vtss_rc fa_oam_vop_int_enable(vtss_state_t *vtss_state, BOOL enable)
 {
     REG_WRM(VTSS_VOP_MASTER_INTR_CTRL, VTSS_F_VOP_MASTER_INTR_CTRL_OAM_MEP_INTR_ENA(enable ? 1 : 0), VTSS_M_VOP_MASTER_INTR_CTRL_OAM_MEP_INTR_ENA);
@@ -496,6 +612,8 @@ static vtss_rc fa_voe_alloc(vtss_state_t                *vtss_state,
     REG_WR(VTSS_VOP_SAM_COSID_SEQ_CFG(*voe_idx), 0);
     REG_WR(VTSS_VOP_SAM_NON_OAM_SEQ_CFG(*voe_idx), 0);
 
+    voe_poll_schedule(vtss_state, *voe_idx);
+
     VTSS_D("Exit voe_idx %u", *voe_idx);
 
     return VTSS_RC_OK;
@@ -514,6 +632,7 @@ static vtss_rc fa_voe_free(vtss_state_t          *vtss_state,
         return (VTSS_RC_OK);
     }
     alloc_data->allocated = FALSE;
+    voe_poll_unlink(vtss_state, voe_idx);
 
     if (voe_idx < VTSS_PATH_SERVICE_VOE_CNT) {
         voe_alloc_idx = voe_idx;
@@ -629,6 +748,8 @@ static vtss_rc fa_voe_conf_set(vtss_state_t           *vtss_state,
     /* Enable/Disable VOE */
     REG_WRM(VTSS_VOP_VOE_MISC_CONFIG(voe_idx), VTSS_F_VOP_VOE_MISC_CONFIG_VOE_ENA(conf->enable ? 1 : 0), VTSS_M_VOP_VOE_MISC_CONFIG_VOE_ENA);
 
+    voe_poll_schedule(vtss_state, voe_idx);
+
     return (VTSS_RC_OK);
 }
 
@@ -700,6 +821,8 @@ static vtss_rc fa_voe_cc_conf_set(vtss_state_t              *vtss_state,
     /* Enable/Disable CCM handling */
     REG_WRM(VTSS_VOP_OAM_HW_CTRL(voe_idx), VTSS_F_VOP_OAM_HW_CTRL_CCM_ENA(conf->enable ? 1 : 0), VTSS_M_VOP_OAM_HW_CTRL_CCM_ENA);
 
+    voe_poll_schedule(vtss_state, voe_idx);
+
     return (VTSS_RC_OK);
 }
 
@@ -1487,6 +1610,10 @@ static vtss_rc fa_debug_vop(vtss_state_t               *vtss_state,
         pr("UMIP: %u\n", umip_cnt);
         pr("DMIP: %u\n", dmip_cnt);
         pr("\n");
+        pr("VOE counter poll:\n");
+        pr("Load: %u.%03u VOEs pr. second\n", vtss_state->oam.voe_poll_load / 65536, (vtss_state->oam.voe_poll_load % 65536) * 1000 / 65536);
+        pr("Max VOEs pr. poll: %u\n", vtss_state->oam.voe_poll_max);
+        pr("\n");
         pr("Maximum values:\n");
         pr("SERVICE-VOE-MAX: %u\n", VTSS_PATH_SERVICE_VOE_CNT);
         pr("PORT-VOE-MAX: %u\n", VTSS_PORT_VOE_CNT);
@@ -1631,42 +1758,46 @@ static vtss_rc voi_default_set(vtss_state_t          *vtss_state,
 
 static vtss_rc fa_oam_voe_poll_1sec(vtss_state_t *vtss_state)
 {
-    /* LM and DM PDU Tx/Rx counters are 8 bit
-     * Some CCM PDU counters are 16 bit
-     * Data frame counters are 32 bit
-     * No byte counters
-     * For a 32-bit frame counter at 10G, wrap happens after approx. 219s
-     * For OAM PDU at 3.3 ms (CCM) 16-bit wrap happens after approx. 196s
-     * For OAM PDU at 100 ms (LM/DM) 8-bit wrap happens after approx. 25s
-     * I.e. worst case is 25s
-     * Jaguar2 has 1077 VOEs to cover in 25s -> poll 44 at each tick
-     * ServalT has  203 VOEs to cover in 25s -> poll 9 at each tick
-     *
-     * Bugzilla #23350: The original algorithm depended on a very accurate
-     * timer to drive this poll. This turned out to be a false assumption.
-     * We thus occasionally encountered DM counter overrun because the polling
-     * sometimes took a bit longer. We have thus increased the number of VOEs
-     * that is polled every second by setting the target "full circle" period
-     * to 20 seconds instead of 25.
-     */
-    const u32 N = 1 + VTSS_VOE_CNT / 20;
-
-    vtss_voe_idx_t *idx = &(vtss_state->oam.voe_poll_idx);  /* For readability */
-    u32 i;
-
-    for (i = 0; i < N; ++i) {
-        VTSS_RC(voe_counter_update(vtss_state, *idx, 0));
-        *idx = (*idx == VTSS_VOE_CNT - 1) ? 0 : *idx + 1;
+    vtss_oam_state_t    *oam = &vtss_state->oam;
+    vtss_voe_internal_t *vi;
+    vtss_rc             rc = VTSS_RC_OK;
+    u32                 tick, budget, cnt = 0, d, period;
+    u16                 *head, idx;
+
+    tick = ++oam->voe_poll_tick;
+    budget = oam->voe_poll_load / 65536 + 1;
+    for (d = 0; d < VOE_POLL_LOOKAHEAD && (d == 0 || cnt < budget); d++) {
+        /* VOEs due now are always read, the later ones only within the budget */
+        head = &oam->voe_poll_wheel[(tick + d) % VTSS_VOE_POLL_WHEEL];
+        while ((idx = *head) != VOE_POLL_NONE && (d == 0 || cnt < budget)) {
+            if (voe_counter_update(vtss_state, idx, 0) != VTSS_RC_OK) {
+                rc = VTSS_RC_ERROR;
+            }
+            vi = &oam->voe_internal[idx];
+            period = vi->poll_period;
+            voe_poll_unlink(vtss_state, idx);
+            voe_poll_link(vtss_state, idx, period, tick + period);
+            cnt++;
+        }
+    }
+    if (cnt > oam->voe_poll_max) {
+        oam->voe_poll_max = cnt;
     }
 
-    return VTSS_RC_OK;
+    return rc;
 }
 
 static vtss_rc fa_init(vtss_state_t *vtss_state)
 {
+    u32 i;
+
     /* All VOEs are disabled in hardware by default - Disable VOP */
     REG_WR(VTSS_VOP_VOP_CTRL, 0);
 
+    for (i = 0; i < VTSS_VOE_POLL_WHEEL; i++) {
+        vtss_state->oam.voe_poll_wheel[i] = VOE_POLL_NONE;
+    }
+
     switch (vtss_state->init_conf.core_clock.freq) {
         case VTSS_CORE_CLOCK_625MHZ:
         case VTSS_CORE_CLOCK_DEFAULT:
@@ -963,6 +963,7 @@ static vtss_rc jr2_mirror_conf_set(vtss_state_t *vtss_state)
     u32                probe, port = 0, dir, vlan_mode, tx_port, rx_cpu, cpu_set;
     u64                pmask = 0, pmask_probe;
     BOOL               member[VTSS_PORTS];
+    vtss_port_mask_t   set_mask;
 
     /* Mirror port and mask */
     if (conf->port_no != VTSS_PORT_NO_NONE && vtss_state->l2.tx_forward_aggr[conf->port_no]) {
@@ -981,7 +982,8 @@ static vtss_rc jr2_mirror_conf_set(vtss_state_t *vtss_state)
         if (probe == JR2_MIRROR_PROBE_RX) {
             /* Ingress probe */
             if (pmask) {
-                pmask_probe = vtss_jr2_port_mask(vtss_state, vtss_state->l2.mirror_ingress);
+                vtss_port_set_mask_get(vtss_state, &vtss_state->l2.mirror_ingress, &set_mask);
+                pmask_probe = (set_mask.m[0] | ((u64)set_mask.m[1] << 32));
                 if (vtss_state->l2.mirror_cpu_ingress) {
                     rx_cpu = 0x3; /* Enable Rx mirror from both CPU ports */
                 }
@@ -990,7 +992,8 @@ static vtss_rc jr2_mirror_conf_set(vtss_state_t *vtss_state)
             /* Egress probe */
             dir = 1;
             if (pmask) {
-                pmask_probe = vtss_jr2_port_mask(vtss_state, vtss_state->l2.mirror_egress);
+                vtss_port_set_mask_get(vtss_state, &vtss_state->l2.mirror_egress, &set_mask);
+                pmask_probe = (set_mask.m[0] | ((u64)set_mask.m[1] << 32));
                 tx_port = jr2_first_port(pmask_probe); /* The first egress port is used in the rewriter */
                 if (vtss_state->l2.mirror_cpu_egress) {
                     cpu_set = 0xff;
@@ -398,13 +398,7 @@ static vtss_rc tupe_realloc(vtss_state_t *vtss_state, u8 tupe_linear_prot_bits)
     for (i = 0; i < new_tupe_bits_max; ++i) {
         vtss_state->tupe.tupe_bits_free |= 1 << i;
     }
-    if (vtss_state->tupe.tupe_vals_free) {
-        free(vtss_state->tupe.tupe_vals_free);
-    }
-    if (new_tupe_vals_max > 0) {
-        vtss_state->tupe.tupe_vals_free = malloc(4 * (31 + new_tupe_vals_max) / 32);
-        VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0, 4 * (31 + new_tupe_vals_max) / 32);
-    }
+    VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0, sizeof(vtss_state->tupe.tupe_vals_free));
     for (i = 0; i <= max_addr; ++i) {
         if (jr2_tupe_vlan_get(vtss_state, i, &tupe_type, &tupe_val) != VTSS_RC_OK) {
             continue;
@@ -501,12 +495,9 @@ static vtss_rc tupe_realloc(vtss_state_t *vtss_state, u8 tupe_linear_prot_bits)
     for (i = 0; i < TUPE_BITS_MAX; ++i) {
         vtss_state->tupe.tupe_bits_free |= 1 << i;
     }
-    if (vtss_state->tupe.tupe_vals_free) {
-        free(vtss_state->tupe.tupe_vals_free);
-    }
+    VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0, sizeof(vtss_state->tupe.tupe_vals_free));
     if (vtss_state->tupe.tupe_vals_bits) {
-        vtss_state->tupe.tupe_vals_free = malloc(4 * (31 + TUPE_VALS_MAX) / 32);
-        VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0xff, 4 * (31 + TUPE_VALS_MAX) / 32);
+        VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0xff, 4 * ((31 + TUPE_VALS_MAX) / 32));
         vtss_state->tupe.tupe_vals_next = 1; // 0 is reserved
     }
     for (i = 0; i <= max_addr; ++i) {
@@ -717,19 +708,16 @@ vtss_rc jr2_tupe_init(vtss_state_t *vtss_state, u8 tupe_linear_prot_bits)
         for (i = 0; i < TUPE_BITS_MAX; ++i) {
             vtss_state->tupe.tupe_bits_free |= 1 << i;
         }
-        if (vtss_state->tupe.tupe_vals_free) {
-            free(vtss_state->tupe.tupe_vals_free);
-            vtss_state->tupe.tupe_vals_free = NULL;
-        }
+        VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0, sizeof(vtss_state->tupe.tupe_vals_free));
         if (vtss_state->tupe.tupe_vals_bits) {
-            vtss_state->tupe.tupe_vals_free = malloc(4 * (31 + TUPE_VALS_MAX) / 32);
-            VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0xff, 4 * (31 + TUPE_VALS_MAX) / 32);
+            VTSS_MEMSET(vtss_state->tupe.tupe_vals_free, 0xff, 4 * ((31 + TUPE_VALS_MAX) / 32));
             vtss_state->tupe.tupe_vals_next = 1; // 0 is reserved
         }
     }
-    if (!vtss_state->tupe.afi_tupe_vals_free) {
-        vtss_state->tupe.afi_tupe_vals_free = malloc(4 * (31 + AFI_TUPE_VALS_MAX) / 32);
-        VTSS_MEMSET(vtss_state->tupe.afi_tupe_vals_free, 0xff, 4 * (31 + AFI_TUPE_VALS_MAX) / 32);
+    if (vtss_state->tupe.afi_tupe_vals_next == 0) {
+        // first init, all AFI TUPE values are free
+        VTSS_MEMSET(vtss_state->tupe.afi_tupe_vals_free, 0xff, sizeof(vtss_state->tupe.afi_tupe_vals_free));
+        vtss_state->tupe.afi_tupe_vals_next = 1; // 0 is reserved
     }
     // Minium number of clock cycles between TUPE accessing TTI Table. Default 10.
     // TUPE access to TTI Table takes precedence over both CSR accesses and normal TTI processing.
@@ -782,14 +782,17 @@ static vtss_rc lan966x_mirror_ingress_set(vtss_state_t *vtss_state)
 
     for (port_no = 0; port_no < vtss_state->port_count; port_no++) {
         port = VTSS_CHIP_PORT(port_no);
-        REG_WRM_CTL(ANA_PORT_CFG(port), vtss_state->l2.mirror_ingress[port_no], ANA_PORT_CFG_SRC_MIRROR_ENA_M);
+        REG_WRM_CTL(ANA_PORT_CFG(port), VTSS_PORT_SET_GET(&vtss_state->l2.mirror_ingress, port_no), ANA_PORT_CFG_SRC_MIRROR_ENA_M);
     }
     return VTSS_RC_OK;
 }
 
 static vtss_rc lan966x_mirror_egress_set(vtss_state_t *vtss_state)
 {
-    REG_WR(ANA_EMIRRORPORTS, vtss_lan966x_port_mask(vtss_state, vtss_state->l2.mirror_egress));
+    vtss_port_mask_t pmask;
+
+    vtss_port_set_mask_get(vtss_state, &vtss_state->l2.mirror_egress, &pmask);
+    REG_WR(ANA_EMIRRORPORTS, pmask.m[0]);
     return VTSS_RC_OK;
 }
 
@@ -1529,12 +1532,15 @@ static vtss_rc lan966x_debug_frer(vtss_state_t *vtss_state,
     vtss_sdx_entry_t *sdx;
     vtss_xms_entry_t *ms;
     vtss_port_no_t   port_no;
+    vtss_iflow_id_t  id;
     u32              i, idx, val;
     char             buf[80];
     BOOL             header = 1;
 
-    for (sdx = vtss_state->l2.sdx_info.iflow; sdx != NULL; sdx = sdx->next) {
-        if (sdx->conf.frer.mstream_enable == 0 && sdx->conf.frer.generation == 0) {
+    /* The flow list is unordered, so walk the flows in ISDX order */
+    for (id = 1; id <= vtss_state->l2.sdx_info.max_count; id++) {
+        if ((sdx = vtss_iflow_lookup(vtss_state, id)) == NULL ||
+            (sdx->conf.frer.mstream_enable == 0 && sdx->conf.frer.generation == 0)) {
             continue;
         }
         if (header) {
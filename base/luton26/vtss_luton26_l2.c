@@ -924,7 +924,7 @@ static vtss_rc l26_mirror_ingress_set(vtss_state_t *vtss_state)
     BOOL           enabled;
 
     for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
-        enabled = vtss_state->l2.mirror_ingress[port_no];
+        enabled = VTSS_PORT_SET_GET(&vtss_state->l2.mirror_ingress, port_no);
         L26_WRM(VTSS_ANA_PORT_PORT_CFG(VTSS_CHIP_PORT(port_no)), 
                 (enabled ? VTSS_F_ANA_PORT_PORT_CFG_SRC_MIRROR_ENA : 0), VTSS_F_ANA_PORT_PORT_CFG_SRC_MIRROR_ENA);
     }
@@ -934,7 +934,10 @@ static vtss_rc l26_mirror_ingress_set(vtss_state_t *vtss_state)
 /* Egress ports subjects for mirroring */
 static vtss_rc l26_mirror_egress_set(vtss_state_t *vtss_state)
 {
-    L26_WR(VTSS_ANA_ANA_EMIRRORPORTS, vtss_l26_port_mask(vtss_state, vtss_state->l2.mirror_egress));
+    vtss_port_mask_t pmask;
+
+    vtss_port_set_mask_get(vtss_state, &vtss_state->l2.mirror_egress, &pmask);
+    L26_WR(VTSS_ANA_ANA_EMIRRORPORTS, pmask.m[0]);
     return VTSS_RC_OK;
 }
 
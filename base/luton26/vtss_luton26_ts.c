@@ -585,6 +585,7 @@ l26_ts_timestamp_get(vtss_state_t *vtss_state)
             } else if (tx_port == VTSS_CHIP_PORT_CPU) {
                 vtss_state->ts.status[mess_id].rx_tc = delay;
                 vtss_state->ts.status[mess_id].rx_tc_valid = TRUE;
+                vtss_state->ts.active_mask |= 1LL<<mess_id;
             } else {
                 VTSS_I("invalid port (%u)", tx_port);
             }
@@ -225,44 +225,41 @@ void vtss_srvl_debug_cnt(const vtss_debug_printf_t pr, const char *col1, const c
     pr("\n");
 }
 
-vtss_rc vtss_srvl_debug_isdx_list(vtss_state_t *vtss_state,
-                                  const vtss_debug_printf_t pr, vtss_sdx_entry_t *isdx_list, 
-                                  u32 id, BOOL *header, BOOL ece)
+vtss_rc vtss_srvl_debug_isdx(vtss_state_t *vtss_state,
+                             const vtss_debug_printf_t pr, vtss_sdx_entry_t *isdx,
+                             u32 id, BOOL *header, BOOL ece)
 {
-    vtss_sdx_entry_t *isdx;
-    u32              value;
-
-    for (isdx = isdx_list; isdx != NULL; isdx = isdx->next) {
-        if (*header) {
-            pr("ISDX  %s    Port  FORCE_ENA  ES0_ENA  SDLBI  VOE  ", ece ? "ECE ID" : "IFLOW");
-            vtss_srvl_debug_print_port_header(vtss_state, pr, "");
-            *header = 0;
-        }
-        SRVL_WR(VTSS_ANA_ANA_TABLES_ISDXTIDX, 
-                VTSS_F_ANA_ANA_TABLES_ISDXTIDX_ISDX_INDEX(isdx->sdx));
-        SRVL_WR(VTSS_ANA_ANA_TABLES_ISDXACCESS, 
-                VTSS_F_ANA_ANA_TABLES_ISDXACCESS_ISDX_TBL_CMD(ISDX_CMD_READ));
-        VTSS_RC(srvl_isdx_table_idle(vtss_state));
-        SRVL_RD(VTSS_ANA_ANA_TABLES_ISDXTIDX, &value);
-        pr("%-6u%-10X", isdx->sdx, id);
-        if (isdx->port_no < vtss_state->port_count)
-            pr("%-6u", VTSS_CHIP_PORT(isdx->port_no));
-        else
-            pr("%-6s", isdx->port_no == VTSS_PORT_NO_CPU ? "CPU" : "?");
-        pr("%-11u%-9u%-7u",
-           value & VTSS_F_ANA_ANA_TABLES_ISDXTIDX_ISDX_FORCE_ENA ? 1 : 0,
-           value & VTSS_F_ANA_ANA_TABLES_ISDXTIDX_ISDX_ES0_KEY_ENA ? 1 : 0,
-           VTSS_X_ANA_ANA_TABLES_ISDXTIDX_ISDX_SDLBI(value));
-        
-        SRVL_RD(VTSS_ANA_IPT_OAM_MEP_CFG(isdx->sdx), &value);
-        if (value & VTSS_F_ANA_IPT_OAM_MEP_CFG_MEP_IDX_ENA)
-            pr("%-5u", VTSS_X_ANA_IPT_OAM_MEP_CFG_MEP_IDX(value));
-        else
-            pr("None ");
-        
-        SRVL_RD(VTSS_ANA_ANA_TABLES_ISDXACCESS, &value);
-        vtss_srvl_debug_print_mask(pr, VTSS_X_ANA_ANA_TABLES_ISDXACCESS_ISDX_PORT_MASK(value));
+    u32 value;
+
+    if (*header) {
+        pr("ISDX  %s    Port  FORCE_ENA  ES0_ENA  SDLBI  VOE  ", ece ? "ECE ID" : "IFLOW");
+        vtss_srvl_debug_print_port_header(vtss_state, pr, "");
+        *header = 0;
     }
+    SRVL_WR(VTSS_ANA_ANA_TABLES_ISDXTIDX, 
+            VTSS_F_ANA_ANA_TABLES_ISDXTIDX_ISDX_INDEX(isdx->sdx));
+    SRVL_WR(VTSS_ANA_ANA_TABLES_ISDXACCESS, 
+            VTSS_F_ANA_ANA_TABLES_ISDXACCESS_ISDX_TBL_CMD(ISDX_CMD_READ));
+    VTSS_RC(srvl_isdx_table_idle(vtss_state));
+    SRVL_RD(VTSS_ANA_ANA_TABLES_ISDXTIDX, &value);
+    pr("%-6u%-10X", isdx->sdx, id);
+    if (isdx->port_no < vtss_state->port_count)
+        pr("%-6u", VTSS_CHIP_PORT(isdx->port_no));
+    else
+        pr("%-6s", isdx->port_no == VTSS_PORT_NO_CPU ? "CPU" : "?");
+    pr("%-11u%-9u%-7u",
+       value & VTSS_F_ANA_ANA_TABLES_ISDXTIDX_ISDX_FORCE_ENA ? 1 : 0,
+       value & VTSS_F_ANA_ANA_TABLES_ISDXTIDX_ISDX_ES0_KEY_ENA ? 1 : 0,
+       VTSS_X_ANA_ANA_TABLES_ISDXTIDX_ISDX_SDLBI(value));
+    
+    SRVL_RD(VTSS_ANA_IPT_OAM_MEP_CFG(isdx->sdx), &value);
+    if (value & VTSS_F_ANA_IPT_OAM_MEP_CFG_MEP_IDX_ENA)
+        pr("%-5u", VTSS_X_ANA_IPT_OAM_MEP_CFG_MEP_IDX(value));
+    else
+        pr("None ");
+    
+    SRVL_RD(VTSS_ANA_ANA_TABLES_ISDXACCESS, &value);
+    vtss_srvl_debug_print_mask(pr, VTSS_X_ANA_ANA_TABLES_ISDXACCESS_ISDX_PORT_MASK(value));
     return VTSS_RC_OK;
 }
 
@@ -147,9 +147,9 @@ void vtss_srvl_debug_print_port_header(vtss_state_t *vtss_state,
                                        const vtss_debug_printf_t pr, const char *txt);
 void vtss_srvl_debug_print_mask(const vtss_debug_printf_t pr, u32 mask);
 
-vtss_rc vtss_srvl_debug_isdx_list(vtss_state_t *vtss_state,
-                                  const vtss_debug_printf_t pr, vtss_sdx_entry_t *isdx_list, 
-                                  u32 id, BOOL *header, BOOL ece);
+vtss_rc vtss_srvl_debug_isdx(vtss_state_t *vtss_state,
+                             const vtss_debug_printf_t pr, vtss_sdx_entry_t *isdx,
+                             u32 id, BOOL *header, BOOL ece);
 
 /* Port functions */
 vtss_rc vtss_srvl_port_init(vtss_state_t *vtss_state, vtss_init_cmd_t cmd);
@@ -724,11 +724,11 @@ static vtss_rc srvl_mirror_ingress_set(vtss_state_t *vtss_state)
     VTSS_MEMSET(set, 0, sizeof(set));
     for (vp_idx = VTSS_MPLS_VPROFILE_RESERVED_CNT; vp_idx < VTSS_MPLS_VPROFILE_CNT; vp_idx++) {
         vtss_mpls_vprofile_t *vp = &VP_P(vp_idx);
-        set[vp_idx] = (vp->port < vtss_state->port_count)  &&  vtss_state->l2.mirror_ingress[vp->port];
+        set[vp_idx] = (vp->port < vtss_state->port_count)  &&  VTSS_PORT_SET_GET(&vtss_state->l2.mirror_ingress, vp->port);
     }
 
     for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
-        set[VTSS_CHIP_PORT(port_no)] = vtss_state->l2.mirror_ingress[port_no];
+        set[VTSS_CHIP_PORT(port_no)] = VTSS_PORT_SET_GET(&vtss_state->l2.mirror_ingress, port_no);
     }
 
     for (vp_idx = 0; vp_idx < VTSS_MPLS_VPROFILE_CNT; vp_idx++) {
@@ -738,9 +738,9 @@ static vtss_rc srvl_mirror_ingress_set(vtss_state_t *vtss_state)
     vtss_port_no_t port_no;
 
     for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
-        VTSS_I("vtss_state->l2.mirror_ingress[port_no]:%d, port_no:%d, chip_port:%d", vtss_state->l2.mirror_ingress[port_no], port_no, VTSS_CHIP_PORT(port_no));
+        VTSS_I("mirror_ingress:%d, port_no:%d, chip_port:%d", VTSS_PORT_SET_GET(&vtss_state->l2.mirror_ingress, port_no), port_no, VTSS_CHIP_PORT(port_no));
         SRVL_WRM_CTL(VTSS_ANA_PORT_PORT_CFG(VTSS_CHIP_PORT(port_no)),
-                     vtss_state->l2.mirror_ingress[port_no],
+                     VTSS_PORT_SET_GET(&vtss_state->l2.mirror_ingress, port_no),
                      VTSS_F_ANA_PORT_PORT_CFG_SRC_MIRROR_ENA);
     }
 #endif /* VTSS_FEATURE_MPLS */
@@ -749,7 +749,10 @@ static vtss_rc srvl_mirror_ingress_set(vtss_state_t *vtss_state)
 
 static vtss_rc srvl_mirror_egress_set(vtss_state_t *vtss_state)
 {
-    SRVL_WR(VTSS_ANA_ANA_EMIRRORPORTS, vtss_srvl_port_mask(vtss_state, vtss_state->l2.mirror_egress));
+    vtss_port_mask_t pmask;
+
+    vtss_port_set_mask_get(vtss_state, &vtss_state->l2.mirror_egress, &pmask);
+    SRVL_WR(VTSS_ANA_ANA_EMIRRORPORTS, pmask.m[0]);
     return VTSS_RC_OK;
 }
 
@@ -1022,11 +1025,19 @@ static vtss_rc srvl_debug_vxlat(vtss_state_t *vtss_state,
                                 const vtss_debug_printf_t pr,
                                 const vtss_debug_info_t   *const info)
 {
-    BOOL header = 1;
+    vtss_sdx_entry_t *sdx;
+    vtss_iflow_id_t  id;
+    BOOL             header = 1;
 
     VTSS_RC(vtss_srvl_debug_is1_all(vtss_state, pr, info));
     VTSS_RC(vtss_srvl_debug_es0_all(vtss_state, pr, info));
-    VTSS_RC(vtss_srvl_debug_isdx_list(vtss_state, pr, vtss_state->l2.sdx_info.iflow, 0, &header, FALSE));
+
+    /* The flow list is unordered, so walk the flows in ISDX order */
+    for (id = 1; id <= vtss_state->l2.sdx_info.max_count; id++) {
+        if ((sdx = vtss_iflow_lookup(vtss_state, id)) != NULL) {
+            VTSS_RC(vtss_srvl_debug_isdx(vtss_state, pr, sdx, id, &header, FALSE));
+        }
+    }
 
     return VTSS_RC_OK;
 }
@@ -223,6 +223,7 @@
 // #define VTSS_FEATURE_10GBASE_KR                  /**< KR */
 #define VTSS_FEATURE_AFI_SWC                      /**< AFI */
 #define VTSS_AFI_V2                               /**< AFI API version 2 */
+#define VTSS_FEATURE_TUPE                         /**< Table Update Engine for VLAN and AFI tables */
 // #if !defined(VTSS_OPT_VCORE_IV)
 //   #define VTSS_OPT_VCORE_IV 1                   /**< Internal VCore-IV (ARM) CPU enabled by default */
 // #endif
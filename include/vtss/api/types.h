@@ -381,6 +381,11 @@ typedef enum {
 
 #define VTSS_PORT_IS_PORT(x) ((x)<VTSS_PORT_NO_END) /**< Valid port number */
 
+/** \brief Port list, bit (port_no % 8) of byte (port_no / 8) is set for member ports */
+typedef struct {
+    u8 bf[(VTSS_PORT_ARRAY_SIZE + 7) / 8]; /**< Port bit field */
+} vtss_port_bf_t;
+
 /** \brief The different interfaces for connecting MAC and PHY */
 typedef enum
 {
@@ -249,6 +249,8 @@ vtss_rc vtss_afi_hijack(const vtss_inst_t inst, vtss_afi_id_t id);
  *    Repeat 4-5 as desired.
  * 6) Call vtss_afi_slow_inj_free() to free allocated resources.
  *
+ * Freeing an injection may complete asynchronously, see vtss_afi_rm_event_get().
+ *
  * During link down, all injections (slow as well as fast) are automatically stopped
  * and upon link up, injections are restarted.
  *
@@ -623,6 +625,33 @@ vtss_rc vtss_afi_port_start(const vtss_inst_t    inst,
 vtss_rc vtss_afi_port_stop(const vtss_inst_t    inst,
                                  vtss_port_no_t port_no);
 
+/**
+ * \brief AFI frame removal event
+ **/
+typedef struct {
+    BOOL valid;   /**< TRUE if an event was returned */
+    BOOL fast;    /**< TRUE if #id is a vtss_afi_fastid_t, FALSE if it is a vtss_afi_slowid_t */
+    u32  id;      /**< Fast or slow injection ID */
+    BOOL removed; /**< TRUE if the frames were removed and the ID freed, FALSE if removal failed and the ID is still allocated */
+} vtss_afi_rm_event_t;
+
+/**
+ * \brief Get AFI frame removal event
+ *
+ * On some targets, vtss_afi_fast_inj_free() and vtss_afi_slow_inj_free() only
+ * start the removal of the injected frames. The removal is completed by
+ * vtss_poll_1sec() or by this function, which may be called as often as desired.
+ * The ID is freed when the removal is completed.
+ * Call this function until event->valid is FALSE.
+ *
+ * \param inst  [IN]  Target instance reference.
+ * \param event [OUT] Removal event.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_afi_rm_event_get(const vtss_inst_t         inst,
+                              vtss_afi_rm_event_t *const event);
+
 #endif // VTSS_AFI_V2
 
 #ifdef __cplusplus
@@ -67,7 +67,9 @@ typedef enum {
 
 /** \brief Create structure */
 typedef struct {
-    vtss_target_type_t target; /**< Target type */
+    vtss_target_type_t target;     /**< Target type */
+    void               *state_mem; /**< Persistent memory region for the API state or NULL to allocate it. See vtss_inst_persist_size_get() */
+    u32                state_size; /**< Size of state_mem in bytes */
 } vtss_inst_create_t;
 
 /**
@@ -101,6 +103,44 @@ vtss_rc vtss_inst_create(const vtss_inst_create_t *const create,
  **/
 vtss_rc vtss_inst_destroy(const vtss_inst_t inst);
 
+/**
+ * \brief Get the size of the persistent memory region needed for the API state.
+ *
+ * The region starts with a versioned header followed by the API state.
+ * When vtss_inst_create() is given a region holding a valid state released by
+ * vtss_inst_destroy(), the state is adopted instead of created.
+ * The state is only adopted if it was created by the same API build loaded at the same
+ * address and the region is mapped at the same address, because the state holds function
+ * pointers and pointers into itself.
+ *
+ * \param size [OUT] Size of the region in bytes.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_inst_persist_size_get(u32 *const size);
+
+/** \brief Persistent state status */
+typedef struct {
+    BOOL persistent; /**< The API state is located in a persistent memory region */
+    BOOL adopted;    /**< The API state was adopted from the previous owner of the region */
+} vtss_inst_persist_status_t;
+
+/**
+ * \brief Get persistent state status.
+ *
+ * If the state has been adopted, the hardware and API state are already configured.
+ * The application must call vtss_init_conf_set() to update the register access and
+ * other callback functions, which does not access the hardware for an adopted state.
+ * Reconfiguration and warm start synchronization can then be skipped.
+ *
+ * \param inst [IN]    Target instance reference.
+ * \param status [OUT] Persistent state status.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_inst_persist_status_get(const vtss_inst_t          inst,
+                                     vtss_inst_persist_status_t *const status);
+
 /**
  * \brief Register read function
  *
@@ -1229,6 +1229,28 @@ vtss_rc vtss_iflow_conf_set(const vtss_inst_t       inst,
                             const vtss_iflow_id_t   id,
                             const vtss_iflow_conf_t *const conf);
 
+/** \brief Ingress flow ID and configuration */
+typedef struct {
+    vtss_iflow_id_t   id;   /**< Ingress flow ID */
+    vtss_iflow_conf_t conf; /**< Ingress flow configuration */
+} vtss_iflow_entry_t;
+
+/**
+ * \brief Set configuration of a list of ingress flows.
+ * The flows are applied in order, stopping at the first failure.
+ *
+ * \param inst [IN]      Target instance reference.
+ * \param cnt [IN]       Length of 'entry'.
+ * \param entry [IN]     List of flows to configure.
+ * \param set_cnt [OUT]  Number of flows configured.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_iflow_conf_bulk_set(const vtss_inst_t        inst,
+                                 const u32                cnt,
+                                 const vtss_iflow_entry_t *entry,
+                                 u32                      *const set_cnt);
+
 #endif /* VTSS_FEATURE_XFLOW */
 
 #if defined(VTSS_FEATURE_VCAP)
@@ -2021,7 +2043,7 @@ vtss_rc vtss_aggr_port_members_get(const vtss_inst_t     inst,
  **/
 vtss_rc vtss_aggr_port_members_set(const vtss_inst_t     inst,
                                    const vtss_aggr_no_t  aggr_no,
-                                   const BOOL            member[VTSS_PORT_ARRAY_SIZE]);
+                                   const vtss_port_bf_t  *const member);
 
 /**
  * \brief Get aggregation traffic distribution mode.
@@ -2158,13 +2180,13 @@ vtss_rc vtss_mirror_ingress_ports_get(const vtss_inst_t  inst,
  * \brief Set the mirror ingress ports.
  *
  * \param inst [IN]    Target instance reference.
- * \param member [IN]  Port member list. If a port is enabled in this array, 
+ * \param member [IN]  Port member list. If a port is set in this list,
  *                     frames received on the port are mirrored.
  *
  * \return Return code.
  **/
-vtss_rc vtss_mirror_ingress_ports_set(const vtss_inst_t  inst,
-                                      const BOOL         member[VTSS_PORT_ARRAY_SIZE]);
+vtss_rc vtss_mirror_ingress_ports_set(const vtss_inst_t     inst,
+                                      const vtss_port_bf_t  *const member);
 
 
 /**
@@ -2184,13 +2206,13 @@ vtss_rc vtss_mirror_egress_ports_get(const vtss_inst_t  inst,
  * \brief Set the mirror egress ports.
  *
  * \param inst [IN]    Target instance reference.
- * \param member [IN]  Port member list. If a port is enabled in this array, 
+ * \param member [IN]  Port member list. If a port is set in this list,
  *                     frames transmitted on the port are mirrored.
  *
  * \return Return code.
  **/
-vtss_rc vtss_mirror_egress_ports_set(const vtss_inst_t  inst,
-                                     const BOOL         member[VTSS_PORT_ARRAY_SIZE]);
+vtss_rc vtss_mirror_egress_ports_set(const vtss_inst_t     inst,
+                                     const vtss_port_bf_t  *const member);
 
 
 
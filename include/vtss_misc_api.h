@@ -97,6 +97,48 @@ vtss_rc vtss_trace_conf_get(const vtss_trace_group_t  group,
 vtss_rc vtss_trace_conf_set(const vtss_trace_group_t  group,
                             const vtss_trace_conf_t   *const conf);
 
+/** \brief Binary trace configuration */
+typedef struct {
+    BOOL enable; /**< Record debug and noise trace in per-thread binary ring buffers instead of calling vtss_callout_trace_printf() */
+} vtss_trace_bin_conf_t;
+
+/**
+ * \brief Get binary trace configuration
+ *
+ * \param conf [OUT]  Binary trace configuration.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_trace_bin_conf_get(vtss_trace_bin_conf_t *const conf);
+
+/**
+ * \brief Set binary trace configuration
+ *
+ * \param conf [IN]  Binary trace configuration.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_trace_bin_conf_set(const vtss_trace_bin_conf_t *const conf);
+
+/** \brief Binary trace benchmark result */
+typedef struct {
+    u32 cnt;       /**< Number of trace points recorded */
+    u32 bin_ns;    /**< Average time per binary trace point [nsec] */
+    u32 printf_ns; /**< Average time per trace point formatted using vsnprintf() [nsec] */
+} vtss_trace_bin_bench_t;
+
+/**
+ * \brief Measure the overhead of binary and formatted trace points
+ *
+ * The trace points are recorded in a private ring buffer, so existing trace is not affected.
+ *
+ * \param cnt [IN]     Number of trace points to record.
+ * \param bench [OUT]  Benchmark result.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_trace_bin_bench(const u32 cnt, vtss_trace_bin_bench_t *const bench);
+
 /** \brief Attribute */
 #if defined(__GNUC__) && (__GNUC__ > 2)
 #define VTSS_ATTR_PRINTF(X, Y) __attribute__ ((format(printf,X,Y)))
@@ -255,6 +297,19 @@ vtss_rc vtss_debug_info_get(vtss_debug_info_t *const info);
 vtss_rc vtss_debug_info_print(const vtss_inst_t         inst,
                               const vtss_debug_printf_t prntf,
                               const vtss_debug_info_t   *const info);
+
+/**
+ * \brief Print binary trace
+ *
+ * The entries of all thread ring buffers are formatted and printed in time stamp order.
+ *
+ * \param prntf [IN]  Debug printf function.
+ * \param clear [IN]  Remove the printed entries from the ring buffers.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_trace_bin_print(const vtss_debug_printf_t prntf,
+                             const BOOL                clear);
 #endif // VTSS_OPT_DEBUG_PRINT
 
 /* - API protection functions -------------------------------------- */
@@ -360,6 +415,74 @@ vtss_rc vtss_reg_write_masked(const vtss_inst_t    inst,
                               const u32            value,
                               const u32            mask);
 
+/* - Register access profiling (for debugging only) ---------------- */
+
+/** \brief Register access profiling configuration */
+typedef struct {
+    BOOL enable; /**< Count register accesses and access time per register group and per API function */
+} vtss_reg_profile_conf_t;
+
+/**
+ * \brief Get register access profiling configuration.
+ *
+ * \param inst [IN]   Target instance reference.
+ * \param conf [OUT]  Profiling configuration.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_reg_profile_conf_get(const vtss_inst_t       inst,
+                                  vtss_reg_profile_conf_t *const conf);
+
+/**
+ * \brief Set register access profiling configuration.
+ *
+ * \param inst [IN]  Target instance reference.
+ * \param conf [IN]  Profiling configuration.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_reg_profile_conf_set(const vtss_inst_t             inst,
+                                  const vtss_reg_profile_conf_t *const conf);
+
+/**
+ * \brief Clear register access profiling counters.
+ *
+ * \param inst [IN]  Target instance reference.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_reg_profile_clear(const vtss_inst_t inst);
+
+/** \brief Register access profiling table */
+typedef enum {
+    VTSS_REG_PROFILE_TYPE_GROUP, /**< Counters per register target and group */
+    VTSS_REG_PROFILE_TYPE_FUNC,  /**< Counters per API function */
+} vtss_reg_profile_type_t;
+
+/** \brief Register access profiling entry */
+typedef struct {
+    const char *name;   /**< Target name or API function name */
+    const char *group;  /**< Register group name, NULL for API functions */
+    u32        rd_cnt;  /**< Number of register reads */
+    u32        wr_cnt;  /**< Number of register writes */
+    u64        nsec;    /**< Accumulated access time [nsec] */
+} vtss_reg_profile_entry_t;
+
+/**
+ * \brief Get register access profiling entry.
+ *
+ * \param inst [IN]   Target instance reference.
+ * \param type [IN]   Profiling table.
+ * \param idx [IN]    Entry index, starting from zero.
+ * \param entry [OUT] Profiling entry. Unused entries have zero counters.
+ *
+ * \return Return code, VTSS_RC_ERROR if the index is beyond the last entry.
+ **/
+vtss_rc vtss_reg_profile_get(const vtss_inst_t             inst,
+                             const vtss_reg_profile_type_t type,
+                             const u32                     idx,
+                             vtss_reg_profile_entry_t      *const entry);
+
 /* - Secondary chip if ------------------- */
 
 /**
@@ -110,6 +110,13 @@ typedef struct {
     tod.sec = tve.tv_sec; \
 } /**< Time of day macro */
 
+/** \brief Monotonic time stamp in nanoseconds */
+#define VTSS_OS_TIMESTAMP_NS() ({ \
+    struct timespec _ts; \
+    (void)clock_gettime(CLOCK_MONOTONIC, &_ts); \
+    ((uint64_t)_ts.tv_sec * 1000000000ULL + _ts.tv_nsec); \
+})
+
 // vtss_jaguar_1.c requires these defines. When compiling for the
 // Genie board we're not in kernel mode and the application is 
 // single-threaded, so we can live with not doing anything in these functions.
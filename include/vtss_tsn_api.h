@@ -88,7 +88,7 @@ typedef u16 vtss_frer_mstream_id_t;
 // port_list [IN]  Egress port list, maximum 8 ports enabled
 // id [OUT]        Member stream ID base.
 vtss_rc vtss_frer_mstream_alloc(const vtss_inst_t      inst,
-                                const BOOL             port_list[VTSS_PORTS],
+                                const vtss_port_bf_t   *const port_list,
                                 vtss_frer_mstream_id_t *const id);
 
 // Free FRER member stream ID block.
@@ -14,6 +14,44 @@
 mepa_rc meba_phy_reset(meba_inst_t inst, mepa_port_no_t port_no,
                        const mepa_reset_param_t *rst_conf);
 
+// Max number of MDIO buses handled by meba_phy_reset_list()
+#define MEBA_PHY_BUS_MAX 8
+
+// PHY reset statistics for one MDIO bus
+typedef struct {
+    mesa_chip_no_t         chip_no;         // Chip owning the MDIO controller
+    mesa_miim_controller_t miim_controller; // MDIO controller
+    uint32_t               port_cnt;        // Number of ports reset
+    uint32_t               package_cnt;     // Number of PHY packages (base ports)
+    uint32_t               error_cnt;       // Number of ports failing reset
+    uint64_t               package_us;      // Time spent resetting base ports (package-level initialization)
+    uint64_t               port_us;         // Time spent resetting the remaining ports
+} meba_phy_bus_stat_t;
+
+// PHY reset statistics
+typedef struct {
+    uint32_t            bus_cnt;                // Number of MDIO buses
+    meba_phy_bus_stat_t bus[MEBA_PHY_BUS_MAX];  // Per MDIO bus statistics
+    uint64_t            total_us;               // Total time spent
+} meba_phy_reset_stat_t;
+
+// Reset a list of PHYs.
+// The ports are grouped by MDIO bus and PHY package. On each bus, the base
+// port of every package is reset first, so package-level initialization (like
+// micro-patch download) is done once before the remaining ports of the package
+// are reset. If 'parallel' is set, each bus is handled by its own worker
+// thread. This requires that the lock_enter/lock_exit board callouts and the
+// MDIO access functions are thread safe. Without the lock callouts, the buses
+// are reset one at a time.
+// port_list [IN]  Ports to reset.
+// rst_conf  [IN]  Reset configuration used for all ports.
+// parallel  [IN]  Reset the MDIO buses concurrently.
+// failed    [OUT] Ports that failed reset (may be NULL).
+// stat      [OUT] Per bus statistics (may be NULL).
+mepa_rc meba_phy_reset_list(meba_inst_t inst, const mesa_port_list_t *port_list,
+                            const mepa_reset_param_t *rst_conf, mesa_bool_t parallel,
+                            mesa_port_list_t *failed, meba_phy_reset_stat_t *stat);
+
 // Get the current status of the PHY.
 mepa_rc meba_phy_status_poll(meba_inst_t inst, mepa_port_no_t port_no,
                              mepa_status_t *status);
@@ -3,6 +3,8 @@
 
 #include <ctype.h>
 #include <unistd.h>
+#include <time.h>
+#include <pthread.h>
 #include <microchip/ethernet/board/api.h>
 #include <microchip/ethernet/phy/api/phy.h>
 #include <vtss_phy_api.h>
@@ -20,6 +22,172 @@ mepa_rc meba_phy_reset(meba_inst_t inst, mepa_port_no_t port_no,
     return mepa_reset(inst->phy_devices[port_no], rst_conf);
 }
 
+// Work item for resetting the PHYs on one MDIO bus
+typedef struct {
+    meba_inst_t               inst;
+    const mesa_port_list_t    *port_list;
+    const mepa_reset_param_t  *rst_conf;
+    meba_phy_bus_stat_t       stat;
+    mesa_port_list_t          failed;
+    mepa_rc                   rc;
+} meba_phy_bus_work_t;
+
+static uint64_t meba_phy_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+// Get the port entry of a port to be reset. Returns false if the port is not included.
+static mesa_bool_t meba_phy_reset_port_get(meba_inst_t inst, const mesa_port_list_t *port_list,
+                                           mesa_port_no_t port_no, meba_port_entry_t *entry)
+{
+    return (mesa_port_list_get(port_list, port_no) && inst->phy_devices[port_no] != NULL &&
+            inst->api.meba_port_entry_get(inst, port_no, entry) == MESA_RC_OK);
+}
+
+static void *meba_phy_bus_reset(void *arg)
+{
+    meba_phy_bus_work_t *work = arg;
+    meba_inst_t         inst = work->inst;
+    meba_phy_bus_stat_t *stat = &work->stat;
+    meba_port_entry_t   entry;
+    mesa_port_no_t      port_no;
+    mesa_bool_t         base;
+    uint64_t            start;
+    mepa_rc             rc;
+    int                 pass;
+
+    // Pass 0 resets the base ports, pass 1 the remaining ports
+    for (pass = 0; pass < 2; pass++) {
+        start = meba_phy_time_us();
+        for (port_no = 0; port_no < inst->phy_device_cnt; port_no++) {
+            if (!meba_phy_reset_port_get(inst, work->port_list, port_no, &entry) ||
+                entry.map.chip_no != stat->chip_no ||
+                entry.map.miim_controller != stat->miim_controller) {
+                continue;
+            }
+            base = (entry.phy_base_port == port_no);
+            if (base != (pass == 0)) {
+                continue;
+            }
+            T_I(inst, "port %u, miim_controller %d, base %u", port_no, entry.map.miim_controller, base);
+            rc = mepa_reset(inst->phy_devices[port_no], work->rst_conf);
+            stat->port_cnt++;
+            if (rc != MESA_RC_OK && rc != MESA_RC_NOT_IMPLEMENTED) {
+                // Reset is not always implemented in e.g. third party phys
+                T_E(inst, "mepa_reset(%u) failed: %d", port_no, rc);
+                mesa_port_list_set(&work->failed, port_no, 1);
+                stat->error_cnt++;
+                work->rc = rc;
+            }
+        }
+        if (pass == 0) {
+            stat->package_us = meba_phy_time_us() - start;
+        } else {
+            stat->port_us = meba_phy_time_us() - start;
+        }
+    }
+    return NULL;
+}
+
+/* Reset a list of PHYs, grouped by MDIO bus and PHY package */
+mepa_rc meba_phy_reset_list(meba_inst_t inst, const mesa_port_list_t *port_list,
+                            const mepa_reset_param_t *rst_conf, mesa_bool_t parallel,
+                            mesa_port_list_t *failed, meba_phy_reset_stat_t *stat)
+{
+    meba_phy_bus_work_t work[MEBA_PHY_BUS_MAX];
+    pthread_t           thread[MEBA_PHY_BUS_MAX];
+    mesa_bool_t         started[MEBA_PHY_BUS_MAX];
+    meba_port_entry_t   entry;
+    mesa_port_no_t      port_no;
+    uint64_t            start = meba_phy_time_us();
+    uint32_t            bus, bus_cnt = 0;
+    mepa_rc             rc = MESA_RC_OK;
+
+    T_I(inst, "Called, parallel: %u", parallel);
+
+    if (failed != NULL) {
+        mesa_port_list_clear(failed);
+    }
+    if (stat != NULL) {
+        memset(stat, 0, sizeof(*stat));
+    }
+    if (parallel && (inst->iface.lock_enter == NULL || inst->iface.lock_exit == NULL)) {
+        // Without the lock callouts, the MEPA API is not thread safe
+        T_I(inst, "no lock callouts, resetting the MDIO buses one at a time");
+        parallel = FALSE;
+    }
+
+    // Group the ports by MDIO bus
+    memset(work, 0, sizeof(work));
+    for (port_no = 0; port_no < inst->phy_device_cnt; port_no++) {
+        if (!meba_phy_reset_port_get(inst, port_list, port_no, &entry)) {
+            continue;
+        }
+        for (bus = 0; bus < bus_cnt; bus++) {
+            if (work[bus].stat.chip_no == entry.map.chip_no &&
+                work[bus].stat.miim_controller == entry.map.miim_controller) {
+                break;
+            }
+        }
+        if (bus == bus_cnt) {
+            if (bus_cnt == MEBA_PHY_BUS_MAX) {
+                T_E(inst, "port %u: too many MDIO buses", port_no);
+                return MESA_RC_ERROR;
+            }
+            bus_cnt++;
+            work[bus].inst = inst;
+            work[bus].port_list = port_list;
+            work[bus].rst_conf = rst_conf;
+            work[bus].stat.chip_no = entry.map.chip_no;
+            work[bus].stat.miim_controller = entry.map.miim_controller;
+        }
+        if (entry.phy_base_port == port_no) {
+            work[bus].stat.package_cnt++;
+        }
+    }
+
+    // Reset the PHYs on each bus. If a worker thread can not be started, the bus is reset by the caller.
+    for (bus = 0; bus < bus_cnt; bus++) {
+        started[bus] = (parallel && bus_cnt > 1 &&
+                        pthread_create(&thread[bus], NULL, meba_phy_bus_reset, &work[bus]) == 0);
+        if (!started[bus]) {
+            (void)meba_phy_bus_reset(&work[bus]);
+        }
+    }
+
+    for (bus = 0; bus < bus_cnt; bus++) {
+        if (started[bus]) {
+            (void)pthread_join(thread[bus], NULL);
+        }
+        T_I(inst, "chip %u, miim_controller %d: %u ports, %u packages, %u errors, package: %llu us, port: %llu us",
+            work[bus].stat.chip_no, work[bus].stat.miim_controller, work[bus].stat.port_cnt, work[bus].stat.package_cnt,
+            work[bus].stat.error_cnt, work[bus].stat.package_us, work[bus].stat.port_us);
+        if (work[bus].rc != MESA_RC_OK) {
+            rc = work[bus].rc;
+        }
+        if (failed != NULL) {
+            for (port_no = 0; port_no < inst->phy_device_cnt; port_no++) {
+                if (mesa_port_list_get(&work[bus].failed, port_no)) {
+                    mesa_port_list_set(failed, port_no, 1);
+                }
+            }
+        }
+        if (stat != NULL) {
+            stat->bus[bus] = work[bus].stat;
+        }
+    }
+
+    if (stat != NULL) {
+        stat->bus_cnt = bus_cnt;
+        stat->total_us = meba_phy_time_us() - start;
+    }
+    return rc;
+}
+
 /* Get the current status of the PHY. */
 mepa_rc meba_phy_status_poll(meba_inst_t inst, mepa_port_no_t port_no,
                              mepa_status_t *status)
@@ -10,6 +10,7 @@
 #include <sys/mman.h>
 #include <linux/i2c-dev.h>  /* I2C support */
 #include <errno.h>
+#include <time.h>
 #include <microchip/ethernet/board/api.h>
 #include "../meba_aux.h"
 #include "../meba_generic.h"
@@ -20,6 +21,13 @@
 #define INTERUPTIBLE_POE_OFF_TIME         5000  // for how many ms to turn off all poe ports and turn on only the cfg enabled poe ports
 #define PD_BUFFER_SIZE                    15    // PoE 15bytes message length is 15 bytes
 
+// Reply polling. The controller is polled for a reply with a backoff doubling
+// from PD69200_POLL_MIN_US to PD69200_POLL_MAX_US, until PD69200_REPLY_TIMEOUT_MS.
+#define PD69200_POLL_MIN_US               1000
+#define PD69200_POLL_MAX_US               10000
+#define PD69200_REPLY_TIMEOUT_MS          1500
+#define PD69200_POLL_BACKOFF(us)          ((us) * 2 > PD69200_POLL_MAX_US ? PD69200_POLL_MAX_US : (us) * 2)
+
 #define MAX_STR_SIZE  100
 
 // poe adc pin reading - will be defined from version 3.57 and above
@@ -380,6 +388,28 @@ typedef struct {
 } poe_private_status_data_t;
 
 
+// A request to the controller and its reply. The controller handles one
+// message at a time, so queued requests are transmitted back to back, each
+// one as soon as the reply to the previous one has been read.
+typedef struct {
+    uint8_t                     tx[PD_BUFFER_SIZE];  // Request. Echo and checksum are set when transmitted
+    uint8_t                     rx[PD_BUFFER_SIZE];  // Reply
+    mesa_rc                     rc;                  // Result of the request
+} pd69200_req_t;
+
+// Request queue state
+typedef struct {
+    pd69200_req_t               *req;         // Queued requests
+    uint32_t                    cnt;          // Number of queued requests
+    uint32_t                    idx;          // Request awaiting reply
+    uint32_t                    backoff_us;   // Delay before next poll for reply
+    uint64_t                    timeout_ms;   // Reply timeout of request in flight
+    mesa_bool_t                 sent;         // Request awaiting reply has been transmitted
+    uint8_t                     last;         // Last byte polled, 0x00: buffer empty, 0xFF: no I2C response
+    const char                  *file;        // Caller, for debug
+    int                         line;
+} pd69200_queue_t;
+
 typedef struct  {
     poe_private_status_data_t   status;
     poe_private_cfg_data_t      cfg;
@@ -392,6 +422,8 @@ typedef struct  {
     uint8_t                     buf_rx[PD_BUFFER_SIZE];
     mesa_bool_t                 IsBootError;
     Telemetry_at_Boot_Up_Error_e eTelemetry_at_Boot_Up_Error;
+    meba_pd69200_io_t           io;                // Controller access methods
+    pd69200_queue_t             queue;             // Request queue
 } poe_driver_private_t;
 
 
@@ -438,6 +470,21 @@ mesa_rc Get_15Bytes_CommProtocol_Reply(const meba_poe_ctrl_inst_t* const inst,
                    mesa_bool_t *pePOE_BOOL_Is_system_status,
                    Telemetry_at_Boot_Up_Error_e *peTelemetry_at_Boot_Up_Error);
 
+static mesa_rc pd69200_rx_poll(const meba_poe_ctrl_inst_t* const inst,
+                               uint8_t* rx_data,
+                               uint8_t byTxEcho,
+                               uint8_t *last,
+                               mesa_bool_t *pePOE_BOOL_Is_system_status,
+                               Telemetry_at_Boot_Up_Error_e *peTelemetry_at_Boot_Up_Error);
+
+// Monotonic time in milliseconds
+static uint64_t pd69200_time_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
 
 
 /*---------------------------------------------------------------------
@@ -485,18 +532,44 @@ int meba_pd69200_i2c_adapter_open(const char* filename, uint8_t i2c_addr)
 }
 
 
+static int pd69200_io_read(int fd, uint8_t *data, size_t size)
+{
+    return read(fd, data, size);
+}
+
+static int pd69200_io_write(int fd, const uint8_t *data, size_t size)
+{
+    return write(fd, data, size);
+}
+
+static const meba_pd69200_io_t pd69200_io_default = {
+    .read  = pd69200_io_read,
+    .write = pd69200_io_write,
+};
+
+mesa_rc meba_pd69200_io_set(meba_poe_ctrl_inst_t *inst, const meba_pd69200_io_t *io)
+{
+    if (inst == NULL || inst->private_data == NULL) {
+        return MESA_RC_ERROR;
+    }
+    ((poe_driver_private_t *)inst->private_data)->io = (io ? *io : pd69200_io_default);
+    return MESA_RC_OK;
+}
+
 // Function for reading data from the MicroSemi micro-controller.
 // IN/OUT : Data - Pointer to where to put the read data
 // IN     : Size - Number of bytes to read.
+// The read does not wait for the controller. While it has nothing to send the
+// controller returns 0x00 bytes, see pd69200_rx_poll().
 static
 mesa_rc pd69200_rd(const meba_poe_ctrl_inst_t* const inst,
                    uint8_t* data,
                    uint8_t size)
 {
     char buf[size * 3 + 1];
-    VTSS_MSLEEP(50); // Wait 50ms
+    poe_driver_private_t *private_data = (poe_driver_private_t *)inst->private_data;
     memset(data, 0, size);
-    int cnt = read(inst->adapter_fd, data, size);
+    int cnt = private_data->io.read(inst->adapter_fd, data, size);
     DEBUG(inst, MEBA_TRACE_LVL_NOISE, "%s: Read(%d/%d)  %s ",
           inst->adapter_name, size, cnt,
           print_as_hex_string(data, size, buf, sizeof(buf)));
@@ -505,24 +578,6 @@ mesa_rc pd69200_rd(const meba_poe_ctrl_inst_t* const inst,
 
 
 
-int iFF_byte_count = 0;   // no i2c response
-int i00_byte_count = 0;   // poe data buffer empty
-
-
-void CheckReadingByte(uint8_t data)
-{
-    if (data == 0)
-        i00_byte_count++;
-    else
-        i00_byte_count = 0;
-
-    if (data == 0xFF)
-        iFF_byte_count++;
-    else
-        iFF_byte_count = 0;
-}
-
-
 // Function for writing data from the MicroSemi micro-controller.
 // IN  : Data - Pointer to data to write
 //     : Size - Number of bytes to write.
@@ -535,7 +590,8 @@ mesa_rc pd69200_wr(const meba_poe_ctrl_inst_t* const inst,
                    char size)
 {
     char buf[size * 3 + 1];
-    int cnt = write(inst->adapter_fd, data, size);
+    poe_driver_private_t *private_data = (poe_driver_private_t *)inst->private_data;
+    int cnt = private_data->io.write(inst->adapter_fd, data, size);
     DEBUG(inst, MEBA_TRACE_LVL_DEBUG, "%s: Wrote(%d/%d) %s ",
           inst->adapter_name, size, cnt,
           print_as_hex_string(data, size, buf, sizeof(buf)));
@@ -552,7 +608,7 @@ mesa_rc pd69200_firm_update_rd(const meba_poe_ctrl_inst_t* const inst, uint8_t*
     int loop_number = 0;
     do
     {
-        rc = read(inst->adapter_fd, data, 1);
+        rc = ((poe_driver_private_t *)inst->private_data)->io.read(inst->adapter_fd, data, 1);
 
         if (rc == MESA_RC_ERROR)
         {
@@ -572,7 +628,7 @@ mesa_rc pd69200_firm_update_rd(const meba_poe_ctrl_inst_t* const inst, uint8_t*
     if (data[0] == 0)
         return rc;
 
-    rc = read(inst->adapter_fd, &(data[1]), size - 1);
+    rc = ((poe_driver_private_t *)inst->private_data)->io.read(inst->adapter_fd, &(data[1]), size - 1);
 
     if (rc == MESA_RC_ERROR)
     {
@@ -816,77 +872,198 @@ static mesa_rc get_controller_request_response(
 
 
 /*---------------------------------------------------------------------
- *    description: Transmit the command - and read telemetr/reply (byte after byte...)
- *    			  if no legal 15bytes command found - buffer with be empty at the end of function.
+ *    description: check the reply to a request - report for command/program (section 4.6), telemetry for request.
  *
- *    input :   bI2C_Address                 - device I2C address
- *              U8 byEcho                    - messgae Echo
- *    output:   byArrRxBuffer[]              - pointer to recieve data byte array
- *              *pePOE_BOOL_Is_system_status - parameter to inform calling function if special system status (with echo 255) message was detected.
  *    return:   MESA_RC_OK                   - operation succeed
  *              MESA_RC_ERR_POE_RX_BUF_EMPTY - rx buffer empty
  *              MESA_RC_ERROR                - i2c device error
  *              MESA_RC_ERR_POE_FIRM_UPDATE_NEEDED - poe firmware update needed
  *              MESA_RC_ERR_POE_COMM_PROT_ERR - communication protocol error (checksum or key)
  *---------------------------------------------------------------------*/
-static mesa_rc pd69200_tx(
+static mesa_rc pd69200_reply_check(
     const meba_poe_ctrl_inst_t* const inst,
     const char* file,
     int line,
-    uint8_t* buf)
+    pd69200_req_t *req,
+    mesa_rc rc)
 {
-    uint8_t buf_tx[PD_BUFFER_SIZE];
-    memcpy(buf_tx, buf, PD_BUFFER_SIZE);
-
-    mesa_rc rc = MESA_RC_ERROR;
-
-    // write i2c data
-    if (!is_tx_ok(inst, buf_tx)) {
-        DEBUG(inst, MEBA_TRACE_LVL_ERROR, "%s Failed\n",  __FUNCTION__);
-        return MESA_RC_ERROR;
-    }
-
-    mesa_bool_t                     ePOE_BOOL_Is_system_status = false;
-    Telemetry_at_Boot_Up_Error_e    eTelemetry_at_Boot_Up_Error = eBoot_Unknown_error;
-
-    rc = Get_15Bytes_CommProtocol_Reply(inst,
-                   buf,
-                   buf_tx[1],
-                   &ePOE_BOOL_Is_system_status,
-                   &eTelemetry_at_Boot_Up_Error);
-
-    // Do the I2C transmission and check report key.
-    if (rc ==  MESA_RC_OK)
+    if (rc == MESA_RC_OK)
     {
         // Section 4.6 in PD69200/G user guide - check report in case of command or program
-        if ((buf_tx[0] == COMMAND_KEY || buf_tx[0] == PROGRAM_KEY))
+        if ((req->tx[0] == COMMAND_KEY || req->tx[0] == PROGRAM_KEY))
         {
-            if (report_key_ok(inst, buf_tx[1] , buf))
-            {
-                rc = MESA_RC_OK;
-            }
-            else
+            if (!report_key_ok(inst, req->tx[1], req->rx))
             {
                 DEBUG(inst, MEBA_TRACE_LVL_WARNING, "%s called from %s(%d) failed\n",  __FUNCTION__, file, line);
             }
         }
-        else if (buf_tx[0] == REQUEST_KEY)
-        {
-            rc = get_controller_request_response(inst, buf, buf_tx);
-        }
-        else
+        else if (req->tx[0] == REQUEST_KEY)
         {
-            rc = MESA_RC_OK;
+            rc = get_controller_request_response(inst, req->rx, req->tx);
         }
     }
     else
     {
-        char dbg_txt[sizeof(buf_tx) * 4];
+        char dbg_txt[PD_BUFFER_SIZE * 4];
         DEBUG(inst, MEBA_TRACE_LVL_WARNING,
               "%s called from %s(%d), Invalid response: %s\n",  __FUNCTION__, file, line,
-              print_as_hex_string(buf, PD_BUFFER_SIZE, dbg_txt, sizeof(dbg_txt)));
+              print_as_hex_string(req->rx, PD_BUFFER_SIZE, dbg_txt, sizeof(dbg_txt)));
+    }
+
+    return rc;
+}
+
+// Queue requests for transmission, see pd69200_queue_poll().
+// Only one set of requests can be queued at a time.
+static mesa_rc pd69200_queue_submit(
+    const meba_poe_ctrl_inst_t* const inst,
+    const char* file,
+    int line,
+    pd69200_req_t *req,
+    uint32_t cnt)
+{
+    pd69200_queue_t *q = &((poe_driver_private_t *)inst->private_data)->queue;
+    uint32_t        i;
+
+    if (q->idx < q->cnt) {
+        DEBUG(inst, MEBA_TRACE_LVL_ERROR, "%s called from %s(%d), queue busy\n",  __FUNCTION__, file, line);
+        return MESA_RC_ERROR;
+    }
+    for (i = 0; i < cnt; i++) {
+        req[i].rc = MESA_RC_INCOMPLETE;
+        memset(req[i].rx, 0, PD_BUFFER_SIZE);
+    }
+    q->req = req;
+    q->cnt = cnt;
+    q->idx = 0;
+    q->sent = false;
+    q->file = file;
+    q->line = line;
+    return MESA_RC_OK;
+}
+
+// Poll the request queue without waiting for the controller. Requests are
+// transmitted back to back: the next request is transmitted as soon as the
+// reply to the previous one has been matched by its echo.
+// Returns MESA_RC_INCOMPLETE while requests are pending, in which case
+// *wait_us is the time to wait before polling again.
+static mesa_rc pd69200_queue_poll(
+    const meba_poe_ctrl_inst_t* const inst,
+    uint32_t *wait_us)
+{
+    pd69200_queue_t *q = &((poe_driver_private_t *)inst->private_data)->queue;
+    pd69200_req_t   *req;
+    mesa_rc         rc;
+
+    while (q->idx < q->cnt) {
+        req = &q->req[q->idx];
+        if (!q->sent) {
+            // write i2c data
+            if (!is_tx_ok(inst, req->tx)) {
+                DEBUG(inst, MEBA_TRACE_LVL_ERROR, "%s Failed\n",  __FUNCTION__);
+                req->rc = MESA_RC_ERROR;
+                q->idx++;
+                continue;
+            }
+            q->sent = true;
+            q->backoff_us = PD69200_POLL_MIN_US;
+            q->timeout_ms = pd69200_time_ms() + PD69200_REPLY_TIMEOUT_MS;
+            q->last = 0;
+        }
+
+        mesa_bool_t                     ePOE_BOOL_Is_system_status = false;
+        Telemetry_at_Boot_Up_Error_e    eTelemetry_at_Boot_Up_Error = eBoot_Unknown_error;
+
+        rc = pd69200_rx_poll(inst, req->rx, req->tx[1], &q->last,
+                             &ePOE_BOOL_Is_system_status,
+                             &eTelemetry_at_Boot_Up_Error);
+        if (rc == MESA_RC_INCOMPLETE) {
+            if (pd69200_time_ms() <= q->timeout_ms) {
+                *wait_us = q->backoff_us;
+                q->backoff_us = PD69200_POLL_BACKOFF(q->backoff_us);
+                return MESA_RC_INCOMPLETE;
+            }
+            // 0x00: Empty I2C buffer in controller, 0xFF: No I2C response
+            rc = (q->last == 0xFF ? MESA_RC_ERROR : MESA_RC_ERR_POE_RX_BUF_EMPTY);
+        }
+        req->rc = pd69200_reply_check(inst, q->file, q->line, req, rc);
+        q->sent = false;
+        q->idx++;
+    }
+    return MESA_RC_OK;
+}
+
+// Transmit a number of requests and read the replies without waiting for the
+// controller. The request buffers must be built like for pd69200_tx().
+// The requests are queued on the first call. While replies are pending,
+// MESA_RC_INCOMPLETE is returned and the caller must call again with the same
+// requests after *wait_us. When done, the first error, if any, is returned.
+static mesa_rc pd69200_tx_batch(
+    const meba_poe_ctrl_inst_t* const inst,
+    const char* file,
+    int line,
+    pd69200_req_t *req,
+    uint32_t cnt,
+    uint32_t *wait_us)
+{
+    pd69200_queue_t *q = &((poe_driver_private_t *)inst->private_data)->queue;
+    uint32_t        i;
+    mesa_rc         rc;
+
+    if (q->req != req || q->idx >= q->cnt) {
+        MESA_RC(pd69200_queue_submit(inst, file, line, req, cnt));
+    }
+    if ((rc = pd69200_queue_poll(inst, wait_us)) == MESA_RC_INCOMPLETE) {
+        return rc;
+    }
+    for (i = 0; i < cnt && rc == MESA_RC_OK; i++) {
+        rc = req[i].rc;
+    }
+    return rc;
+}
+
+// Transmit a number of requests and wait for the replies, see pd69200_tx_batch().
+// The MEBA PoE API is synchronous, so the waiting is done here.
+static mesa_rc pd69200_tx_wait(
+    const meba_poe_ctrl_inst_t* const inst,
+    const char* file,
+    int line,
+    pd69200_req_t *req,
+    uint32_t cnt)
+{
+    uint32_t wait_us;
+    mesa_rc  rc;
+
+    while ((rc = pd69200_tx_batch(inst, file, line, req, cnt, &wait_us)) == MESA_RC_INCOMPLETE) {
+        usleep(wait_us);
     }
+    return rc;
+}
 
+/*---------------------------------------------------------------------
+ *    description: Transmit the command - and read telemetr/reply
+ *    			  if no legal 15bytes command found - buffer with be empty at the end of function.
+ *
+ *    input :   buf[]                        - request
+ *    output:   buf[]                        - reply
+ *    return:   MESA_RC_OK                   - operation succeed
+ *              MESA_RC_ERR_POE_RX_BUF_EMPTY - rx buffer empty
+ *              MESA_RC_ERROR                - i2c device error
+ *              MESA_RC_ERR_POE_FIRM_UPDATE_NEEDED - poe firmware update needed
+ *              MESA_RC_ERR_POE_COMM_PROT_ERR - communication protocol error (checksum or key)
+ *---------------------------------------------------------------------*/
+static mesa_rc pd69200_tx(
+    const meba_poe_ctrl_inst_t* const inst,
+    const char* file,
+    int line,
+    uint8_t* buf)
+{
+    pd69200_req_t req;
+    mesa_rc       rc;
+
+    memcpy(req.tx, buf, PD_BUFFER_SIZE);
+    rc = pd69200_tx_wait(inst, file, line, &req, 1);
+    memcpy(buf, req.rx, PD_BUFFER_SIZE);
     return rc;
 }
 
@@ -1699,48 +1876,6 @@ static mesa_rc meba_poe_pd69200_ctrl_save_command(
 
 
 
-static
-mesa_rc meba_poe_pd69200_ctrl_get_temporary_matrix(
-    const meba_poe_ctrl_inst_t* const inst,
-    meba_poe_port_handle_t      handle,
-    uint8_t* phys_numb_a,
-    uint8_t* phys_numb_b)
-{
-    // Transmit the command
-    uint8_t buf[PD_BUFFER_SIZE] = {
-        REQUEST_KEY,
-        DUMMY_SEQ_NUM,
-        CHANNEL_KEY,
-        TMP_MATRIX_KEY,
-        handle,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE
-    };
-
-    MESA_RC(pd69200_tx(inst, __FUNCTION__, __LINE__, buf));
-
-    *phys_numb_a = buf[2];
-    *phys_numb_b = buf[3];
-
-    DEBUG(inst, MEBA_TRACE_LVL_INFO, "[GET TEMPORARY MATRIX] CH=%d ,phys numb a=%d ,phys_numb_b=%d",
-       handle,
-       *phys_numb_a,
-       *phys_numb_b);
-
-
-    return MESA_RC_OK;
-}
-
-
-
 static
 mesa_rc meba_poe_pd69200_ctrl_get_active_matrix(
     const meba_poe_ctrl_inst_t* const inst,
@@ -1780,41 +1915,27 @@ mesa_rc meba_poe_pd69200_ctrl_get_active_matrix(
     return MESA_RC_OK;
 }
 
-static
-mesa_rc meba_poe_pd69200_ctrl_set_temporary_matrix(
-    const meba_poe_ctrl_inst_t* const inst,
+// Build a channel matrix request: COMMAND_KEY to set, REQUEST_KEY to get
+static void pd69200_matrix_req(
+    pd69200_req_t               *req,
+    uint8_t                     key,
+    uint8_t                     subject,
     meba_poe_port_handle_t      handle,
     uint8_t                     phys_numb_a,
     uint8_t                     phys_numb_b)
 {
-    // Transmit the command
-    uint8_t buf[PD_BUFFER_SIZE] = {
-        COMMAND_KEY,
-        DUMMY_SEQ_NUM,
-        CHANNEL_KEY,
-        TMP_MATRIX_KEY,
-        handle,
-        phys_numb_a,
-        phys_numb_b,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE,
-        DUMMY_BYTE
-    };
-
-    MESA_RC(pd69200_tx(inst, __FUNCTION__, __LINE__, buf));
-
-    DEBUG(inst, MEBA_TRACE_LVL_INFO, "[SET TEMPORARY MATRIX] CH=%d ,phys numb_a=%d ,phys numb_b=%d",
-       handle,
-       phys_numb_a,
-       phys_numb_b);
-
-
-    return MESA_RC_OK;
+    uint8_t *buf = req->tx;
+
+    memset(buf, DUMMY_BYTE, PD_BUFFER_SIZE);
+    buf[0] = key;
+    buf[1] = DUMMY_SEQ_NUM;
+    buf[2] = CHANNEL_KEY;
+    buf[3] = subject;
+    buf[4] = handle;
+    if (key == COMMAND_KEY) {
+        buf[5] = phys_numb_a;
+        buf[6] = phys_numb_b;
+    }
 }
 
 // Apply the port mapping
@@ -1942,104 +2063,126 @@ mesa_rc check_for_poe_firmware_errors(const meba_poe_ctrl_inst_t* const inst,
 
 
 /*---------------------------------------------------------------------
- *    description: read legal 15 bytes prtocol message from PoE device buffer. includes sunc mechnism and message checksum test.
- *    			   in case of message system status telemetry with echo 255 - it checks for any firmware damage.
- *    			   if no legal 15bytes command found - buffer with be empty at the end of function.
+ *    description: poll for the reply with echo byTxEcho without waiting for the controller.
+ *                 bytes are read as long as the controller has data to send. Bytes outside
+ *                 a message, replies with invalid checksum and replies with another echo
+ *                 (stale replies) are discarded.
  *
- *    input :   bI2C_Address                 - device I2C address
- *              U8 byEcho                    - messgae Echo
+ *    input :   U8 byEcho                    - messgae Echo
  *    output:   byArrRxBuffer[]              - pointer to recieve data byte array
+ *              *last                        - last byte read while looking for a message:
+ *                                             0x00 - controller buffer empty, 0xFF - no i2c response
  *              *pePOE_BOOL_Is_system_status - parameter to inform calling function if special system status (with echo 255) message was detected.
  *    return:   MESA_RC_OK                   - operation succeed
- *              MESA_RC_ERR_POE_RX_BUF_EMPTY - rx buffer empty
+ *              MESA_RC_INCOMPLETE           - reply not received yet
  *              MESA_RC_ERROR                - i2c device error
  *              MESA_RC_ERR_POE_FIRM_UPDATE_NEEDED - poe firmware update needed
  *---------------------------------------------------------------------*/
-mesa_rc Get_15Bytes_CommProtocol_Reply(const meba_poe_ctrl_inst_t* const inst,
-                   uint8_t* rx_data,
-                   uint8_t byTxEcho,
-                   mesa_bool_t *pePOE_BOOL_Is_system_status,
-                   Telemetry_at_Boot_Up_Error_e *peTelemetry_at_Boot_Up_Error)
+static mesa_rc pd69200_rx_poll(const meba_poe_ctrl_inst_t* const inst,
+                               uint8_t* rx_data,
+                               uint8_t byTxEcho,
+                               uint8_t *last,
+                               mesa_bool_t *pePOE_BOOL_Is_system_status,
+                               Telemetry_at_Boot_Up_Error_e *peTelemetry_at_Boot_Up_Error)
 {
-	uint8_t      bRxMsg[PD_BUFFER_SIZE];
-
-    iFF_byte_count = 0;   // no i2c response
-    i00_byte_count = 0;   // poe data buffer empty
-
-	memset(rx_data, 0, sizeof(PD_BUFFER_SIZE));
+    uint8_t bRxMsg[PD_BUFFER_SIZE];
+    int     cnt;
 
-    VTSS_MSLEEP(50); // Wait 50ms
-
-	while ((iFF_byte_count < 30) && (i00_byte_count < 30)) /* 30 bytes with value 0 means that I2C driver has no data to send */
-	{
-		/* Read the 1 first byte from PoE Device */
+    // Limit the number of bytes read in one poll, if the controller keeps sending garbage
+    for (cnt = 0; cnt < PD_BUFFER_SIZE * 4; cnt++) {
+        // Read the first byte from PoE Device
         MESA_RC(pd69200_rd(inst, bRxMsg, 1));
+        *last = bRxMsg[0];
 
-        CheckReadingByte(bRxMsg[0]);
-
-	if (bRxMsg[0] == TELEMETRY_KEY || bRxMsg[0] == REPORT_KEY) /* first msg byte - telemetry or response */
-	{
-            rx_data[0] = bRxMsg[0];  // store telemetry/response
-
-            // Read the second byte (ECHO) from PoE Device
-            MESA_RC(pd69200_rd(inst, bRxMsg, 1));
-
-            CheckReadingByte(bRxMsg[0]);
-
-	    /* second msg byte - echo */
-	    if ((bRxMsg[0] == byTxEcho) ||     									     	  /* original messsage */
-	       ((rx_data[0] == TELEMETRY_KEY) && (bRxMsg[0] == SYSTEM_STATUS_ECHO_KEY)))  /* system status on startup */
-	    {
-		    rx_data[1] = bRxMsg[0];     /* store echo */
-
-                /* Read the last 13 bytes from PoE Device */
-                char size = PD_BUFFER_SIZE - 2;
-                MESA_RC(pd69200_rd(inst, bRxMsg, size));
-
-                for (int i=0;i<PD_BUFFER_SIZE - 2;i++)
-                    CheckReadingByte(bRxMsg[i]);
-
-                memcpy(rx_data + 2 , bRxMsg , PD_BUFFER_SIZE - 2);
-
-		    // checksum check
-		    if (!pd69200_check_sum_ok(rx_data))
-		    {
-                    DEBUG(inst, MEBA_TRACE_LVL_DEBUG, "RX checksum is not valid");
-
+        if (bRxMsg[0] == 0x00 || bRxMsg[0] == 0xFF) {
+            // Nothing to read (yet)
+            return MESA_RC_INCOMPLETE;
+        }
 
+        if (bRxMsg[0] != TELEMETRY_KEY && bRxMsg[0] != REPORT_KEY) {
+            continue; // Not the first byte of a message, keep looking
+        }
+        rx_data[0] = bRxMsg[0];  // store telemetry/response
 
-		        continue; //see if we have other valid data bytes in the buffer
-		    }
+        // Read the second byte (ECHO) from PoE Device
+        MESA_RC(pd69200_rd(inst, bRxMsg, 1));
+        if ((bRxMsg[0] != byTxEcho) &&                                             /* original messsage */
+            ((rx_data[0] != TELEMETRY_KEY) || (bRxMsg[0] != SYSTEM_STATUS_ECHO_KEY))) /* system status on startup */
+        {
+            if (bRxMsg[0] == 0x00) {
+                *last = bRxMsg[0];
+                return MESA_RC_INCOMPLETE;
+            }
+            // Discard the rest of the stale reply, so its data is not taken for a message
+            DEBUG(inst, MEBA_TRACE_LVL_DEBUG, "Discard reply with echo %u, expected %u", bRxMsg[0], byTxEcho);
+            MESA_RC(pd69200_rd(inst, bRxMsg, PD_BUFFER_SIZE - 2));
+            continue;
+        }
+        rx_data[1] = bRxMsg[0];     /* store echo */
 
-                if (rx_data[1] == 0xFF) // it's a system status telemetry with echo 255 - system status on startup or firmware damage...
-		    {
-		        if (pePOE_BOOL_Is_system_status)
-                            *pePOE_BOOL_Is_system_status = true;
+        // Read the last 13 bytes from PoE Device
+        MESA_RC(pd69200_rd(inst, rx_data + 2, PD_BUFFER_SIZE - 2));
 
-                        return check_for_poe_firmware_errors(inst, rx_data, peTelemetry_at_Boot_Up_Error);
-                }
+        // checksum check
+        if (!pd69200_check_sum_ok(rx_data)) {
+            DEBUG(inst, MEBA_TRACE_LVL_DEBUG, "RX checksum is not valid");
+            continue; //see if we have other valid data bytes in the buffer
+        }
 
-			if (rx_data[1] == byTxEcho) // ECHO ok
-			{
-					return MESA_RC_OK;
-			}
-			}
-		}
-	}
+        if (rx_data[1] == SYSTEM_STATUS_ECHO_KEY) { // it's a system status telemetry with echo 255 - system status on startup or firmware damage...
+            if (pePOE_BOOL_Is_system_status)
+                *pePOE_BOOL_Is_system_status = true;
 
-    if(i00_byte_count >= 15)
-    {
-        // Empty I2C buffer in controller, just continue
-        return MESA_RC_ERR_POE_RX_BUF_EMPTY;
-    }
-    else if (iFF_byte_count >= 15)
-    {
-        // No I2C response
-        DEBUG(inst, MEBA_TRACE_LVL_INFO, "%s Reading all 0xFF", __FUNCTION__);
-        return MESA_RC_ERROR;
+            return check_for_poe_firmware_errors(inst, rx_data, peTelemetry_at_Boot_Up_Error);
+        }
+        return MESA_RC_OK; // ECHO ok
     }
+    return MESA_RC_INCOMPLETE;
+}
 
-	return MESA_RC_ERROR;
+/*---------------------------------------------------------------------
+ *    description: read legal 15 bytes prtocol message from PoE device buffer. includes sunc mechnism and message checksum test.
+ *    			   in case of message system status telemetry with echo 255 - it checks for any firmware damage.
+ *    			   the controller is polled with a short backoff until the reply arrives or PD69200_REPLY_TIMEOUT_MS expires.
+ *
+ *    input :   bI2C_Address                 - device I2C address
+ *              U8 byEcho                    - messgae Echo
+ *    output:   byArrRxBuffer[]              - pointer to recieve data byte array
+ *              *pePOE_BOOL_Is_system_status - parameter to inform calling function if special system status (with echo 255) message was detected.
+ *    return:   MESA_RC_OK                   - operation succeed
+ *              MESA_RC_ERR_POE_RX_BUF_EMPTY - rx buffer empty
+ *              MESA_RC_ERROR                - i2c device error
+ *              MESA_RC_ERR_POE_FIRM_UPDATE_NEEDED - poe firmware update needed
+ *---------------------------------------------------------------------*/
+mesa_rc Get_15Bytes_CommProtocol_Reply(const meba_poe_ctrl_inst_t* const inst,
+                   uint8_t* rx_data,
+                   uint8_t byTxEcho,
+                   mesa_bool_t *pePOE_BOOL_Is_system_status,
+                   Telemetry_at_Boot_Up_Error_e *peTelemetry_at_Boot_Up_Error)
+{
+    uint64_t timeout = pd69200_time_ms() + PD69200_REPLY_TIMEOUT_MS;
+    uint32_t backoff_us = PD69200_POLL_MIN_US;
+    uint8_t  last = 0;
+    mesa_rc  rc;
+
+    memset(rx_data, 0, PD_BUFFER_SIZE);
+
+    while ((rc = pd69200_rx_poll(inst, rx_data, byTxEcho, &last,
+                                 pePOE_BOOL_Is_system_status,
+                                 peTelemetry_at_Boot_Up_Error)) == MESA_RC_INCOMPLETE) {
+        if (pd69200_time_ms() > timeout) {
+            if (last == 0xFF) {
+                // No I2C response
+                DEBUG(inst, MEBA_TRACE_LVL_INFO, "%s Reading all 0xFF", __FUNCTION__);
+                return MESA_RC_ERROR;
+            }
+            // Empty I2C buffer in controller, just continue
+            return MESA_RC_ERR_POE_RX_BUF_EMPTY;
+        }
+        usleep(backoff_us);
+        backoff_us = PD69200_POLL_BACKOFF(backoff_us);
+    }
+    return rc;
 }
 
 
@@ -3206,6 +3349,7 @@ mesa_rc meba_poe_pd69200_ctrl_do_reset(
     int i = 30;
     while (i--) {
         pd69200_rd(inst, &dummy, 1);
+        VTSS_MSLEEP(50); // Give the controller time to push out what it has
     }
 
     MESA_RC(meba_poe_pd69200_ctrl_reset_command(inst));
@@ -3228,7 +3372,7 @@ mesa_rc meba_poe_pd69200_ctrl_do_reset(
             break;
         }
 
-        VTSS_MSLEEP(100); // OK, not an expected byte, give PoE controller a little more time to come up, before checking again.
+        VTSS_MSLEEP(150); // OK, not an expected byte, give PoE controller a little more time to come up, before checking again.
     }
 
     if (found) {
@@ -3402,36 +3546,38 @@ static mesa_rc pd69200_active_matrix_verify(
 }
 
 
-// Setup port mapping
+// Setup port mapping. The requests for all logical ports are transmitted back to back.
 static mesa_rc pd69200_temp_matrix_set(
     const meba_poe_ctrl_inst_t* const inst)
 {
+    pd69200_req_t req[POE_MAX_LOGICAL_PORTS];
+    uint8_t       i;
+
     // set all defined poe ports at required matrix phy - port_a and port_b
     // if not poe port (as data port) - set both port_a and port_b as 255
-    for (uint8_t i = 0; i < inst->port_map_length; i++)
+    // poe define logical 48 ports - let's set the unused logical ports as 255 255
+    for (i = 0; i < POE_MAX_LOGICAL_PORTS; i++)
     {
-        if (inst->port_map[i].capabilities & MEBA_POE_PORT_CAP_POE)
+        if (i < inst->port_map_length && (inst->port_map[i].capabilities & MEBA_POE_PORT_CAP_POE))
         {
-            MESA_RC(meba_poe_pd69200_ctrl_set_temporary_matrix(inst, i, inst->port_map[i].phys_port_a, inst->port_map[i].phys_port_b));
+            pd69200_matrix_req(&req[i], COMMAND_KEY, TMP_MATRIX_KEY, i, inst->port_map[i].phys_port_a, inst->port_map[i].phys_port_b);
         }
         else
         {
-            MESA_RC(meba_poe_pd69200_ctrl_set_temporary_matrix( inst, i, 255, 255));
+            pd69200_matrix_req(&req[i], COMMAND_KEY, TMP_MATRIX_KEY, i, 255, 255);
         }
     }
+    MESA_RC(pd69200_tx_wait(inst, __FUNCTION__, __LINE__, req, POE_MAX_LOGICAL_PORTS));
 
-    // poe define logical 48 ports - let's set the unused logical ports as 255 255
-    for (uint8_t i = inst->port_map_length; i < POE_MAX_LOGICAL_PORTS; i++)
+    // print temporary matrix for testing that all we set went ok
+    for (i = 0; i < POE_MAX_LOGICAL_PORTS; i++)
     {
-        MESA_RC(meba_poe_pd69200_ctrl_set_temporary_matrix( inst, i, 255, 255));
+        pd69200_matrix_req(&req[i], REQUEST_KEY, TMP_MATRIX_KEY, i, DUMMY_BYTE, DUMMY_BYTE);
     }
-
-    // print temporary matrix for testing that all we set went ok
-    for (uint8_t i = 0; i < POE_MAX_LOGICAL_PORTS; i++)
+    MESA_RC(pd69200_tx_wait(inst, __FUNCTION__, __LINE__, req, POE_MAX_LOGICAL_PORTS));
+    for (i = 0; i < POE_MAX_LOGICAL_PORTS; i++)
     {
-        uint8_t port_a, port_b;
-        MESA_RC(meba_poe_pd69200_ctrl_get_temporary_matrix( inst, i, &port_a, &port_b));
-        DEBUG(inst, MEBA_TRACE_LVL_DEBUG, "%s CH=%d ,port_a=%d ,port_b=%d ", __FUNCTION__, i ,port_a, port_b );
+        DEBUG(inst, MEBA_TRACE_LVL_DEBUG, "%s CH=%d ,port_a=%d ,port_b=%d ", __FUNCTION__, i, req[i].rx[2], req[i].rx[3]);
     }
 
     return MESA_RC_OK;
@@ -4942,6 +5088,7 @@ void meba_pd69200_driver_init(
 
     poe_driver_private_t* private_data = malloc(sizeof(poe_driver_private_t));
     memset(private_data   , 0, sizeof(poe_driver_private_t));
+    private_data->io = pd69200_io_default;
 
     private_data->IsBT_mode_user_config = false;
     private_data->debug = debug;
@@ -6735,6 +6882,7 @@ void meba_pd69200bt_driver_init(
 
     poe_driver_private_t* private_data = malloc(sizeof(poe_driver_private_t));
     memset(private_data   , 0, sizeof(poe_driver_private_t));
+    private_data->io = pd69200_io_default;
 
     private_data->IsBT_mode_user_config = true;
     private_data->debug = debug;
@@ -115,6 +115,26 @@ typedef struct {
 */
 int meba_pd69200_i2c_adapter_open(const char *filename, uint8_t i2c_addr);
 
+/**
+ * \brief Access methods used by the driver to talk to the PoE controller.
+ * Both return the number of bytes transferred or -1 on error, like read()/write().
+ */
+typedef struct {
+    int (*read)(int fd, uint8_t *data, size_t size);
+    int (*write)(int fd, const uint8_t *data, size_t size);
+} meba_pd69200_io_t;
+
+/**
+ * \brief Replace the access methods of an initialized driver instance.
+ * By default the adapter file descriptor is accessed using read()/write().
+ *
+ * \param inst  [IN] PoE controller instance.
+ * \param io    [IN] Access methods, NULL restores the default.
+ *
+ * \return MESA_RC_OK on success.
+*/
+mesa_rc meba_pd69200_io_set(meba_poe_ctrl_inst_t *inst, const meba_pd69200_io_t *io);
+
 /**
  * \brief Initialize driver
  *
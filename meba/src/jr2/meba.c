@@ -126,6 +126,7 @@ typedef struct meba_board_state {
     int                   phy10g_ts_cnt;
 
     mepa_device_t        *phy_devices[PORTS_MAX];
+    meba_sgpio_cache_t    sgpio;
 } meba_board_state_t;
 
 static const mesa_fan_conf_t fan_conf = {
@@ -1242,7 +1243,7 @@ static mesa_rc led_update_j2_cu48(meba_inst_t inst,
     if ((rc = mesa_sgpio_conf_get(NULL, 0, sgpio_group, &conf)) == MESA_RC_OK) {
         conf.port_conf[sgpio_port].mode[LED_GREEN] = mode_green;
         conf.port_conf[sgpio_port].mode[LED_YELLOW] = mode_yellow;
-        rc = mesa_sgpio_conf_set(NULL, 0, sgpio_group, &conf);
+        rc = meba_sgpio_conf_set(inst, sgpio_group, &conf);
     }
     return rc;
 }
@@ -1362,7 +1363,7 @@ static mesa_rc led_update_j2_cu8sfp16(meba_inst_t inst,
         // (chip_port 48).
         conf.port_conf[sgpio_port].mode[LED_GREEN] = (entry->map.chip_port >= 48) ? mode_green : mode_yellow;
         conf.port_conf[sgpio_port].mode[LED_YELLOW] = (entry->map.chip_port >= 48) ? mode_yellow : mode_green;
-        rc = mesa_sgpio_conf_set(NULL, 0, sgpio_group, &conf);
+        rc = meba_sgpio_conf_set(inst, sgpio_group, &conf);
     }
     return rc;
 }
@@ -1415,7 +1416,7 @@ static mesa_rc led_update_aqr(meba_inst_t inst,
         conf.port_conf[sgpio_port].mode[LED_GREEN] = mode_yellow;
         conf.port_conf[sgpio_port].mode[LED_YELLOW] = mode_green;
 
-        rc = mesa_sgpio_conf_set(NULL, 0, 0, &conf);
+        rc = meba_sgpio_conf_set(inst, 0, &conf);
     }
     return rc;
 }
@@ -2296,7 +2297,7 @@ static mesa_rc jr2_sfp_insertion_status_get(meba_inst_t inst,
         }
     } else {
         mesa_sgpio_port_data_t data[MESA_SGPIO_PORTS];
-        if ((rc = mesa_sgpio_read(NULL, 0, (board->type == BOARD_TYPE_SERVAL2_NID) ? 0 : 2, data)) == MESA_RC_OK) {
+        if ((rc = meba_sgpio_read(inst, &board->sgpio, (board->type == BOARD_TYPE_SERVAL2_NID) ? 0 : 2, data)) == MESA_RC_OK) {
             mesa_port_no_t port_no;
             if (board->type == BOARD_TYPE_SERVAL2_NID) {
                 meba_port_entry_t *entry = &board->port[0].map;
@@ -2408,7 +2409,7 @@ static mesa_rc jr2_sfp_status_get(meba_inst_t inst,
                 rc = MESA_RC_OK;    // No SGPIO needed, data don't care
             } else {
                 uint32_t sgpio_group = (board->type == BOARD_TYPE_SERVAL2_NID) ? 0 : 2;
-                rc = mesa_sgpio_read(NULL, 0, sgpio_group, data);
+                rc = meba_sgpio_read(inst, &board->sgpio, sgpio_group, data);
             }
             if (rc == MESA_RC_OK) {
                 status->present  = get_sfp_status(inst, port_no, data, SFP_DETECT);
@@ -2437,7 +2438,7 @@ static mesa_rc jr2_port_admin_state_set(meba_inst_t inst,
             if (port_no < sizeof(port_to_tx_disable_map_nid) &&
                 (rc = mesa_sgpio_conf_get(NULL, 0, 0, &conf)) == MESA_RC_OK) {
                 conf.port_conf[port_to_tx_disable_map_nid[port_no]].mode[0] = sgpio_mode;
-                rc = mesa_sgpio_conf_set(NULL, 0, 0, &conf);
+                rc = meba_sgpio_conf_set(inst, 0, &conf);
             }
         } else if (board->type == BOARD_TYPE_JAGUAR2) {
             vtss_gpio_10g_gpio_mode_t gpio_conf;
@@ -2515,7 +2516,7 @@ static mesa_rc jr2_port_admin_state_set(meba_inst_t inst,
                     default:
                         return rc;    // Nothing to do, return
                 }
-                rc = mesa_sgpio_conf_set(NULL, 0, 2, &conf);
+                rc = meba_sgpio_conf_set(inst, 2, &conf);
             }
         } else if (board->type == BOARD_TYPE_JAGUAR2_CU48) {
             if ((rc = mesa_sgpio_conf_get(NULL, 0, 2, &conf)) == MESA_RC_OK) {
@@ -2536,7 +2537,7 @@ static mesa_rc jr2_port_admin_state_set(meba_inst_t inst,
                     default:
                         return rc;    // Nothing to do, return
                 }
-                rc = mesa_sgpio_conf_set(NULL, 0, 2, &conf);
+                rc = meba_sgpio_conf_set(inst, 2, &conf);
 
             }
 
@@ -3047,6 +3048,7 @@ static mesa_rc sgpio2_handler(meba_inst_t inst,
             return rc; // Don't even re-enable SGPIO2 interrupt
         }
     }
+    meba_sgpio_snapshot_clear(&board->sgpio); // Inputs have changed
 
     // Disable the interrupt while handling the event
     for (sgpio_port = 0; sgpio_port < MESA_SGPIO_PORTS; sgpio_port++) {
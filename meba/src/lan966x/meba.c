@@ -38,6 +38,7 @@ typedef struct meba_board_state {
     meba_port_entry_t     *entry;
     mepa_device_t         *phy_devices[PORTS_MAX];
     mesa_port_status_t    status[PORTS_MAX];
+    meba_sgpio_cache_t    sgpio;
 } meba_board_state_t;
 
 // GPIO for interrupts from external PHYs
@@ -440,7 +441,7 @@ static mesa_rc lan966x_sfp_insertion_status_get(meba_inst_t inst,
 
     mesa_port_list_clear(present);
     if (board->type == BOARD_TYPE_ENDNODE_CARRIER &&
-        (rc = mesa_sgpio_read(NULL, 0, 0, data)) == MESA_RC_OK) {
+        (rc = meba_sgpio_read(inst, &board->sgpio, 0, data)) == MESA_RC_OK) {
         for (port_no = 2; port_no < 4; port_no++) {
             // SFP MODDET at bit 1
             mesa_port_list_set(present, port_no, data[port_no].value[1] ? 0 : 1);
@@ -460,7 +461,7 @@ static mesa_rc lan966x_sfp_status_get(meba_inst_t inst,
     memset(status, 0, sizeof(*status));
     if (board->type == BOARD_TYPE_ENDNODE_CARRIER &&
         (port_no == 2 || port_no == 3) &&
-        (rc = mesa_sgpio_read(NULL, 0, 0, data)) == MESA_RC_OK) {
+        (rc = meba_sgpio_read(inst, &board->sgpio, 0, data)) == MESA_RC_OK) {
         status->los      = (data[port_no].value[0] ? 0 : 1);     // SFP LOS at bit 0
         status->present  = (data[port_no].value[1] ? 0 : 1);     // SFP MODDET at bit 1
         status->tx_fault = (data[1].value[port_no - 2] ? 0 : 1); // SFP TXFAULT at port 1, bit 0/1
@@ -482,7 +483,7 @@ static mesa_rc lan966x_port_admin_state_set(meba_inst_t inst,
         (rc = mesa_sgpio_conf_get(NULL, 0, 0, &conf)) == MESA_RC_OK) {
         mode = (state->enable ? MESA_SGPIO_MODE_ON : MESA_SGPIO_MODE_OFF);
         conf.port_conf[10].mode[port_no - 2] = mode; // SFP TXEN at port 10, bit 0/1
-        rc = mesa_sgpio_conf_set(NULL, 0, 0, &conf);
+        rc = meba_sgpio_conf_set(inst, 0, &conf);
     }
     return rc;
 }
@@ -516,7 +517,7 @@ static mesa_rc lan966x_port_led_update(meba_inst_t inst,
                 mode[1] = MESA_SGPIO_MODE_0_ACTIVITY;
             }
         }
-        rc = mesa_sgpio_conf_set(NULL, 0, 0, &conf);
+        rc = meba_sgpio_conf_set(inst, 0, &conf);
     }
     return rc;
 }
@@ -540,6 +541,7 @@ static mesa_rc sgpio_handler(meba_inst_t inst, meba_board_state_t *board, meba_e
             return rc;
         }
     }
+    meba_sgpio_snapshot_clear(&board->sgpio); // Inputs have changed
 
     // Check for LOS, MODDET and TXFAULT events
     for (port_no = 2; port_no < 4; port_no++) {
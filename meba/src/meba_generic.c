@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: MIT
 
 
+#include <string.h>
+#include <time.h>
 #include <vtss_phy_api.h>
 #include <microchip/ethernet/board/api.h>
 
@@ -217,6 +219,82 @@ mesa_rc meba_generic_phy_event_check(meba_inst_t inst,
     return rc;
 }
 
+static uint64_t meba_sgpio_time_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
+}
+
+mesa_rc meba_sgpio_read(meba_inst_t inst, meba_sgpio_cache_t *cache,
+                        mesa_sgpio_group_t group, mesa_sgpio_port_data_t data[MESA_SGPIO_PORTS])
+{
+    meba_sgpio_snapshot_t *snap;
+    uint64_t              now = meba_sgpio_time_ms();
+    mesa_rc               rc;
+
+    if (group >= MEBA_SGPIO_GROUPS) {
+        return mesa_sgpio_read(NULL, 0, group, data);
+    }
+    snap = &cache->group[group];
+    if (snap->time_ms == 0 || now - snap->time_ms >= MEBA_SGPIO_SNAPSHOT_MS) {
+        if ((rc = mesa_sgpio_read(NULL, 0, group, snap->data)) != MESA_RC_OK) {
+            snap->time_ms = 0;
+            return rc;
+        }
+        T_N(inst, "group %u: new snapshot", group);
+        snap->time_ms = now;
+    }
+    memcpy(data, snap->data, sizeof(snap->data));
+    return MESA_RC_OK;
+}
+
+void meba_sgpio_snapshot_clear(meba_sgpio_cache_t *cache)
+{
+    mesa_sgpio_group_t group;
+
+    for (group = 0; group < MEBA_SGPIO_GROUPS; group++) {
+        cache->group[group].time_ms = 0;
+    }
+}
+
+// Compare field by field, the structures contain padding
+static mesa_bool_t meba_sgpio_conf_equal(const mesa_sgpio_conf_t *a, const mesa_sgpio_conf_t *b)
+{
+    const mesa_sgpio_port_conf_t *pa, *pb;
+    int                          port, bit;
+
+    if (a->bmode[0] != b->bmode[0] || a->bmode[1] != b->bmode[1] || a->bit_count != b->bit_count) {
+        return false;
+    }
+    for (port = 0; port < MESA_SGPIO_PORTS; port++) {
+        pa = &a->port_conf[port];
+        pb = &b->port_conf[port];
+        if (pa->enabled != pb->enabled) {
+            return false;
+        }
+        for (bit = 0; bit < 4; bit++) {
+            if (pa->mode[bit] != pb->mode[bit] || pa->int_pol_high[bit] != pb->int_pol_high[bit]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+mesa_rc meba_sgpio_conf_set(meba_inst_t inst, mesa_sgpio_group_t group, const mesa_sgpio_conf_t *conf)
+{
+    mesa_sgpio_conf_t cur;
+
+    // The configuration kept by the API mirrors the SGPIO output registers
+    if (mesa_sgpio_conf_get(NULL, 0, group, &cur) == MESA_RC_OK && meba_sgpio_conf_equal(&cur, conf)) {
+        return MESA_RC_OK;
+    }
+    T_N(inst, "group %u: write", group);
+    return mesa_sgpio_conf_set(NULL, 0, group, conf);
+}
+
 mepa_rc meba_mmd_read(struct mepa_callout_ctx           *ctx,
                       const uint8_t                      mmd,
                       const uint16_t                     addr,
@@ -297,6 +375,7 @@ void meba_phy_driver_init(meba_inst_t inst)
     inst->mepa_callout.mmd_write = meba_mmd_write;
     inst->mepa_callout.miim_read = meba_miim_read;
     inst->mepa_callout.miim_write = meba_miim_write;
+    inst->mepa_callout.mdio_xfer = NULL; // No batched MIIM access in MESA, MEPA falls back to single accesses
     inst->mepa_callout.lock_enter = inst->iface.lock_enter;
     inst->mepa_callout.lock_exit = inst->iface.lock_exit;
     inst->mepa_callout.mem_alloc = mem_alloc;
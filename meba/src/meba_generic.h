@@ -62,6 +62,30 @@ mesa_rc meba_generic_phy_event_check(meba_inst_t inst,
                                      meba_event_signal_t signal_notifier);
 
 
+// SGPIO input snapshots. Inputs of a group read within MEBA_SGPIO_SNAPSHOT_MS
+// of the previous read are served from a snapshot, so the port, SFP and LED
+// paths of a board share one read of the SGPIO chain per poll.
+#define MEBA_SGPIO_GROUPS      3
+#define MEBA_SGPIO_SNAPSHOT_MS 100
+
+typedef struct {
+    uint64_t               time_ms;                 // Snapshot time, zero if none
+    mesa_sgpio_port_data_t data[MESA_SGPIO_PORTS];  // Input snapshot
+} meba_sgpio_snapshot_t;
+
+typedef struct {
+    meba_sgpio_snapshot_t  group[MEBA_SGPIO_GROUPS];
+} meba_sgpio_cache_t;
+
+mesa_rc meba_sgpio_read(meba_inst_t inst, meba_sgpio_cache_t *cache,
+                        mesa_sgpio_group_t group, mesa_sgpio_port_data_t data[MESA_SGPIO_PORTS]);
+
+// Drop all snapshots, e.g. when an SGPIO interrupt signals that inputs have changed
+void meba_sgpio_snapshot_clear(meba_sgpio_cache_t *cache);
+
+// Write SGPIO output configuration of a group, if different from the current configuration
+mesa_rc meba_sgpio_conf_set(meba_inst_t inst, mesa_sgpio_group_t group, const mesa_sgpio_conf_t *conf);
+
 uint32_t meba_get_phy_id(meba_inst_t inst, uint32_t port_no, meba_port_entry_t port_entry);
 void meba_phy_driver_init(meba_inst_t inst);
 
@@ -44,6 +44,7 @@ typedef struct meba_board_state {
     uint32_t              *sgpio_port;
     const board_func_t    *func;
     mepa_device_t        *phy_devices[MAX_PORTS];
+    meba_sgpio_cache_t    sgpio;
 } meba_board_state_t;
 
 static const meba_aux_rawio_t rawio = {
@@ -1072,7 +1073,7 @@ static mesa_rc ocelot_sfp_insertion_status_get(meba_inst_t inst,
 
     mesa_port_list_clear(present);
 
-    if ((rc = mesa_sgpio_read(NULL, 0, 0, data)) == MESA_RC_OK) {
+    if ((rc = meba_sgpio_read(inst, &board->sgpio, 0, data)) == MESA_RC_OK) {
         mesa_port_no_t port_no;
         for (port_no = 0; port_no < board->port_cnt; port_no++) {
             mesa_bool_t detect = get_sfp_status(inst, port_no, data, SFP_DETECT);
@@ -1094,7 +1095,7 @@ static mesa_rc ocelot_sfp_status_get(meba_inst_t inst,
     if (port_no < board->port_cnt) {
         mesa_sgpio_port_data_t data[MESA_SGPIO_PORTS];
         meba_port_entry_t  *entry = &board->port[port_no].map;
-        if ((rc = mesa_sgpio_read(NULL, 0, 0, data)) == MESA_RC_OK) {
+        if ((rc = meba_sgpio_read(inst, &board->sgpio, 0, data)) == MESA_RC_OK) {
             if ((entry->cap & MEBA_PORT_CAP_SFP_DETECT) || (entry->cap & MEBA_PORT_CAP_DUAL_SFP_DETECT)) {
                 status->present  = get_sfp_status(inst, port_no, data, SFP_DETECT);
                 status->tx_fault = get_sfp_status(inst, port_no, data, SFP_FAULT);
@@ -1135,7 +1136,7 @@ static mesa_rc ocelot_port_admin_state_set(meba_inst_t inst,
                 break;
             }
 
-            rc = mesa_sgpio_conf_set(NULL, 0, 0, &conf);
+            rc = meba_sgpio_conf_set(inst, 0, &conf);
         }
     } else if (board->type == BOARD_TYPE_OCELOT_PCB123) {
         // If the port is a dual-media one, then the board port no is different
@@ -1173,7 +1174,7 @@ static mesa_rc ocelot_port_admin_state_set(meba_inst_t inst,
                 return rc;
             }
 
-            rc = mesa_sgpio_conf_set(NULL, 0, 0, &conf);
+            rc = meba_sgpio_conf_set(inst, 0, &conf);
         }
     }
     return rc;
@@ -1338,7 +1339,7 @@ static mesa_rc ocelot_port_led_update(meba_inst_t inst,
                 T_N(inst, "Port %d (chip %d) = [%d,%d]", port_no, sgpio_port, mode_green, mode_red);
                 conf.port_conf[sgpio_port].mode[1] = mode_green; // NB: Red/Green reversed in board docs
                 conf.port_conf[sgpio_port].mode[0] = mode_red;   // NB: Red/Green reversed in board docs
-                rc = mesa_sgpio_conf_set(NULL, 0, 0, &conf);
+                rc = meba_sgpio_conf_set(inst, 0, &conf);
             }
         }
     }
@@ -1489,6 +1490,7 @@ static mesa_rc sgpio_handler(meba_inst_t inst, meba_board_state_t *board, meba_e
         T_E(inst, "mesa_sgpio_event_poll = %d", rc);
         return rc;
     }
+    meba_sgpio_snapshot_clear(&board->sgpio); // Inputs have changed
 
     // Poll SGPIO LOS from SFP ports
     for (port_no = 0; port_no < board->port_cnt; port_no++) {
@@ -1053,7 +1053,7 @@ static mesa_rc fa_sfp_insertion_status_get(meba_inst_t inst, mesa_port_list_t *p
     T_N(inst, "Called");
     mesa_port_list_clear(present);
 
-    if ((rc = mesa_sgpio_read(NULL, 0, 2, data)) == MESA_RC_OK) {
+    if ((rc = meba_sgpio_read(inst, &board->sgpio, 2, data)) == MESA_RC_OK) {
         mesa_port_no_t port_no;
         /* The 'Module Detect' is inverted i.e. '0' means detected */
         for (port_no = 0; port_no < board->port_cnt; port_no++) {
@@ -1082,7 +1082,7 @@ static mesa_rc fa_sfp_status_get(meba_inst_t inst,
             status->tx_fault = false;
             if (is_sfp_port(board->port[port_no].map.cap)) {
                 mesa_sgpio_port_data_t data[MESA_SGPIO_PORTS];
-                rc = mesa_sgpio_read(NULL, 0, 2, data); // SGPIO group 2
+                rc = meba_sgpio_read(inst, &board->sgpio, 2, data); // SGPIO group 2
                 if (rc == MESA_RC_OK) {
                     status->present  = get_sfp_status(inst, port_no, data, SFP_DETECT);
                     status->tx_fault = get_sfp_status(inst, port_no, data, SFP_FAULT);
@@ -1130,7 +1130,7 @@ static mesa_rc fa_port_admin_state_set(meba_inst_t inst,
             } else {
                 conf.port_conf[sgpio_port].mode[0] = sgpio_mode; // TxDisable maps to bit 0, SGPIO group 2
             }
-            rc = mesa_sgpio_conf_set(NULL, 0, 2, &conf);
+            rc = meba_sgpio_conf_set(inst, 2, &conf);
         }
 //    }
 
@@ -1316,7 +1316,7 @@ static mesa_rc fa_port_led_update(meba_inst_t inst,
             conf.port_conf[led_tower].mode[LED_GREEN] = mode_green_tower;
             conf.port_conf[led_tower].mode[LED_YELLOW] = mode_yellow_tower;
         }
-        rc = mesa_sgpio_conf_set(NULL, 0, sgpio_group, &conf);
+        rc = meba_sgpio_conf_set(inst, sgpio_group, &conf);
     }
 
     return rc;
@@ -1959,6 +1959,7 @@ static mesa_rc sgpio2_handler(meba_inst_t inst,
             return rc; // Don't even re-enable SGPIO2 interrupt
         }
     }
+    meba_sgpio_snapshot_clear(&board->sgpio); // Inputs have changed
     for (port_no = 0; port_no < board->port_cnt; port_no++) {
         if (is_sfp_port(board->port[port_no].map.cap)) {
             mesa_bool_t event_detected = false;
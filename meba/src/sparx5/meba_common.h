@@ -58,5 +58,6 @@ typedef struct meba_board_state {
     fa_port_info_t        *port;
     const board_func_t    *func;
     mepa_device_t        *phy_devices[MAX_PORTS];
+    meba_sgpio_cache_t    sgpio;
 } meba_board_state_t;
 
@@ -0,0 +1,224 @@
+// Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+// SPDX-License-Identifier: MIT
+
+// Host-side emulation of the PD69200 serial communication protocol. Used by
+// the driver tests for measuring the latency of the driver without PoE
+// hardware, see pd69200_emul_open().
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "pd69200_emul.h"
+
+#define EMUL_MSG_SIZE       15   // Message length
+#define EMUL_INST_MAX       4    // Number of emulated controllers
+#define EMUL_CH_MAX         256  // Number of channels in matrix
+
+#define EMUL_COMMAND_KEY    0x00
+#define EMUL_PROGRAM_KEY    0x01
+#define EMUL_REQUEST_KEY    0x02
+#define EMUL_TELEMETRY_KEY  0x03
+#define EMUL_CHANNEL_KEY    0x05
+#define EMUL_TMP_MATRIX_KEY 0x43
+#define EMUL_REPORT_KEY     0x52
+#define EMUL_DUMMY_BYTE     0x4E
+
+typedef struct {
+    int                     fd;                         // File descriptor, -1 if unused
+    uint32_t                reply_delay_us;             // Processing time per message
+    uint8_t                 reply[2 * EMUL_MSG_SIZE];   // Pending stale reply and reply
+    uint32_t                reply_idx;                  // Next reply byte to read
+    uint32_t                reply_len;                  // Reply length, zero if none
+    uint64_t                reply_time_us;              // Time when reply is ready
+    mesa_bool_t             stale;                      // Send a stale reply first
+    uint8_t                 matrix[EMUL_CH_MAX][2];     // Temporary matrix
+    pd69200_emul_cnt_t      cnt;
+} pd69200_emul_t;
+
+static pd69200_emul_t pd69200_emul[EMUL_INST_MAX] = {
+    [0 ... EMUL_INST_MAX - 1] = { .fd = -1 }
+};
+
+static uint64_t emul_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static pd69200_emul_t *emul_get(int fd)
+{
+    int i;
+
+    for (i = 0; i < EMUL_INST_MAX; i++) {
+        if (pd69200_emul[i].fd == fd && fd >= 0) {
+            return &pd69200_emul[i];
+        }
+    }
+    return NULL;
+}
+
+static uint16_t emul_check_sum(const uint8_t *buf)
+{
+    uint16_t sum = 0;
+    int      i;
+
+    for (i = 0; i < EMUL_MSG_SIZE - 2; i++) {
+        sum += buf[i];
+    }
+    return sum;
+}
+
+static void emul_check_sum_set(uint8_t *buf)
+{
+    uint16_t sum = emul_check_sum(buf);
+
+    buf[13] = (sum >> 8);
+    buf[14] = (sum & 0xff);
+}
+
+// Build the reply to a message, see section 4 in the user guide
+static void emul_reply(pd69200_emul_t *emul, const uint8_t *msg)
+{
+    uint8_t  *rep = emul->reply;
+    uint16_t sum = emul_check_sum(msg);
+
+    emul->reply_idx = 0;
+    emul->reply_len = 0;
+    if (emul->stale) {
+        // Telemetry to an earlier request, with data looking like the start of the reply.
+        // The echo 0x00 reads as an empty buffer and 0xFF as a system status.
+        emul->stale = false;
+        memset(rep, EMUL_DUMMY_BYTE, EMUL_MSG_SIZE);
+        rep[0] = EMUL_TELEMETRY_KEY;
+        rep[1] = (msg[1] > 1 ? msg[1] - 1 : msg[1] + 1);
+        rep[2] = EMUL_REPORT_KEY;
+        rep[3] = msg[1];
+        emul_check_sum_set(rep);
+        rep += EMUL_MSG_SIZE;
+        emul->reply_len = EMUL_MSG_SIZE;
+    }
+
+    memset(rep, EMUL_DUMMY_BYTE, EMUL_MSG_SIZE);
+    rep[1] = msg[1]; // Echo
+    if (msg[13] != (sum >> 8) || msg[14] != (sum & 0xff)) {
+        // Command received/wrong checksum
+        rep[0] = EMUL_REPORT_KEY;
+        rep[2] = rep[3] = rep[4] = rep[5] = 0xff;
+    } else if (msg[0] == EMUL_REQUEST_KEY) {
+        rep[0] = EMUL_TELEMETRY_KEY;
+        if (msg[2] == EMUL_CHANNEL_KEY && msg[3] == EMUL_TMP_MATRIX_KEY) {
+            rep[2] = emul->matrix[msg[4]][0];
+            rep[3] = emul->matrix[msg[4]][1];
+        }
+    } else {
+        // Command received/correctly executed
+        rep[0] = EMUL_REPORT_KEY;
+        rep[2] = rep[3] = 0x00;
+        if (msg[0] == EMUL_COMMAND_KEY && msg[2] == EMUL_CHANNEL_KEY && msg[3] == EMUL_TMP_MATRIX_KEY) {
+            emul->matrix[msg[4]][0] = msg[5];
+            emul->matrix[msg[4]][1] = msg[6];
+        }
+    }
+    emul_check_sum_set(rep);
+    emul->reply_len += EMUL_MSG_SIZE;
+    emul->reply_time_us = emul_time_us() + emul->reply_delay_us;
+}
+
+static int emul_read(int fd, uint8_t *data, size_t size)
+{
+    pd69200_emul_t *emul = emul_get(fd);
+    size_t         i;
+
+    if (emul == NULL) {
+        return -1;
+    }
+
+    // The controller sends 0x00 while it has nothing to send
+    memset(data, 0, size);
+    if (emul->reply_idx == emul->reply_len || emul_time_us() < emul->reply_time_us) {
+        emul->cnt.empty_reads++;
+        return size;
+    }
+    for (i = 0; i < size && emul->reply_idx < emul->reply_len; i++) {
+        data[i] = emul->reply[emul->reply_idx++];
+        if (emul->reply_idx % EMUL_MSG_SIZE == 0) {
+            emul->cnt.replies++;
+        }
+    }
+    return size;
+}
+
+static int emul_write(int fd, const uint8_t *data, size_t size)
+{
+    pd69200_emul_t *emul = emul_get(fd);
+
+    if (emul == NULL) {
+        return -1;
+    }
+
+    // Only complete messages are answered, single characters are used for
+    // firmware download
+    if (size == EMUL_MSG_SIZE) {
+        emul->cnt.requests++;
+        emul_reply(emul, data);
+    }
+    return size;
+}
+
+const meba_pd69200_io_t pd69200_emul_io = {
+    .read  = emul_read,
+    .write = emul_write,
+};
+
+int pd69200_emul_open(uint32_t reply_delay_us)
+{
+    pd69200_emul_t *emul = NULL;
+    int            i;
+
+    for (i = 0; i < EMUL_INST_MAX; i++) {
+        if (pd69200_emul[i].fd < 0) {
+            emul = &pd69200_emul[i];
+            break;
+        }
+    }
+    if (emul == NULL) {
+        return -1;
+    }
+
+    // A real file descriptor identifies the emulator
+    memset(emul, 0, sizeof(*emul));
+    if ((emul->fd = open("/dev/null", O_RDWR)) < 0) {
+        return -1;
+    }
+    emul->reply_delay_us = reply_delay_us;
+    memset(emul->matrix, 0xff, sizeof(emul->matrix));
+    return emul->fd;
+}
+
+mesa_rc pd69200_emul_cnt_get(int fd, pd69200_emul_cnt_t *cnt)
+{
+    pd69200_emul_t *emul = emul_get(fd);
+
+    if (emul == NULL || cnt == NULL) {
+        return MESA_RC_ERROR;
+    }
+    emul->cnt.pending = emul->reply_len - emul->reply_idx;
+    *cnt = emul->cnt;
+    memset(&emul->cnt, 0, sizeof(emul->cnt));
+    return MESA_RC_OK;
+}
+
+mesa_rc pd69200_emul_stale_set(int fd)
+{
+    pd69200_emul_t *emul = emul_get(fd);
+
+    if (emul == NULL) {
+        return MESA_RC_ERROR;
+    }
+    emul->stale = true;
+    return MESA_RC_OK;
+}
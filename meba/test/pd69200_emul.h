@@ -0,0 +1,58 @@
+// Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+// SPDX-License-Identifier: MIT
+
+#ifndef _PD69200_EMUL_H_
+#define _PD69200_EMUL_H_
+
+#include <microchip/ethernet/board/api.h>
+#include "poe_driver.h"
+
+/**
+ * \brief Open a host-side PD69200 protocol emulator.
+ * The emulator answers requests with telemetry and commands with a report,
+ * each carrying the echo of the request. Reads return 0x00 (empty buffer)
+ * until reply_delay_us has elapsed after the request was written.
+ *
+ * \param reply_delay_us [IN] Controller processing time per message.
+ *
+ * \return File descriptor to pass as adapter_fd, or -1 on error.
+*/
+int pd69200_emul_open(uint32_t reply_delay_us);
+
+/**
+ * \brief Emulator counters.
+ */
+typedef struct {
+    uint32_t requests;      // Messages written
+    uint32_t replies;       // Replies completely read, including stale replies
+    uint32_t empty_reads;   // Reads done before a reply was ready
+    uint32_t pending;       // Reply bytes not read yet
+} pd69200_emul_cnt_t;
+
+/**
+ * \brief Get (and clear) emulator counters.
+ *
+ * \param fd   [IN]  File descriptor returned by pd69200_emul_open().
+ * \param cnt  [OUT] Counters.
+ *
+ * \return MESA_RC_OK on success.
+*/
+mesa_rc pd69200_emul_cnt_get(int fd, pd69200_emul_cnt_t *cnt);
+
+/**
+ * \brief Send a stale reply before the reply to the next request.
+ * The stale reply carries the previous echo, and its data holds a report key
+ * followed by the echo of the next request.
+ *
+ * \param fd   [IN]  File descriptor returned by pd69200_emul_open().
+ *
+ * \return MESA_RC_OK on success.
+*/
+mesa_rc pd69200_emul_stale_set(int fd);
+
+/**
+ * \brief Access methods for the emulator, for use with meba_pd69200_io_set().
+ */
+extern const meba_pd69200_io_t pd69200_emul_io;
+
+#endif // _PD69200_EMUL_H_
@@ -0,0 +1,180 @@
+// Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+// SPDX-License-Identifier: MIT
+
+/* PD69200 driver tests against the host-side protocol emulator.
+   The driver is included here, so the request queue can be driven directly.
+   Built by the BUILD_MEBA_PD69200_TEST option and run by ctest. */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <inttypes.h>
+
+#include "../src/drivers/poe_driver.c"
+#include "pd69200_emul.h"
+
+#define SWEEP_PORT_CNT      48
+#define SWEEP_REPLY_US      5000 /* Controller processing time per message */
+
+static uint32_t sweep_test_errors;
+static int      sweep_test_verbose;
+
+#define SWEEP_CHECK(expr, ...) do { if (!(expr)) { sweep_test_errors++; printf("%s:%d: ", __FUNCTION__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+/* - Callouts ------------------------------------------------------ */
+
+static void sweep_test_debug(meba_trace_level_t level, const char *location, uint32_t line_no, const char *fmt, ...)
+{
+    va_list args;
+
+    if (sweep_test_verbose) {
+        va_start(args, fmt);
+        printf("%s(%u): ", location, line_no);
+        vprintf(fmt, args);
+        printf("\n");
+        va_end(args);
+    }
+}
+
+static uint64_t sweep_test_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* - Tests --------------------------------------------------------- */
+
+/* The per-port status sweep done by the application through the synchronous API */
+static void sweep_test_status(meba_poe_ctrl_inst_t *inst)
+{
+    meba_poe_port_status_t status;
+    pd69200_emul_cnt_t     cnt;
+    uint64_t               start_us, sweep_us;
+    meba_poe_port_handle_t handle;
+
+    memset(&status, 0, sizeof(status));
+    (void)pd69200_emul_cnt_get(inst->adapter_fd, &cnt);
+    start_us = sweep_test_time_us();
+    for (handle = 0; handle < SWEEP_PORT_CNT; handle++) {
+        SWEEP_CHECK(meba_poe_pd69200_ctrl_port_status_get(inst, handle, &status) == MESA_RC_OK, "port %u status", handle);
+    }
+    sweep_us = sweep_test_time_us() - start_us;
+    (void)pd69200_emul_cnt_get(inst->adapter_fd, &cnt);
+    SWEEP_CHECK(cnt.requests > 0 && cnt.replies == cnt.requests, "%u requests, %u replies", cnt.requests, cnt.replies);
+    SWEEP_CHECK(cnt.pending == 0, "%u bytes pending", cnt.pending);
+    printf("status sweep: %u ports, %u messages, %u empty reads, %" PRIu64 " ms (%" PRIu64 " us/message, reply delay %u us)\n",
+           SWEEP_PORT_CNT, cnt.requests, cnt.empty_reads, sweep_us / 1000,
+           cnt.requests ? sweep_us / cnt.requests : 0, SWEEP_REPLY_US);
+}
+
+/* The queue does not wait for the controller, and sends the requests back to back */
+static void sweep_test_batch(meba_poe_ctrl_inst_t *inst)
+{
+    static pd69200_req_t req[SWEEP_PORT_CNT];
+    pd69200_emul_cnt_t   cnt;
+    uint64_t             start_us, poll_us, busy_us = 0;
+    uint32_t             i, wait_us, poll_cnt = 0;
+    mesa_rc              rc;
+
+    for (i = 0; i < SWEEP_PORT_CNT; i++) {
+        pd69200_matrix_req(&req[i], REQUEST_KEY, PORT_STATUS_KEY, i, DUMMY_BYTE, DUMMY_BYTE);
+    }
+    (void)pd69200_emul_cnt_get(inst->adapter_fd, &cnt);
+    start_us = sweep_test_time_us();
+    while (1) {
+        poll_us = sweep_test_time_us();
+        rc = pd69200_tx_batch(inst, __FUNCTION__, __LINE__, req, SWEEP_PORT_CNT, &wait_us);
+        poll_us = sweep_test_time_us() - poll_us;
+        busy_us = (poll_us > busy_us ? poll_us : busy_us);
+        poll_cnt++;
+        if (rc != MESA_RC_INCOMPLETE) {
+            break;
+        }
+        SWEEP_CHECK(wait_us >= PD69200_POLL_MIN_US && wait_us <= PD69200_POLL_MAX_US, "wait %u us", wait_us);
+        usleep(wait_us);
+    }
+    start_us = sweep_test_time_us() - start_us;
+    (void)pd69200_emul_cnt_get(inst->adapter_fd, &cnt);
+    SWEEP_CHECK(rc == MESA_RC_OK, "batch rc %d", rc);
+    SWEEP_CHECK(poll_cnt > SWEEP_PORT_CNT, "%u polls", poll_cnt);
+    SWEEP_CHECK(busy_us < SWEEP_REPLY_US, "poll took %" PRIu64 " us", busy_us);
+    SWEEP_CHECK(cnt.requests == SWEEP_PORT_CNT && cnt.replies == SWEEP_PORT_CNT, "%u requests, %u replies", cnt.requests, cnt.replies);
+    for (i = 0; i < SWEEP_PORT_CNT; i++) {
+        SWEEP_CHECK(req[i].rc == MESA_RC_OK && req[i].rx[1] == req[i].tx[1], "req %u rc %d, echo %u/%u", i, req[i].rc, req[i].rx[1], req[i].tx[1]);
+    }
+    printf("batch sweep: %u messages, %u polls, longest poll %" PRIu64 " us, %" PRIu64 " ms\n",
+           cnt.requests, poll_cnt, busy_us, start_us / 1000);
+}
+
+/* A stale reply is discarded as a whole, also when its data looks like a reply */
+static void sweep_test_stale(meba_poe_ctrl_inst_t *inst)
+{
+    uint8_t            enable, state, force, latch, pd_class, poh, four_pair;
+    pd69200_emul_cnt_t cnt;
+
+    (void)pd69200_emul_cnt_get(inst->adapter_fd, &cnt);
+    SWEEP_CHECK(pd69200_emul_stale_set(inst->adapter_fd) == MESA_RC_OK, "stale set");
+    SWEEP_CHECK(meba_poe_pd69200_ctrl_get_single_port_status(inst, 0, &enable, &state, &force, &latch, &pd_class, &poh, &four_pair) == MESA_RC_OK,
+                "port status");
+    (void)pd69200_emul_cnt_get(inst->adapter_fd, &cnt);
+    SWEEP_CHECK(cnt.requests == 1 && cnt.replies == 2, "%u requests, %u replies", cnt.requests, cnt.replies);
+    SWEEP_CHECK(cnt.pending == 0, "%u bytes pending", cnt.pending);
+}
+
+/* - Main ---------------------------------------------------------- */
+
+typedef struct {
+    const char *name;
+    void       (*func)(meba_poe_ctrl_inst_t *inst);
+} sweep_test_t;
+
+static const sweep_test_t sweep_test_table[] = {
+    { "status_sweep", sweep_test_status },
+    { "batch_sweep",  sweep_test_batch },
+    { "stale_reply",  sweep_test_stale },
+};
+
+int main(int argc, char **argv)
+{
+    static meba_poe_port_properties_t port_map[SWEEP_PORT_CNT];
+    meba_poe_ctrl_inst_t              inst;
+    meba_poe_parameters_t             params;
+    poe_driver_private_t              *private_data;
+    uint32_t                          i, errors = 0;
+    int                               fd;
+
+    sweep_test_verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    if ((fd = pd69200_emul_open(SWEEP_REPLY_US)) < 0) {
+        printf("FAIL: emulator open\n");
+        return 1;
+    }
+    for (i = 0; i < SWEEP_PORT_CNT; i++) {
+        port_map[i].capabilities = MEBA_POE_PORT_CAP_POE;
+        port_map[i].port_no = i;
+        port_map[i].handle = i;
+        port_map[i].phys_port_a = i;
+        port_map[i].phys_port_b = 0xff;
+    }
+    memset(&inst, 0, sizeof(inst));
+    memset(&params, 0, sizeof(params));
+    meba_pd69200_driver_init(&inst, "pd69200_emul", fd, 0, port_map, SWEEP_PORT_CNT, NULL, 0, sweep_test_debug, params);
+    if (meba_pd69200_io_set(&inst, &pd69200_emul_io) != MESA_RC_OK) {
+        printf("FAIL: io set\n");
+        return 1;
+    }
+
+    // The controller is found without running the detection
+    private_data = inst.private_data;
+    private_data->status.global.chip_state = MEBA_POE_CHIPSET_FOUND;
+    memset(private_data->status.ports, 0, sizeof(meba_poe_port_private_status_t) * SWEEP_PORT_CNT);
+    memset(private_data->cfg.ports, 0, sizeof(meba_poe_port_cfg_t) * SWEEP_PORT_CNT);
+
+    for (i = 0; i < sizeof(sweep_test_table) / sizeof(sweep_test_table[0]); i++) {
+        sweep_test_errors = 0;
+        sweep_test_table[i].func(&inst);
+        printf("%s: %s\n", sweep_test_errors ? "FAIL" : "PASS", sweep_test_table[i].name);
+        errors += sweep_test_errors;
+    }
+    return (errors ? 1 : 0);
+}
@@ -56,6 +56,7 @@ typedef mepa_rc (*mepa_macsec_rx_sc_counters_get_t)(struct mepa_device *dev, con
 typedef mepa_rc (*mepa_macsec_tx_sc_counters_get_t)(struct mepa_device *dev, const mepa_macsec_port_t port, mepa_macsec_tx_sc_counters_t *const counters);
 typedef mepa_rc (*mepa_macsec_tx_sa_counters_get_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const uint16_t an, mepa_macsec_tx_sa_counters_t *const counters);
 typedef mepa_rc (*mepa_macsec_rx_sa_counters_get_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const mepa_macsec_sci_t *const sci, const uint16_t an, mepa_macsec_rx_sa_counters_t *const counters);
+typedef mepa_rc (*mepa_macsec_secy_counters_snapshot_get_t)(struct mepa_device *dev, const mepa_macsec_port_t port, mepa_macsec_secy_counters_snapshot_t *const snapshot);
 typedef mepa_rc (*mepa_macsec_control_frame_match_conf_set_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const mepa_macsec_control_frame_match_conf_t *const conf, uint32_t *const rule_id);
 typedef mepa_rc (*mepa_macsec_control_frame_match_conf_del_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const uint32_t rule_id);
 typedef mepa_rc (*mepa_macsec_control_frame_match_conf_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, mepa_macsec_control_frame_match_conf_t *const conf, uint32_t rule_id);
@@ -161,6 +162,7 @@ typedef struct mepa_macsec_driver {
     mepa_macsec_tx_sc_counters_get_t mepa_macsec_tx_sc_counters_get;
     mepa_macsec_tx_sa_counters_get_t mepa_macsec_tx_sa_counters_get;
     mepa_macsec_rx_sa_counters_get_t mepa_macsec_rx_sa_counters_get;
+    mepa_macsec_secy_counters_snapshot_get_t mepa_macsec_secy_counters_snapshot_get;
     mepa_macsec_control_frame_match_conf_set_t mepa_macsec_control_frame_match_conf_set;
     mepa_macsec_control_frame_match_conf_del_t mepa_macsec_control_frame_match_conf_del;
     mepa_macsec_control_frame_match_conf_get_t mepa_macsec_control_frame_match_conf_get;
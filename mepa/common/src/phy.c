@@ -1957,6 +1957,21 @@ mepa_rc mepa_macsec_rx_sa_counters_get(struct mepa_device *dev,
     return dev->drv->mepa_macsec->mepa_macsec_rx_sa_counters_get(dev, port, sci, an, counters);
 }
 
+mepa_rc mepa_macsec_secy_counters_snapshot_get(struct mepa_device *dev,
+                                               const mepa_macsec_port_t port,
+                                               mepa_macsec_secy_counters_snapshot_t *const snapshot)
+{
+    if (!dev->drv->mepa_macsec) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    if (!dev->drv->mepa_macsec->mepa_macsec_secy_counters_snapshot_get) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    return dev->drv->mepa_macsec->mepa_macsec_secy_counters_snapshot_get(dev, port, snapshot);
+}
+
 mepa_rc mepa_macsec_control_frame_match_conf_set(struct mepa_device *dev,
                                                  const mepa_port_no_t port_no,
                                                  const mepa_macsec_control_frame_match_conf_t *const conf,
@@ -100,6 +100,42 @@ typedef mepa_rc (*mepa_miim_write_t)(struct mepa_callout_ctx         *ctx,
                                      const uint16_t                   value);
 
 
+/** \brief MDIO operation type used by mepa_mdio_xfer_t */
+typedef enum {
+    MEPA_MDIO_OP_MIIM_READ,  /**< Clause 22 read  */
+    MEPA_MDIO_OP_MIIM_WRITE, /**< Clause 22 write */
+    MEPA_MDIO_OP_MMD_READ,   /**< Clause 45 read  */
+    MEPA_MDIO_OP_MMD_WRITE,  /**< Clause 45 write */
+} mepa_mdio_op_type_t;
+
+/** \brief Single MDIO operation in a batch */
+typedef struct {
+    mepa_mdio_op_type_t type;  /**< Operation type */
+    uint8_t             mmd;   /**< MMD device (clause 45 only) */
+    uint16_t            addr;  /**< Register address */
+    uint16_t            value; /**< Value to write, or value read on return */
+} mepa_mdio_op_t;
+
+/**
+ * \brief MDIO batch transfer function.
+ *
+ * Executes a list of MDIO operations in order, e.g. as one queued bus
+ * transaction. The read values are returned in the 'value' field of the
+ * corresponding operations. Processing stops at the first failing operation.
+ *
+ * \param ctx   [IN]     Pointer to a callout structure.
+ * \param ops   [IN/OUT] List of operations.
+ * \param cnt   [IN]     Number of operations.
+ *
+ * \return
+ *   MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *   MEPA_RC_OK on success.
+ **/
+typedef mepa_rc (*mepa_mdio_xfer_t)(struct mepa_callout_ctx         *ctx,
+                                    mepa_mdio_op_t                  *const ops,
+                                    const uint32_t                   cnt);
+
+
 typedef void (*mepa_trace_func_t)(const mepa_trace_data_t *data, va_list args);
 typedef void *(*mepa_mem_alloc_t)(struct mepa_callout_ctx *ctx, size_t size);
 typedef void (*mepa_mem_free_t)(struct mepa_callout_ctx *ctx, void *ptr);
@@ -128,6 +164,9 @@ typedef struct mepa_callout {
 
     mepa_mem_alloc_t       mem_alloc;
     mepa_mem_free_t        mem_free;
+
+    // Optional. When NULL, batches are executed as single MIIM/MMD accesses.
+    mepa_mdio_xfer_t       mdio_xfer;
 } mepa_callout_t;
 
 struct vtss_state_s;
@@ -789,6 +789,24 @@ mepa_rc mepa_macsec_rx_sa_counters_get(struct mepa_device *dev,
                                        const uint16_t an,
                                        mepa_macsec_rx_sa_counters_t *const counters);
 
+/** \brief Counters of a SecY with all its SCs and SAs */
+typedef struct {
+    mepa_macsec_secy_counters_t  secy;                                      /**< SecY counters */
+    mepa_macsec_tx_sc_counters_t tx_sc;                                     /**< Tx SC counters */
+    mepa_macsec_tx_sa_counters_t tx_sa[MEPA_MACSEC_SA_PER_SC_MAX];          /**< Tx SA counters, indexed by AN */
+    uint32_t                     rx_sc_cnt;                                 /**< Number of valid entries in rx_sci, rx_sc and rx_sa */
+    mepa_macsec_sci_t            rx_sci[MEPA_MACSEC_MAX_SC_RX];             /**< SCI of each Rx SC */
+    mepa_macsec_rx_sc_counters_t rx_sc[MEPA_MACSEC_MAX_SC_RX];              /**< Rx SC counters */
+    mepa_macsec_rx_sa_counters_t rx_sa[MEPA_MACSEC_MAX_SC_RX][MEPA_MACSEC_SA_PER_SC_MAX]; /**< Rx SA counters, indexed by Rx SC and AN */
+} mepa_macsec_secy_counters_snapshot_t;
+
+/** SecY, SC and SA counters in one call.
+ *  The SecY counters are updated once for all SCs and SAs instead of once per SC/SA get.
+ */
+mepa_rc mepa_macsec_secy_counters_snapshot_get(struct mepa_device *dev,
+                                               const mepa_macsec_port_t port,
+                                               mepa_macsec_secy_counters_snapshot_t *const snapshot);
+
 /*--------------------------------------------------------------------*/
 /* VP / Uncontrolled classification                                   */
 /*--------------------------------------------------------------------*/
@@ -107,6 +107,9 @@ typedef struct {
     uint32_t    egr_frm_mod_cnt;      /**< No of frames modified by timestamp block (rewritter) in egress */
     uint32_t    ts_fifo_tx_cnt;       /**< the number of timestamps transmitted to the interface */
     uint32_t    ts_fifo_drop_cnt;     /**< Count of dropped Timestamps not enqueued to the Tx TSFIFO */
+    uint32_t    ts_fifo_hwm;          /**< Highest Tx TSFIFO level seen when draining the FIFO */
+    uint32_t    ts_fifo_overflow_cnt; /**< Number of Tx TSFIFO overflow events seen by event poll */
+    uint32_t    ts_fifo_partial_cnt;  /**< Number of partial timestamps discarded when draining the FIFO */
 } mepa_ts_stats_t;
 
 /** \brief Local TIME Counter Load/Save Enable commands */
@@ -1027,6 +1027,22 @@ vtss_rc vtss_macsec_rx_sa_counters_get(const vtss_inst_t            inst,
                                        const u16                    an,
                                        vtss_macsec_rx_sa_counters_t *const counters);
 
+typedef mepa_macsec_secy_counters_snapshot_t vtss_macsec_secy_counters_snapshot_t;
+
+/** \brief SecY counters with the counters of all its SCs and SAs
+ *
+ * The SecY counters are updated once, instead of once per SC/SA get.
+ *
+ * \param inst         [IN]     VTSS-API instance.
+ * \param port         [IN]     MacSec port.
+ * \param snapshot     [OUT]    SecY, SC and SA counters
+ *
+ * \return VTSS_RC_OK when successful; VTSS_RC_ERROR if parameters are invalid.
+ */
+vtss_rc vtss_macsec_secy_counters_snapshot_get(const vtss_inst_t                    inst,
+                                               const vtss_macsec_port_t             port,
+                                               vtss_macsec_secy_counters_snapshot_t *const snapshot);
+
 /*--------------------------------------------------------------------*/
 /* VP / Uncontrolled classification                                   */
 /*--------------------------------------------------------------------*/
@@ -1508,6 +1508,9 @@ typedef struct {
     u32    egr_frm_mod_cnt;       /**< No of frames modified by timestamp block (rewritter) in egress */
     u32    ts_fifo_tx_cnt;        /**< the number of timestamps transmitted to the interface */
     u32    ts_fifo_drop_cnt;      /**< Count of dropped Timestamps not enqueued to the Tx TSFIFO */
+    u32    ts_fifo_hwm;           /**< Highest Tx TSFIFO level seen when draining the FIFO */
+    u32    ts_fifo_overflow_cnt;  /**< Number of Tx TSFIFO overflow events seen by event poll */
+    u32    ts_fifo_partial_cnt;   /**< Number of partial timestamps discarded when draining the FIFO */
 } vtss_phy_ts_stats_t;
 
 /**
@@ -510,6 +510,24 @@ typedef vtss_rc (*vtss_mmd_write_t)(const vtss_inst_t    inst,
                                     const u16            addr,
                                     const u16            value);
 
+/** \brief MDIO batch operation */
+typedef mepa_mdio_op_t vtss_mdio_op_t;
+
+/**
+ * \brief MDIO batch transfer function
+ *
+ * \param inst [IN]    Target instance reference.
+ * \param port_no [IN] Port number
+ * \param ops [IN/OUT] List of operations, read values are returned in place
+ * \param cnt [IN]     Number of operations
+ *
+ * \return Return code, VTSS_RC_NOT_IMPLEMENTED if batching is not supported.
+ **/
+typedef vtss_rc (*vtss_mdio_xfer_t)(const vtss_inst_t    inst,
+                                    const vtss_port_no_t port_no,
+                                    vtss_mdio_op_t       *const ops,
+                                    const u32            cnt);
+
 #if defined(VTSS_FEATURE_WARM_START)
 /** \brief Restart information source */
 typedef enum {
@@ -584,6 +602,7 @@ typedef struct {
     vtss_mmd_read_t          mmd_read;          /**< MMD management read function */
     vtss_mmd_read_inc_t      mmd_read_inc;      /**< MMD management read increment function */
     vtss_mmd_write_t         mmd_write;         /**< MMD management write function */
+    vtss_mdio_xfer_t         mdio_xfer;         /**< MDIO batch transfer function (optional) */
     vtss_spi_read_write_t    spi_read_write;    /**< Board specific SPI read/write callout function */
     vtss_spi_32bit_read_write_t spi_32bit_read_write; /**< Board specific SPI read/write callout function for 32 bit data */
     vtss_spi_64bit_read_write_t spi_64bit_read_write; /**< Board specific SPI read/write callout function for 64 bit data*/
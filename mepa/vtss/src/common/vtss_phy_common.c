@@ -541,6 +541,45 @@ ioreg_blk *_ioreg(ioreg_blk *io, u16 dev, BOOL is32, u32 off)
     return io;
 }
 #endif
+// Execute a list of MDIO operations, using the batch callout when available.
+// Falls back to one MIIM/MMD access per operation.
+vtss_rc vtss_phy_mdio_xfer(vtss_state_t *vtss_state, vtss_port_no_t port_no, vtss_mdio_op_t *ops, u32 cnt)
+{
+    vtss_rc rc;
+    u32     i;
+
+    if (cnt == 0) {
+        return VTSS_RC_OK;
+    }
+    if (vtss_state->init_conf.mdio_xfer != NULL) {
+        rc = vtss_state->init_conf.mdio_xfer(vtss_state, port_no, ops, cnt);
+        if (rc != VTSS_RC_NOT_IMPLEMENTED) {
+            return rc;
+        }
+    }
+
+    for (i = 0; i < cnt; i++) {
+        switch (ops[i].type) {
+        case MEPA_MDIO_OP_MIIM_READ:
+            VTSS_RC(vtss_state->init_conf.miim_read(vtss_state, port_no, (u8)ops[i].addr, &ops[i].value));
+            break;
+        case MEPA_MDIO_OP_MIIM_WRITE:
+            VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, port_no, (u8)ops[i].addr, ops[i].value));
+            break;
+        case MEPA_MDIO_OP_MMD_READ:
+            VTSS_RC(vtss_state->init_conf.mmd_read(vtss_state, port_no, ops[i].mmd, ops[i].addr, &ops[i].value));
+            break;
+        case MEPA_MDIO_OP_MMD_WRITE:
+            VTSS_RC(vtss_state->init_conf.mmd_write(vtss_state, port_no, ops[i].mmd, ops[i].addr, ops[i].value));
+            break;
+        default:
+            VTSS_E("port_no: %u, invalid MDIO op type: %d", port_no, ops[i].type);
+            return VTSS_RC_ERROR;
+        }
+    }
+    return VTSS_RC_OK;
+}
+
 vtss_rc phy_type_get(vtss_state_t *vtss_state,
                         const vtss_port_no_t port_no, BOOL *const clause45)
 {
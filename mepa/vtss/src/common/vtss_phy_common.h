@@ -108,6 +108,13 @@ vtss_rc get_base_adr(vtss_state_t *vtss_state, vtss_port_no_t port_no, u32 dev,
 vtss_rc phy_type_get(vtss_state_t *vtss_state,
                      const vtss_port_no_t port_no, BOOL *const clause45);
 
+/* Execute a list of MDIO operations, batched if the application supports it */
+vtss_rc vtss_phy_mdio_xfer(vtss_state_t *vtss_state, vtss_port_no_t port_no, vtss_mdio_op_t *ops, u32 cnt);
+
+/* Helpers for building vtss_phy_mdio_xfer() operation lists */
+#define VTSS_MDIO_OP_RD(op, reg)      { (op)->type = MEPA_MDIO_OP_MIIM_READ; (op)->mmd = 0; (op)->addr = (reg); (op)->value = 0; }
+#define VTSS_MDIO_OP_WR(op, reg, val) { (op)->type = MEPA_MDIO_OP_MIIM_WRITE; (op)->mmd = 0; (op)->addr = (reg); (op)->value = (val); }
+
 /** \brief PHY Packet Counters */
 typedef struct vtss_statistic_t_ {
 #if defined(VTSS_CHIP_CU_PHY)
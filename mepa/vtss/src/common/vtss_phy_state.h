@@ -359,6 +359,13 @@ typedef struct {
 } vtss_phy_ts_new_spi_conf_t;
 #endif /* defined(VTSS_CHIP_CU_PHY) && defined(VTSS_PHY_TS_SPI_CLK_THRU_PPS0) */
 
+/* Tx TSFIFO drain counters */
+typedef struct {
+    u32                              hwm;          /* Highest TSFIFO level seen when draining */
+    u32                              overflow_cnt; /* TSFIFO overflow events seen by event poll */
+    u32                              partial_cnt;  /* Partial timestamps discarded */
+} vtss_phy_ts_fifo_cnt_t;
+
 typedef struct {
     BOOL                             port_ts_init_done; /* PHY TS init done */
     BOOL                             eng_init_done; /* 1588 TS engine init done */
@@ -375,6 +382,7 @@ typedef struct {
     vtss_phy_ts_8487_xaui_sel_t      xaui_sel_8487; /* 8487 XAUI Lane selection */
     vtss_phy_ts_fifo_sig_mask_t      sig_mask;  /* FIFO signature */
     u32                              fifo_age;  /* SW TSFIFO age in milli-sec */
+    vtss_phy_ts_fifo_cnt_t           fifo_cnt;  /* Tx TSFIFO drain counters */
     vtss_timeinterval_t              ingress_latency;
     vtss_timeinterval_t              egress_latency;
     vtss_timeinterval_t              path_delay;
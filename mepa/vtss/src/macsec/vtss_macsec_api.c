@@ -303,6 +303,19 @@ static BOOL phy_is_1g(vtss_state_t *vtss_state, vtss_port_no_t port_no)
     return !clause45;
 }
 
+/* Rx SCs to walk on a port, bounded by the size of the SecY Rx SC table */
+static u32 macsec_max_sc_rx(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    u32 max_sc_rx = VTSS_MACSEC_1G_MAX_SC_RX;
+
+#if defined(VTSS_CHIP_10G_PHY)
+    if (!phy_is_1g(vtss_state, port_no)) {
+        max_sc_rx = VTSS_MACSEC_10G_MAX_SC_RX;
+    }
+#endif
+    return (max_sc_rx > VTSS_MACSEC_MAX_SC_RX ? VTSS_MACSEC_MAX_SC_RX : max_sc_rx);
+}
+
 static BOOL is_reg_32(u32 dev, u32 addr)
 {
     if (dev == 1) {
@@ -792,6 +805,9 @@ static BOOL macsec_secy_in_use_inter_getnext(vtss_state_t        *vtss_state,
         max_secy = VTSS_MACSEC_10G_MAX_SECY;
 #endif
     }
+    if (max_secy > VTSS_MACSEC_MAX_SECY) {
+        max_secy = VTSS_MACSEC_MAX_SECY;
+    }
 
     for (i = in_use_inter->next_index; i < max_secy; i++) {
         in_use_inter->next_index++;
@@ -3701,10 +3717,10 @@ static vtss_rc vtss_macsec_tx_sa_del_priv(vtss_state_t              *vtss_state,
     return VTSS_RC_OK;
 }
 
-static vtss_rc vtss_macsec_secy_counters_get_priv(vtss_state_t                  *vtss_state,
-                                                  const vtss_port_no_t          port_no,
-                                                  vtss_macsec_secy_counters_t   *const counters,
-                                                  u32                           secy_id)
+// Read the SA counters of a SecY and update its software counters
+static vtss_rc vtss_macsec_secy_sa_counters_update(vtss_state_t          *vtss_state,
+                                                   const vtss_port_no_t  port_no,
+                                                   u32                   secy_id)
 {
     u16 an;
     vtss_macsec_internal_secy_t *secy = &vtss_state->macsec_conf[port_no].secy[secy_id];
@@ -3715,7 +3731,6 @@ static vtss_rc vtss_macsec_secy_counters_get_priv(vtss_state_t
     u64 out_pkts_encrypt = 0;
     u64 in_ok_pkts = 0;
     u64 out_ok_pkts = 0;
-    macsec_secy_in_use_iter_t in_use_inter;
 
     // TX an
     for (an = 0; an < VTSS_MACSEC_SA_PER_SC_MAX; an ++ ) {
@@ -3814,11 +3829,7 @@ static vtss_rc vtss_macsec_secy_counters_get_priv(vtss_state_t
 
     VTSS_N("ev_bit:%d", ev_bit);
 
-    if (phy_is_1g(vtss_state, port_no)) {
-        max_sc_rx = VTSS_MACSEC_1G_MAX_SC_RX;
-    } else {
-        max_sc_rx = VTSS_MACSEC_10G_MAX_SC_RX;
-    }
+    max_sc_rx = macsec_max_sc_rx(vtss_state, port_no);
 
     // RX an
     /* Octets validated are now maintained in respective SC, hence clearing before updation */
@@ -3880,6 +3891,20 @@ static vtss_rc vtss_macsec_secy_counters_get_priv(vtss_state_t
 
     }
 
+    return VTSS_RC_OK;
+}
+
+// Read the global SecY counters and add them to every SecY in use.
+// The counters are cleared on read, so they are read once per port.
+static vtss_rc vtss_macsec_secy_glb_counters_update(vtss_state_t          *vtss_state,
+                                                    const vtss_port_no_t  port_no)
+{
+    vtss_macsec_secy_counters_t glb, *const counters = &glb;
+    macsec_secy_in_use_iter_t   in_use_inter;
+    u64                         cnt;
+
+    memset(counters, 0, sizeof(*counters));
+
     // in_pkts_no_sci
     MACSEC_CNT64_RD(port_no,
                     VTSS_MACSEC_INGR_GLOBAL_STATS_IGR_IN_PKTS_NO_SCI_LOWER,
@@ -3947,11 +3972,33 @@ static vtss_rc vtss_macsec_secy_counters_get_priv(vtss_state_t
         vtss_state->macsec_conf[port_no].secy[in_use_inter.secy_id].secy_cnt.in_pkts_untagged += counters->in_pkts_untagged;
         vtss_state->macsec_conf[port_no].secy[in_use_inter.secy_id].secy_cnt.in_pkts_overrun += counters->in_pkts_overrun;
     }
-    memcpy(counters, &vtss_state->macsec_conf[port_no].secy[secy_id].secy_cnt, sizeof(*counters));
+    return VTSS_RC_OK;
+}
 
+static vtss_rc vtss_macsec_secy_counters_get_priv(vtss_state_t                  *vtss_state,
+                                                  const vtss_port_no_t          port_no,
+                                                  vtss_macsec_secy_counters_t   *const counters,
+                                                  u32                           secy_id)
+{
+    VTSS_RC(vtss_macsec_secy_sa_counters_update(vtss_state, port_no, secy_id));
+    VTSS_RC(vtss_macsec_secy_glb_counters_update(vtss_state, port_no));
+    memcpy(counters, &vtss_state->macsec_conf[port_no].secy[secy_id].secy_cnt, sizeof(*counters));
     return VTSS_RC_OK;
 }
 
+// Update the software counters of all SecYs on a port, reading each hardware counter once
+static vtss_rc vtss_macsec_secy_all_counters_update(vtss_state_t          *vtss_state,
+                                                    const vtss_port_no_t  port_no)
+{
+    macsec_secy_in_use_iter_t in_use_inter;
+
+    macsec_secy_in_use_inter_init(&in_use_inter);
+    while (macsec_secy_in_use_inter_getnext(vtss_state, port_no, &in_use_inter)) {
+        VTSS_RC(vtss_macsec_secy_sa_counters_update(vtss_state, port_no, in_use_inter.secy_id));
+    }
+    return vtss_macsec_secy_glb_counters_update(vtss_state, port_no);
+}
+
 static vtss_rc vtss_macsec_secy_cnt_update(vtss_state_t             *vtss_state,
                                            const vtss_port_no_t     port_no,
                                            u32                      secy_id)
@@ -3965,42 +4012,22 @@ static vtss_rc vtss_macsec_secy_cnt_update(vtss_state_t             *vtss_state,
 }
 
 
-static vtss_rc vtss_macsec_rx_sa_counters_get_priv(vtss_state_t                 *vtss_state,
-                                                   const vtss_port_no_t         port_no,
-                                                   const vtss_macsec_sci_t      *const sci,
-                                                   const u16                    an,
-                                                   vtss_macsec_rx_sa_counters_t *const counters,
-                                                   u32                          secy_id)
+// Read the counters of an Rx SA in use and update its software counters.
+// The OK packets and octets counters are read by vtss_macsec_secy_sa_counters_update(),
+// which must be called first, so each counter is read once.
+static vtss_rc vtss_macsec_rx_sa_cnt_update(vtss_state_t         *vtss_state,
+                                            const vtss_port_no_t port_no,
+                                            u32                  secy_id,
+                                            u32                  sc,
+                                            const u16            an)
 {
     vtss_macsec_internal_secy_t *secy = &vtss_state->macsec_conf[port_no].secy[secy_id];
-    u32 sc;
     u32 record;
     u64 cnt;
-    BOOL ev_bit = FALSE;
-    u16  txan;
-    u64 in_ok_pkts = 0;
-    memset(counters, 0, sizeof(vtss_macsec_rx_sa_counters_t));
-
-    // Update the counter for this secy_id
-    VTSS_RC(vtss_macsec_secy_cnt_update(vtss_state, port_no, secy_id));
-
-    VTSS_RC(sc_from_sci_get(vtss_state, port_no, secy, sci, &sc));
-
-    if (secy->rx_sc[sc] == NULL || !secy->rx_sc[sc]->in_use || secy->rx_sc[sc]->sa[an] == NULL || !secy->rx_sc[sc]->sa[an]->in_use) {
-        return VTSS_RC_OK;
-    }
 
     VTSS_MACSEC_ASSERT(secy->rx_sc[sc] == NULL, "SC does not exist");
     VTSS_MACSEC_ASSERT(secy->rx_sc[sc]->sa[an] == NULL, "AN does not exist");
     record = secy->rx_sc[sc]->sa[an]->record;
-    MACSEC_CNT64_RD(port_no,
-                    VTSS_MACSEC_INGR_SA_STATS_IGR_IN_PKTS_OK_LOWER(record),
-                    VTSS_MACSEC_INGR_SA_STATS_IGR_IN_PKTS_OK_UPPER(record),
-                    cnt);
-
-    secy->rx_sc[sc]->sa[an]->cnt.in_pkts_ok += cnt;
-    in_ok_pkts = cnt;
-    VTSS_N("cnt:%" PRIu64 ", record:%u", cnt, record);
 
     MACSEC_CNT64_RD(port_no,
                     VTSS_MACSEC_INGR_SA_STATS_IGR_IN_PKTS_INVALID_LOWER(record),
@@ -4052,36 +4079,6 @@ static vtss_rc vtss_macsec_rx_sa_counters_get_priv(vtss_state_t
     secy->rx_sc[sc]->sa[an]->cnt.in_pkts_late += cnt;
     VTSS_D("rx_sa_counters.in_pkts_late:%" PRIu64 "", secy->rx_sc[sc]->sa[an]->cnt.in_pkts_late);
 
-    /* Update SC Specific  counters */
-
-    MACSEC_CNT64_RD(port_no,
-                    VTSS_MACSEC_INGR_SA_STATS_IGR_IN_OCTETS_DECRYPTED_FIRST_CNTR_LOWER(record),
-                    VTSS_MACSEC_INGR_SA_STATS_IGR_IN_OCTETS_DECRYPTED_FIRST_CNTR_UPPER(record),
-                    cnt);
-
-    txan = secy->tx_sc.status.encoding_sa;
-
-    if ((secy->tx_sc.in_use) && (secy->tx_sc.sa[txan] != NULL)) {
-        ev_bit = secy->tx_sc.sa[txan]->confidentiality;
-    }
-
-    if (secy->conf.validate_frames != VTSS_MACSEC_VALIDATE_FRAMES_DISABLED && !ev_bit) {
-        secy->rx_sc[sc]->cnt.in_octets_validated += cnt;
-    }
-
-    if (secy->conf.validate_frames != VTSS_MACSEC_VALIDATE_FRAMES_DISABLED && ev_bit) {
-        if (cnt > (in_ok_pkts * secy->conf.confidentiality_offset)) {
-            secy->rx_sc[sc]->cnt.in_octets_decrypted += cnt - (in_ok_pkts * secy->conf.confidentiality_offset);
-            secy->rx_sc[sc]->cnt.in_octets_validated += in_ok_pkts * secy->conf.confidentiality_offset;
-        } else {
-            secy->rx_sc[sc]->cnt.in_octets_validated += cnt;
-        }
-    }
-
-    if (vtss_state->macsec_conf[port_no].glb.macsec_revb == TRUE &&
-        secy->conf.validate_frames == VTSS_MACSEC_VALIDATE_FRAMES_DISABLED) {
-        secy->rx_sc[sc]->in_octets_validation_disabled += cnt;
-    }
     /* Rx Unicast, multicast and broadcast counters are available only for Rev B*/
     if (vtss_state->macsec_conf[port_no].glb.macsec_revb == TRUE) {
         MACSEC_CNT64_RD(port_no, VTSS_MACSEC_INGR_SA_STATS_IGR_IN_UNICAST_PKTS_LOWER(record),
@@ -4094,27 +4091,47 @@ static vtss_rc vtss_macsec_rx_sa_counters_get_priv(vtss_state_t
                         VTSS_MACSEC_INGR_SA_STATS_IGR_IN_BROADCAST_PKTS_UPPER(record), cnt);
         secy->controlled_cnt.if_in_broadcast_pkts += cnt;
     }
-    // Pass the counters
-    memcpy(counters, &secy->rx_sc[sc]->sa[an]->cnt, sizeof(vtss_macsec_rx_sa_counters_t));
     return VTSS_RC_OK;
 }
 
-// ** RX_SC counters **
-static vtss_rc vtss_macsec_rx_sc_counters_get_priv(vtss_state_t                    *vtss_state,
-                                                   const vtss_port_no_t            port_no,
-                                                   const vtss_macsec_sci_t         *const sci,
-                                                   vtss_macsec_rx_sc_counters_t    *const counters,
-                                                   u32                              secy_id)
+static vtss_rc vtss_macsec_rx_sa_counters_get_priv(vtss_state_t                 *vtss_state,
+                                                   const vtss_port_no_t         port_no,
+                                                   const vtss_macsec_sci_t      *const sci,
+                                                   const u16                    an,
+                                                   vtss_macsec_rx_sa_counters_t *const counters,
+                                                   u32                          secy_id)
 {
+    vtss_macsec_internal_secy_t *secy = &vtss_state->macsec_conf[port_no].secy[secy_id];
     u32 sc;
-    u32 an;
 
-    vtss_macsec_internal_secy_t *secy = &vtss_state->macsec_conf[port_no].secy[secy_id];
-    vtss_macsec_rx_sa_counters_t rx_sa_counters;
+    memset(counters, 0, sizeof(vtss_macsec_rx_sa_counters_t));
+
+    // Update the counter for this secy_id
+    VTSS_RC(vtss_macsec_secy_cnt_update(vtss_state, port_no, secy_id));
 
     VTSS_RC(sc_from_sci_get(vtss_state, port_no, secy, sci, &sc));
 
-    VTSS_MACSEC_ASSERT(secy->rx_sc[sc] == NULL, "SC does not exist");
+    if (secy->rx_sc[sc] == NULL || !secy->rx_sc[sc]->in_use || secy->rx_sc[sc]->sa[an] == NULL || !secy->rx_sc[sc]->sa[an]->in_use) {
+        return VTSS_RC_OK;
+    }
+
+    VTSS_RC(vtss_macsec_rx_sa_cnt_update(vtss_state, port_no, secy_id, sc, an));
+
+    // Pass the counters
+    memcpy(counters, &secy->rx_sc[sc]->sa[an]->cnt, sizeof(vtss_macsec_rx_sa_counters_t));
+    return VTSS_RC_OK;
+}
+
+// Read the counters of the Rx SAs of an SC and update the SC software counters.
+// The SecY counters must be updated by the caller.
+static vtss_rc vtss_macsec_rx_sc_cnt_update(vtss_state_t         *vtss_state,
+                                            const vtss_port_no_t port_no,
+                                            u32                  secy_id,
+                                            u32                  sc)
+{
+    u32 an;
+    vtss_macsec_internal_secy_t  *secy = &vtss_state->macsec_conf[port_no].secy[secy_id];
+    vtss_macsec_rx_sa_counters_t rx_sa_counters;
 
     /* Clear counters maintained in SA's Donot clear Octets counters*/
     secy->rx_sc[sc]->cnt.in_pkts_ok             = 0;
@@ -4131,7 +4148,8 @@ static vtss_rc vtss_macsec_rx_sc_counters_get_priv(vtss_state_t
             continue;
         }
 
-        VTSS_RC(vtss_macsec_rx_sa_counters_get_priv(vtss_state, port_no, sci, an, &rx_sa_counters, secy_id));
+        VTSS_RC(vtss_macsec_rx_sa_cnt_update(vtss_state, port_no, secy_id, sc, an));
+        rx_sa_counters = secy->rx_sc[sc]->sa[an]->cnt;
 
         secy->rx_sc[sc]->cnt.in_pkts_ok            += rx_sa_counters.in_pkts_ok;
         secy->rx_sc[sc]->cnt.in_pkts_invalid       += rx_sa_counters.in_pkts_invalid;
@@ -4154,11 +4172,77 @@ static vtss_rc vtss_macsec_rx_sc_counters_get_priv(vtss_state_t
     secy->rx_sc[sc]->cnt.in_pkts_delayed       += secy->rx_sc[sc]->del_rx_sa_cnt.in_pkts_delayed;
     secy->rx_sc[sc]->cnt.in_pkts_late          += secy->rx_sc[sc]->del_rx_sa_cnt.in_pkts_late;
 
+    return VTSS_RC_OK;
+}
+
+// ** RX_SC counters **
+static vtss_rc vtss_macsec_rx_sc_counters_get_priv(vtss_state_t                    *vtss_state,
+                                                   const vtss_port_no_t            port_no,
+                                                   const vtss_macsec_sci_t         *const sci,
+                                                   vtss_macsec_rx_sc_counters_t    *const counters,
+                                                   u32                              secy_id)
+{
+    u32 sc;
+    vtss_macsec_internal_secy_t *secy = &vtss_state->macsec_conf[port_no].secy[secy_id];
+
+    VTSS_RC(sc_from_sci_get(vtss_state, port_no, secy, sci, &sc));
+
+    VTSS_MACSEC_ASSERT(secy->rx_sc[sc] == NULL, "SC does not exist");
+
+    // Update the counter for this secy_id once for all the SAs
+    VTSS_RC(vtss_macsec_secy_cnt_update(vtss_state, port_no, secy_id));
+    VTSS_RC(vtss_macsec_rx_sc_cnt_update(vtss_state, port_no, secy_id, sc));
+
     // Pass the counters
     memcpy(counters, &secy->rx_sc[sc]->cnt, sizeof(vtss_macsec_rx_sc_counters_t));
     return VTSS_RC_OK;
 }
 
+// SecY counters with the counters of all its SCs and SAs
+static vtss_rc vtss_macsec_secy_counters_snapshot_get_priv(vtss_state_t                         *vtss_state,
+                                                           const vtss_port_no_t                 port_no,
+                                                           vtss_macsec_secy_counters_snapshot_t *const snapshot,
+                                                           u32                                  secy_id)
+{
+    vtss_macsec_internal_secy_t *secy = &vtss_state->macsec_conf[port_no].secy[secy_id];
+    u32 sc, an, max_sc_rx, n = 0;
+
+    memset(snapshot, 0, sizeof(*snapshot));
+
+    // The SecY update reads all Tx SA counters and the Rx SA OK packets and octets.
+    // The Tx SC totals are summed from the updated SA counters without reading them again.
+    VTSS_RC(vtss_macsec_secy_counters_get_priv(vtss_state, port_no, &snapshot->secy, secy_id));
+
+    secy->tx_sc.cnt.out_pkts_encrypted = secy->tx_sc.del_tx_sa_cnt.out_pkts_encrypted;
+    secy->tx_sc.cnt.out_pkts_protected = secy->tx_sc.del_tx_sa_cnt.out_pkts_protected;
+    for (an = 0; an < VTSS_MACSEC_SA_PER_SC_MAX; an++) {
+        if (secy->tx_sc.in_use && secy->tx_sc.sa[an] != NULL) {
+            snapshot->tx_sa[an] = secy->tx_sc.sa[an]->cnt;
+            secy->tx_sc.cnt.out_pkts_encrypted += snapshot->tx_sa[an].out_pkts_encrypted;
+            secy->tx_sc.cnt.out_pkts_protected += snapshot->tx_sa[an].out_pkts_protected;
+        }
+    }
+    snapshot->tx_sc = secy->tx_sc.cnt;
+
+    max_sc_rx = macsec_max_sc_rx(vtss_state, port_no);
+    for (sc = 0; sc < max_sc_rx; sc++) {
+        if (secy->rx_sc[sc] == NULL || !secy->rx_sc[sc]->in_use) {
+            continue;
+        }
+        VTSS_RC(vtss_macsec_rx_sc_cnt_update(vtss_state, port_no, secy_id, sc));
+        snapshot->rx_sci[n] = secy->rx_sc[sc]->sci;
+        snapshot->rx_sc[n] = secy->rx_sc[sc]->cnt;
+        for (an = 0; an < VTSS_MACSEC_SA_PER_SC_MAX; an++) {
+            if (secy->rx_sc[sc]->sa[an] != NULL && secy->rx_sc[sc]->sa[an]->in_use) {
+                snapshot->rx_sa[n][an] = secy->rx_sc[sc]->sa[an]->cnt;
+            }
+        }
+        n++;
+    }
+    snapshot->rx_sc_cnt = n;
+    return VTSS_RC_OK;
+}
+
 static vtss_rc vtss_macsec_rx_sa_del_priv(vtss_state_t              *vtss_state,
                                           const u32                 secy_id,
                                           const vtss_macsec_port_t  port,
@@ -5996,11 +6080,12 @@ static vtss_rc vtss_macsec_common_counters_get_priv(vtss_state_t
            port_no, lsb, msb);
 
 
-    macsec_secy_in_use_inter_init(&in_use_inter);
+    // Read the hardware counters of all SecYs in order to update the software counters
+    VTSS_RC(vtss_macsec_secy_all_counters_update(vtss_state, port_no));
 
+    macsec_secy_in_use_inter_init(&in_use_inter);
     while (macsec_secy_in_use_inter_getnext(vtss_state, port_no, &in_use_inter)) {
-        // Call the read of hardware counters in order to update the software counters
-        VTSS_RC(vtss_macsec_secy_counters_get_priv(vtss_state, port_no, &secy_counters, in_use_inter.secy_id));
+        secy_counters = vtss_state->macsec_conf[port_no].secy[in_use_inter.secy_id].secy_cnt;
         /* The below set of 4 counters are read from global registers. So, they are common for all Secys */
         in_pkts_bad_tag = (in_pkts_bad_tag >= secy_counters.in_pkts_bad_tag) ? in_pkts_bad_tag : secy_counters.in_pkts_bad_tag;
         in_pkts_no_sci  = (in_pkts_no_sci >= secy_counters.in_pkts_no_sci) ? in_pkts_no_sci : secy_counters.in_pkts_no_sci;
@@ -6198,20 +6283,11 @@ static vtss_rc vtss_macsec_counters_clear_priv(vtss_state_t                  *vt
 static vtss_rc vtss_macsec_counters_update_priv(vtss_state_t                  *vtss_state,
                                                 const vtss_port_no_t          port_no)
 {
-    macsec_secy_in_use_iter_t in_use_inter;
-
     // Dummy, because are only reading the counters in order to update software counters (read hw
     // counters in order to make sure they don't wraps around)
-    vtss_macsec_secy_counters_t   dummy_counters;
     vtss_macsec_common_counters_t dummy_common_counters;
 
-    macsec_secy_in_use_inter_init(&in_use_inter);
-
-    while (macsec_secy_in_use_inter_getnext(vtss_state, port_no, &in_use_inter)) {
-        // Call the read of hardware counters in order to update the software counters
-        VTSS_RC(vtss_macsec_secy_counters_get_priv(vtss_state, port_no, &dummy_counters, in_use_inter.secy_id));
-    }
-
+    // The common counters are derived from the SecY counters, so this also updates all SecYs
     VTSS_RC(vtss_macsec_common_counters_get_priv(vtss_state, port_no, &dummy_common_counters, FALSE));
 
     return VTSS_RC_OK;
@@ -8715,6 +8791,23 @@ vtss_rc vtss_macsec_rx_sa_counters_get(const vtss_inst_t            inst,
     return rc;
 }
 
+vtss_rc vtss_macsec_secy_counters_snapshot_get(const vtss_inst_t                    inst,
+                                               const vtss_macsec_port_t             port,
+                                               vtss_macsec_secy_counters_snapshot_t *const snapshot)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc rc;
+    u32 secy_id = 0;
+
+    VTSS_D("Port: %u/%u/%u", MACSEC_PORT_ARG(&port));
+    VTSS_ENTER();
+    if ((rc = vtss_macsec_port_check(inst, &vtss_state, port, 0, &secy_id)) == VTSS_RC_OK) {
+        rc = vtss_macsec_secy_counters_snapshot_get_priv(vtss_state, port.port_no, snapshot, secy_id);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 vtss_rc vtss_macsec_control_frame_match_conf_set(const vtss_inst_t                             inst,
                                                  const vtss_port_no_t                          port_no,
                                                  const vtss_macsec_control_frame_match_conf_t *const conf,
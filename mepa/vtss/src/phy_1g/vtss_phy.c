@@ -394,6 +394,25 @@ static vtss_rc vtss_phy_i2c_rd_private(vtss_state_t *vtss_state, vtss_port_no_t
 }
 
 
+// Select a page in the chip, unless the page shadow shows that it is already selected
+static vtss_rc vtss_phy_page_sync(vtss_state_t *vtss_state, const vtss_port_no_t port_no, const u16 page)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    vtss_rc               rc;
+
+    if (ps->page_valid && ps->page == page) {
+        return VTSS_RC_OK;
+    }
+
+    // The page register is unknown until the write has succeeded
+    ps->page_valid = FALSE;
+    if ((rc = vtss_state->init_conf.miim_write(vtss_state, port_no, 31, page)) == VTSS_RC_OK) {
+        ps->page = page;
+        ps->page_valid = TRUE;
+    }
+    return rc;
+}
+
 static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
                                      BOOL                 read,
                                      const vtss_port_no_t port_no,
@@ -401,10 +420,11 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
                                      u16                  *const value,
                                      const u16            mask)
 {
-    vtss_rc           rc = VTSS_RC_OK;
-    vtss_miim_read_t  read_func;
-    vtss_miim_write_t write_func;
-    u16               reg, page, val;
+    vtss_rc               rc = VTSS_RC_OK;
+    vtss_miim_read_t      read_func;
+    vtss_miim_write_t     write_func;
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    u16                   reg, page, val;
 
     /* Setup read/write function pointers */
     read_func = vtss_state->init_conf.miim_read;
@@ -414,9 +434,20 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
     page = (addr >> 5);
     reg = (addr & 0x1f);
 
+    if (page == 0 && reg == 31 && !read && mask == 0xffff) {
+        /* Page selection. Within a page batch it is deferred until the next register access */
+        if (ps->page_batch) {
+            ps->page_want = *value;
+            return VTSS_RC_OK;
+        }
+        return vtss_phy_page_sync(vtss_state, port_no, *value);
+    }
+
     /* Change page */
     if (page) {
-        rc = write_func(vtss_state, port_no, 31, page);
+        rc = vtss_phy_page_sync(vtss_state, port_no, page);
+    } else if (ps->page_batch) {
+        rc = vtss_phy_page_sync(vtss_state, port_no, ps->page_want);
     }
     if (rc == VTSS_RC_OK) {
         if (read) {
@@ -437,16 +468,63 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
             rc = write_func(vtss_state, port_no, reg, *value);
             VTSS_N("Write - port:%d, reg:0x%X, value:0x%X", port_no, reg, *value);
         }
+        if (!read && reg == 31) {
+            /* Masked write of the page register - the page is no longer known */
+            ps->page_valid = FALSE;
+        }
     }
 
-    /* Restore standard page */
+    /* Restore standard page. Within a page batch it is done when the batch ends */
     if (page && rc == VTSS_RC_OK) {
-        rc = write_func(vtss_state, port_no, 31, VTSS_PHY_PAGE_STANDARD);
+        if (ps->page_batch) {
+            ps->page_want = VTSS_PHY_PAGE_STANDARD;
+        } else {
+            rc = vtss_phy_page_sync(vtss_state, port_no, VTSS_PHY_PAGE_STANDARD);
+        }
     }
 
     return rc;
 }
 
+void vtss_phy_page_batch_begin(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    if (ps->page_batch++ == 0) {
+        // Start out with the page that is expected by the code using the batch
+        ps->page_want = (ps->page_valid ? ps->page : VTSS_PHY_PAGE_STANDARD);
+    }
+}
+
+vtss_rc vtss_phy_page_batch_end(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    if (ps->page_batch == 0) {
+        VTSS_E("port_no %u, page batch not started", port_no);
+        return VTSS_RC_ERROR;
+    }
+    if (--ps->page_batch) {
+        return VTSS_RC_OK;
+    }
+    return vtss_phy_page_sync(vtss_state, port_no, VTSS_PHY_PAGE_STANDARD);
+}
+
+vtss_rc vtss_phy_page_select(vtss_state_t *vtss_state, vtss_port_no_t port_no, u16 page)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    if (ps->page_batch) {
+        ps->page_want = page;
+    }
+    return vtss_phy_page_sync(vtss_state, port_no, page);
+}
+
+void vtss_phy_page_shadow_invalidate(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    vtss_state->phy_state[port_no].page_valid = FALSE;
+}
+
 /* Read PHY register - used for legacy code where the programmer keep track of the page.*/
 vtss_rc vtss_phy_rd(vtss_state_t         *vtss_state,
                     const vtss_port_no_t port_no,
@@ -932,6 +1010,7 @@ static vtss_rc vtss_phy_soft_reset_port(vtss_state_t *vtss_state, vtss_port_no_t
             }
         }
         MEPA_MTIMER_CANCEL(&timer);
+        vtss_phy_page_shadow_invalidate(vtss_state, port_no);
         // After reset of a port, we need to re-configure it
         VTSS_RC(vtss_phy_conf_1g_set_private(vtss_state, port_no));
 
@@ -9270,6 +9349,36 @@ static vtss_rc vtss_phy_wait_for_macsec_command_busy(vtss_state_t *vtss_state, c
 }
 
 
+// Issue a MACsec CSR read command (page 19) and fetch the data registers (17/18) in one MDIO batch.
+// The MACsec page must be selected. If 'target' is non-NULL, the target register (page 20) is written first.
+// The data registers are read optimistically; if the command had not completed, they are read again.
+static vtss_rc vtss_phy_macsec_csr_rd_cmd(vtss_state_t         *vtss_state,
+                                          const vtss_port_no_t port_no,
+                                          const u16            *target,
+                                          const u16            cmd,
+                                          u16                  *lsb,
+                                          u16                  *msb)
+{
+    vtss_mdio_op_t ops[5], *op = ops;
+
+    if (target != NULL) {
+        VTSS_MDIO_OP_WR(op, 20, *target);
+        op++;
+    }
+    VTSS_MDIO_OP_WR(op, 19, cmd);
+    VTSS_MDIO_OP_RD(op + 1, 19);
+    VTSS_MDIO_OP_RD(op + 2, 17);
+    VTSS_MDIO_OP_RD(op + 3, 18);
+    VTSS_RC(vtss_phy_mdio_xfer(vtss_state, port_no, ops, (op - ops) + 4));
+    if (!(op[1].value & VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT)) {
+        VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19));
+        VTSS_RC(vtss_phy_mdio_xfer(vtss_state, port_no, op + 2, 2));
+    }
+    *lsb = op[2].value;
+    *msb = op[3].value;
+    return VTSS_RC_OK;
+}
+
 // See vtss_phy_csr_wr
 vtss_rc vtss_phy_1588_csr_wr_private(vtss_state_t         *vtss_state,
                                      const vtss_port_no_t port_no,
@@ -9512,7 +9621,7 @@ vtss_rc vtss_phy_macsec_csr_wr_private(vtss_state_t         *vtss_state,
     u16 reg_value_lower = (value & 0xffff);
     u16 reg_value_upper = (value >> 16);
     u32 target_tmp = 0;
-    //    u16 val;
+    vtss_mdio_op_t ops[5];
 
     // The only ones not accessible in non-MACsec devices are the MACsec ingress and egress blocks at 0x38 and 0x3C (for each port).
     // Everything else is accessible using the so-called macsec_csr_wr/rd functions using registers 17-20 in extended page 4 (as described in PS1046).
@@ -9532,25 +9641,23 @@ vtss_rc vtss_phy_macsec_csr_wr_private(vtss_state_t         *vtss_state,
     // Write the Most Significant Word (MSW) (18)
     // Trigger CSR Action - Write(16) into the CSR's and wait for complete
 
-    // Setup the Target Id
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2))));
-
-    //    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, &val));
-    //    printf("reg20:%x\n",val);
-
     if (target >> 2 == 1 || target >> 2 == 3) {
         target_tmp = target; // non-macsec access
     }
-    // Write the Least Significant Word (LSW) (17)
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_LSB, reg_value_lower));
-    // Write the Most Significant Word (MSW) (18)
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_MSB, reg_value_upper));
-    // Trigger CSR Action - Write into the CSR's and wait for complete
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_19,  VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT |
-                        VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr)));
+
+    // The whole sequence is issued as one MDIO batch, followed by an optimistic completion check
+    VTSS_MDIO_OP_WR(&ops[0], 20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2)));
+    VTSS_MDIO_OP_WR(&ops[1], 17, reg_value_lower);
+    VTSS_MDIO_OP_WR(&ops[2], 18, reg_value_upper);
+    VTSS_MDIO_OP_WR(&ops[3], 19, VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT |
+                    VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr));
+    VTSS_MDIO_OP_RD(&ops[4], 19);
+    VTSS_RC(vtss_phy_mdio_xfer(vtss_state, port_no, ops, 5));
 
     // Wait for the Write to complete
-    VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
+    if (!(ops[4].value & VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT)) {
+        VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
+    }
 
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
     return VTSS_RC_OK;
@@ -9565,6 +9672,7 @@ vtss_rc vtss_phy_macsec_csr_rd_private(vtss_state_t         *vtss_state,
 {
     u16 reg_value_lower;
     u16 reg_value_upper;
+    u16 reg_target;
     u32 target_tmp = 0;
 
     if (!vtss_phy_can(vtss_state, port_no, VTSS_CAP_MACSEC) && (target == 0x38 || target == 0x3C)) {
@@ -9583,24 +9691,16 @@ vtss_rc vtss_phy_macsec_csr_rd_private(vtss_state_t         *vtss_state,
     // Read the Least Significant Word (LSW) (17)
     // Read the Most Significant Word (MSW) (18)
 
-    // Setup the Target Id
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2))));
-
     if (target >> 2 == 1) {
         target_tmp = target & 3; // non-macsec access
     }
 
-    // Trigger CSR Action - Read(16) into the CSR's and wait for complete
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_19,
-                        VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT | VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) |
-                        VTSS_PHY_F_PAGE_MACSEC_19_READ    | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr)));
-
-    VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
-
-    // Read the Least Significant Word (LSW) (17)
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_LSB, &reg_value_lower));
-    // Read the Most Significant Word (MSW) (18)
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_MSB, &reg_value_upper));
+    // Setup the Target Id, trigger the read and fetch LSW/MSW in one MDIO batch
+    reg_target = VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2));
+    VTSS_RC(vtss_phy_macsec_csr_rd_cmd(vtss_state, port_no, &reg_target,
+                                       VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT | VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) |
+                                       VTSS_PHY_F_PAGE_MACSEC_19_READ    | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr),
+                                       &reg_value_lower, &reg_value_upper));
 
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
     *value = (reg_value_upper << 16) | reg_value_lower;
@@ -9618,6 +9718,7 @@ vtss_rc vtss_phy_macsec_csr_rd_64_private(vtss_state_t         *vtss_state,
     u16 reg_value_upper;
     u16 reg_value_lower_1;
     u16 reg_value_upper_1;
+    u16 reg_target;
     u32 target_tmp = 0;
     u64 value_64 = 0;
 
@@ -9639,35 +9740,21 @@ vtss_rc vtss_phy_macsec_csr_rd_64_private(vtss_state_t         *vtss_state,
     // Read the Least Significant Word (LSW) (17)
     // Read the Most Significant Word (MSW) (18)
 
-    // Setup the Target Id
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2))));
-
     if (target >> 2 == 1) {
         target_tmp = target & 3; // non-macsec access
     }
-    // Trigger CSR Action - Read into the CSR's and wait for complete
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_19,
-                        VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT | VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) |
-                        VTSS_PHY_F_PAGE_MACSEC_19_READ    | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr)));
-
-    VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
+    // Setup the Target Id, trigger the read of the lower word and fetch LSW/MSW in one MDIO batch
+    reg_target = VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2));
+    VTSS_RC(vtss_phy_macsec_csr_rd_cmd(vtss_state, port_no, &reg_target,
+                                       VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT | VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) |
+                                       VTSS_PHY_F_PAGE_MACSEC_19_READ    | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr),
+                                       &reg_value_lower, &reg_value_upper));
 
-    // Read the Least Significant Word (LSW) (17)
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_LSB, &reg_value_lower));
-    // Read the Most Significant Word (MSW) (18)
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_MSB, &reg_value_upper));
-
-    // Trigger CSR Action - Read into the CSR's and wait for complete
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_19,
-                        VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT | VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) |
-                        VTSS_PHY_F_PAGE_MACSEC_19_READ    | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr + 1)));
-
-    VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
-
-    // Read the Least Significant Word (LSW) (17)
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_LSB, &reg_value_lower_1));
-    // Read the Most Significant Word (MSW) (18)
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_MSB, &reg_value_upper_1));
+    // Same for the upper word
+    VTSS_RC(vtss_phy_macsec_csr_rd_cmd(vtss_state, port_no, NULL,
+                                       VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT | VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) |
+                                       VTSS_PHY_F_PAGE_MACSEC_19_READ    | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr + 1),
+                                       &reg_value_lower_1, &reg_value_upper_1));
 
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
 
@@ -9768,6 +9855,32 @@ void vtss_phy_reg_decode_status(vtss_port_no_t port_no, u16 lp_auto_neg_advertis
     // Link up/down
     vtss_phy_decode_status_reg(port_no, mii_status_reg, status);
 }
+// Registers fetched in one MDIO batch when polling the status.
+// Register 1 is read twice to get both the latched and the current link state.
+enum {
+    VTSS_PHY_STATUS_PRE_MODE_STATUS,
+    VTSS_PHY_STATUS_PRE_MODE_STATUS_NOW,
+    VTSS_PHY_STATUS_PRE_AUX_CTRL_STATUS,
+    VTSS_PHY_STATUS_PRE_LP_ABILITY,
+    VTSS_PHY_STATUS_PRE_CNT
+};
+
+// Read status register, from the prefetched registers if available
+static vtss_rc vtss_phy_status_rd(vtss_state_t         *vtss_state,
+                                  const vtss_port_no_t port_no,
+                                  const vtss_mdio_op_t *pre,
+                                  const u32            idx,
+                                  const u16            page,
+                                  const u32            addr,
+                                  u16                  *const value)
+{
+    if (pre != NULL) {
+        *value = pre[idx].value;
+        return VTSS_RC_OK;
+    }
+    return vtss_phy_rd_page(vtss_state, port_no, page, addr, value, __LINE__);
+}
+
 vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
                                     const vtss_port_no_t port_no,
                                     vtss_port_status_t   *const status)
@@ -9776,13 +9889,25 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
     u16                   reg, reg10;
     u16                   revision;
     vtss_phy_reset_conf_t *conf = &ps->reset;
+    vtss_mdio_op_t        pre_ops[VTSS_PHY_STATUS_PRE_CNT], *pre = NULL;
     revision = ps->type.revision;
 
         VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
         VTSS_N("vtss_phy_status_get_private, port_no: %u", port_no);
 
+        if (vtss_state->init_conf.mdio_xfer != NULL) {
+            /* Batched MDIO access is available, fetch the status registers in one go */
+            VTSS_RC(vtss_phy_page_select(vtss_state, port_no, VTSS_PHY_PAGE_STANDARD));
+            VTSS_MDIO_OP_RD(&pre_ops[VTSS_PHY_STATUS_PRE_MODE_STATUS], 1);
+            VTSS_MDIO_OP_RD(&pre_ops[VTSS_PHY_STATUS_PRE_MODE_STATUS_NOW], 1);
+            VTSS_MDIO_OP_RD(&pre_ops[VTSS_PHY_STATUS_PRE_AUX_CTRL_STATUS], 28);
+            VTSS_MDIO_OP_RD(&pre_ops[VTSS_PHY_STATUS_PRE_LP_ABILITY], 5);
+            VTSS_RC(vtss_phy_mdio_xfer(vtss_state, port_no, pre_ops, VTSS_PHY_STATUS_PRE_CNT));
+            pre = pre_ops;
+        }
+
         /* Read link status from register 1 */
-        VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MODE_STATUS, &reg));
+        VTSS_RC(vtss_phy_status_rd(vtss_state, port_no, pre, VTSS_PHY_STATUS_PRE_MODE_STATUS, VTSS_PHY_MODE_STATUS, &reg));
         /* Set Link Down Indication based on latched in link_status in Reg01 */
         status->link_down = (reg & (1 << 2) ? 0 : 1);
 
@@ -9792,7 +9917,7 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
 
         if (status->link_down) {
             /* Read status again if link down (latch low field) */
-            VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MODE_STATUS, &reg));
+            VTSS_RC(vtss_phy_status_rd(vtss_state, port_no, pre, VTSS_PHY_STATUS_PRE_MODE_STATUS_NOW, VTSS_PHY_MODE_STATUS, &reg));
             status->link = (reg & (1 << 2) ? 1 : 0);
             VTSS_N("status->link = %d, port = %d, reg = 0x%X", status->link, port_no, reg);
         } else {
@@ -9819,7 +9944,7 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
             switch (setup_mode) {
             case VTSS_PHY_MODE_ANEG:
                 if ((reg & (1 << 5)) == 0) {
-                    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_AUXILIARY_CONTROL_AND_STATUS, &reg));
+                    VTSS_RC(vtss_phy_status_rd(vtss_state, port_no, pre, VTSS_PHY_STATUS_PRE_AUX_CTRL_STATUS, VTSS_PHY_AUXILIARY_CONTROL_AND_STATUS, &reg));
                     status->mdi_cross = ((reg & VTSS_F_PHY_AUXILIARY_CONTROL_AND_STATUS_HP_AUTO_MDIX_CROSSOVER_INDICATION) ? TRUE : FALSE);
                     // Link up can not be trusted if auto-neg has not completed.
                     if ((reg & 0x1b) != 0xa) {
@@ -9835,16 +9960,17 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
                 }
 
                 /* Use register 5 to determine flow control result */
-                VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_AUTONEGOTIATION_LINK_PARTNER_ABILITY, &reg));
+                VTSS_RC(vtss_phy_status_rd(vtss_state, port_no, pre, VTSS_PHY_STATUS_PRE_LP_ABILITY, VTSS_PHY_AUTONEGOTIATION_LINK_PARTNER_ABILITY, &reg));
                 vtss_phy_flowcontrol_decode_status_private(port_no, reg, ps->setup, status); // Decode type of flow control
 
                 if (ps->family == VTSS_PHY_FAMILY_NONE) {
-                    /* Standard PHY, use register 10 and 5 to determine speed/duplex */
+                    /* Standard PHY, use register 10 and 5 to determine speed/duplex.
+                       Register 10 has clear-on-read fields, so it is not prefetched */
                     VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_1000BASE_T_STATUS, &reg10));
                     vtss_phy_link_speeed_decode_status(port_no, reg10, reg, ps->setup, status);
                 } else {
                     /* Vitesse PHY, use register 28 to determine speed/duplex */
-                    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_AUXILIARY_CONTROL_AND_STATUS, &reg));
+                    VTSS_RC(vtss_phy_status_rd(vtss_state, port_no, pre, VTSS_PHY_STATUS_PRE_AUX_CTRL_STATUS, VTSS_PHY_AUXILIARY_CONTROL_AND_STATUS, &reg));
                     status->mdi_cross = ((reg & VTSS_F_PHY_AUXILIARY_CONTROL_AND_STATUS_HP_AUTO_MDIX_CROSSOVER_INDICATION) ? TRUE : FALSE);
 
                     switch ((reg >> 3) & 0x3) {
@@ -9865,7 +9991,7 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
                 }
                 break;
             case VTSS_PHY_MODE_FORCED:
-                VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_AUXILIARY_CONTROL_AND_STATUS, &reg));
+                VTSS_RC(vtss_phy_status_rd(vtss_state, port_no, pre, VTSS_PHY_STATUS_PRE_AUX_CTRL_STATUS, VTSS_PHY_AUXILIARY_CONTROL_AND_STATUS, &reg));
                 status->mdi_cross = ((reg & VTSS_F_PHY_AUXILIARY_CONTROL_AND_STATUS_HP_AUTO_MDIX_CROSSOVER_INDICATION) ? TRUE : FALSE);
 
                 if (ps->family == VTSS_PHY_FAMILY_NONE) {
@@ -12188,6 +12314,9 @@ vtss_rc vtss_phy_reset(const vtss_inst_t           inst,
     if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
         vtss_state->phy_state[port_no].reset = *conf;
 
+        // The PHY may have been hardware reset since it was last accessed
+        vtss_phy_page_shadow_invalidate(vtss_state, port_no);
+
         /* -- Step 1: Detect PHY type and family -- */
         rc = vtss_phy_detect(vtss_state, port_no);
         if (rc == VTSS_RC_OK) {
@@ -12214,7 +12343,11 @@ vtss_rc vtss_phy_reset(const vtss_inst_t           inst,
         }
 
         if (rc == VTSS_RC_OK) {
+            vtss_phy_page_batch_begin(vtss_state, port_no);
             rc = VTSS_RC_COLD(vtss_phy_reset_private(vtss_state, port_no));
+            if (vtss_phy_page_batch_end(vtss_state, port_no) != VTSS_RC_OK) {
+                rc = VTSS_RC_ERROR;
+            }
         }
     }
     VTSS_EXIT();
@@ -12457,7 +12590,11 @@ vtss_rc vtss_phy_conf_set(const vtss_inst_t     inst,
         if (rc == VTSS_RC_OK) {
 #endif
 
+            vtss_phy_page_batch_begin(vtss_state, port_no);
             rc = VTSS_RC_COLD(vtss_phy_conf_set_private(vtss_state, port_no));
+            if (vtss_phy_page_batch_end(vtss_state, port_no) != VTSS_RC_OK) {
+                rc = VTSS_RC_ERROR;
+            }
 
 #if defined(VTSS_OPT_PHY_TIMESTAMP)
             rc = VTSS_RC_COLD(vtss_phy_ts_bypass_set(vtss_state, port_no, FALSE, FALSE));
@@ -12477,7 +12614,11 @@ vtss_rc vtss_phy_status_get(const vtss_inst_t    inst,
 
     VTSS_ENTER();
     if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        vtss_phy_page_batch_begin(vtss_state, port_no);
         rc = vtss_phy_status_get_private(vtss_state, port_no, status);
+        if (vtss_phy_page_batch_end(vtss_state, port_no) != VTSS_RC_OK) {
+            rc = VTSS_RC_ERROR;
+        }
     }
     VTSS_EXIT();
     return rc;
@@ -13610,14 +13751,11 @@ static void vtss_phy_deb_pr_reg (vtss_state_t *vtss_state, const vtss_debug_prin
                                  u16 page, u16 addr, const char *name, u16 *value)
 {
 
-    vtss_miim_read_t miim_read_fn = vtss_state->init_conf.miim_read;
-    vtss_miim_write_t miim_write_fn = vtss_state->init_conf.miim_write;
-
     /* Change page */
     if (page) {
-        miim_write_fn(vtss_state, port_no, 31, page);
+        (void)vtss_phy_wr(vtss_state, port_no, 31, page);
     }
-    miim_read_fn(vtss_state, port_no, addr, value);
+    (void)vtss_phy_rd(vtss_state, port_no, addr, value);
     pr("%-45s:  0x%02x   0x%04x     0x%08x\n", name, page, addr, *value);
 
 }
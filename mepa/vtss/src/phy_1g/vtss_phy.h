@@ -146,6 +146,12 @@ typedef struct _vtss_phy_port_state_info_t {
     BOOL                   warm_start_reg_changed;
     u16                    mac_block_mtu; /* MAC Block MTU  */
     u16                    forced_long_linkup_counter;    /* Delay for Forced Mode Work-Around for Forced Mode Long Linkup Time issue  */
+
+    // Shadow of the page register (register 31), used for skipping page selections that are already in place.
+    BOOL                   page_valid; /* The page shadow matches the chip. Cleared when the page register is unknown */
+    u16                    page;       /* Page currently selected in the chip */
+    u16                    page_want;  /* Page selected within a page batch. Written to the chip on the next register access */
+    u8                     page_batch; /* Page batch nesting level, see vtss_phy_page_batch_begin() */
 } vtss_phy_port_state_t;
 
 #define MAX_REGISTERS_PER_PAGE  32
@@ -263,6 +269,17 @@ vtss_rc vtss_phy_page_test(struct vtss_state_s *vtss_state, vtss_port_no_t port_
 vtss_rc vtss_phy_page_tr(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
 vtss_rc vtss_phy_page_0x2daf(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
 
+// Page batch. Within a batch, page selections are deferred until the next register access and the
+// standard page is restored only once, when the outermost batch ends.
+void    vtss_phy_page_batch_begin(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
+vtss_rc vtss_phy_page_batch_end(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
+
+// Select a page in the chip immediately, also within a page batch. For code accessing the page registers directly through the MIIM callouts
+vtss_rc vtss_phy_page_select(struct vtss_state_s *vtss_state, vtss_port_no_t port_no, u16 page);
+
+// Must be called when the page register may have been changed without using the vtss_phy_page_xxx/vtss_phy_rd/vtss_phy_wr functions (e.g. after a reset)
+void    vtss_phy_page_shadow_invalidate(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
+
 vtss_rc vtss_phy_reset_private(struct vtss_state_s *vtss_state, const vtss_port_no_t port_no);
 vtss_rc vtss_phy_sync(struct vtss_state_s *vtss_state, const vtss_port_no_t port_no);
 
@@ -10,6 +10,7 @@
 #include "vtss_phy_api.h"
 
 #if defined(VTSS_OPT_PHY_TIMESTAMP)
+#include <stddef.h>
 #include "../common/vtss_phy_common.h"
 #include "vtss_phy_ts_api.h"
 #include "vtss_phy_ts.h"
@@ -86,6 +87,9 @@
 
 #define VTSS_PHY_TS_WRITE_CSR(p, b, a, v) vtss_phy_ts_write_csr(vtss_state, p , b, a, v)
 
+/* Max number of consecutive CSRs read by vtss_phy_ts_read_csr_bulk() */
+#define VTSS_PHY_TS_CSR_BULK_MAX 8
+
 
 #define VTSS_PHY_TS_TIME_INTERVAL_ADJUST_16(ti) \
                       ((ti & 0xffff0000) >> 16)
@@ -963,11 +967,17 @@ static vtss_rc vtss_phy_ts_biu_address_map_get(
     return rc;
 }
 
-vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
-                             const vtss_port_no_t port_no,
-                             const vtss_phy_ts_blk_id_t blk_id,
-                             const u16 csr_address,
-                             u32 *const value)
+/* Read 'cnt' consecutive CSRs starting at 'csr_address'.
+ * The registers are read in ascending order, as required by e.g. the Tx TSFIFO.
+ * Over MDIO, each register is read with one MDIO batch (1G) or all registers with one incrementing MMD read (10G).
+ * The reads stop at the first error, so a failing read does not pop a TSFIFO entry.
+ */
+static vtss_rc vtss_phy_ts_read_csr_bulk(vtss_state_t *vtss_state,
+                                         const vtss_port_no_t port_no,
+                                         const vtss_phy_ts_blk_id_t blk_id,
+                                         const u16 csr_address,
+                                         u32 *const value,
+                                         const u32 cnt)
 {
     u32                        phy_type = 0;
     u16                        device_feature_status = 0;
@@ -980,7 +990,12 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
     BOOL                       spi_access = FALSE;
     BOOL                       gen = FALSE;
     BOOL                       support = FALSE;
+    u32                        i;
 
+    if (cnt == 0 || cnt > VTSS_PHY_TS_CSR_BULK_MAX) {
+        VTSS_E("port_no %u, invalid CSR count: %u", port_no, cnt);
+        return VTSS_RC_ERROR;
+    }
     VTSS_RC(vtss_phy_ts_is_1588_supported(vtss_state, port_no, &gen, &support));
     if (gen) {
         spi_access = vtss_state->init_conf.spi_32bit_read_write || vtss_state->init_conf.spi_read_write;
@@ -1023,7 +1038,7 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
         u32                 reg_value32;
         vtss_mmd_read_t     mmd_read_func = vtss_state->init_conf.mmd_read;
         vtss_mmd_read_inc_t mmd_read_inc_func = vtss_state->init_conf.mmd_read_inc;
-        u16                 reg_values[2];
+        u16                 reg_values[2 * VTSS_PHY_TS_CSR_BULK_MAX];
         u16                 mmd_addr = 0;
         u16                 reg_addr = 0;
 
@@ -1058,16 +1073,20 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
         mmd_addr = biu_addr_map_ptr->mmd_addr;
         /* [15..0] bits Address */
         if (spi_access == TRUE) {
-            reg_addr = biu_addr_map_ptr->mdio_address[actual_blk_id] | (csr_address);
-            if (vtss_state->init_conf.spi_32bit_read_write != NULL) {
-                VTSS_RC(vtss_state->init_conf.spi_32bit_read_write(vtss_state, cfg_port, 1, (u8)mmd_addr, (u16)reg_addr, value));
-            } else if (vtss_state->init_conf.spi_read_write != NULL) {
-                VTSS_RC(vtss_phy_10g_spi_read_write(vtss_state, cfg_port, 1, (u8)mmd_addr, (u16)reg_addr, value));
+            for (i = 0; i < cnt; i++) {
+                reg_addr = biu_addr_map_ptr->mdio_address[actual_blk_id] | (csr_address + i);
+                if (vtss_state->init_conf.spi_32bit_read_write != NULL) {
+                    VTSS_RC(vtss_state->init_conf.spi_32bit_read_write(vtss_state, cfg_port, 1, (u8)mmd_addr, (u16)reg_addr, &value[i]));
+                } else if (vtss_state->init_conf.spi_read_write != NULL) {
+                    VTSS_RC(vtss_phy_10g_spi_read_write(vtss_state, cfg_port, 1, (u8)mmd_addr, (u16)reg_addr, &value[i]));
+                }
             }
         } else {
             reg_addr = biu_addr_map_ptr->mdio_address[actual_blk_id] | (csr_address << 1);
-            VTSS_RC(mmd_read_inc_func(vtss_state, cfg_port, mmd_addr, reg_addr, reg_values, 2));
-            *value = reg_values[0] + (((u32)reg_values[1]) << 16);
+            VTSS_RC(mmd_read_inc_func(vtss_state, cfg_port, mmd_addr, reg_addr, reg_values, 2 * cnt));
+            for (i = 0; i < cnt; i++) {
+                value[i] = reg_values[2 * i] + (((u32)reg_values[2 * i + 1]) << 16);
+            }
         }
         break;
     }
@@ -1079,7 +1098,7 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
     case VTSS_PHY_TYPE_8254:
     case VTSS_PHY_TYPE_8258: {  /*TBD:For 1588 Target add and device ID same, so no separate case*/
         vtss_mmd_read_inc_t mmd_read_inc_func = vtss_state->init_conf.mmd_read_inc;
-        u16                 reg_values[2];
+        u16                 reg_values[2 * VTSS_PHY_TS_CSR_BULK_MAX];
         u16                 mmd_addr = 0;
         u16                 reg_addr = 0;
         if (!clause45) {
@@ -1091,17 +1110,21 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
          */
         mmd_addr = biu_addr_map_ptr->mmd_addr;
         if (spi_access == TRUE) {
-            reg_addr = biu_addr_map_ptr->mdio_address[actual_blk_id] | (csr_address);
-            if (vtss_state->init_conf.spi_32bit_read_write != NULL) {
-                VTSS_RC(vtss_state->init_conf.spi_32bit_read_write(vtss_state, cfg_port, 1, (u8)mmd_addr, (u16)reg_addr, value));
-            } else if (vtss_state->init_conf.spi_read_write != NULL) {
-                VTSS_RC(vtss_phy_10g_spi_read_write(vtss_state, cfg_port, 1, (u8)mmd_addr, (u16)reg_addr, value));
+            for (i = 0; i < cnt; i++) {
+                reg_addr = biu_addr_map_ptr->mdio_address[actual_blk_id] | (csr_address + i);
+                if (vtss_state->init_conf.spi_32bit_read_write != NULL) {
+                    VTSS_RC(vtss_state->init_conf.spi_32bit_read_write(vtss_state, cfg_port, 1, (u8)mmd_addr, (u16)reg_addr, &value[i]));
+                } else if (vtss_state->init_conf.spi_read_write != NULL) {
+                    VTSS_RC(vtss_phy_10g_spi_read_write(vtss_state, cfg_port, 1, (u8)mmd_addr, (u16)reg_addr, &value[i]));
+                }
             }
         } else {
             /* [15..0] bits Address */
             reg_addr = biu_addr_map_ptr->mdio_address[actual_blk_id] | (csr_address << 1);
-            VTSS_RC(mmd_read_inc_func(vtss_state, cfg_port, mmd_addr, reg_addr, reg_values, 2));
-            *value = reg_values[0] + (((u32)reg_values[1]) << 16);
+            VTSS_RC(mmd_read_inc_func(vtss_state, cfg_port, mmd_addr, reg_addr, reg_values, 2 * cnt));
+            for (i = 0; i < cnt; i++) {
+                value[i] = reg_values[2 * i] + (((u32)reg_values[2 * i + 1]) << 16);
+            }
         }
         break;
     }
@@ -1115,9 +1138,8 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
     case VTSS_PHY_TYPE_8586: {
         u16                reg_value;
         u16                max_read;
-        u16                reg_value_upper, reg_value_lower;
+        vtss_mdio_op_t     ops[4];
         vtss_miim_read_t   miim_read_func = vtss_state->init_conf.miim_read;
-        vtss_miim_write_t  miim_write_func = vtss_state->init_conf.miim_write;
 
         /* Assume it is 1G or clause 22 Register Access */
         /* Command Execution : Enable the Extended Page Register
@@ -1144,41 +1166,56 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
         }
 #endif /* VTSS_FEATURE_PTP_DELAY_COMP_ENGINE */
         if (spi_access == TRUE) {
-            if (vtss_state->init_conf.spi_32bit_read_write != NULL) {
-                VTSS_RC(vtss_state->init_conf.spi_32bit_read_write(vtss_state, cfg_port, 1, (actual_blk_id + 8), (u16)csr_address, value));
-            } else if (vtss_state->init_conf.spi_read_write != NULL) {
-                VTSS_RC(vtss_phy_1g_spi_read_write(vtss_state, cfg_port, 0, 1, (actual_blk_id + 8), (u16)csr_address, value));
+            for (i = 0; i < cnt; i++) {
+                if (vtss_state->init_conf.spi_32bit_read_write != NULL) {
+                    VTSS_RC(vtss_state->init_conf.spi_32bit_read_write(vtss_state, cfg_port, 1, (actual_blk_id + 8), (u16)(csr_address + i), &value[i]));
+                } else if (vtss_state->init_conf.spi_read_write != NULL) {
+                    VTSS_RC(vtss_phy_1g_spi_read_write(vtss_state, cfg_port, 0, 1, (actual_blk_id + 8), (u16)(csr_address + i), &value[i]));
+                }
             }
 //            VTSS_D("Read CSR: port %u, blk_id %d, adr %x, value %x", port_no, blk_id, csr_address, *value);
         } else {
             /* 1588 - Page Selection */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
-
-            reg_value = (VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD  |
-                         VTSS_PHY_TS_1G_BIU_ADDR_REG_READ_CMD |
-                         (actual_blk_id << 11) | csr_address);
-            /* Write the reg_value which contains the read/write operation, target
-             * Id and the CSR register address to register 16
-             */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_BIU_ADDR_REG, reg_value));
-
-            reg_value = 0;
-            max_read = 0;
-            do {
-                max_read++;
-                VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_BIU_ADDR_REG, &reg_value));
-            } while ((!(reg_value & VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD)) && (max_read < VTSS_PHY_TS_1G_REG_READ_MAX_CNT));
-            /* Read the upper word (upper 16 bits) from register 18
-             */
-            VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, &reg_value_upper));
-            /* Read the lower word (lower 16 bits) from register 17
-             */
-            VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_LOWER, &reg_value_lower));
+            VTSS_RC(vtss_phy_page_select(vtss_state, cfg_port, VTSS_PHY_PAGE_1588));
+
+            for (i = 0; i < cnt; i++) {
+                reg_value = (VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD  |
+                             VTSS_PHY_TS_1G_BIU_ADDR_REG_READ_CMD |
+                             (actual_blk_id << 11) | (csr_address + i));
+                /* Write the reg_value which contains the read/write operation, target
+                 * Id and the CSR register address to register 16, check for completion
+                 * and read the upper/lower word from register 18/17.
+                 * The accesses for one register are handled in one MDIO batch, as the
+                 * command normally completes before the status is read back.
+                 * Each register is checked before the next one is read, as reading
+                 * e.g. the last TSFIFO register pops the entry.
+                 */
+                VTSS_MDIO_OP_WR(&ops[0], VTSS_PHY_TS_1G_BIU_ADDR_REG, reg_value);
+                VTSS_MDIO_OP_RD(&ops[1], VTSS_PHY_TS_1G_BIU_ADDR_REG);
+                VTSS_MDIO_OP_RD(&ops[2], VTSS_PHY_TS_1G_CSR_DATA_UPPER);
+                VTSS_MDIO_OP_RD(&ops[3], VTSS_PHY_TS_1G_CSR_DATA_LOWER);
+                VTSS_RC(vtss_phy_mdio_xfer(vtss_state, cfg_port, ops, 4));
+
+                reg_value = ops[1].value;
+                if (!(reg_value & VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD)) {
+                    /* Not done yet, poll and read the data words again */
+                    max_read = 1;
+                    while ((!(reg_value & VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD)) && (max_read < VTSS_PHY_TS_1G_REG_READ_MAX_CNT)) {
+                        max_read++;
+                        VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_BIU_ADDR_REG, &reg_value));
+                    }
+                    if (!(reg_value & VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD)) {
+                        VTSS_E("port_no %u, CSR 0x%x read not completed", port_no, csr_address + i);
+                        return VTSS_RC_ERROR;
+                    }
+                    VTSS_RC(vtss_phy_mdio_xfer(vtss_state, cfg_port, &ops[2], 2));
+                }
+                value[i] = (((u32)ops[2].value << 16) | ops[3].value);
+            }
             /* Restore standard page
              */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, VTSS_PHY_PAGE_STANDARD));
+            VTSS_RC(vtss_phy_page_select(vtss_state, cfg_port, VTSS_PHY_PAGE_STANDARD));
 
-            *value = ((reg_value_upper << 16) | reg_value_lower);
 //            VTSS_D("Read CSR: port %u, blk_id %d, adr %x, value %x", port_no, blk_id, csr_address, *value);
         }
         break;
@@ -1188,10 +1225,21 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
         return VTSS_RC_ERROR;
     }
 
-    VTSS_D("RD port %u, base port %u 1588 reg 0x%04x on block %u  = 0x%08x\n",port_no, cfg_port, csr_address, actual_blk_id, *value);
+    for (i = 0; i < cnt; i++) {
+        VTSS_D("RD port %u, base port %u 1588 reg 0x%04x on block %u  = 0x%08x\n",port_no, cfg_port, csr_address + i, actual_blk_id, value[i]);
+    }
     return VTSS_RC_OK;
 }
 
+vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
+                             const vtss_port_no_t port_no,
+                             const vtss_phy_ts_blk_id_t blk_id,
+                             const u16 csr_address,
+                             u32 *const value)
+{
+    return vtss_phy_ts_read_csr_bulk(vtss_state, port_no, blk_id, csr_address, value, 1);
+}
+
 vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
                               const vtss_port_no_t port_no,
                               const vtss_phy_ts_blk_id_t blk_id,
@@ -1380,6 +1428,7 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
         u16                reg_value;
         u16                base_reg_value;
         BOOL               base_reg_update;
+        vtss_mdio_op_t     ops[4], *op;
         vtss_miim_read_t   miim_read_func = vtss_state->init_conf.miim_read;
         vtss_miim_write_t  miim_write_func = vtss_state->init_conf.miim_write;
 
@@ -1417,11 +1466,14 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
             base_reg_value = 0;
             base_reg_update = FALSE;
             /* Read basepage Reg-18 */
+            VTSS_RC(vtss_phy_page_select(vtss_state, cfg_port, VTSS_PHY_PAGE_STANDARD));
             VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, &base_reg_value));
 
             /* 1588 - Page Selection */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
+            VTSS_RC(vtss_phy_page_select(vtss_state, cfg_port, VTSS_PHY_PAGE_1588));
 
+            /* The data words, the command and the first completion check are issued as one MDIO batch */
+            op = ops;
             /* Write the upper word data (upper 16 bits) to register 18 */
             if ((blk_id == 6 || blk_id == 7) && (csr_address == 0x10 ||
                                                  csr_address == 0x2e || csr_address == 0x4e ||
@@ -1430,13 +1482,16 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
                     VTSS_D("Ignore upper value for blk_id %d, csr_address %x", blk_id, csr_address);
                 } else {
                     base_reg_update = TRUE;
-                    VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, reg_value_upper));
+                    VTSS_MDIO_OP_WR(op, VTSS_PHY_TS_1G_CSR_DATA_UPPER, reg_value_upper);
+                    op++;
                 }
             } else {
-                VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, reg_value_upper));
+                VTSS_MDIO_OP_WR(op, VTSS_PHY_TS_1G_CSR_DATA_UPPER, reg_value_upper);
+                op++;
             }
             /* Write the lower word data (lower 16 bits) to register 17 */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_LOWER, reg_value_lower));
+            VTSS_MDIO_OP_WR(op, VTSS_PHY_TS_1G_CSR_DATA_LOWER, reg_value_lower);
+            op++;
 
             reg_value = (VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD  |
                          VTSS_PHY_TS_1G_BIU_ADDR_REG_WRITE_CMD |
@@ -1444,17 +1499,20 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
             /* Write the reg_value which contains the read/write operation, target
              * Id and the CSR register address to register 16.
              */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_BIU_ADDR_REG, reg_value));
-
-            reg_value = 0;
-            max_read  = 0;
-            do {
+            VTSS_MDIO_OP_WR(op, VTSS_PHY_TS_1G_BIU_ADDR_REG, reg_value);
+            op++;
+            VTSS_MDIO_OP_RD(op, VTSS_PHY_TS_1G_BIU_ADDR_REG);
+            VTSS_RC(vtss_phy_mdio_xfer(vtss_state, cfg_port, ops, (op - ops) + 1));
+
+            reg_value = op->value;
+            max_read  = 1;
+            while ((!(reg_value & VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD)) && (max_read < VTSS_PHY_TS_1G_REG_READ_MAX_CNT)) {
                 max_read++;
                 VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_BIU_ADDR_REG, &reg_value));
-            } while ((!(reg_value & VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD)) && (max_read < VTSS_PHY_TS_1G_REG_READ_MAX_CNT));
+            }
 
             /* Restore standard page */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, VTSS_PHY_PAGE_STANDARD));
+            VTSS_RC(vtss_phy_page_select(vtss_state, cfg_port, VTSS_PHY_PAGE_STANDARD));
             if (base_reg_update != FALSE) {
                 VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, base_reg_value));
             }
@@ -1849,7 +1907,7 @@ static vtss_rc vtss_phy_ts_block_init(vtss_state_t *vtss_state, const vtss_port_
     case VTSS_PHY_TYPE_8586:
         /* initial setup of extended register 29 and 30 in 1588 extended page */
         /* 1588 - Page Selection */
-        VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, base_port_no, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
+        VTSS_RC(vtss_phy_page_select(vtss_state, base_port_no, VTSS_PHY_PAGE_1588));
         /* Write the lower word data to register 29 */
         VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, base_port_no, 29, 0x7ae0));
         /* Write the upper word data to register 30 */
@@ -3781,7 +3839,7 @@ static vtss_rc vtss_phy_ts_csr_event_poll_priv(vtss_state_t *vtss_state,
                                                const vtss_port_no_t  port_no,
                                                vtss_phy_ts_event_t   *const status)
 {
-    u32 mask, pending;
+    u32 mask, pending, overflow, clear;
 
     *status = 0;
     /* read the sticky bits */
@@ -3814,9 +3872,15 @@ static vtss_rc vtss_phy_ts_csr_event_poll_priv(vtss_state_t *vtss_state,
     mask = vtss_state->phy_ts_port_conf[port_no].egr_reg_mask;
     VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
                                  VTSS_PTP_EGR_IP_1588_CFG_STAT_EGR_INT_STATUS, &pending));
+    /* TSFIFO overflows are counted and cleared, also when the event is not enabled */
+    overflow = (pending & VTSS_F_PTP_EGR_IP_1588_CFG_STAT_EGR_INT_STATUS_EGR_TS_OVERFLOW_STICKY);
+    if (overflow) {
+        vtss_state->phy_ts_port_conf[port_no].fifo_cnt.overflow_cnt++;
+    }
     pending &= mask;    /* Only event on enabled sources */
+    clear = (pending | overflow);
     VTSS_RC(VTSS_PHY_TS_WRITE_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                  VTSS_PTP_EGR_IP_1588_CFG_STAT_EGR_INT_STATUS, &pending));
+                                  VTSS_PTP_EGR_IP_1588_CFG_STAT_EGR_INT_STATUS, &clear));
 
     /* egress interrupt mask register */
     if (pending & VTSS_F_PTP_EGR_IP_1588_CFG_STAT_EGR_INT_MASK_EGR_ANALYZER_ERROR_MASK) {
@@ -3888,6 +3952,9 @@ static vtss_rc vtss_phy_ts_stats_get_priv(vtss_state_t *vtss_state,
     VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
                                  VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_DROP_CNT, &value));
     statistics->ts_fifo_drop_cnt = value;
+    statistics->ts_fifo_hwm = vtss_state->phy_ts_port_conf[port_no].fifo_cnt.hwm;
+    statistics->ts_fifo_overflow_cnt = vtss_state->phy_ts_port_conf[port_no].fifo_cnt.overflow_cnt;
+    statistics->ts_fifo_partial_cnt = vtss_state->phy_ts_port_conf[port_no].fifo_cnt.partial_cnt;
     return VTSS_RC_OK;
 }
 
@@ -4303,8 +4370,98 @@ static vtss_rc vtss_phy_ts_signature_set_priv(vtss_state_t *vtss_state,
 
 #define VTSS_PHY_TS_EXTRACT_BYTE(value,pos) ((value & ((u32)0xff << pos)) >> pos)
 
+/* Tx TSFIFO entry size in bytes [10 Ts Bytes + 16 Signature Bytes] */
+#define VTSS_PHY_TS_FIFO_ENTRY_LEN 26
+
+/* Signature field decoding */
+typedef enum {
+    VTSS_PHY_TS_SIG_FLD_U8,        /* Single byte */
+    VTSS_PHY_TS_SIG_FLD_NIBBLE,    /* Lower nibble of a byte */
+    VTSS_PHY_TS_SIG_FLD_U16,       /* 16 bit value, LSB first */
+    VTSS_PHY_TS_SIG_FLD_U32,       /* 32 bit value, LSB first */
+    VTSS_PHY_TS_SIG_FLD_BYTES,     /* Byte array in FIFO order */
+    VTSS_PHY_TS_SIG_FLD_BYTES_REV, /* Byte array in reverse FIFO order */
+} vtss_phy_ts_sig_fld_type_t;
+
+typedef struct {
+    vtss_phy_ts_fifo_sig_mask_t mask;   /* Signature mask bit */
+    vtss_phy_ts_sig_fld_type_t  type;   /* Decoding */
+    u8                          len;    /* Length in the FIFO entry */
+    u8                          offset; /* Offset in vtss_phy_ts_fifo_sig_t */
+} vtss_phy_ts_sig_fld_t;
+
+/* Signature fields in the order they follow the timestamp in a Tx TSFIFO entry */
+static const vtss_phy_ts_sig_fld_t vtss_phy_ts_sig_fld[] = {
+    {VTSS_PHY_TS_FIFO_SIG_SEQ_ID,         VTSS_PHY_TS_SIG_FLD_U16,       VTSS_PHY_TS_SIG_SEQUENCE_ID_LEN,    offsetof(vtss_phy_ts_fifo_sig_t, sequence_id)},
+    {VTSS_PHY_TS_FIFO_SIG_SOURCE_PORT_ID, VTSS_PHY_TS_SIG_FLD_BYTES_REV, VTSS_PHY_TS_SIG_SOURCE_PORT_ID_LEN, offsetof(vtss_phy_ts_fifo_sig_t, src_port_identity)},
+    {VTSS_PHY_TS_FIFO_SIG_DOMAIN_NUM,     VTSS_PHY_TS_SIG_FLD_U8,        1,                                  offsetof(vtss_phy_ts_fifo_sig_t, domain_num)},
+    {VTSS_PHY_TS_FIFO_SIG_MSG_TYPE,       VTSS_PHY_TS_SIG_FLD_NIBBLE,    1,                                  offsetof(vtss_phy_ts_fifo_sig_t, msg_type)},
+    {VTSS_PHY_TS_FIFO_SIG_DEST_IP,        VTSS_PHY_TS_SIG_FLD_U32,       VTSS_PHY_TS_SIG_DEST_IP_LEN,        offsetof(vtss_phy_ts_fifo_sig_t, dest_ip)},
+    {VTSS_PHY_TS_FIFO_SIG_SRC_IP,         VTSS_PHY_TS_SIG_FLD_U32,       VTSS_PHY_TS_SIG_SRC_IP_LEN,         offsetof(vtss_phy_ts_fifo_sig_t, src_ip)},
+    {VTSS_PHY_TS_FIFO_SIG_DEST_MAC,       VTSS_PHY_TS_SIG_FLD_BYTES,     VTSS_PHY_TS_SIG_DEST_MAC_LEN,       offsetof(vtss_phy_ts_fifo_sig_t, dest_mac)},
+};
+
+/* Decode timestamp and signature from a Tx TSFIFO entry */
+static void vtss_phy_ts_fifo_entry_decode(const u8                          *entry,
+                                          const vtss_phy_ts_fifo_sig_mask_t sig_mask,
+                                          vtss_phy_timestamp_t              *const ts,
+                                          vtss_phy_ts_fifo_sig_t            *const signature)
+{
+    const vtss_phy_ts_sig_fld_t *fld;
+    const u8                    *src;
+    u8                          *dst;
+    u32                         i, j, pos;
+
+    memset(signature, 0, sizeof(*signature));
+    memset(ts, 0, sizeof(*ts));
+    ts->nanoseconds = (entry[3] << 24) | (entry[2] << 16) | (entry[1] << 8) | entry[0];
+    ts->seconds.low = (entry[7] << 24) | (entry[6] << 16) | (entry[5] << 8) | entry[4];
+    ts->seconds.high = (entry[9] << 8) | entry[8];
+
+    signature->sig_mask = sig_mask;
+    pos = VTSS_PHY_TS_SIG_TIME_STAMP_LEN;
+    for (i = 0; i < VTSS_ARRSZ(vtss_phy_ts_sig_fld); i++) {
+        fld = &vtss_phy_ts_sig_fld[i];
+        if (!(sig_mask & fld->mask)) {
+            continue;
+        }
+        if ((pos + fld->len) > VTSS_PHY_TS_FIFO_ENTRY_LEN) {
+            /* Signature is limited to 16 bytes when configured */
+            break;
+        }
+        src = &entry[pos];
+        dst = (u8 *)signature + fld->offset;
+        switch (fld->type) {
+        case VTSS_PHY_TS_SIG_FLD_U8:
+            *dst = src[0];
+            break;
+        case VTSS_PHY_TS_SIG_FLD_NIBBLE:
+            *dst = (src[0] & 0x0f);
+            break;
+        case VTSS_PHY_TS_SIG_FLD_U16:
+            *(u16 *)dst = (src[1] << 8) | src[0];
+            break;
+        case VTSS_PHY_TS_SIG_FLD_U32:
+            *(u32 *)dst = (src[3] << 24) | (src[2] << 16) | (src[1] << 8) | src[0];
+            break;
+        case VTSS_PHY_TS_SIG_FLD_BYTES:
+            for (j = 0; j < fld->len; j++) {
+                dst[j] = src[j];
+            }
+            break;
+        case VTSS_PHY_TS_SIG_FLD_BYTES_REV:
+            for (j = 0; j < fld->len; j++) {
+                dst[j] = src[fld->len - 1 - j];
+            }
+            break;
+        }
+        pos += fld->len;
+    }
+}
+
 /*
  * TS FIFO service algorithm: 2R TSFIFO_0 with optimization as par TIMM algorithm
+ * TSFIFO_1 to TSFIFO_6 are read using one bulk CSR access per entry.
  */
 static vtss_rc vtss_phy_ts_fifo_empty_priv(const vtss_inst_t inst,
                                            vtss_state_t *vtss_state,
@@ -4313,14 +4470,15 @@ static vtss_rc vtss_phy_ts_fifo_empty_priv(const vtss_inst_t inst,
     u32   value = 0;
     u32   loop_cnt = 5;
     u32   depth = 0;
-    u8    sig[26], id_cnt = 0;
+    u32   fifo[6], i;
+    u8    sig[VTSS_PHY_TS_FIFO_ENTRY_LEN];
     BOOL  entry_found = FALSE;
     vtss_rc rc = VTSS_RC_OK;
-    u32    pos = 0;
     vtss_phy_timestamp_t        ts;
     vtss_phy_ts_fifo_sig_mask_t sig_mask;
     vtss_phy_ts_fifo_sig_t      signature;
     vtss_phy_ts_fifo_status_t   status = VTSS_PHY_TS_FIFO_SUCCESS;
+    vtss_phy_ts_fifo_cnt_t      *fifo_cnt = &vtss_state->phy_ts_port_conf[port_no].fifo_cnt;
     u32   val_1st = 0, val_2nd = 0;
 
     vtss_phy_ts_fifo_read cb;
@@ -4349,9 +4507,15 @@ static vtss_rc vtss_phy_ts_fifo_empty_priv(const vtss_inst_t inst,
     } while (loop_cnt > 0);
 
     if (entry_found) {
+        /* The FIFO level is highest before the first entry is popped */
+        VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
+                                     VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_CSR, &value));
+        depth = VTSS_X_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_CSR_EGR_TS_LEVEL(value);
+        if (depth > fifo_cnt->hwm) {
+            fifo_cnt->hwm = depth;
+        }
         do {
             value = 0;
-            pos = 0;
             /* Step 2:: Read the TSFIFO_0 register again to get valid timestamp[15:0] data and valid flags[2:0] data */
             VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
                                          VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_0, &value));
@@ -4360,137 +4524,34 @@ static vtss_rc vtss_phy_ts_fifo_empty_priv(const vtss_inst_t inst,
                 break;
             }
 
+            /* Step 3:: Read the TSFIFO_1 to TSFIFO_6 registers to get valid timestamp[207:16] data;
+                        must always read the TSFIFO_6 register and it must be read last */
+            VTSS_RC(vtss_phy_ts_read_csr_bulk(vtss_state, port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
+                                              VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_1, fifo, 6));
+
             if (VTSS_X_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_0_EGR_TS_FLAGS(value) != 7) {
-                /* Partial time stamps are invalid, empty the FIFO */
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_1, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_2, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_3, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_4, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_5, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_6, &value));
+                /* Partial time stamps are invalid, the FIFO entry has been emptied */
+                fifo_cnt->partial_cnt++;
                 break;
             }
-            memset(&signature, 0, sizeof(vtss_phy_ts_fifo_sig_t));
-            memset(&ts, 0, sizeof(vtss_phy_timestamp_t));
 
             /* we only support 26 Byte Timestamp [16 Signature Bytes + 10 Ts Bytes]
              */
-
             sig[1] = (VTSS_X_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_0_EGR_TSFIFO_0(value) & 0xff00) >> 8;
             sig[0] = VTSS_X_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_0_EGR_TSFIFO_0(value) & 0xff;
-            /* Step 3:: Read the TSFIFO_1 to TSFIFO_6 registers to get valid timestamp[207:16] data;
-                        must always read the TSFIFO_6 register and it must be read last */
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_1, &value));
-            sig[2] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[3] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[4] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[5] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_2, &value));
-            sig[6] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[7] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[8] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[9] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_3, &value));
-            sig[10] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[11] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[12] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[13] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_4, &value));
-            sig[14] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[15] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[16] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[17] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_5, &value));
-            sig[18] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[19] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[20] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[21] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_6, &value));
-            sig[22] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[23] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[24] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[25] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
+            for (i = 0; i < 6; i++) {
+                sig[2 + 4 * i] = VTSS_PHY_TS_EXTRACT_BYTE(fifo[i], 0);
+                sig[3 + 4 * i] = VTSS_PHY_TS_EXTRACT_BYTE(fifo[i], 8);
+                sig[4 + 4 * i] = VTSS_PHY_TS_EXTRACT_BYTE(fifo[i], 16);
+                sig[5 + 4 * i] = VTSS_PHY_TS_EXTRACT_BYTE(fifo[i], 24);
+            }
 
             /* Step 4:: Read the TSFIFO_CSR register and check the value of TS_FIFO_LEVEL */
             VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
                                          VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_CSR, &value));
 
             depth = VTSS_X_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_CSR_EGR_TS_LEVEL(value);
-            signature.sig_mask = sig_mask;
-            ts.nanoseconds = (sig[3] << 24) | (sig[2] << 16) | (sig[1] << 8)  | sig[0];
-            ts.seconds.low = (sig[7] << 24) | (sig[6] << 16) | (sig[5] << 8)  | sig[4];
-            ts.seconds.high = (sig[9] << 8) | sig[8];
-
-            pos += VTSS_PHY_TS_SIG_TIME_STAMP_LEN; /* 10 Byte Timestamp length */
-
-            if (sig_mask & VTSS_PHY_TS_FIFO_SIG_SEQ_ID) {
-                VTSS_PHY_TS_ASSERT((pos + VTSS_PHY_TS_SIG_SEQUENCE_ID_LEN) > 26); /* LINT */
-                signature.sequence_id = (sig[pos + 1] << 8) | sig[pos];
-                pos += VTSS_PHY_TS_SIG_SEQUENCE_ID_LEN;
-            }
-
-            if (sig_mask & VTSS_PHY_TS_FIFO_SIG_SOURCE_PORT_ID) {
-                VTSS_PHY_TS_ASSERT((pos + VTSS_PHY_TS_SIG_SOURCE_PORT_ID_LEN) > 26); /* LINT */
-                for (id_cnt = 0; id_cnt <= 9; id_cnt++) { /* 0 - 9, Total 10 Byte Source Port ID */
-                    signature.src_port_identity[id_cnt] = sig[pos + (9 - id_cnt)];
-                }
-                pos += VTSS_PHY_TS_SIG_SOURCE_PORT_ID_LEN;
-            }
-
-            if (sig_mask & VTSS_PHY_TS_FIFO_SIG_DOMAIN_NUM) {
-                VTSS_PHY_TS_ASSERT((pos + 1) > 26); /* LINT */
-                signature.domain_num = sig[pos++];
-            }
-
-            if (sig_mask & VTSS_PHY_TS_FIFO_SIG_MSG_TYPE) {
-                /* message_type field is only the lower nibble
-                 */
-                VTSS_PHY_TS_ASSERT((pos + 1) > 26); /* LINT */
-                signature.msg_type = sig[pos++] & 0x0f;
-            }
-
-            if (sig_mask & VTSS_PHY_TS_FIFO_SIG_DEST_IP) {
-                VTSS_PHY_TS_ASSERT((pos + VTSS_PHY_TS_SIG_DEST_IP_LEN) > 26); /* LINT */
-                signature.dest_ip = (sig[pos + 3] << 24) | (sig[pos + 2] << 16) | (sig[pos + 1] << 8) | sig[pos];
-                pos += VTSS_PHY_TS_SIG_DEST_IP_LEN;
-            }
-
-            if (sig_mask & VTSS_PHY_TS_FIFO_SIG_SRC_IP) {
-                VTSS_PHY_TS_ASSERT((pos + VTSS_PHY_TS_SIG_SRC_IP_LEN) > 26); /* LINT */
-                signature.src_ip = (sig[pos + 3] << 24) | (sig[pos + 2] << 16) | (sig[pos + 1] << 8) | sig[pos];
-                pos += VTSS_PHY_TS_SIG_SRC_IP_LEN;
-            }
-
-            if (sig_mask & VTSS_PHY_TS_FIFO_SIG_DEST_MAC) {
-                VTSS_PHY_TS_ASSERT((pos + VTSS_PHY_TS_SIG_DEST_MAC_LEN) > 26); /* LINT */
-                for (loop_cnt = 0; loop_cnt < VTSS_PHY_TS_SIG_DEST_MAC_LEN; loop_cnt++) {
-                    signature.dest_mac[loop_cnt] = sig[pos + loop_cnt];
-                }
-                pos += VTSS_PHY_TS_SIG_DEST_MAC_LEN;
-            }
+            vtss_phy_ts_fifo_entry_decode(sig, sig_mask, &ts, &signature);
 
             VTSS_D("Time Stamp :: ");
             VTSS_D("    Seconds High :: %x ", ts.seconds.high);
@@ -16886,7 +16947,7 @@ static vtss_rc vtss_phy_ts_block_sync(
         /* initial setup of extended register 29 and 30 in 1588 extended page */
         /* 1588 - Page Selection */
 #ifdef VTSS_CHIP_CU_PHY
-        VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, port_no, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
+        VTSS_RC(vtss_phy_page_select(vtss_state, port_no, VTSS_PHY_PAGE_1588));
         /* Read the lower word data from register 29
          */
         VTSS_RC(vtss_state->init_conf.miim_read(vtss_state, port_no, 29, &reg_value_1));
@@ -63,6 +63,17 @@ static vtss_rc mmd_write(vtss_state_t        *inst,
     return inst->callout[port_no]->mmd_write(inst->callout_ctx[port_no], mmd, addr, value);
 }
 
+static vtss_rc mdio_xfer(vtss_state_t        *inst,
+                         const vtss_port_no_t port_no,
+                         vtss_mdio_op_t       *const ops,
+                         const u32            cnt)
+{
+    if (inst->callout[port_no]->mdio_xfer == NULL) {
+        return VTSS_RC_NOT_IMPLEMENTED;
+    }
+    return inst->callout[port_no]->mdio_xfer(inst->callout_ctx[port_no], ops, cnt);
+}
+
 static void trace_func(const vtss_phy_trace_group_t group,
                        const vtss_phy_trace_level_t level,
                        const char                   *location,
@@ -144,6 +155,12 @@ static mepa_rc mscc_vtss_create(const mepa_callout_t    MEPA_SHARED_PTR *callout
         conf.mmd_read = mmd_read;
         conf.mmd_read_inc = mmd_read_inc;
         conf.mmd_write = mmd_write;
+        // Only hook the batched MDIO access if the callout supports it.
+        // Without the hook, the driver uses the direct register accesses
+        // and does not prefetch status registers that clear on read.
+        if (callout->mdio_xfer != NULL) {
+            conf.mdio_xfer = mdio_xfer;
+        }
         conf.trace_func = trace_func;
 
         // No need for delegate as the callouts are binary compatible
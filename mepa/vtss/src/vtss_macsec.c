@@ -448,6 +448,14 @@ static mepa_rc vtss_phy_macsec_rx_sa_counters_get(struct mepa_device *dev,
     return vtss_macsec_rx_sa_counters_get(data->vtss_instance, port, sci, an, counters);
 }
 
+static mepa_rc vtss_phy_macsec_secy_counters_snapshot_get(struct mepa_device *dev,
+                                                          const mepa_macsec_port_t port,
+                                                          mepa_macsec_secy_counters_snapshot_t *const snapshot)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    return vtss_macsec_secy_counters_snapshot_get(data->vtss_instance, port, snapshot);
+}
+
 static mepa_rc vtss_phy_macsec_control_frame_match_conf_set(struct mepa_device *dev ,
                                                             const mepa_port_no_t port_no,
                                                             const mepa_macsec_control_frame_match_conf_t *const conf,
@@ -924,6 +932,7 @@ mepa_macsec_driver_t vtss_macsec_drivers = {
     .mepa_macsec_tx_sc_counters_get = vtss_phy_macsec_tx_sc_counters_get,
     .mepa_macsec_tx_sa_counters_get = vtss_phy_macsec_tx_sa_counters_get,
     .mepa_macsec_rx_sa_counters_get = vtss_phy_macsec_rx_sa_counters_get,
+    .mepa_macsec_secy_counters_snapshot_get = vtss_phy_macsec_secy_counters_snapshot_get,
     .mepa_macsec_control_frame_match_conf_set = vtss_phy_macsec_control_frame_match_conf_set,
     .mepa_macsec_control_frame_match_conf_del = vtss_phy_macsec_control_frame_match_conf_del,
     .mepa_macsec_control_frame_match_conf_get = vtss_phy_macsec_control_frame_match_conf_get,
@@ -254,6 +254,11 @@ vtss_rc vtss_macsec_rx_sa_counters_get(const vtss_inst_t inst, const vtss_macsec
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_macsec_secy_counters_snapshot_get(const vtss_inst_t inst, const vtss_macsec_port_t port, vtss_macsec_secy_counters_snapshot_t *const snapshot)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_macsec_control_frame_match_conf_set(const vtss_inst_t inst, const vtss_port_no_t port_no, const vtss_macsec_control_frame_match_conf_t *const conf, u32 *const rule_id)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -1096,6 +1096,9 @@ mepa_rc vtss_ts_stats_get(mepa_device_t *dev, mepa_ts_stats_t *const statistics)
         statistics->egr_frm_mod_cnt      = stats.egr_frm_mod_cnt;
         statistics->ts_fifo_tx_cnt       = stats.ts_fifo_tx_cnt;
         statistics->ts_fifo_drop_cnt     = stats.ts_fifo_drop_cnt;
+        statistics->ts_fifo_hwm          = stats.ts_fifo_hwm;
+        statistics->ts_fifo_overflow_cnt = stats.ts_fifo_overflow_cnt;
+        statistics->ts_fifo_partial_cnt  = stats.ts_fifo_partial_cnt;
         return MEPA_RC_OK;
     } else {
         return MEPA_RC_ERROR;
@@ -0,0 +1,188 @@
+// Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+// SPDX-License-Identifier: MIT
+
+/* Counter register access tests for the MACsec API.
+   The MACsec module is included here with its 64-bit counter read replaced by
+   a stub counting the reads of each register.
+   Built by the BUILD_MEPA_VTSS_MACSEC_TEST option and run by ctest. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define _csr_rd_64 macsec_test_csr_rd_64
+#include "../src/macsec/vtss_macsec_api.c"
+
+#if !defined(VTSS_FEATURE_MACSEC) || !defined(VTSS_CHIP_CU_PHY)
+#error "The MACsec counter tests must be built with 1G and MACsec support"
+#endif
+
+#define MACSEC_TEST_PORT   0
+#define MACSEC_TEST_PORT_10G 1
+#define MACSEC_TEST_SECY   0
+#define MACSEC_TEST_TX_SA  2  /* Tx SAs in use */
+#define MACSEC_TEST_RX_SC  4  /* Rx SCs in use */
+#define MACSEC_TEST_RX_SA  2  /* Rx SAs in use per Rx SC */
+#define MACSEC_TEST_RD_MAX 256
+
+#define MACSEC_TEST_TX_SA_RD 3 /* Too long, encrypted and octets per Tx SA */
+#define MACSEC_TEST_RX_SA_RD 9 /* OK, octets and 7 error counters per Rx SA */
+#define MACSEC_TEST_GLB_RD   6 /* Global SecY counters */
+
+typedef struct {
+    u32 mmd;
+    u32 addr;
+    u32 cnt;
+} macsec_test_rd_t;
+
+static macsec_test_rd_t macsec_test_rd[MACSEC_TEST_RD_MAX];
+static u32              macsec_test_rd_cnt;
+static u32              macsec_test_errors;
+
+#define MACSEC_CHECK(expr, ...) do { if (!(expr)) { macsec_test_errors++; printf("%s:%d: ", __FUNCTION__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+/* - Callouts ------------------------------------------------------ */
+
+/* Used by the PHY instance handling, which the tests do not use */
+void *mepa_mem_alloc_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
+                         struct mepa_callout_ctx MEPA_SHARED_PTR *callout_ctx,
+                         size_t                                   size)
+{
+    return calloc(1, size);
+}
+
+void mepa_mem_free_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
+                       struct mepa_callout_ctx MEPA_SHARED_PTR *callout_ctx,
+                       void                                    *ptr)
+{
+    free(ptr);
+}
+
+/* - Register access ----------------------------------------------- */
+
+/* Each counter register reads as one, so a counter read twice is also seen in the totals */
+vtss_rc macsec_test_csr_rd_64(vtss_state_t *vtss_state, vtss_port_no_t port_no, ioreg_blk *reg_low, ioreg_blk *reg_up, u64 *value)
+{
+    u32 i;
+
+    for (i = 0; i < macsec_test_rd_cnt; i++) {
+        if (macsec_test_rd[i].mmd == reg_low->mmd && macsec_test_rd[i].addr == reg_low->addr) {
+            break;
+        }
+    }
+    if (i == MACSEC_TEST_RD_MAX) {
+        return VTSS_RC_ERROR;
+    }
+    if (i == macsec_test_rd_cnt) {
+        macsec_test_rd[i].mmd = reg_low->mmd;
+        macsec_test_rd[i].addr = reg_low->addr;
+        macsec_test_rd_cnt++;
+    }
+    macsec_test_rd[i].cnt++;
+    *value = 1;
+    return VTSS_RC_OK;
+}
+
+static void macsec_test_rd_clear(void)
+{
+    memset(macsec_test_rd, 0, sizeof(macsec_test_rd));
+    macsec_test_rd_cnt = 0;
+}
+
+static u32 macsec_test_rd_total(void)
+{
+    u32 i, total = 0;
+
+    for (i = 0; i < macsec_test_rd_cnt; i++) {
+        MACSEC_CHECK(macsec_test_rd[i].cnt == 1, "register 0x%02x:0x%04x read %u times",
+                     macsec_test_rd[i].mmd, macsec_test_rd[i].addr, macsec_test_rd[i].cnt);
+        total += macsec_test_rd[i].cnt;
+    }
+    return total;
+}
+
+/* - Tests --------------------------------------------------------- */
+
+/* A port with one SecY, its Tx SAs and Rx SCs with their Rx SAs */
+static void macsec_test_state_init(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    vtss_macsec_internal_conf_t *conf = &vtss_state->macsec_conf[port_no];
+    vtss_macsec_internal_secy_t *secy = &conf->secy[MACSEC_TEST_SECY];
+    u32                         an, sc, record = 0;
+
+    secy->in_use = TRUE;
+    secy->conf.validate_frames = VTSS_MACSEC_VALIDATE_FRAMES_STRICT;
+    secy->tx_sc.in_use = TRUE;
+    for (an = 0; an < MACSEC_TEST_TX_SA; an++) {
+        conf->tx_sa[an].in_use = TRUE;
+        conf->tx_sa[an].record = an;
+        secy->tx_sc.sa[an] = &conf->tx_sa[an];
+    }
+    for (sc = 0; sc < MACSEC_TEST_RX_SC; sc++) {
+        conf->rx_sc[sc].in_use = TRUE;
+        conf->rx_sc[sc].sci.port_id = sc + 1;
+        secy->rx_sc[sc] = &conf->rx_sc[sc];
+        for (an = 0; an < MACSEC_TEST_RX_SA; an++, record++) {
+            conf->rx_sa[record].in_use = TRUE;
+            conf->rx_sa[record].record = record;
+            conf->rx_sc[sc].sa[an] = &conf->rx_sa[record];
+        }
+    }
+}
+
+/* A snapshot reads each SA counter once and sums the SC totals from them */
+static vtss_rc macsec_test_snapshot(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    vtss_macsec_secy_counters_snapshot_t snapshot;
+    u32                                  sc, total;
+
+    macsec_test_rd_clear();
+    VTSS_RC(vtss_macsec_secy_counters_snapshot_get_priv(vtss_state, port_no, &snapshot, MACSEC_TEST_SECY));
+    total = macsec_test_rd_total();
+    MACSEC_CHECK(total == (MACSEC_TEST_TX_SA * MACSEC_TEST_TX_SA_RD + MACSEC_TEST_RX_SC * MACSEC_TEST_RX_SA * MACSEC_TEST_RX_SA_RD + MACSEC_TEST_GLB_RD),
+                 "%u counter reads", total);
+    MACSEC_CHECK(snapshot.tx_sc.out_pkts_protected == MACSEC_TEST_TX_SA, "tx_sc protected %" PRIu64, snapshot.tx_sc.out_pkts_protected);
+    MACSEC_CHECK(snapshot.tx_sa[0].out_pkts_protected == 1, "tx_sa protected %" PRIu64, snapshot.tx_sa[0].out_pkts_protected);
+    MACSEC_CHECK(snapshot.rx_sc_cnt == MACSEC_TEST_RX_SC, "%u rx_sc", snapshot.rx_sc_cnt);
+    for (sc = 0; sc < snapshot.rx_sc_cnt; sc++) {
+        MACSEC_CHECK(snapshot.rx_sc[sc].in_pkts_ok == MACSEC_TEST_RX_SA, "rx_sc %u ok %" PRIu64, sc, snapshot.rx_sc[sc].in_pkts_ok);
+        MACSEC_CHECK(snapshot.rx_sa[sc][0].in_pkts_ok == 1, "rx_sa %u ok %" PRIu64, sc, snapshot.rx_sa[sc][0].in_pkts_ok);
+        MACSEC_CHECK(snapshot.rx_sa[sc][0].in_pkts_late == 1, "rx_sa %u late %" PRIu64, sc, snapshot.rx_sa[sc][0].in_pkts_late);
+    }
+
+    /* The totals accumulate over snapshots */
+    macsec_test_rd_clear();
+    VTSS_RC(vtss_macsec_secy_counters_snapshot_get_priv(vtss_state, port_no, &snapshot, MACSEC_TEST_SECY));
+    (void)macsec_test_rd_total();
+    MACSEC_CHECK(snapshot.tx_sc.out_pkts_protected == 2 * MACSEC_TEST_TX_SA, "tx_sc protected %" PRIu64, snapshot.tx_sc.out_pkts_protected);
+    MACSEC_CHECK(snapshot.rx_sc[0].in_pkts_ok == 2 * MACSEC_TEST_RX_SA, "rx_sc ok %" PRIu64, snapshot.rx_sc[0].in_pkts_ok);
+    return VTSS_RC_OK;
+}
+
+/* - Main ---------------------------------------------------------- */
+
+int main(int argc, char **argv)
+{
+    vtss_state_t *vtss_state;
+
+    if ((vtss_state = calloc(1, sizeof(*vtss_state))) == NULL) {
+        printf("FAIL: state allocation\n");
+        return 1;
+    }
+    vtss_state->phy_state[MACSEC_TEST_PORT].type.part_number = VTSS_PHY_TYPE_8584;
+    macsec_test_state_init(vtss_state, MACSEC_TEST_PORT);
+    if (macsec_test_snapshot(vtss_state, MACSEC_TEST_PORT) != VTSS_RC_OK) {
+        macsec_test_errors++;
+    }
+    printf("%s: secy_counters_snapshot\n", macsec_test_errors ? "FAIL" : "PASS");
+#if defined(VTSS_CHIP_10G_PHY)
+    /* A 10G port walks the SecYs and Rx SCs within the sizes of their tables */
+    vtss_state->phy_10g_state[MACSEC_TEST_PORT_10G].type = VTSS_PHY_TYPE_8490;
+    macsec_test_state_init(vtss_state, MACSEC_TEST_PORT_10G);
+    if (macsec_test_snapshot(vtss_state, MACSEC_TEST_PORT_10G) != VTSS_RC_OK) {
+        macsec_test_errors++;
+    }
+    printf("%s: secy_counters_snapshot_10g\n", macsec_test_errors ? "FAIL" : "PASS");
+#endif
+    free(vtss_state);
+    return (macsec_test_errors ? 1 : 0);
+}
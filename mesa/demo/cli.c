@@ -1088,7 +1088,7 @@ static void cli_accept(int fd, void *ref)
         T_E("already connected");
     } else if ((cli_con = accept(fd, NULL, NULL)) <= 0) {
         T_E("accept() failed");
-    } else if (fd_read_register(cli_con, cli_connection, NULL) < 0) {
+    } else if (fd_read_register_name(cli_con, cli_connection, NULL, "cli") < 0) {
         T_E("fd_read_register() failed");
         close(cli_con);
         cli_con = -1;
@@ -1114,7 +1114,7 @@ static void cli_socket_init(void)
     } else if (listen(fd, 1) < 0) {
         T_E("listen failed");
         close(fd);
-    } else if (fd_read_register(fd, cli_accept, NULL) < 0) {
+    } else if (fd_read_register_name(fd, cli_accept, NULL, "cli_accept") < 0) {
         T_E("fd_read_register() failed");
         close(fd);
     }
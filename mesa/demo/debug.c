@@ -4,6 +4,7 @@
 
 #include <stdio.h>
 #include <ctype.h>
+#include <inttypes.h>
 #include "microchip/ethernet/switch/api.h"
 #include "microchip/ethernet/board/api.h"
 #include "main.h"
@@ -390,6 +391,62 @@ static void cli_cmd_debug_symreg_query(cli_req_t *req)
     symreg_cli_regs_print(QUERY, mreq->pattern, 0);
 }
 
+static void cli_cmd_debug_symreg_lookup(cli_req_t *req)
+{
+    debug_cli_req_t *mreq = req->module_req;
+
+    symreg_cli_addr_print(mreq->addr);
+}
+
+static void debug_reg_profile_print(mesa_reg_profile_type_t type)
+{
+    mesa_reg_profile_entry_t entry;
+    uint32_t                 idx, cnt;
+    char                     buf[80];
+
+    cli_table_header(type == MESA_REG_PROFILE_TYPE_GROUP ?
+                     "Target:Group                              Reads       Writes      Time [nsec]   Avg [nsec]" :
+                     "Function                                  Reads       Writes      Time [nsec]   Avg [nsec]");
+    for (idx = 0; mesa_reg_profile_get(NULL, type, idx, &entry) == MESA_RC_OK; idx++) {
+        if ((cnt = (entry.rd_cnt + entry.wr_cnt)) == 0) {
+            continue;
+        }
+        if (entry.group == NULL) {
+            snprintf(buf, sizeof(buf), "%s", entry.name);
+        } else {
+            snprintf(buf, sizeof(buf), "%s:%s", entry.name, entry.group);
+        }
+        cli_printf("%-40s  %-10u  %-10u  %-12" PRIu64 "  %" PRIu64 "\n",
+                   buf, entry.rd_cnt, entry.wr_cnt, entry.nsec, entry.nsec / cnt);
+    }
+}
+
+static void cli_cmd_debug_reg_profile(cli_req_t *req)
+{
+    debug_cli_req_t         *mreq = req->module_req;
+    mesa_reg_profile_conf_t conf;
+
+    if (mesa_reg_profile_conf_get(NULL, &conf) != MESA_RC_OK) {
+        cli_printf("Register profiling not supported\n");
+        return;
+    }
+    if (req->set) {
+        conf.enable = req->enable;
+        if (mesa_reg_profile_conf_set(NULL, &conf) != MESA_RC_OK) {
+            cli_printf("Register profiling not supported\n");
+            return;
+        }
+    }
+    if (mreq->clear) {
+        (void)mesa_reg_profile_clear(NULL);
+    } else if (!req->set) {
+        cli_printf("Register profiling: %s\n\n", conf.enable ? "Enabled" : "Disabled");
+        debug_reg_profile_print(MESA_REG_PROFILE_TYPE_GROUP);
+        cli_printf("\n");
+        debug_reg_profile_print(MESA_REG_PROFILE_TYPE_FUNC);
+    }
+}
+
 static cli_cmd_t cli_cmd_table[] = {
     {
         "Debug API [<layer>] [<group>] [<port_list>] [full] [clear] [action] [<act_value>]",
@@ -453,6 +510,16 @@ static cli_cmd_t cli_cmd_table[] = {
         "Display the matched register(s)",
         cli_cmd_debug_symreg_query
     },
+    {
+        "Debug Sym Lookup <reg_addr>",
+        "Display the register at an address",
+        cli_cmd_debug_symreg_lookup
+    },
+    {
+        "Debug Register Profile [enable|disable] [clear]",
+        "Set or show register access counters per register group and API function",
+        cli_cmd_debug_reg_profile
+    },
     {
         "Debug serdes <port_list> [dfe] [ctle] [txeq] <value_list>",
         "deb serdes <port> dfe h1,h2,h3,h4,h5,0 (10g) or h1,h2,h3,h4,h5,dlev (25g)\n "
@@ -628,6 +695,12 @@ static int cli_parm_reg_pattern(cli_req_t *req)
     return 0;
 }
 
+static int cli_parm_reg_addr(cli_req_t *req)
+{
+    debug_cli_req_t *mreq = req->module_req;
+    return cli_parm_u32(req, &mreq->addr, 0, 0xffffffff);
+}
+
 static int cli_parm_reg_value(cli_req_t *req)
 {
     debug_cli_req_t *mreq = req->module_req;
@@ -659,6 +732,13 @@ static cli_parm_t cli_parm_table[] = {
         CLI_PARM_FLAG_NONE,
         cli_parm_keyword
     },
+    {
+        "clear",
+        "Clear register access counters",
+        CLI_PARM_FLAG_NONE,
+        cli_parm_keyword,
+        cli_cmd_debug_reg_profile
+    },
     {
         "full",
         "Show full information",
@@ -749,9 +829,16 @@ static cli_parm_t cli_parm_table[] = {
         r        is a list of register replications if applicable.\n\
         If a given replication (t, g, r) is omitted, all applicable replications will be accessed.\n\
         Both 'target', 'reggrp' and 'reg' may be omitted, which corresponds to wildcarding that part\n\
-        of the name. Matches are exact, but wildcards ('*', '?') are allowed.",
+        of the name. Matches are exact, but wildcards ('*', '?') are allowed.\n\
+        Multiple patterns may be separated by commas.",
         CLI_PARM_FLAG_NONE,
         cli_parm_reg_pattern
+    },
+    {
+        "<reg_addr>",
+        "Register address as used by mesa_reg_read/write() (0-0xffffffff)",
+        CLI_PARM_FLAG_NONE,
+        cli_parm_reg_addr
     },
         {
         "<value32>",
@@ -118,6 +118,24 @@ static intr_ev_info_t intr_ev_table[MEBA_EVENT_LAST + 1] = {
     [MEBA_EVENT_LAST] = { "unknown" },
 };
 
+// Event subscribers, called from the interrupt callback
+static meba_event_signal_t intr_ev_cb[MEBA_EVENT_LAST];
+
+mesa_rc intr_ev_register(meba_event_t ev, meba_event_signal_t cb)
+{
+    if (ev >= MEBA_EVENT_LAST) {
+        return MESA_RC_ERROR;
+    }
+    intr_ev_cb[ev] = cb;
+    return MESA_RC_OK;
+}
+
+// Interrupts are delivered if the 'irqctl' file is open
+mesa_bool_t intr_active(void)
+{
+    return (irq_wr != NULL);
+}
+
 mesa_rc intr_ev_get(const char *name, uint32_t idx, uint32_t *cnt)
 {
     intr_ev_info_t *ev;
@@ -157,6 +175,9 @@ static void intr_event(meba_event_t ev, uint32_t idx)
         idx = port_cnt;
     }
     info->cnt[idx]++;
+    if (ev < MEBA_EVENT_LAST && intr_ev_cb[ev] != NULL) {
+        intr_ev_cb[ev](ev, idx);
+    }
 }
 
 static void intr_enable(void)
@@ -240,12 +261,13 @@ static void intr_init(void)
     if ((irq_wr = fopen(uio_path, "w")) == NULL) {
         T_I("open %s for write failed", uio_path);
         fclose(irq_rd);
+        irq_rd = NULL;
         return;
     }
     setlinebuf(irq_wr);
 
     // Register for activity on UIO file descriptor
-    fd_read_register(uio_fd, intr_callback, NULL);
+    fd_read_register_name(uio_fd, intr_callback, NULL, "intr");
 
     (void)MEBA_WRAP(meba_reset, meba_global_inst, MEBA_INTERRUPT_INITIALIZE);
 
@@ -5,7 +5,10 @@
 #include <stdio.h>
 #include <ctype.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
 #include <errno.h>
 #include <netinet/in.h>
 #include "microchip/ethernet/switch/api.h"
@@ -1428,6 +1431,7 @@ static mesa_rc mesa_rpc_packet_tx_frame(json_rpc_req_t *req)
 }
 
 mesa_rc intr_ev_get(const char *name, uint32_t idx, uint32_t *cnt);
+static mesa_rc json_rpc_stats_get(json_rpc_req_t *req);
 
 static mesa_rc event_get(json_rpc_req_t *req)
 {
@@ -1441,6 +1445,37 @@ static mesa_rc event_get(json_rpc_req_t *req)
     return MESA_RC_OK;
 }
 
+static mesa_rc reg_profile_get(json_rpc_req_t *req)
+{
+    mesa_reg_profile_type_t  type;
+    mesa_reg_profile_entry_t entry;
+    json_object              *obj_result, *obj_array, *obj;
+    uint32_t                 idx;
+    const char               *names[] = { "groups", "functions" };
+
+    MESA_RC(json_rpc_new(req, &obj_result));
+    for (type = MESA_REG_PROFILE_TYPE_GROUP; type <= MESA_REG_PROFILE_TYPE_FUNC; type++) {
+        MESA_RC(json_rpc_array_new(req, &obj_array));
+        for (idx = 0; mesa_reg_profile_get(NULL, type, idx, &entry) == MESA_RC_OK; idx++) {
+            if (entry.rd_cnt == 0 && entry.wr_cnt == 0) {
+                continue;
+            }
+            MESA_RC(json_rpc_new(req, &obj));
+            MESA_RC(json_rpc_add_name_json_string(req, obj, "name", entry.name));
+            if (entry.group != NULL) {
+                MESA_RC(json_rpc_add_name_json_string(req, obj, "group", entry.group));
+            }
+            MESA_RC(json_rpc_add_name_uint32_t(req, obj, "rd_cnt", &entry.rd_cnt));
+            MESA_RC(json_rpc_add_name_uint32_t(req, obj, "wr_cnt", &entry.wr_cnt));
+            MESA_RC(json_rpc_add_name_uint64_t(req, obj, "nsec", &entry.nsec));
+            MESA_RC(json_rpc_add_json_array(req, obj_array, obj));
+        }
+        MESA_RC(json_rpc_add_name_json_object(req, obj_result, names[type], obj_array));
+    }
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj_result));
+    return MESA_RC_OK;
+}
+
 static json_rpc_method_t json_rpc_static_table[] = {
     { "mesa_qos_dscp_dpl_conf_get", mesa_rpc_mesa_qos_dscp_dpl_conf_get },
     { "mesa_qos_dscp_dpl_conf_set", mesa_rpc_mesa_qos_dscp_dpl_conf_set },
@@ -1452,29 +1487,158 @@ static json_rpc_method_t json_rpc_static_table[] = {
     { "mesa_misc_get", misc_get },
     { "mesa_packet_tx_frame", mesa_rpc_packet_tx_frame },
     { "mesa_event_get", event_get },
+    { "mscc_appl_json_rpc_stats_get", json_rpc_stats_get },
+    { "mscc_appl_reg_profile_get", reg_profile_get },
     { NULL, NULL}
 };
-/* - JSON-RPC parser ----------------------------------------------- */
+/* - Method table --------------------------------------------------- */
 
-static int find_and_call_method(const char *method_name, json_rpc_req_t *req)
+// Method entry with call statistics
+typedef struct {
+    const json_rpc_method_t *method;
+    uint32_t                cnt;        // Number of calls
+    uint32_t                err_cnt;    // Number of calls returning an error
+    uint64_t                usec_total; // Total call time
+    uint32_t                usec_max;   // Maximum call time
+} json_rpc_method_entry_t;
+
+// The method tables hold thousands of generated methods, so the lookup is done using an
+// open addressing hash table with twice as many slots as methods.
+static json_rpc_method_entry_t *json_rpc_method_table;
+static uint32_t                json_rpc_method_cnt;
+static uint32_t                *json_rpc_hash_table; // Method table index plus one, zero means free
+static uint32_t                json_rpc_hash_mask;
+
+static uint32_t json_rpc_hash(const char *name)
+{
+    uint32_t hash = 2166136261; // FNV-1a
+
+    while (*name) {
+        hash = ((hash ^ (uint8_t)*name++) * 16777619);
+    }
+    return hash;
+}
+
+static json_rpc_method_entry_t *json_rpc_method_lookup(const char *name)
 {
-    int                 found = 0;
-    json_rpc_method_t   *method;
+    uint32_t                i, idx;
+    json_rpc_method_entry_t *entry;
 
-    for (method = json_rpc_table; method->cb != NULL && !found; method++) {
-        if (!strcmp(method->name, method_name)) {
-            found = 1;
-            method->cb(req);
+    if (json_rpc_hash_table == NULL) {
+        return NULL;
+    }
+    for (i = (json_rpc_hash(name) & json_rpc_hash_mask); (idx = json_rpc_hash_table[i]) != 0; i = ((i + 1) & json_rpc_hash_mask)) {
+        entry = &json_rpc_method_table[idx - 1];
+        if (!strcmp(entry->method->name, name)) {
+            return entry;
         }
     }
-    for (method = json_rpc_static_table; method->cb != NULL && !found; method++) {
-        if (!strcmp(method->name, method_name)) {
-            found = 1;
-            method->cb(req);
+    return NULL;
+}
+
+static void json_rpc_method_add(const json_rpc_method_t *method)
+{
+    uint32_t i;
+
+    if (json_rpc_method_lookup(method->name) != NULL) {
+        // The first entry found wins
+        T_D("duplicate method: %s", method->name);
+        return;
+    }
+    for (i = (json_rpc_hash(method->name) & json_rpc_hash_mask); json_rpc_hash_table[i] != 0; i = ((i + 1) & json_rpc_hash_mask)) {
+    }
+    json_rpc_method_table[json_rpc_method_cnt].method = method;
+    json_rpc_method_cnt++;
+    json_rpc_hash_table[i] = json_rpc_method_cnt;
+}
+
+static void json_rpc_method_init(void)
+{
+    const json_rpc_method_t *method;
+    uint32_t                cnt = 0, size = 64;
+
+    for (method = json_rpc_table; method->cb != NULL; method++) {
+        cnt++;
+    }
+    for (method = json_rpc_static_table; method->cb != NULL; method++) {
+        cnt++;
+    }
+    while (size < (2 * cnt)) {
+        size *= 2;
+    }
+    if ((json_rpc_method_table = calloc(cnt, sizeof(*json_rpc_method_table))) == NULL ||
+        (json_rpc_hash_table = calloc(size, sizeof(*json_rpc_hash_table))) == NULL) {
+        T_E("method table malloc failed");
+        free(json_rpc_method_table);
+        json_rpc_method_table = NULL;
+        return;
+    }
+    json_rpc_hash_mask = (size - 1);
+    for (method = json_rpc_table; method->cb != NULL; method++) {
+        json_rpc_method_add(method);
+    }
+    for (method = json_rpc_static_table; method->cb != NULL; method++) {
+        json_rpc_method_add(method);
+    }
+    T_I("methods: %u, hash size: %u", json_rpc_method_cnt, size);
+}
+
+static uint64_t json_rpc_usec_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+
+static mesa_rc json_rpc_stats_get(json_rpc_req_t *req)
+{
+    json_rpc_method_entry_t *entry;
+    json_object             *obj_array, *obj;
+    uint32_t                i, usec_avg;
+
+    MESA_RC(json_rpc_array_new(req, &obj_array));
+    for (i = 0; i < json_rpc_method_cnt; i++) {
+        entry = &json_rpc_method_table[i];
+        if (entry->cnt == 0) {
+            continue;
         }
+        usec_avg = (entry->usec_total / entry->cnt);
+        MESA_RC(json_rpc_new(req, &obj));
+        MESA_RC(json_rpc_add_name_json_string(req, obj, "method", entry->method->name));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj, "cnt", &entry->cnt));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj, "err_cnt", &entry->err_cnt));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj, "usec_avg", &usec_avg));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj, "usec_max", &entry->usec_max));
+        MESA_RC(json_rpc_add_json_array(req, obj_array, obj));
+    }
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj_array));
+    return MESA_RC_OK;
+}
+
+/* - JSON-RPC parser ----------------------------------------------- */
+
+static int find_and_call_method(const char *method_name, json_rpc_req_t *req)
+{
+    json_rpc_method_entry_t *entry;
+    uint64_t                start, usec;
+
+    if ((entry = json_rpc_method_lookup(method_name)) == NULL) {
+        return 0;
     }
 
-    return (found);
+    start = json_rpc_usec_get();
+    entry->method->cb(req);
+    usec = (json_rpc_usec_get() - start);
+    entry->cnt++;
+    if (req->error) {
+        entry->err_cnt++;
+    }
+    entry->usec_total += usec;
+    if (usec > entry->usec_max) {
+        entry->usec_max = usec;
+    }
+    return 1;
 }
 
 static int json_cli(int argc, const char **argv)
@@ -1549,32 +1713,18 @@ OUT:
     }
 }
 
-static cli_cmd_t cli_cmd_table[] = {
-    {
-        "call <method> <params>",
-        "Call an API method using JSON syntax",
-        0,
-        0,
-        json_cli,
-    },
-};
-
-static int json_rpc_parse(int fd, char *msg)
+static json_object *json_rpc_request(json_object *obj_req)
 {
-    json_object       *obj_req, *obj_rep, *obj_result, *obj_error, *obj_method, *obj_id;
-    const char        *method_name, *reply;
+    json_object       *obj_rep = NULL, *obj_result, *obj_error, *obj_method, *obj_id;
+    const char        *method_name;
     json_rpc_req_t    req = {};
     int               send_reply = 0, found = 0;
-    uint32_t          len, *p;
-    char              hdr[JSON_RPC_HDR_LEN];
-
-    T_N("request: %s", msg);
 
     req.idx = 0;
     req.result = NULL;
     sprintf(req.buf, "internal error");
-    if ((obj_req = json_tokener_parse(msg)) == NULL) {
-        T_I("json_tokener_parse failed");
+    if (json_object_get_type(obj_req) != json_type_object) {
+        T_I("request not object");
     } else if (!json_object_object_get_ex(obj_req, "method", &obj_method)) {
         T_I("method object not found");
     } else if (json_object_get_type(obj_method) != json_type_string) {
@@ -1601,7 +1751,7 @@ static int json_rpc_parse(int fd, char *msg)
             req.error = 1;
         }
     }
-    
+
     if (send_reply && (obj_rep = json_object_new_object()) != NULL) {
         if (req.error) {
             obj_result = NULL;
@@ -1614,154 +1764,499 @@ static int json_rpc_parse(int fd, char *msg)
         json_object_object_add(obj_rep, "result", obj_result);
         json_object_object_add(obj_rep, "error", obj_error);
         json_object_object_add(obj_rep, "id", json_object_get(obj_id));
-        reply = json_object_to_json_string(obj_rep);
-        len = strlen(reply);
-        p = (uint32_t *)hdr;
-        *p = htonl(len);
-        T_I("reply length: %u", len);
-        T_D("reply: %s", reply);
-        if (write(fd, hdr, sizeof(hdr)) != sizeof(hdr) || 
-            write(fd, reply, len) != len) {
-            T_E("write error");
-        }
-        json_object_put(obj_rep);
     }
 
-    // Free objects (the call ignores NULL object)
-    json_object_put(obj_req);
+    // Free result object (the call ignores NULL object)
     json_object_put(req.result);
 
+    return obj_rep;
+}
+
+/* - Connection handling ------------------------------------------- */
+
+// Framing is detected from the first byte received on a connection:
+// - Binary: 4 bytes length field in network order followed by the JSON text (default).
+// - Text  : JSON text terminated by a newline, for simple clients like netcat.
+typedef enum {
+    JSON_RPC_FRAMING_NONE,
+    JSON_RPC_FRAMING_BINARY,
+    JSON_RPC_FRAMING_TEXT
+} json_rpc_framing_t;
+
+typedef struct json_rpc_con {
+    struct json_rpc_con *next;
+    int                 fd;
+    struct sockaddr_in  addr;
+    json_rpc_framing_t  framing;
+    uint32_t            events;  // Current epoll events
+    uint32_t            req_cnt; // Number of requests received
+    char                *rx_buf;
+    uint32_t            rx_size;
+    uint32_t            rx_len;
+    char                *tx_buf;
+    uint32_t            tx_size;
+    uint32_t            tx_len;
+    uint32_t            tx_done;
+} json_rpc_con_t;
+
+#define JSON_RPC_CON_MAX   256
+#define JSON_RPC_MSG_MAX   (100 * 1024)
+#define JSON_RPC_RX_CHUNK  (16 * 1024)
+#define JSON_RPC_EVENT_MAX 32
+
+static json_rpc_con_t     *json_rpc_con_list;
+static uint32_t           json_rpc_con_cnt;
+static int                json_rpc_epoll_fd = -1;
+static json_tokener       *json_rpc_tok;
+static int                json_rpc_listen_fd = -1; // Registered in epoll with data.ptr NULL
+
+static int json_rpc_buf_alloc(char **buf, uint32_t *size, uint32_t len)
+{
+    uint32_t new_size = (*size ? *size : JSON_RPC_RX_CHUNK);
+    char     *new_buf;
+
+    if (len <= *size) {
+        return 0;
+    }
+    while (new_size < len) {
+        new_size *= 2;
+    }
+    if ((new_buf = realloc(*buf, new_size)) == NULL) {
+        T_E("buffer realloc failed, size: %u", new_size);
+        return -1;
+    }
+    *buf = new_buf;
+    *size = new_size;
     return 0;
 }
 
-typedef struct {
-    int                fd;
-    struct sockaddr_in addr;
-    uint32_t           len;
-    uint32_t           rx_cnt;
-    char               *msg;
-} json_rpc_con_t;
+static void json_rpc_con_close(json_rpc_con_t *con)
+{
+    json_rpc_con_t *cur, *prev = NULL;
+
+    T_I("closing connection, requests: %u", con->req_cnt);
+    if (epoll_ctl(json_rpc_epoll_fd, EPOLL_CTL_DEL, con->fd, NULL) < 0) {
+        T_E("epoll_ctl() failed: %s", strerror(errno));
+    }
+    close(con->fd);
+    for (cur = json_rpc_con_list; cur != NULL; prev = cur, cur = cur->next) {
+        if (cur == con) {
+            if (prev == NULL) {
+                json_rpc_con_list = con->next;
+            } else {
+                prev->next = con->next;
+            }
+            json_rpc_con_cnt--;
+            break;
+        }
+    }
+    free(con->rx_buf);
+    free(con->tx_buf);
+    free(con);
+}
+
+static int json_rpc_events_set(json_rpc_con_t *con, uint32_t events)
+{
+    struct epoll_event ev = {};
+
+    if (events == con->events) {
+        return 0;
+    }
+    ev.events = events;
+    ev.data.ptr = con;
+    if (epoll_ctl(json_rpc_epoll_fd, EPOLL_CTL_MOD, con->fd, &ev) < 0) {
+        T_E("epoll_ctl() failed: %s", strerror(errno));
+        return -1;
+    }
+    con->events = events;
+    return 0;
+}
 
-#define FD_FREE (-1)
-#define JSON_RPC_CON_MAX 4
-static json_rpc_con_t json_rpc_con_table[JSON_RPC_CON_MAX];
+// Queue reply for transmission
+static int json_rpc_reply(json_rpc_con_t *con, json_object *obj_rep)
+{
+    const char *reply;
+    uint32_t   len, hdr;
+    char       *p;
+
+    reply = json_object_to_json_string_ext(obj_rep, JSON_C_TO_STRING_PLAIN);
+    len = strlen(reply);
+    T_I("reply length: %u", len);
+    T_D("reply: %s", reply);
+    if (json_rpc_buf_alloc(&con->tx_buf, &con->tx_size, con->tx_len + JSON_RPC_HDR_LEN + len + 1) < 0) {
+        return -1;
+    }
+    p = (con->tx_buf + con->tx_len);
+    if (con->framing == JSON_RPC_FRAMING_BINARY) {
+        hdr = htonl(len);
+        memcpy(p, &hdr, JSON_RPC_HDR_LEN);
+        p += JSON_RPC_HDR_LEN;
+    }
+    memcpy(p, reply, len);
+    p += len;
+    if (con->framing == JSON_RPC_FRAMING_TEXT) {
+        *p++ = '\n';
+    }
+    con->tx_len = (p - con->tx_buf);
+    return 0;
+}
 
-static json_rpc_con_t *json_rpc_connection_lookup(int fd)
+// Parse and handle one message, which may be a single request or a batch array of requests
+static int json_rpc_parse(json_rpc_con_t *con, const char *msg, uint32_t len)
 {
-    int            i;
-    json_rpc_con_t *con;
+    json_object *obj_req, *obj_rep, *obj;
+    int         i, cnt, rc = 0;
+
+    T_N("request: %.*s", len, msg);
 
-    for (i = 0; i < JSON_RPC_CON_MAX; i++) {
-        con = &json_rpc_con_table[i];
-        if (con->fd == fd) {
-            return con;
+    con->req_cnt++;
+    json_tokener_reset(json_rpc_tok);
+    if ((obj_req = json_tokener_parse_ex(json_rpc_tok, msg, len)) == NULL) {
+        T_I("json_tokener_parse failed");
+        return 0;
+    }
+    if (json_object_get_type(obj_req) == json_type_array) {
+        // Batch request, the replies are collected in an array
+        cnt = json_object_array_length(obj_req);
+        T_D("batch request, count: %d", cnt);
+        if ((obj_rep = json_object_new_array()) == NULL) {
+            T_I("alloc reply array failed");
+        } else {
+            for (i = 0; i < cnt; i++) {
+                if ((obj = json_rpc_request(json_object_array_get_idx(obj_req, i))) != NULL) {
+                    json_object_array_add(obj_rep, obj);
+                }
+            }
+            if (json_object_array_length(obj_rep) == 0) {
+                json_object_put(obj_rep);
+                obj_rep = NULL;
+            }
         }
+    } else {
+        obj_rep = json_rpc_request(obj_req);
     }
-    return NULL;
+    if (obj_rep != NULL) {
+        rc = json_rpc_reply(con, obj_rep);
+        json_object_put(obj_rep);
+    }
+    json_object_put(obj_req);
+    return rc;
 }
 
-static void json_rpc_connection(int fd, void *ref)
+// Handle all complete messages in the receive buffer
+static int json_rpc_rx_process(json_rpc_con_t *con)
 {
-    int            n, error = 1;
-    uint32_t       len;
-    json_rpc_con_t *con;
-    char           hdr[JSON_RPC_HDR_LEN], *p = hdr;
+    char     *msg, *end;
+    uint32_t pos = 0, len, hdr;
+    int      rc = 0;
 
-    // Lookup connection
-    if ((con = json_rpc_connection_lookup(fd)) == NULL) {
-        T_E("connection not found");
-        return;
+    if (con->framing == JSON_RPC_FRAMING_NONE && con->rx_len) {
+        con->framing = (con->rx_buf[0] == '{' || con->rx_buf[0] == '[' ? JSON_RPC_FRAMING_TEXT : JSON_RPC_FRAMING_BINARY);
+        T_D("framing: %s", con->framing == JSON_RPC_FRAMING_TEXT ? "text" : "binary");
     }
 
-    if (con->len == 0) {
-        // Read header
-        if ((n = read(fd, hdr, sizeof(hdr))) < sizeof(hdr)) {
-            T_I("header small");
-        } else if ((len = ntohl(*(uint32_t *)p)) == 0 || len > (100 * 1024)) {
-            T_E("illegal length: %u", len);
-        } else if ((con->msg = (char *)malloc(len + 1)) == NULL) {
-            T_E("msg malloc failed");
+    while (rc == 0 && pos < con->rx_len) {
+        msg = (con->rx_buf + pos);
+        len = (con->rx_len - pos);
+        if (con->framing == JSON_RPC_FRAMING_BINARY) {
+            if (len < JSON_RPC_HDR_LEN) {
+                break;
+            }
+            memcpy(&hdr, msg, JSON_RPC_HDR_LEN);
+            if ((hdr = ntohl(hdr)) == 0 || hdr > JSON_RPC_MSG_MAX) {
+                T_E("illegal length: %u", hdr);
+                return -1;
+            }
+            if (len < (JSON_RPC_HDR_LEN + hdr)) {
+                break;
+            }
+            T_I("data length: %u", hdr);
+            pos += (JSON_RPC_HDR_LEN + hdr);
+            rc = json_rpc_parse(con, msg + JSON_RPC_HDR_LEN, hdr);
         } else {
-            T_I("data length: %u", len);
-            con->len = len;
-            return;
+            if ((end = memchr(msg, '\n', len)) == NULL) {
+                if (len > JSON_RPC_MSG_MAX) {
+                    T_E("message too long");
+                    return -1;
+                }
+                break;
+            }
+            len = (end - msg);
+            pos += (len + 1);
+            while (len && isspace((uint8_t)msg[len - 1])) {
+                len--;
+            }
+            if (len) {
+                rc = json_rpc_parse(con, msg, len);
+            }
         }
-    } else if ((n = read(fd, con->msg + con->rx_cnt, con->len - con->rx_cnt)) <= 0) {
-        // Read data failed
-        T_I("no data");
-    } else {
-        // Read data success
-        error = 0;
-        con->rx_cnt += n;
-        if (con->rx_cnt != con->len) {
-            // Message not complete
-            return;
+    }
+
+    // Keep partial message
+    con->rx_len -= pos;
+    if (con->rx_len && pos) {
+        memmove(con->rx_buf, con->rx_buf + pos, con->rx_len);
+    }
+    return rc;
+}
+
+// Transmit queued replies. While replies are pending, requests are not read from the socket.
+static int json_rpc_tx_flush(json_rpc_con_t *con)
+{
+    int n;
+
+    while (con->tx_done < con->tx_len) {
+        if ((n = write(con->fd, con->tx_buf + con->tx_done, con->tx_len - con->tx_done)) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return json_rpc_events_set(con, EPOLLOUT);
+            }
+            T_I("write error: %s", strerror(errno));
+            return -1;
+        }
+        con->tx_done += n;
+    }
+    con->tx_len = 0;
+    con->tx_done = 0;
+    return json_rpc_events_set(con, EPOLLIN);
+}
+
+static int json_rpc_rx(json_rpc_con_t *con)
+{
+    int n;
+
+    if (json_rpc_buf_alloc(&con->rx_buf, &con->rx_size, con->rx_len + JSON_RPC_RX_CHUNK) < 0) {
+        return -1;
+    }
+    if ((n = read(con->fd, con->rx_buf + con->rx_len, con->rx_size - con->rx_len)) < 0) {
+        if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
         }
-        con->msg[con->len] = 0;
-        error = json_rpc_parse(fd, con->msg);
+        T_I("read error: %s", strerror(errno));
+        return -1;
+    } else if (n == 0) {
+        T_I("no data");
+        return -1;
     }
+    con->rx_len += n;
 
-    // Free message
-    if (con->msg) {
-        free(con->msg);
+    // All pipelined requests are handled and the replies are sent together
+    if (json_rpc_rx_process(con) < 0) {
+        return -1;
     }
-    memset(con, 0, sizeof(*con));
+    return json_rpc_tx_flush(con);
+}
 
-    if (error) {
-        T_I("closing connection");
-        close(fd);
-        if (fd_read_register(fd, NULL, NULL)) {
-            T_E("Failed to un-rgister fd");
+static void json_rpc_accept(void)
+{
+    json_rpc_con_t     *con;
+    struct sockaddr_in addr;
+    socklen_t          len;
+    struct epoll_event ev = {};
+    int                fd;
+
+    while (1) {
+        len = sizeof(addr);
+        if ((fd = accept(json_rpc_listen_fd, (struct sockaddr *)&addr, &len)) < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                T_E("accept() failed: %s", strerror(errno));
+            }
+            break;
+        }
+        if (json_rpc_con_cnt >= JSON_RPC_CON_MAX) {
+            T_E("no free connection");
+            close(fd);
+            continue;
+        }
+        if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0) {
+            T_E("fcntl() failed: %s", strerror(errno));
+            close(fd);
+            continue;
+        }
+        if ((con = calloc(1, sizeof(*con))) == NULL) {
+            T_E("connection malloc failed");
+            close(fd);
+            continue;
         }
-        con->fd = FD_FREE;
-    } else {
-        // Preserve file descriptor
         con->fd = fd;
+        con->addr = addr;
+        con->events = EPOLLIN;
+        ev.events = EPOLLIN;
+        ev.data.ptr = con;
+        if (epoll_ctl(json_rpc_epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            T_E("epoll_ctl() failed: %s", strerror(errno));
+            close(fd);
+            free(con);
+            continue;
+        }
+        T_N("new connection accepted");
+        con->next = json_rpc_con_list;
+        json_rpc_con_list = con;
+        json_rpc_con_cnt++;
     }
 }
 
-static void json_rpc_accept(int fd, void *ref)
+// Called from the main loop when any of the JSON-RPC sockets is ready
+static void json_rpc_poll(int fd, void *ref)
 {
-    json_rpc_con_t *con;
-    socklen_t      len = sizeof(con->addr);
-    
-    // Lookup free connection
-    if ((con = json_rpc_connection_lookup(FD_FREE)) == NULL) {
-        T_E("no free connection");
-    } else if ((fd = accept(fd, (struct sockaddr *)&con->addr, &len)) < 0) {
-        T_E("accept() failed: %s", strerror(errno));
-    } else if (fd_read_register(fd, json_rpc_connection, NULL) < 0) {
-        T_E("fd_read_register() failed");
-    } else {
-        T_N("new connection accepted");
-        con->fd = fd;
+    struct epoll_event events[JSON_RPC_EVENT_MAX], *ev;
+    json_rpc_con_t     *con;
+    int                i, n, error;
+
+    if ((n = epoll_wait(fd, events, JSON_RPC_EVENT_MAX, 0)) < 0) {
+        if (errno != EINTR) {
+            T_E("epoll_wait() failed: %s", strerror(errno));
+        }
+        return;
+    }
+    for (i = 0; i < n; i++) {
+        ev = &events[i];
+        if ((con = ev->data.ptr) == NULL) {
+            json_rpc_accept();
+            continue;
+        }
+        if (ev->events & EPOLLOUT) {
+            error = json_rpc_tx_flush(con);
+        } else if (ev->events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+            error = json_rpc_rx(con);
+        } else {
+            error = 0;
+        }
+        if (error) {
+            json_rpc_con_close(con);
+        }
+    }
+}
+
+/* - CLI ----------------------------------------------------------- */
+
+typedef struct {
+    mesa_bool_t clear;
+} json_rpc_cli_req_t;
+
+static void cli_cmd_json_rpc(cli_req_t *req)
+{
+    json_rpc_cli_req_t      *mreq = req->module_req;
+    json_rpc_method_entry_t *entry;
+    json_rpc_con_t          *con;
+    uint32_t                i, ip;
+    int                     header = 1;
+    char                    buf[32];
+
+    if (!mreq->clear) {
+        cli_printf("Connections: %u\n", json_rpc_con_cnt);
+        cli_printf("Methods    : %u\n", json_rpc_method_cnt);
+        for (con = json_rpc_con_list; con != NULL; con = con->next) {
+            if (header) {
+                header = 0;
+                cli_printf("\n");
+                cli_table_header("Peer                   Framing  Requests");
+            }
+            ip = ntohl(con->addr.sin_addr.s_addr);
+            sprintf(buf, "%u.%u.%u.%u:%u", (ip >> 24) & 0xff, (ip >> 16) & 0xff, (ip >> 8) & 0xff, ip & 0xff,
+                    ntohs(con->addr.sin_port));
+            cli_printf("%-21s  %-7s  %u\n", buf,
+                       con->framing == JSON_RPC_FRAMING_TEXT ? "Text" : "Binary", con->req_cnt);
+        }
     }
+
+    for (i = 0, header = 1; i < json_rpc_method_cnt; i++) {
+        entry = &json_rpc_method_table[i];
+        if (mreq->clear) {
+            entry->cnt = 0;
+            entry->err_cnt = 0;
+            entry->usec_total = 0;
+            entry->usec_max = 0;
+        } else if (entry->cnt) {
+            if (header) {
+                header = 0;
+                cli_printf("\n");
+                cli_table_header("Method                                    Count       Errors      Avg [usec]  Max [usec]");
+            }
+            cli_printf("%-40s  %-10u  %-10u  %-10u  %u\n",
+                       entry->method->name, entry->cnt, entry->err_cnt,
+                       (uint32_t)(entry->usec_total / entry->cnt), entry->usec_max);
+        }
+    }
+}
+
+static int cli_parm_keyword(cli_req_t *req)
+{
+    const char         *found;
+    json_rpc_cli_req_t *mreq = req->module_req;
+
+    if ((found = cli_parse_find(req->cmd, req->stx)) == NULL)
+        return 1;
+
+    if (!strncmp(found, "clear", 5))
+        mreq->clear = 1;
+    else
+        cli_printf("no match: %s\n", found);
+
+    return 0;
 }
 
+static cli_parm_t cli_parm_table[] = {
+    {
+        "clear",
+        "Clear method statistics",
+        CLI_PARM_FLAG_NO_TXT,
+        cli_parm_keyword,
+        cli_cmd_json_rpc
+    },
+};
+
+static cli_cmd_t cli_cmd_table[] = {
+    {
+        "call <method> <params>",
+        "Call an API method using JSON syntax",
+        0,
+        0,
+        json_cli,
+    },
+    {
+        "Debug JSON-RPC [clear]",
+        "Show JSON-RPC connections and method statistics",
+        cli_cmd_json_rpc,
+    },
+};
+
 static void json_rpc_init(void)
 {
-    int                i, fd;
+    int                fd;
     struct sockaddr_in addr;
+    struct epoll_event ev = {};
 
     T_D("enter");
-    for (i = 0; i < JSON_RPC_CON_MAX; i++) {
-        json_rpc_con_table[i].fd = FD_FREE;
-    }
+    json_rpc_method_init();
+    ev.events = EPOLLIN;
     bzero(&addr, sizeof(addr));
     addr.sin_family = AF_INET;
     addr.sin_addr.s_addr = htonl(INADDR_ANY);
     addr.sin_port = htons(1234);
-    if ((fd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+    if ((json_rpc_tok = json_tokener_new()) == NULL) {
+        T_E("json_tokener_new failed");
+    } else if ((json_rpc_epoll_fd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        T_E("epoll_create1 failed: %s", strerror(errno));
+    } else if ((fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) < 0) {
         T_E("socket failed: %s", strerror(errno));
     } else if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
         T_E("bind failed: %s", strerror(errno));
         close(fd);
-    } else if (listen(fd, 1) < 0) {
+    } else if (listen(fd, 64) < 0) {
         T_E("listen failed: %s", strerror(errno));
         close(fd);
-    } else if (fd_read_register(fd, json_rpc_accept, NULL) < 0) {
+    } else if (epoll_ctl(json_rpc_epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        T_E("epoll_ctl() failed: %s", strerror(errno));
+        close(fd);
+    } else if (fd_read_register_name(json_rpc_epoll_fd, json_rpc_poll, NULL, "json_rpc") < 0) {
+        // All JSON-RPC sockets are served through a single descriptor in the main loop
         T_E("fd_read_register() failed");
         close(fd);
+    } else {
+        json_rpc_listen_fd = fd;
     }
     T_D("exit");
 }
@@ -1782,6 +2277,10 @@ void mscc_appl_json_rpc_init(mscc_appl_init_t *init)
             mscc_appl_cli_cmd_reg(&cli_cmd_table[i]);
         }
 
+        for (i = 0; i < sizeof(cli_parm_table)/sizeof(cli_parm_t); i++) {
+            mscc_appl_cli_parm_reg(&cli_parm_table[i]);
+        }
+
         break;
 
     default:
@@ -8,6 +8,7 @@
 #include "cli.h"
 #include "kr.h"
 #include <sys/time.h>
+#include <sys/timerfd.h>
 #include <unistd.h>
 
 typedef uint32_t u32;
@@ -16,6 +17,21 @@ typedef uint16_t u16;
 extern meba_inst_t meba_global_inst;
 kr_appl_conf_t *kr_conf_state;
 
+// From interrupt module
+mesa_rc intr_ev_register(meba_event_t ev, meba_event_signal_t cb);
+mesa_bool_t intr_active(void);
+
+// 802.3ap deadlines. The KR hardware runs the timers itself, the application
+// only services a port if the expected interrupt has not arrived in time.
+#define KR_MAX_WAIT_MS          500 // Clause 72 max_wait_timer (training)
+#define KR_LINK_FAIL_INHIBIT_MS 510 // Clause 73 link_fail_inhibit_timer (aneg)
+#define KR_DEADLINE_MARGIN_MS   10
+#define KR_IRQ_DRAIN_MAX        32  // Max IRQ vectors serviced per event
+
+static uint32_t kr_port_cnt;
+static int      kr_timer_fd = -1;
+static int      kr_irq_mode = -1; // Unknown (-1), polling (0) or interrupt (1)
+
 // For debug
 uint32_t deb_dump_irq = 0;
 mesa_bool_t kr_debug = 0;
@@ -240,6 +256,27 @@ static u32 get_time_sec(struct timeval *store)
     return ((stop.tv_sec - store->tv_sec) * 1000000 + stop.tv_usec - store->tv_usec)/1000000;
 }
 
+static uint64_t kr_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+
+static void kr_time_stat_add(kr_time_stat_t *stat, uint32_t ms)
+{
+    if (stat->cnt == 0 || ms < stat->min) {
+        stat->min = ms;
+    }
+    if (ms > stat->max) {
+        stat->max = ms;
+    }
+    stat->last = ms;
+    stat->total += ms;
+    stat->cnt++;
+}
+
 
 /* ================================================================= *
  *  CLI
@@ -1102,7 +1139,41 @@ static void dump_irq(u32 p, u32 irq, u32 time, u32 irqs)
     }
 }
 
-static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
+// Arm the timer for the earliest port deadline, or disarm it if all ports are idle
+static void kr_timer_update(void)
+{
+    struct itimerspec its = {};
+    uint64_t          next = 0, dl;
+    mesa_port_no_t    iport;
+
+    if (kr_timer_fd < 0) {
+        return;
+    }
+    for (iport = 0; iport < kr_port_cnt; iport++) {
+        dl = kr_conf_state[iport].deadline_us;
+        if (dl != 0 && (next == 0 || dl < next)) {
+            next = dl;
+        }
+    }
+    its.it_value.tv_sec = (next / 1000000);
+    its.it_value.tv_nsec = ((next % 1000000) * 1000);
+    if (timerfd_settime(kr_timer_fd, TFD_TIMER_ABSTIME, &its, NULL) < 0) {
+        T_E("timerfd_settime() failed");
+    }
+}
+
+static void kr_deadline_set(mesa_port_no_t iport, uint32_t ms)
+{
+    uint64_t dl = (ms ? kr_time_us() + (ms + KR_DEADLINE_MARGIN_MS) * 1000ULL : 0);
+
+    if (kr_conf_state[iport].deadline_us != dl) {
+        kr_conf_state[iport].deadline_us = dl;
+        kr_timer_update();
+    }
+}
+
+// Returns the serviced IRQ vector, zero if there was nothing to do
+static uint32_t kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
 {
     mesa_port_no_t        uport;
     mesa_port_kr_conf_t   kr_conf;
@@ -1114,12 +1185,12 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
     mesa_port_kr_fec_t fec = {0};
 
     if (mesa_port_kr_conf_get(NULL, iport, &kr_conf) != MESA_RC_OK || !kr_conf.aneg.enable) {
-        return;
+        return 0;
     }
 
     // For debugging..
     if (kr_conf_state[iport].global_stop && kr_conf_state[iport].link_break) {
-        return;
+        return 0;
     }
 
     uport = iport2uport(iport);
@@ -1139,8 +1210,9 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
             kr_add_to_irq_history(iport, irq, &status);
             kr_conf_state[iport].aneg_sm_state = status.aneg.sm;
         }
-        return;
+        return 0;
     }
+    kr_conf_state[iport].stats.irq_cnt++;
 
     if ((irq & MESA_KR_AN_XMIT_DISABLE) || (irq & MESA_KR_LINK_FAIL)) {
         mesa_port_state_set(NULL, iport, FALSE);
@@ -1158,6 +1230,11 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
         (void)time_start(&kr->time_start_aneg);
     }
 
+    // Aneg restarted, nothing to wait for until the link partner shows up
+    if ((irq & MESA_KR_AN_XMIT_DISABLE) || (irq & MESA_KR_LINK_FAIL)) {
+        kr_deadline_set(iport, 0);
+    }
+
     if ((irq & MESA_KR_LINK_FAIL || irq & MESA_KR_AN_XMIT_DISABLE) && kr_conf_state[iport].mesa_kr_an_good) {
         kr_conf_state[iport].link_break = 1;
         kr_conf_state[iport].mesa_kr_an_good = 0;
@@ -1198,6 +1275,7 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
             }
         }
 
+        kr_deadline_set(iport, KR_LINK_FAIL_INHIBIT_MS);
         if (kr_conf_state[iport].compl_ack_done) {
             kr_printf("Aneg is complete.  Now start training (if enabled).\n");
         } else {
@@ -1221,6 +1299,7 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
 
     if ((irq & MESA_KR_TRAIN)) {
         (void)time_start(&kr->time_start_train);
+        kr_deadline_set(iport, KR_MAX_WAIT_MS);
         if (kr_conf_state[iport].ctle) {
             // Adjust CTLE Rx setings (MESA-693) - before training
             if (mesa_port_kr_ctle_adjust(NULL, iport) != MESA_RC_OK) {
@@ -1254,11 +1333,15 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
     // Training completed
     if (irq & MESA_KR_WT_DONE && (krs->current_state == MESA_TR_SEND_DATA)) {
         kr->time_ld = get_time_ms(&kr->time_start_train);
+        kr_time_stat_add(&kr_conf_state[iport].stats.train, kr->time_ld);
+        kr_deadline_set(iport, KR_LINK_FAIL_INHIBIT_MS);
         kr_printf("Port:%d - Training completed (%d ms)\n",uport, get_time_ms(&kr->time_start_train));
     }
 
     // Aneg completed
     if (irq & MESA_KR_AN_GOOD) {
+        kr_deadline_set(iport, 0);
+        kr_time_stat_add(&kr_conf_state[iport].stats.aneg, get_time_ms(&kr->time_start_aneg));
         mesa_port_state_set(NULL, iport, TRUE);
         if (krs->current_state == MESA_TR_SEND_DATA) {
             mesa_port_kr_eye_dim_t  eye;
@@ -1273,6 +1356,7 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
         }
         kr_conf_state[iport].next_parallel_spd = MESA_SPEED_2500M;
     }
+    return irq;
 }
 
 static void kr_poll_v2(meba_inst_t inst, mesa_port_no_t iport)
@@ -1326,6 +1410,109 @@ static void kr_poll(meba_inst_t inst)
     }
 }
 
+// Service a port until its IRQ vector is empty
+static void kr_port_service(meba_inst_t inst, mesa_port_no_t iport)
+{
+    mesa_port_conf_t pconf;
+    uint32_t         i;
+
+    if (mesa_port_conf_get(NULL, iport, &pconf) == MESA_RC_OK && pconf.power_down) {
+        return;
+    }
+    for (i = 0; i < KR_IRQ_DRAIN_MAX && kr_poll_v3(inst, iport) != 0; i++) {
+    }
+}
+
+// KR interrupt from MEBA, called before the IRQ is re-enabled
+static void kr_irq_event(meba_event_t ev, uint32_t iport)
+{
+    if (!BASE_KR_V3 || kr_conf_state == NULL || iport >= kr_port_cnt) {
+        return;
+    }
+    kr_conf_state[iport].stats.irq_events++;
+    kr_port_service(meba_global_inst, iport);
+}
+
+static void kr_timer_cb(int fd, void *ref)
+{
+    uint64_t       exp, now;
+    mesa_port_no_t iport;
+
+    if (read(fd, &exp, sizeof(exp)) != sizeof(exp) || exp == 0) {
+        return;
+    }
+    now = kr_time_us();
+    for (iport = 0; iport < kr_port_cnt; iport++) {
+        if (kr_conf_state[iport].deadline_us == 0 || kr_conf_state[iport].deadline_us > now) {
+            continue;
+        }
+        kr_conf_state[iport].deadline_us = 0;
+        kr_conf_state[iport].stats.timeouts++;
+        kr_printf("Port:%d - Deadline expired\n", iport2uport(iport));
+        kr_port_service(meba_global_inst, iport);
+    }
+    kr_timer_update();
+}
+
+// Interrupts are used if the interrupt module runs and the board routes all KR IRQs.
+// If a single KR IRQ source is missing, the ports behind it would never be serviced,
+// so polling is used instead.
+static mesa_bool_t kr_irq_mode_get(meba_inst_t inst)
+{
+    mesa_irq_t irq;
+
+    if (kr_irq_mode < 0) {
+        kr_irq_mode = intr_active();
+        for (irq = MESA_IRQ_KR_SD10G_0; kr_irq_mode && irq <= MESA_IRQ_KR_SD10G_19; irq++) {
+            if (MEBA_WRAP(meba_irq_requested, inst, irq) != MESA_RC_OK) {
+                T_I("KR IRQ %d not requested", irq);
+                kr_irq_mode = 0;
+            }
+        }
+        T_I("KR %s mode", kr_irq_mode ? "interrupt" : "polling");
+    }
+    return kr_irq_mode;
+}
+
+static void kr_time_stat_print(const kr_time_stat_t *stat)
+{
+    cli_printf("%-6u%-6u%-6u%-6u%-6u", stat->cnt, stat->last, stat->min, stat->max,
+               stat->cnt ? (uint32_t)(stat->total / stat->cnt) : 0);
+}
+
+static void cli_cmd_port_kr_stats(cli_req_t *req)
+{
+    mesa_port_no_t  uport, iport;
+    port_cli_req_t  *mreq = req->module_req;
+    kr_appl_stats_t *stats;
+    int             header = 1;
+
+    if (!BASE_KR_V3) {
+        return;
+    }
+    for (iport = 0; iport < kr_port_cnt; iport++) {
+        uport = iport2uport(iport);
+        if (req->port_list[uport] == 0 || !kr_conf_state[iport].cap_10g) {
+            continue;
+        }
+        stats = &kr_conf_state[iport].stats;
+        if (mreq->clr) {
+            memset(stats, 0, sizeof(*stats));
+            continue;
+        }
+        if (header) {
+            header = 0;
+            cli_printf("Mode: %s\n\n", kr_irq_mode_get(meba_global_inst) ? "Interrupt" : "Polling");
+            cli_printf("                                Aneg (ms)                     Training (ms)\n");
+            cli_table_header("Port  Events  Vectors  Timeouts  Cnt   Last  Min   Max   Avg   Cnt   Last  Min   Max   Avg   ");
+        }
+        cli_printf("%-6u%-8u%-9u%-10u", uport, stats->irq_events, stats->irq_cnt, stats->timeouts);
+        kr_time_stat_print(&stats->aneg);
+        kr_time_stat_print(&stats->train);
+        cli_printf("\n");
+    }
+}
+
 static cli_cmd_t cli_cmd_table[] = {
     {
         "Port KR aneg [<port_list>] [all] [adv-1g] [adv-2g5] [adv-5g] [adv-10g] [adv-25g] [np] [rfec] [rsfec] [train] [no-remote] [no-pd] [test] [disable]",
@@ -1337,6 +1524,11 @@ static cli_cmd_t cli_cmd_table[] = {
         "Show status",
         cli_cmd_port_kr_status
     },
+    {
+        "Port KR statistics [<port_list>] [clr]",
+        "Show or clear aneg/training time statistics",
+        cli_cmd_port_kr_stats
+    },
     {
         "Port KR debug [<port_list>] [stop] [irq] [sm] [use-ber] [all] [disable] [ctl] [no-eq-apply] [printout]",
         "Toggle debug",
@@ -1569,6 +1761,7 @@ static void kr_init(meba_inst_t inst)
     if (kr_conf_state != NULL) {
         free(kr_conf_state);
     }
+    kr_port_cnt = 0;
     /* Store the meba inst globally */
     meba_global_inst = inst;
 
@@ -1577,6 +1770,19 @@ static void kr_init(meba_inst_t inst)
         T_E("port_table calloc() failed");
         return;
     }
+    kr_port_cnt = port_cnt;
+
+    // Training is driven by KR interrupts, the timer only handles the deadlines
+    if (BASE_KR_V3 && kr_timer_fd < 0) {
+        if ((kr_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)) < 0) {
+            T_E("timerfd_create() failed");
+        } else if (fd_read_register_name(kr_timer_fd, kr_timer_cb, NULL, "kr_timer") < 0) {
+            T_E("fd_read_register() failed");
+            close(kr_timer_fd);
+            kr_timer_fd = -1;
+        }
+        (void)intr_ev_register(MEBA_EVENT_KR, kr_irq_event);
+    }
 
     for (port_no = 0; port_no < port_cnt; port_no++) {
 
@@ -1623,7 +1829,8 @@ void mscc_appl_kr_init(mscc_appl_init_t *init)
         break;
 
     case MSCC_INIT_CMD_POLL_FASTEST:
-        if (BASE_KR_V3) {
+        // Polling is only needed if KR interrupts are not available
+        if (BASE_KR_V3 && !kr_irq_mode_get(init->board_inst)) {
             kr_poll(init->board_inst);
         }
         break;
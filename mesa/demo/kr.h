@@ -93,8 +93,26 @@ typedef struct {
     mesa_bool_t rsfec;
 } kr_appl_train_t;
 
+typedef struct {
+    uint32_t cnt;
+    uint32_t last;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} kr_time_stat_t;
+
+typedef struct {
+    kr_time_stat_t aneg;   // Aneg start to AN_GOOD (ms)
+    kr_time_stat_t train;  // Training start to training done (ms)
+    uint32_t irq_events;   // KR interrupt events
+    uint32_t irq_cnt;      // Serviced non-zero IRQ vectors
+    uint32_t timeouts;     // Expired 802.3ap deadlines
+} kr_appl_stats_t;
+
 typedef struct {
     kr_appl_train_t tr;
+    kr_appl_stats_t stats;
+    uint64_t deadline_us;  // Aneg/training deadline, zero if idle
     mesa_port_speed_t next_parallel_spd;
     mesa_bool_t cap_25g;
     mesa_bool_t cap_10g;
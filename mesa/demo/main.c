@@ -9,11 +9,18 @@
 #include <linux/i2c.h>      /* I2C support */
 #include <linux/i2c-dev.h>  /* I2C support */
 #include <unistd.h>
+#include <signal.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/personality.h>
+#include <sys/stat.h>
 #include <sys/socket.h>
-#include <sys/select.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 #include <sys/syscall.h>
+#include <time.h>
+#include <pthread.h>
 
 #include "microchip/ethernet/switch/api.h"
 #include "microchip/ethernet/board/api.h"
@@ -545,13 +552,49 @@ static void board_debug(meba_trace_level_t level,
     }
 }
 
+/* API locks, allowing MEBA to access the PHYs from several threads */
+static pthread_once_t  main_lock_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t main_api_mutex;
+static pthread_mutex_t main_phy_mutex;
+
+static void main_lock_init(void)
+{
+    pthread_mutexattr_t attr;
+
+    // Recursive, in case a callback calls the API again
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&main_api_mutex, &attr);
+    pthread_mutex_init(&main_phy_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+static void main_lock(pthread_mutex_t *mutex)
+{
+    pthread_once(&main_lock_once, main_lock_init);
+    pthread_mutex_lock(mutex);
+}
+
 /* MESA callouts */
 void mesa_callout_lock(const mesa_api_lock_t *const lock)
 {
+    main_lock(&main_api_mutex);
 }
 
 void mesa_callout_unlock(const mesa_api_lock_t *const lock)
 {
+    pthread_mutex_unlock(&main_api_mutex);
+}
+
+/* MEPA callouts */
+static void mepa_callout_lock(const mepa_lock_t *const lock)
+{
+    main_lock(&main_phy_mutex);
+}
+
+static void mepa_callout_unlock(const mepa_lock_t *const lock)
+{
+    pthread_mutex_unlock(&main_phy_mutex);
 }
 
 static meba_board_interface_t board_info;
@@ -663,6 +706,21 @@ static mscc_appl_opt_t main_opt_warm = {
     warm_option
 };
 
+static const char *state_file;
+
+static mesa_rc state_file_option(char *parm)
+{
+    state_file = parm;
+    return MESA_RC_OK;
+}
+
+static mscc_appl_opt_t main_opt_state_file = {
+    "P:",
+    "<file>",
+    "Keep the API state in a shared memory file (e.g. /dev/shm/mesa) and adopt it after restart",
+    state_file_option
+};
+
 static mesa_rc loop_port_opt(char *parm)
 {
     uint32_t uport;
@@ -687,6 +745,330 @@ static mscc_appl_opt_t main_opt_loop_port = {
     loop_port_opt
 };
 
+/* - Event loop ---------------------------------------------------- */
+
+// Histogram with logarithmic buckets, bucket 'i' counts values in [2^i; 2^(i+1)[ usec.
+// Bucket zero also counts zero and the last bucket counts all larger values.
+#define LOOP_HIST_CNT 16
+
+typedef struct {
+    uint32_t cnt;
+    uint32_t max;
+    uint64_t total;
+    uint32_t bucket[LOOP_HIST_CNT];
+} loop_hist_t;
+
+typedef struct {
+    int                fd;
+    const char         *name;
+    fd_read_callback_t cb;
+    void               *ref;
+    mesa_bool_t        event; // Event descriptor, the counter is cleared before the callback
+    loop_hist_t        run;   // Callback runtime
+} fd_read_reg_t;
+
+#define FD_REG_MAX 64
+static fd_read_reg_t fd_reg_table[FD_REG_MAX];
+
+// Periodic module polling timers
+typedef struct {
+    const char           *name;
+    mscc_appl_init_cmd_t cmd;
+    uint32_t             period_us;
+    uint64_t             next_us; // Next expiry
+    uint32_t             overrun; // Number of missed expiries
+    loop_hist_t          lat;     // Latency from expiry to callback
+} loop_timer_t;
+
+static loop_timer_t loop_timer_table[] = {
+    { "poll_fastest", MSCC_INIT_CMD_POLL_FASTEST, 10000 },
+    { "poll_fast",    MSCC_INIT_CMD_POLL_FAST,    10000 },
+    { "poll_1sec",    MSCC_INIT_CMD_POLL,         1000000 },
+};
+
+#define LOOP_EVENT_MAX 32
+static int loop_epoll_fd = -1;
+
+static uint64_t loop_usec_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+
+static void loop_hist_add(loop_hist_t *hist, uint64_t usec)
+{
+    uint32_t i, val = (usec > 0xffffffff ? 0xffffffff : usec);
+
+    for (i = 0; i < (LOOP_HIST_CNT - 1) && (val >> (i + 1)) != 0; i++) {
+    }
+    hist->cnt++;
+    hist->total += val;
+    hist->bucket[i]++;
+    if (val > hist->max) {
+        hist->max = val;
+    }
+}
+
+static int loop_epoll_get(void)
+{
+    if (loop_epoll_fd < 0 && (loop_epoll_fd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        T_E("epoll_create1() failed: %s", strerror(errno));
+    }
+    return loop_epoll_fd;
+}
+
+static int fd_reg(int fd, fd_read_callback_t cb, void *ref, const char *name, mesa_bool_t event)
+{
+    int                i, free = -1, epfd;
+    fd_read_reg_t      *reg;
+    struct epoll_event ev = {};
+
+    if (fd <= 0) {
+        T_E("illegal fd: %d", fd);
+        return -1;
+    }
+
+    if ((epfd = loop_epoll_get()) < 0) {
+        return -1;
+    }
+
+    for (i = 0; i < FD_REG_MAX; i++) {
+        reg = &fd_reg_table[i];
+        if (reg->fd == fd) {
+            if (cb == NULL) {
+                // Deregistration, the descriptor may already be closed
+                (void)epoll_ctl(epfd, EPOLL_CTL_DEL, fd, NULL);
+                reg->fd = 0;
+            } else {
+                // Re-registration
+                reg->cb = cb;
+                reg->ref = ref;
+                if (name != NULL) {
+                    reg->name = name;
+                }
+            }
+            return 0;
+        } else if (cb != NULL && reg->fd == 0 && free < 0) {
+            // First free entry found
+            free = i;
+        }
+    }
+    if (free < 0) {
+        return -1;
+    }
+
+    // New registration, the event data holds both the descriptor and the table index
+    ev.events = EPOLLIN;
+    ev.data.u64 = (((uint64_t)fd << 32) | free);
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        T_E("epoll_ctl() failed: %s", strerror(errno));
+        return -1;
+    }
+    reg = &fd_reg_table[free];
+    memset(reg, 0, sizeof(*reg));
+    reg->fd = fd;
+    reg->name = name;
+    reg->cb = cb;
+    reg->ref = ref;
+    reg->event = event;
+    return 0;
+}
+
+int fd_read_register(int fd, fd_read_callback_t cb, void *ref)
+{
+    return fd_reg(fd, cb, ref, NULL, 0);
+}
+
+int fd_read_register_name(int fd, fd_read_callback_t cb, void *ref, const char *name)
+{
+    return fd_reg(fd, cb, ref, name, 0);
+}
+
+int event_fd_register(fd_read_callback_t cb, void *ref, const char *name)
+{
+    int fd;
+
+    if ((fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+        T_E("eventfd() failed: %s", strerror(errno));
+    } else if (fd_reg(fd, cb, ref, name, 1) < 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+void event_fd_signal(int fd)
+{
+    uint64_t val = 1;
+
+    if (write(fd, &val, sizeof(val)) != sizeof(val)) {
+        T_E("eventfd write failed: %s", strerror(errno));
+    }
+}
+
+static void loop_timer_cb(int fd, void *ref)
+{
+    loop_timer_t *timer = ref;
+    uint64_t     exp, now;
+
+    if (read(fd, &exp, sizeof(exp)) != sizeof(exp) || exp == 0) {
+        return;
+    }
+
+    // Expiries missed while the loop was busy are coalesced into one callback
+    now = loop_usec_get();
+    timer->next_us += (exp * timer->period_us);
+    timer->overrun += (exp - 1);
+    loop_hist_add(&timer->lat, now - (timer->next_us - timer->period_us));
+
+    T_N("%s", timer->name);
+    appl_init.cmd = timer->cmd;
+    init_modules(&appl_init);
+    if (timer->cmd == MSCC_INIT_CMD_POLL && mesa_poll_1sec(NULL) != MESA_RC_OK) {
+        T_E("mesa_poll_1sec() failed");
+    }
+}
+
+static int loop_timer_init(uint32_t fastest_us)
+{
+    loop_timer_t      *timer;
+    struct itimerspec its = {};
+    uint64_t          now = loop_usec_get();
+    int               i, fd;
+
+    for (i = 0; i < ARRSZ(loop_timer_table); i++) {
+        timer = &loop_timer_table[i];
+        if (timer->cmd == MSCC_INIT_CMD_POLL_FASTEST) {
+            timer->period_us = fastest_us;
+        }
+        timer->next_us = (now + timer->period_us);
+        its.it_value.tv_sec = (timer->next_us / 1000000);
+        its.it_value.tv_nsec = ((timer->next_us % 1000000) * 1000);
+        its.it_interval.tv_sec = (timer->period_us / 1000000);
+        its.it_interval.tv_nsec = ((timer->period_us % 1000000) * 1000);
+        if ((fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)) < 0) {
+            T_E("timerfd_create() failed: %s", strerror(errno));
+            return -1;
+        }
+        if (timerfd_settime(fd, TFD_TIMER_ABSTIME, &its, NULL) < 0 ||
+            fd_read_register_name(fd, loop_timer_cb, timer, timer->name) < 0) {
+            T_E("timer %s setup failed", timer->name);
+            close(fd);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void loop_dispatch(struct epoll_event *ev)
+{
+    uint32_t      idx = (ev->data.u64 & 0xffffffff);
+    int           fd = (ev->data.u64 >> 32);
+    fd_read_reg_t *reg;
+    uint64_t      val, start;
+
+    if (idx >= FD_REG_MAX || (reg = &fd_reg_table[idx])->fd != fd) {
+        // Deregistered by an earlier callback
+        return;
+    }
+    if (reg->event && read(fd, &val, sizeof(val)) < 0 && errno != EAGAIN) {
+        T_E("eventfd read failed: %s", strerror(errno));
+    }
+    start = loop_usec_get();
+    reg->cb(fd, reg->ref);
+    loop_hist_add(&reg->run, loop_usec_get() - start);
+}
+
+static void loop_hist_print(const char *name, const char *type, loop_hist_t *hist)
+{
+    char     buf[256], *p = buf;
+    uint32_t i;
+
+    for (i = 0; i < LOOP_HIST_CNT; i++) {
+        if (hist->bucket[i]) {
+            p += sprintf(p, " %u%s:%u", 1 << i, i == (LOOP_HIST_CNT - 1) ? "+" : "", hist->bucket[i]);
+        }
+    }
+    *p = 0;
+    cli_printf("%-16s  %-7s  %-10u  %-10u  %-10u %s\n", name, type, hist->cnt,
+               hist->cnt ? (uint32_t)(hist->total / hist->cnt) : 0, hist->max, buf);
+}
+
+typedef struct {
+    mesa_bool_t clear;
+} main_cli_req_t;
+
+static void cli_cmd_loop(cli_req_t *req)
+{
+    main_cli_req_t *mreq = req->module_req;
+    fd_read_reg_t  *reg;
+    loop_timer_t   *timer;
+    int            i;
+    char           buf[32];
+
+    if (!mreq->clear) {
+        cli_table_header("Name              Type     Count       Avg [us]    Max [us]   Histogram [us:count]");
+    }
+    for (i = 0; i < ARRSZ(loop_timer_table); i++) {
+        timer = &loop_timer_table[i];
+        if (mreq->clear) {
+            timer->overrun = 0;
+            memset(&timer->lat, 0, sizeof(timer->lat));
+        } else {
+            loop_hist_print(timer->name, "Latency", &timer->lat);
+        }
+    }
+    for (i = 0; i < FD_REG_MAX; i++) {
+        reg = &fd_reg_table[i];
+        if (reg->fd == 0) {
+            continue;
+        }
+        if (mreq->clear) {
+            memset(&reg->run, 0, sizeof(reg->run));
+        } else {
+            if (reg->name == NULL) {
+                sprintf(buf, "fd-%d", reg->fd);
+            }
+            loop_hist_print(reg->name ? reg->name : buf, "Runtime", &reg->run);
+        }
+    }
+    if (!mreq->clear) {
+        cli_printf("\n");
+        for (i = 0; i < ARRSZ(loop_timer_table); i++) {
+            timer = &loop_timer_table[i];
+            cli_printf("%-16s  period: %u usec, overruns: %u\n", timer->name, timer->period_us, timer->overrun);
+        }
+    }
+}
+
+static int cli_parm_keyword(cli_req_t *req)
+{
+    const char     *found;
+    main_cli_req_t *mreq = req->module_req;
+
+    if ((found = cli_parse_find(req->cmd, req->stx)) == NULL)
+        return 1;
+
+    if (!strncmp(found, "clear", 5))
+        mreq->clear = 1;
+    else
+        cli_printf("no match: %s\n", found);
+
+    return 0;
+}
+
+static cli_parm_t cli_parm_table[] = {
+    {
+        "clear",
+        "Clear event loop statistics",
+        CLI_PARM_FLAG_NO_TXT,
+        cli_parm_keyword,
+        cli_cmd_loop
+    },
+};
+
 static void cli_cmd_warm_start(cli_req_t *req)
 {
     mesa_inst_create_t create;
@@ -755,6 +1137,11 @@ static cli_cmd_t cli_cmd_table[] = {
         "Shows boad config",
         cli_cmd_board_dump
     },
+    {
+        "Debug Loop [clear]",
+        "Show or clear event loop latency and callback runtime histograms",
+        cli_cmd_loop
+    },
 };
 
 static void main_cli_init(void)
@@ -765,6 +1152,11 @@ static void main_cli_init(void)
     for (i = 0; i < sizeof(cli_cmd_table)/sizeof(cli_cmd_t); i++) {
         mscc_appl_cli_cmd_reg(&cli_cmd_table[i]);
     }
+
+    /* Register parameters */
+    for (i = 0; i < sizeof(cli_parm_table)/sizeof(cli_parm_t); i++) {
+        mscc_appl_cli_parm_reg(&cli_parm_table[i]);
+    }
 }
 
 static int  RESET_FPGA = 0;
@@ -892,6 +1284,7 @@ static void main_init(mscc_appl_init_t *init)
         mscc_appl_opt_reg(&main_opt);
         mscc_appl_opt_reg(&main_opt_foreground);
         mscc_appl_opt_reg(&main_opt_warm);
+        mscc_appl_opt_reg(&main_opt_state_file);
         mscc_appl_opt_reg(&main_opt_loop_port);
         mscc_appl_opt_reg(&main_opt_reset);
         mscc_appl_opt_reg(&main_opt_spidev);
@@ -929,53 +1322,6 @@ static void init_modules(mscc_appl_init_t *init)
     mscc_appl_intr_init(init);
 }
 
-typedef struct {
-    int                fd;
-    fd_read_callback_t cb;
-    void               *ref;
-} fd_read_reg_t;
-
-#define FD_REG_MAX 32
-fd_read_reg_t fd_reg_table[FD_REG_MAX];
-
-int fd_read_register(int fd, fd_read_callback_t cb, void *ref)
-{
-    int           i, free = -1;
-    fd_read_reg_t *reg;
-
-    if (fd <= 0) {
-        T_E("illegal fd: %d", fd);
-        return -1;
-    }
-
-    for (i = 0; i < FD_REG_MAX; i++) {
-        reg = &fd_reg_table[i];
-        if (reg->fd == fd) {
-            if (cb == NULL) {
-                // Deregistration
-                reg->fd = 0;
-            } else {
-                // Re-registration
-                reg->cb = cb;
-                reg->ref = ref;
-            }
-            return 0;
-        } else if (cb != NULL && reg->fd == 0 && free < 0) {
-            // First free entry found
-            free = i;
-        }
-    }
-    if (free < 0) {
-        return -1;
-    }
-    // New registration
-    reg = &fd_reg_table[free];
-    reg->fd = fd;
-    reg->cb = cb;
-    reg->ref = ref;
-    return 0;
-}
-
 static mesa_rc gpio_func_info_get(const mesa_inst_t inst, mesa_gpio_func_t gpio_func,  mesa_gpio_func_info_t *info)
 {
     if (appl_init.board_inst->api.meba_gpio_func_info_get != NULL) {
@@ -995,14 +1341,92 @@ static mesa_rc serdes_tap_get(const mesa_inst_t inst, mesa_port_no_t port_no,
     }
 }
 
-mesa_bool_t poll_cnt_us(uint32_t sleep_us, uint32_t *poll_cnt, uint32_t wait_usec)
+/* - Persistent API state ------------------------------------------ */
+
+// The API state is only adopted if the code and the state are located at the same addresses
+// as in the previous process. Address space randomization is therefore disabled and the
+// state file starts with the address where the file was mapped.
+typedef struct {
+    uint64_t addr;
+} state_file_hdr_t;
+
+#define STATE_FILE_HDR_SIZE 4096 // Keeps the API state page aligned
+
+static volatile sig_atomic_t state_stop;
+static sigset_t              state_sigmask; // Signal mask used while waiting for events
+
+static void state_signal(int sig)
 {
-    if ((sleep_us * *poll_cnt) % wait_usec == 0) {
-        return 1;
+    state_stop = 1;
+}
+
+// Must be called before any files are opened, as the process may be restarted
+static void state_aslr_disable(char **argv)
+{
+    int pers;
+
+    if (state_file == NULL) {
+        return;
+    }
+    if ((pers = personality(0xffffffff)) != -1 && (pers & ADDR_NO_RANDOMIZE) == 0) {
+        // Restart without address space randomization
+        if (personality(pers | ADDR_NO_RANDOMIZE) != -1) {
+            execv("/proc/self/exe", argv);
+        }
+        T_E("disabling address space randomization failed: %s", strerror(errno));
+    }
+}
+
+static int state_file_map(mesa_inst_create_t *create)
+{
+    int              fd;
+    uint32_t         size;
+    size_t           len;
+    struct stat      st = {};
+    state_file_hdr_t hdr = {}, *mem;
+    struct sigaction sa = {};
+    sigset_t         mask;
+
+    (void)sigprocmask(SIG_SETMASK, NULL, &state_sigmask);
+    if (state_file == NULL) {
+        return 0;
+    }
+
+    if (mesa_inst_persist_size_get(&size) != MESA_RC_OK) {
+        T_E("mesa_inst_persist_size_get() failed");
+        return -1;
     }
-    if (*poll_cnt > 10000) {
-        *poll_cnt = 0;
+    len = (STATE_FILE_HDR_SIZE + size);
+    if ((fd = open(state_file, O_RDWR | O_CREAT | O_CLOEXEC, 0600)) < 0) {
+        T_E("open(%s) failed: %s", state_file, strerror(errno));
+        return -1;
+    }
+    if (fstat(fd, &st) == 0 && st.st_size == (off_t)len && pread(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr)) {
+        hdr.addr = 0;
     }
+    if ((st.st_size != (off_t)len && ftruncate(fd, len) < 0) ||
+        (mem = mmap((void *)(uintptr_t)hdr.addr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+        T_E("mapping %s failed: %s", state_file, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    close(fd);
+    if (hdr.addr != 0 && hdr.addr != (uintptr_t)mem) {
+        T_I("%s mapped at new address, the API state is not adopted", state_file);
+    }
+    mem->addr = (uintptr_t)mem;
+    create->state_mem = ((uint8_t *)mem + STATE_FILE_HDR_SIZE);
+    create->state_size = size;
+
+    // Termination signals are only delivered while waiting for events, where the API
+    // state is released for adoption by the next process.
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGTERM);
+    sigaddset(&mask, SIGINT);
+    (void)sigprocmask(SIG_BLOCK, &mask, NULL);
+    sa.sa_handler = state_signal;
+    (void)sigaction(SIGTERM, &sa, NULL);
+    (void)sigaction(SIGINT, &sa, NULL);
     return 0;
 }
 
@@ -1018,16 +1442,15 @@ int main(int argc, char **argv)
     meba_port_entry_t  port_entry;
     mesa_port_no_t     port_no;
     mesa_chip_id_t     chip_id;
-    struct timeval     tv;
-    int                i, fd, fd_max;
-    fd_set             rfds;
-    fd_read_reg_t      *reg;
+    struct epoll_event events[LOOP_EVENT_MAX];
+    int                i, n;
     reg_read_t         reg_read;
     reg_write_t        reg_write;
-    uint32_t           sleep_us = 10000, poll_cnt = 0;
+    uint32_t           fastest_us = 10000;
+    mesa_inst_persist_status_t persist = {};
 
     if (mesa_capability(NULL, MESA_CAP_PORT_KR_IRQ)) {
-        sleep_us = 200;
+        fastest_us = 200;
     }
 
     // Register trace
@@ -1036,6 +1459,7 @@ int main(int argc, char **argv)
 
     // Parse options
     main_parse_options(argc, argv);
+    state_aslr_disable(argv);
 
     if (!run_in_foreground) {
         if (daemon(0, 1) < 0) {
@@ -1085,6 +1509,8 @@ int main(int argc, char **argv)
     board_info.conf_get = board_conf_get;
     board_info.debug = board_debug;
     board_info.trace = mscc_mepa_trace_printf;
+    board_info.lock_enter = mepa_callout_lock;
+    board_info.lock_exit = mepa_callout_unlock;
     if ((meba_inst = meba_initialize(sizeof(board_info), &board_info)) == NULL) {
         T_E("MEBA failed to Instantiate");
         return 1;
@@ -1094,10 +1520,16 @@ int main(int argc, char **argv)
 
     // Create API instance
     mesa_inst_get(meba_inst->props.target, &create);
+    if (state_file_map(&create) < 0) {
+        return 1;
+    }
     if (mesa_inst_create(&create, NULL) != MESA_RC_OK) {
         T_E("API Failed to Instantiate");
         return 1;
     }
+    if (mesa_inst_persist_status_get(NULL, &persist) == MESA_RC_OK && persist.adopted) {
+        T_I("API state adopted");
+    }
     T_D("API Instantiated");
 
     // Initialize API instance
@@ -1124,28 +1556,31 @@ int main(int argc, char **argv)
     }
     T_D("API initialized");
 
-    // Do a board init before the port map is established in case of any changes
-    MEBA_WRAP(meba_reset, init->board_inst, MEBA_BOARD_INITIALIZE);
+    // The board and port map are already initialized for an adopted API state
+    if (!persist.adopted) {
+        // Do a board init before the port map is established in case of any changes
+        MEBA_WRAP(meba_reset, init->board_inst, MEBA_BOARD_INITIALIZE);
 
-    // Setup port mapping
-    if ((port_map = calloc(port_cnt, sizeof(*port_map))) == NULL) {
-        T_E("port map calloc() failed");
-        return 1;
-    }
-    for (port_no = 0; port_no < port_cnt; port_no++) {
-        if (meba_inst->api.meba_port_entry_get(meba_inst, port_no, &port_entry) != MESA_RC_OK) {
-            memset(&port_entry, 0, sizeof(port_entry));
-            port_entry.map.chip_port = -1; // Unused
+        // Setup port mapping
+        if ((port_map = calloc(port_cnt, sizeof(*port_map))) == NULL) {
+            T_E("port map calloc() failed");
+            return 1;
         }
-        port_map[port_no] = port_entry.map;
-    }
-    rc = mesa_port_map_set(NULL, port_cnt, port_map);
-    free(port_map);
-    if (rc != MESA_RC_OK) {
-        T_E("mesa_port_map_set() failed");
-        return 1;
+        for (port_no = 0; port_no < port_cnt; port_no++) {
+            if (meba_inst->api.meba_port_entry_get(meba_inst, port_no, &port_entry) != MESA_RC_OK) {
+                memset(&port_entry, 0, sizeof(port_entry));
+                port_entry.map.chip_port = -1; // Unused
+            }
+            port_map[port_no] = port_entry.map;
+        }
+        rc = mesa_port_map_set(NULL, port_cnt, port_map);
+        free(port_map);
+        if (rc != MESA_RC_OK) {
+            T_E("mesa_port_map_set() failed");
+            return 1;
+        }
+        T_D("Port map initialized");
     }
-    T_D("Port map initialized");
 
     // Read chip id (register access check)
     if (mesa_chip_id_get(NULL, &chip_id) != MESA_RC_OK) {
@@ -1166,48 +1601,25 @@ int main(int argc, char **argv)
         MEBA_WRAP(meba_reset, init->board_inst, MEBA_FAN_INITIALIZE);
     }
     // Poll modules
-    while (1) {
-        FD_ZERO(&rfds);
-        fd_max = 0;
-        for (i = 0; i < FD_REG_MAX; i++) {
-            fd = fd_reg_table[i].fd;
-            if (fd > 0) {
-                FD_SET(fd, &rfds);
-                if (fd > fd_max) {
-                    fd_max = fd;
-                }
-            }
-        }
-        tv.tv_sec = 0;
-        tv.tv_usec = sleep_us; // was 10000
-        if (select(fd_max + 1, &rfds, NULL, NULL, &tv) < 0) {
-            T_E("select() failed");
-        } else {
-            for (i = 0; i < FD_REG_MAX; i++) {
-                reg = &fd_reg_table[i];
-                if (reg->fd > 0 && FD_ISSET(reg->fd, &rfds)) {
-                    reg->cb(reg->fd, reg->ref);
-                }
-            }
-        }
-        init->cmd = MSCC_INIT_CMD_POLL_FASTEST;
-        init_modules(init);
-        poll_cnt++;
-        if (poll_cnt_us(sleep_us, &poll_cnt, 1000000)) { // 1 sec poll
-            T_N("Call init_modules() and mesa_poll_1sec()");
-            init->cmd = MSCC_INIT_CMD_POLL;
-            init_modules(init);
-            if (MESA_RC_OK != mesa_poll_1sec(NULL)) {  // One sec poll
-                T_E("mesa_poll_1sec() failed");
+    if (loop_timer_init(fastest_us) < 0) {
+        return 1;
+    }
+    while (!state_stop) {
+        if ((n = epoll_pwait(loop_epoll_fd, events, LOOP_EVENT_MAX, -1, &state_sigmask)) < 0) {
+            if (errno != EINTR) {
+                T_E("epoll_pwait() failed: %s", strerror(errno));
             }
+            continue;
         }
-
-        if (poll_cnt_us(sleep_us, &poll_cnt, 10000)) { // 10 ms poll
-            T_N("MSCC_INIT_CMD_POLL_FAST");
-            init->cmd = MSCC_INIT_CMD_POLL_FAST;
-            init_modules(init);
+        for (i = 0; i < n; i++) {
+            loop_dispatch(&events[i]);
         }
     }
 
+    // Release the API state for adoption by the next process
+    T_I("terminating");
+    if (mesa_inst_destroy(NULL) != MESA_RC_OK) {
+        T_E("mesa_inst_destroy() failed");
+    }
     return 0;
 }
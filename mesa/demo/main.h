@@ -99,6 +99,11 @@ extern mesa_port_no_t ip_port;
 // File descriptor read activity callback registration
 typedef void (*fd_read_callback_t)(int fd, void *ref);
 int fd_read_register(int fd, fd_read_callback_t callback, void *ref);
+int fd_read_register_name(int fd, fd_read_callback_t callback, void *ref, const char *name);
+
+// Event descriptor for wakeup from other threads using event_fd_signal()
+int event_fd_register(fd_read_callback_t callback, void *ref, const char *name);
+void event_fd_signal(int fd);
 
 void get_mac_addr(uint8_t *mac);
 void ip_mac_setup(mesa_vid_t vid, mesa_bool_t add);
@@ -189,7 +189,7 @@ static void cli_cmd_tap_add(cli_req_t *req)
         return;
     }
 
-    if (fd_read_register(fd, tap_read, tap) < 0) {
+    if (fd_read_register_name(fd, tap_read, tap, "tap") < 0) {
         cli_printf("Read registrations exceeded\n");
         close(fd);
         return;
@@ -1362,12 +1362,19 @@ static void port_cli_init(void)
  *  Initialization
  * ================================================================= */
 
+static void check_sfp_drv_status(meba_inst_t inst, mesa_port_no_t port_no, mesa_bool_t sfp_is_inserted);
+
 static void port_init(meba_inst_t inst)
 {
     uint32_t              port_cnt = mesa_capability(NULL, MESA_CAP_PORT_CNT);
     mesa_port_no_t        port_no;
     port_entry_t          *entry;
     mscc_appl_port_conf_t *pc;
+    mesa_port_list_t      phy_list, phy_failed;
+    mepa_reset_param_t    phy_reset = {};
+    meba_phy_reset_stat_t phy_stat;
+    mesa_inst_persist_status_t persist = {};
+    uint32_t              i;
     mesa_rc               rc;
 
     // Free old port table
@@ -1386,9 +1393,18 @@ static void port_init(meba_inst_t inst)
     /* Set front status LED */
     MEBA_WRAP(meba_status_led_set, inst, MEBA_LED_TYPE_FRONT, MEBA_LED_COLOR_GREEN);
 
+    // Ports of an adopted API state are already running and are not reset or reconfigured
+    if (mesa_inst_persist_status_get(NULL, &persist) != MESA_RC_OK) {
+        persist.adopted = 0;
+    }
+
     // Port reset
     MEBA_WRAP(meba_reset, inst, MEBA_PHY_INITIALIZE);
-    MEBA_WRAP(meba_reset, inst, MEBA_PORT_RESET);
+    if (!persist.adopted) {
+        MEBA_WRAP(meba_reset, inst, MEBA_PORT_RESET);
+    }
+
+    mesa_port_list_clear(&phy_list);
 
     for (port_no = 0; port_no < port_cnt; port_no++) {
         entry = &port_table[port_no];
@@ -1461,14 +1477,32 @@ static void port_init(meba_inst_t inst)
             break;
         }
         if (entry->media_type == MSCC_PORT_TYPE_CU) {
-            mepa_reset_param_t phy_reset = {};
-            phy_reset.media_intf = MESA_PHY_MEDIA_IF_CU;
-            T_I("phy_reset: %u", port_no);
-            rc = (meba_phy_reset(inst, port_no, &phy_reset));
-            if (rc == MESA_RC_NOT_IMPLEMENTED || rc == MESA_RC_OK) {
-                // Reset is not always implemented in e.g. third party phys
-            } else {
-                T_E("meba_phy_reset(%u) failed: %d", port_no, rc);
+            mesa_port_list_set(&phy_list, port_no, 1);
+        }
+    }
+
+    // Reset all copper PHYs, package base ports first. The MDIO buses are reset in parallel.
+    phy_reset.media_intf = MESA_PHY_MEDIA_IF_CU;
+    if (persist.adopted) {
+        mesa_port_list_clear(&phy_list);
+    }
+    if ((rc = meba_phy_reset_list(inst, &phy_list, &phy_reset, TRUE, &phy_failed, &phy_stat)) != MESA_RC_OK) {
+        T_E("meba_phy_reset_list() failed: %d", rc);
+    }
+    for (i = 0; i < phy_stat.bus_cnt; i++) {
+        meba_phy_bus_stat_t *bus = &phy_stat.bus[i];
+        T_I("phy_reset chip %u, miim_controller %d: %u ports, %u packages, package: %llu us, port: %llu us",
+            bus->chip_no, bus->miim_controller, bus->port_cnt, bus->package_cnt, bus->package_us, bus->port_us);
+    }
+    T_I("phy_reset total: %llu us", phy_stat.total_us);
+
+    for (port_no = 0; port_no < port_cnt; port_no++) {
+        entry = &port_table[port_no];
+        if (!entry->valid) {
+            continue;
+        }
+        if (entry->media_type == MSCC_PORT_TYPE_CU) {
+            if (mesa_port_list_get(&phy_failed, port_no)) {
                 continue;
             }
             if (entry->meba.mac_if == MESA_PORT_INTERFACE_QXGMII) {
@@ -1480,20 +1514,22 @@ static void port_init(meba_inst_t inst)
         } else {
             /* Disable Clause 37 per default */
             mesa_port_clause_37_control_t ctrl = {0};
-            if (mesa_port_clause_37_control_set(NULL, port_no, &ctrl) != MESA_RC_OK) {
+            if (!persist.adopted && mesa_port_clause_37_control_set(NULL, port_no, &ctrl) != MESA_RC_OK) {
                 T_E("mesa_port_clause_37_control_set(%u) failed", port_no);
             }
             entry->in_bound_status = TRUE;
         }
 
+        if (persist.adopted) {
+            continue;
+        }
+
         port_setup(port_no, FALSE, TRUE);
 
         // Post Mac configuration phy reset in case of Lan8814.
         if (entry->media_type == MSCC_PORT_TYPE_CU) {
-            mepa_reset_param_t phy_reset = {};
-            phy_reset.media_intf = MESA_PHY_MEDIA_IF_CU;
             phy_reset.reset_point = MEPA_RESET_POINT_POST_MAC;
-            rc = (meba_phy_reset(inst, port_no, &phy_reset));
+            (void)meba_phy_reset(inst, port_no, &phy_reset);
         }
 
         if (port_no == loop_port) { // This port is the active loop port
@@ -1552,7 +1588,23 @@ static void port_init(meba_inst_t inst)
     sfp_drivers_prepend(meba_mac_to_mac_driver_init());
     sfp_drivers_prepend(meba_fs_driver_init());
 
-    MEBA_WRAP(meba_reset, inst, MEBA_PORT_RESET_POST);
+    if (persist.adopted) {
+        // Take over the current link and SFP state, so the first poll does not reconfigure the ports
+        for (port_no = 0; port_no < port_cnt; port_no++) {
+            entry = &port_table[port_no];
+            if (!entry->valid) {
+                continue;
+            }
+            (void)mesa_port_state_get(NULL, port_no, &entry->status.link);
+            if (entry->media_type == MSCC_PORT_TYPE_SFP && (entry->meba.cap & MEBA_PORT_CAP_SFP_DETECT) &&
+                MEBA_WRAP(meba_sfp_status_get, inst, port_no, &entry->sfp_status) == MESA_RC_OK &&
+                entry->sfp_status.present) {
+                check_sfp_drv_status(inst, port_no, TRUE);
+            }
+        }
+    } else {
+        MEBA_WRAP(meba_reset, inst, MEBA_PORT_RESET_POST);
+    }
     MEBA_WRAP(meba_reset, inst, MEBA_PORT_LED_INITIALIZE);
 }
 
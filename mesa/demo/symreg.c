@@ -112,6 +112,23 @@ typedef struct {
         const mesa_symreg_reg_t    *r;
     } u;
 
+    // Length of the pattern before the first wildcard and hash of the pattern
+    size_t   prefix_len;
+    uint32_t pattern_hash;
+
+    // Matching entries found through the name index (ascending index order).
+    // If not valid, all entries are considered. Direct candidates are a range
+    // of the name index, otherwise they are copied to #cand. The candidates are
+    // reused while the parent is unchanged, e.g. for replicated groups.
+    const void  *cand_parent;
+    mesa_bool_t cand_valid;
+    mesa_bool_t cand_direct;
+    uint32_t    cand_first;
+    uint32_t    *cand;
+    uint32_t    cand_cnt;
+    uint32_t    cand_max;
+    uint32_t    cand_pos;
+
     // For debug
     const char *self_name;
 } symreg_state_t;
@@ -122,6 +139,33 @@ typedef struct {
 
 static mesa_symreg_data_t SYMREG_DATA;
 
+// Index entry for a target, register group or register
+typedef struct {
+    const void    *parent; // Target, register group or register array holding the entry
+    const char    *name;   // Entry name
+    unsigned long addr;    // Target base address, group base address or register address
+    uint32_t      idx;     // Index of the entry in the array
+} symreg_idx_entry_t;
+
+// Hash entry for a range of the name index. The name is NULL for the range
+// holding all entries of the parent.
+typedef struct {
+    const void *parent;
+    const char *name;
+    uint32_t   pos;
+    uint32_t   cnt;
+} symreg_hash_t;
+
+// Index built by symreg_init(). Register groups and registers shared by replicated
+// targets are only included once.
+static struct {
+    symreg_idx_entry_t *name;      // Sorted by parent, name and index
+    symreg_idx_entry_t *addr;      // Sorted by parent, address and index
+    uint32_t           cnt;
+    symreg_hash_t      *hash;      // Open addressing hash of parents and names
+    uint32_t           hash_mask;
+} SYMREG_IDX;
+
 /******************************************************************************/
 //
 // Module Helper functions
@@ -370,20 +414,188 @@ static inline mesa_bool_t SYMREG_match_repl(symreg_state_t *s, uint32_t repl)
     }
 }
 
+/****************************************************************************/
+// SYMREG_parent_cmp()
+/****************************************************************************/
+static int SYMREG_parent_cmp(const void *a, const void *b)
+{
+    return ((uintptr_t)a < (uintptr_t)b ? -1 : (uintptr_t)a > (uintptr_t)b ? 1 : 0);
+}
+
+/****************************************************************************/
+// SYMREG_name_hash()
+/****************************************************************************/
+static uint32_t SYMREG_name_hash(const char *name)
+{
+    uint32_t h = 2166136261u;
+
+    while (name != NULL && *name != '\0') {
+        h = ((h ^ (uint8_t)*name++) * 16777619u);
+    }
+
+    return h;
+}
+
+/****************************************************************************/
+// SYMREG_hash()
+// Combines a name hash with the parent.
+/****************************************************************************/
+static inline uint32_t SYMREG_hash(const void *parent, uint32_t name_hash)
+{
+    uint32_t h = (name_hash ^ (uint32_t)((uintptr_t)parent >> 3)) * 0x9e3779b1u;
+
+    return (h ^ (h >> 15));
+}
+
+/****************************************************************************/
+// SYMREG_hash_find()
+// Finds the name index range of #name in #parent, or of all entries in #parent
+// if #name is NULL.
+/****************************************************************************/
+static const symreg_hash_t *SYMREG_hash_find(const void *parent, const char *name, uint32_t name_hash)
+{
+    const symreg_hash_t *h;
+    uint32_t            i;
+
+    if (SYMREG_IDX.hash_mask == 0) {
+        return NULL;
+    }
+
+    for (i = SYMREG_hash(parent, name_hash); ; i++) {
+        h = &SYMREG_IDX.hash[i & SYMREG_IDX.hash_mask];
+        if (h->parent == NULL) {
+            return NULL;
+        }
+
+        if (h->parent == parent &&
+            (name == NULL ? h->name == NULL : h->name != NULL && strcmp(h->name, name) == 0)) {
+            return h;
+        }
+    }
+}
+
+/****************************************************************************/
+// SYMREG_idx_start()
+// Finds the entries of #parent matching the pattern using the name index.
+// Exact names are found by hash lookup and patterns starting with a
+// non-wildcard prefix by binary search. Patterns starting with a wildcard
+// must visit all entries.
+/****************************************************************************/
+static void SYMREG_idx_start(symreg_state_t *s, const void *parent)
+{
+    const symreg_hash_t      *h;
+    const symreg_idx_entry_t *e;
+    size_t                   len = s->prefix_len;
+    uint32_t                 i, j, lo, hi, idx, *cand;
+
+    s->cand_pos = 0;
+    if (parent == s->cand_parent) {
+        return;
+    }
+
+    s->cand_parent = parent;
+    s->cand_valid = FALSE;
+    s->cand_direct = FALSE;
+    s->cand_cnt = 0;
+
+    if (len == 0 || SYMREG_IDX.cnt == 0) {
+        return;
+    }
+
+    s->cand_valid = TRUE;
+    if (!s->wildcards) {
+        if ((h = SYMREG_hash_find(parent, s->pattern, s->pattern_hash)) != NULL) {
+            // Entries with the same name are sorted by index
+            s->cand_direct = TRUE;
+            s->cand_first = h->pos;
+            s->cand_cnt = h->cnt;
+        }
+
+        return;
+    }
+
+    if ((h = SYMREG_hash_find(parent, NULL, SYMREG_name_hash(NULL))) == NULL) {
+        return;
+    }
+
+    // Find the first name with the prefix within the entries of the parent
+    for (lo = h->pos, hi = h->pos + h->cnt; lo < hi; ) {
+        i = (lo + hi) / 2;
+        if (strncmp(SYMREG_IDX.name[i].name, s->pattern, len) < 0) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+
+    for (i = lo; i < h->pos + h->cnt; i++) {
+        e = &SYMREG_IDX.name[i];
+        if (strncmp(e->name, s->pattern, len) != 0) {
+            break;
+        }
+
+        if (!SYMREG_match_name(s, e->name)) {
+            continue;
+        }
+
+        if (s->cand_cnt == s->cand_max) {
+            if ((cand = realloc(s->cand, (s->cand_max + 64) * sizeof(*cand))) == NULL) {
+                // Fall back to visiting all entries
+                s->cand_valid = FALSE;
+                return;
+            }
+
+            s->cand = cand;
+            s->cand_max += 64;
+        }
+
+        // Keep the candidates in index order, so the output order is unchanged
+        idx = e->idx;
+        for (j = s->cand_cnt; j > 0 && s->cand[j - 1] > idx; j--) {
+            s->cand[j] = s->cand[j - 1];
+        }
+
+        s->cand[j] = idx;
+        s->cand_cnt++;
+    }
+}
+
+/****************************************************************************/
+// SYMREG_idx_next()
+// Returns the index of the next entry to consider, or -1 when all
+// candidates have been considered.
+/****************************************************************************/
+static int SYMREG_idx_next(symreg_state_t *s)
+{
+    if (!s->cand_valid) {
+        return s->cur_idx + 1;
+    }
+
+    if (s->cand_pos == s->cand_cnt) {
+        return -1;
+    }
+
+    return (s->cand_direct ? SYMREG_IDX.name[s->cand_first + s->cand_pos++].idx : s->cand[s->cand_pos++]);
+}
+
 /****************************************************************************/
 // SYMREG_reg_next()
 /****************************************************************************/
 static mesa_bool_t SYMREG_reg_next(symreg_state_t *r, mesa_symreg_reg_t const *regs)
 {
+    if (r->cur_idx < 0) {
+        SYMREG_idx_start(r, regs);
+    }
+
     if (r->cur_idx < 0 || r->cur_repl >= (int)regs[r->cur_idx].repl_cnt - 1) {
         // Either we're not started, or we've matched the last
         // replication in the previous iteration. Find next
         // matching register by name.
         r->cur_repl = -1;
-        r->cur_idx++;
+        r->cur_idx = SYMREG_idx_next(r);
     }
 
-    while (regs[r->cur_idx].name != NULL) {
+    while (r->cur_idx >= 0 && regs[r->cur_idx].name != NULL) {
         uint32_t repl;
 
         r->u.r = &regs[r->cur_idx];
@@ -412,7 +624,7 @@ static mesa_bool_t SYMREG_reg_next(symreg_state_t *r, mesa_symreg_reg_t const *r
 
         // No replication match
         r->cur_repl = -1;
-        r->cur_idx++;
+        r->cur_idx = SYMREG_idx_next(r);
     }
 
     return FALSE;
@@ -421,17 +633,21 @@ static mesa_bool_t SYMREG_reg_next(symreg_state_t *r, mesa_symreg_reg_t const *r
 /****************************************************************************/
 // SYMREG_grp_next()
 /****************************************************************************/
-static mesa_bool_t SYMREG_grp_next(symreg_state_t *g, mesa_symreg_reggrp_t const *reggrps)
+static mesa_bool_t SYMREG_grp_next(symreg_state_t *g, mesa_symreg_reggrp_t const *reggrps, symreg_state_t *r)
 {
+    if (g->cur_idx < 0) {
+        SYMREG_idx_start(g, reggrps);
+    }
+
     if (g->cur_idx < 0 || g->cur_repl >= (int)reggrps[g->cur_idx].repl_cnt - 1) {
         // Either we're not started, or we've matched the last
         // replication in the previous iteration. Find next
         // matching group by name.
         g->cur_repl = -1;
-        g->cur_idx++;
+        g->cur_idx = SYMREG_idx_next(g);
     }
 
-    while (reggrps[g->cur_idx].name != NULL) {
+    while (g->cur_idx >= 0 && reggrps[g->cur_idx].name != NULL) {
         uint32_t repl;
 
         g->u.g = &reggrps[g->cur_idx];
@@ -440,7 +656,9 @@ static mesa_bool_t SYMREG_grp_next(symreg_state_t *g, mesa_symreg_reggrp_t const
             // Name match. Check to see if there is a replication fit.
             g->matched_at_least_one_name = TRUE;
 
-            for (repl = g->cur_repl + 1; repl < g->u.g->repl_cnt; repl++) {
+            // Skip all replications if no register in the group can match
+            SYMREG_idx_start(r, g->u.g->regs);
+            for (repl = (r->cand_valid && r->cand_cnt == 0 ? g->u.g->repl_cnt : g->cur_repl + 1); repl < g->u.g->repl_cnt; repl++) {
                 if (SYMREG_match_repl(g, repl)) {
                     g->cur_repl = repl;
                     g->match_cnt++;
@@ -460,7 +678,7 @@ static mesa_bool_t SYMREG_grp_next(symreg_state_t *g, mesa_symreg_reggrp_t const
 
         // No replication match
         g->cur_repl = -1;
-        g->cur_idx++;
+        g->cur_idx = SYMREG_idx_next(g);
     }
 
     return FALSE;
@@ -472,9 +690,12 @@ static mesa_bool_t SYMREG_grp_next(symreg_state_t *g, mesa_symreg_reggrp_t const
 static mesa_bool_t SYMREG_tgt_next(symreg_state_t *t)
 {
     // Each target only has one replication.
-    t->cur_idx++;
+    if (t->cur_idx < 0) {
+        SYMREG_idx_start(t, SYMREG_DATA.targets);
+    }
+    t->cur_idx = SYMREG_idx_next(t);
 
-    while (t->cur_idx < SYMREG_DATA.targets_cnt) {
+    while (t->cur_idx >= 0 && t->cur_idx < SYMREG_DATA.targets_cnt) {
         t->u.t = &SYMREG_DATA.targets[t->cur_idx];
 
         if (SYMREG_match_name(t, t->u.t->name)) {
@@ -505,7 +726,7 @@ static mesa_bool_t SYMREG_tgt_next(symreg_state_t *t)
             }
         }
 
-        t->cur_idx++;
+        t->cur_idx = SYMREG_idx_next(t);
     }
 
     return FALSE;
@@ -563,7 +784,7 @@ static mesa_rc SYMREG_check_pattern(symreg_inst_t *inst, uint32_t *max_width, ui
     while (SYMREG_tgt_next(t)) {
         SYMREG_state_clear(g, FALSE);
 
-        while (SYMREG_grp_next(g, t->u.t->reggrps)) {
+        while (SYMREG_grp_next(g, t->u.t->reggrps, r)) {
             SYMREG_state_clear(r, FALSE);
 
             while (SYMREG_reg_next(r, g->u.g->regs)) {
@@ -679,6 +900,20 @@ static const char *symreg_error_txt(mesa_rc rc)
     }
 }
 
+/******************************************************************************/
+// SYMREG_inst_free()
+/******************************************************************************/
+static void SYMREG_inst_free(symreg_inst_t *inst)
+{
+    int i;
+
+    for (i = 0; i < SYMREG_COMPONENTS_LAST; i++) {
+        free(inst->state[i].cand);
+    }
+
+    free(inst);
+}
+
 /******************************************************************************/
 // symreg_query_init()
 /******************************************************************************/
@@ -813,6 +1048,9 @@ static mesa_rc symreg_query_init(void **handle, char *pattern,
             strcpy(inst->state[i].pattern, "*");
             inst->state[i].wildcards = TRUE;
         }
+
+        inst->state[i].prefix_len = strcspn(inst->state[i].pattern, "*?");
+        inst->state[i].pattern_hash = SYMREG_name_hash(inst->state[i].pattern);
     }
 
     for (i = 0; i < SYMREG_COMPONENTS_LAST; i++) {
@@ -826,7 +1064,7 @@ do_exit:
     if (rc == MESA_RC_OK) {
         *handle = inst;
     } else {
-        free(inst);
+        SYMREG_inst_free(inst);
     }
 
     return rc;
@@ -841,7 +1079,7 @@ static mesa_rc symreg_query_uninit(void *handle)
         return SYMREG_RC_PARAM;
     }
 
-    free(handle);
+    SYMREG_inst_free((symreg_inst_t *)handle);
     return MESA_RC_OK;
 }
 
@@ -872,7 +1110,7 @@ static mesa_rc symreg_query_next(void *handle, char *const name, uint32_t *addr,
             SYMREG_state_clear(g, FALSE);
         }
 
-        while (next || SYMREG_grp_next(g, t->u.t->reggrps)) {
+        while (next || SYMREG_grp_next(g, t->u.t->reggrps, r)) {
             if (!next) {
                 SYMREG_state_clear(r, FALSE);
             }
@@ -893,61 +1131,286 @@ static mesa_rc symreg_query_next(void *handle, char *const name, uint32_t *addr,
     return SYMREG_RC_NO_MORE_REGS;
 }
 
+/******************************************************************************/
+// SYMREG_idx_addr_floor()
+// Returns the last entry of #parent with an address not greater than #addr,
+// or -1 if no such entry exists.
+/******************************************************************************/
+static int SYMREG_idx_addr_floor(const void *parent, unsigned long addr)
+{
+    const symreg_idx_entry_t *e;
+    uint32_t                 lo = 0, hi = SYMREG_IDX.cnt, mid;
+    int                      cmp;
+
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        e = &SYMREG_IDX.addr[mid];
+        if ((cmp = SYMREG_parent_cmp(e->parent, parent)) == 0) {
+            cmp = (e->addr > addr ? 1 : -1);
+        }
+
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return (lo > 0 && SYMREG_IDX.addr[lo - 1].parent == parent ? (int)lo - 1 : -1);
+}
+
+/******************************************************************************/
+// SYMREG_repl_name()
+/******************************************************************************/
+static char *SYMREG_repl_name(char *p, const char *name, mesa_bool_t replicated, uint32_t repl)
+{
+    return p + (replicated ? sprintf(p, "%s[%u]", name, repl) : sprintf(p, "%s", name));
+}
+
+/******************************************************************************/
+// SYMREG_addr_reg()
+// Finds the register at word offset #off within a register group.
+// Replicated registers may be interleaved, so earlier registers are
+// also considered.
+/******************************************************************************/
+static mesa_bool_t SYMREG_addr_reg(mesa_symreg_reg_t const *regs, unsigned long off, char *name)
+{
+    const mesa_symreg_reg_t *r;
+    unsigned long           k, repl;
+    int                     i;
+
+    for (i = SYMREG_idx_addr_floor(regs, off); i >= 0 && SYMREG_IDX.addr[i].parent == regs; i--) {
+        r = &regs[SYMREG_IDX.addr[i].idx];
+        k = off - r->addr;
+        if (r->repl_width == 0) {
+            if (k != 0) {
+                continue;
+            }
+
+            repl = 0;
+        } else if ((k % r->repl_width) != 0) {
+            continue;
+        } else {
+            repl = k / r->repl_width;
+        }
+
+        if (repl < r->repl_cnt) {
+            (void)SYMREG_repl_name(name, r->name, r->repl_cnt != 1, repl);
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/******************************************************************************/
+// SYMREG_addr_grp()
+// Finds the register at word offset #off within a target.
+/******************************************************************************/
+static mesa_bool_t SYMREG_addr_grp(mesa_symreg_reggrp_t const *reggrps, unsigned long off, char *name)
+{
+    const mesa_symreg_reggrp_t *g;
+    unsigned long              k, repl;
+    char                       *p;
+    int                        i;
+
+    for (i = SYMREG_idx_addr_floor(reggrps, off); i >= 0 && SYMREG_IDX.addr[i].parent == reggrps; i--) {
+        g = &reggrps[SYMREG_IDX.addr[i].idx];
+        k = off - g->base_addr;
+        repl = (g->repl_width == 0 ? 0 : k / g->repl_width);
+        if (repl >= g->repl_cnt) {
+            continue;
+        }
+
+        p = SYMREG_repl_name(name, g->name, g->repl_cnt != 1, repl);
+        *p++ = ':';
+        if (SYMREG_addr_reg(g->regs, g->repl_width == 0 ? k : k % g->repl_width, p)) {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/******************************************************************************/
+// SYMREG_addr_lookup()
+// Finds the name of the register at byte address #addr.
+/******************************************************************************/
+static mesa_bool_t SYMREG_addr_lookup(unsigned long addr, char *name)
+{
+    const mesa_symreg_target_t *t;
+    char                       *p;
+    int                        i;
+
+    if (SYMREG_IDX.cnt == 0 || (addr % 4) != 0) {
+        return FALSE;
+    }
+
+    for (i = SYMREG_idx_addr_floor(SYMREG_DATA.targets, addr); i >= 0 && SYMREG_IDX.addr[i].parent == SYMREG_DATA.targets; i--) {
+        t = &SYMREG_DATA.targets[SYMREG_IDX.addr[i].idx];
+        p = SYMREG_repl_name(name, t->name, t->repl_number >= 0, t->repl_number);
+        *p++ = ':';
+        if (SYMREG_addr_grp(t->reggrps, (addr - t->base_addr) / 4, p)) {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
 /******************************************************************************/
 //
 // Public functions
 //
 /******************************************************************************/
 
-void symreg_cli_regs_print(symreg_func_t func, char *pattern, uint32_t value)
+// Register matched by one of the patterns given to symreg_cli_regs_print()
+typedef struct {
+    char     *name;
+    uint32_t addr;
+    uint32_t offset;
+    uint32_t value;
+} symreg_match_t;
+
+/******************************************************************************/
+// SYMREG_pattern_next()
+// Patterns are separated by commas outside brackets. Returns the next
+// pattern (terminated in #buf) or NULL.
+/******************************************************************************/
+static char *SYMREG_pattern_next(char **buf)
 {
-    mesa_rc     rc = MESA_RC_OK;
-    void        *handle;
-    uint32_t    max_width, reg_cnt, addr, the_offset;
-    mesa_bool_t next = FALSE;
-    char        *name = NULL;
+    char *pattern = *buf, *p;
+    int  depth = 0;
 
-    if ((rc = symreg_query_init(&handle, pattern, &max_width, &reg_cnt)) != MESA_RC_OK) {
-        cli_printf("%% %s\n", symreg_error_txt(rc));
-        return;
+    if (pattern == NULL || *pattern == '\0') {
+        return NULL;
+    }
+
+    for (p = pattern; *p != '\0'; p++) {
+        if (*p == '[') {
+            depth++;
+        } else if (*p == ']') {
+            depth--;
+        } else if (*p == ',' && depth == 0) {
+            *p = '\0';
+            *buf = p + 1;
+            return pattern;
+        }
+    }
+
+    *buf = NULL;
+    return pattern;
+}
+
+/******************************************************************************/
+// SYMREG_matches_add()
+// Adds the registers matching #pattern to #matches.
+/******************************************************************************/
+static mesa_rc SYMREG_matches_add(char *pattern, symreg_match_t **matches, uint32_t *cnt, uint32_t *max_width)
+{
+    mesa_rc        rc;
+    void           *handle;
+    uint32_t       width, reg_cnt, addr, offset, i = *cnt;
+    mesa_bool_t    next = FALSE;
+    symreg_match_t *m;
+    char           *name = NULL;
+
+    if ((rc = symreg_query_init(&handle, pattern, &width, &reg_cnt)) != MESA_RC_OK) {
+        return rc;
     }
 
-    if ((name = (char *)malloc(max_width + 1)) == NULL) {
-        cli_printf("%% Out of memory while attempting to allocate %u bytes\n", max_width + 1);
+    if ((m = realloc(*matches, (*cnt + reg_cnt) * sizeof(*m))) == NULL ||
+        (name = (char *)malloc(width + 1)) == NULL) {
+        if (m != NULL) {
+            *matches = m;
+        }
+
+        rc = SYMREG_RC_OUT_OF_MEMORY;
         goto do_exit;
     }
 
-    while ((rc = symreg_query_next(handle, name, &addr, &the_offset, next)) == MESA_RC_OK) {
-        // Compute the address to provide to mesa_reg_read/write().
-        // These functions need the 32-bit address offset relative to the
-        // beginning of the switch core base address (VTSS_IO_ORIGIN1_OFFSET).
-        // This is what is presented in #the_offset.
-        // The functions are luckily able to access CPU-domain registers and
-        // are also dual-chip aware.
-        // Both #the_offset and #addr are byte addresses (always jumps in steps of 4),
-        // but the mesa_reg_read/write() functions expect 32-bit addresses, hence the
-        // division by 4 (right-shift by 2).
-        uint32_t offset = the_offset >> 2, v = 0;
-        int j;
-        mesa_chip_no_t chip_no = 0;
+    *matches = m;
+    if (width > *max_width) {
+        *max_width = width;
+    }
+
+    while (i < *cnt + reg_cnt && (rc = symreg_query_next(handle, name, &addr, &offset, next)) == MESA_RC_OK) {
+        next = TRUE;
+        if ((m[i].name = strdup(name)) == NULL) {
+            rc = SYMREG_RC_OUT_OF_MEMORY;
+            break;
+        }
+
+        m[i].addr = addr;
+        m[i].offset = offset;
+        m[i].value = 0;
+        i++;
+    }
+
+    if (rc == SYMREG_RC_NO_MORE_REGS || i == *cnt + reg_cnt) {
+        rc = MESA_RC_OK;
+    }
+
+do_exit:
+    *cnt = i;
+    free(name);
+    (void)symreg_query_uninit(handle);
+    return rc;
+}
+
+void symreg_cli_regs_print(symreg_func_t func, char *pattern, uint32_t value)
+{
+    mesa_rc        rc = MESA_RC_OK;
+    uint32_t       max_width = 0, cnt = 0, i;
+    symreg_match_t *matches = NULL, *m;
+    char           *buf, *p, *pat;
+    int            j;
+
+    if ((buf = strdup(pattern)) == NULL) {
+        cli_printf("%% %s\n", symreg_error_txt(SYMREG_RC_OUT_OF_MEMORY));
+        return;
+    }
+
+    // Resolve all patterns before accessing any registers
+    for (p = buf; (pat = SYMREG_pattern_next(&p)) != NULL; ) {
+        if ((rc = SYMREG_matches_add(pat, &matches, &cnt, &max_width)) != MESA_RC_OK) {
+            if (pat != buf || p != NULL) {
+                cli_printf("%% %s: %s\n", pat, symreg_error_txt(rc));
+            } else {
+                cli_printf("%% %s\n", symreg_error_txt(rc));
+            }
+
+            goto do_exit;
+        }
+    }
 
+    // Access the registers back to back.
+    // mesa_reg_read/write() need the 32-bit address offset relative to the
+    // beginning of the switch core base address (VTSS_IO_ORIGIN1_OFFSET).
+    // This is what is presented in #offset.
+    // The functions are luckily able to access CPU-domain registers and
+    // are also dual-chip aware.
+    // Both #offset and #addr are byte addresses (always jumps in steps of 4),
+    // but the mesa_reg_read/write() functions expect 32-bit addresses, hence the
+    // division by 4 (right-shift by 2).
+    for (i = 0; i < cnt && func != QUERY; i++) {
+        m = &matches[i];
         if (func == READ) {
-            rc = mesa_reg_read(NULL, chip_no, offset, &v);
-        } else if (func == WRITE) {
-            rc = mesa_reg_write(NULL, chip_no, offset, value);
-            v  = value;
+            rc = mesa_reg_read(NULL, 0, m->offset >> 2, &m->value);
         } else {
-            rc = MESA_RC_OK;
+            rc = mesa_reg_write(NULL, 0, m->offset >> 2, value);
+            m->value = value;
         }
 
         if (rc != MESA_RC_OK) {
-            cli_printf("%% Failed to access register %s at address 0x%08x (which is offset = 0x%08x)\n", name, addr, offset);
+            cli_printf("%% Failed to access register %s at address 0x%08x (which is offset = 0x%08x)\n", m->name, m->addr, m->offset >> 2);
             goto do_exit;
         }
+    }
 
-        if (!next) {
-            next = TRUE;
-
+    for (i = 0; i < cnt; i++) {
+        m = &matches[i];
+        if (i == 0) {
             if (func == QUERY) {
                 cli_printf("%-*s %-10s\n", max_width, "Register", "Address");
             } else {
@@ -956,37 +1419,240 @@ void symreg_cli_regs_print(symreg_func_t func, char *pattern, uint32_t value)
         }
 
         if (func == QUERY) {
-            cli_printf("%-*s 0x%08x\n", max_width, name, addr);
+            cli_printf("%-*s 0x%08x\n", max_width, m->name, m->addr);
         } else {
-            cli_printf("%-*s 0x%08x %10u ", max_width, name, v, v);
+            cli_printf("%-*s 0x%08x %10u ", max_width, m->name, m->value, m->value);
             for (j = 31; j >= 0; j--) {
-                cli_printf("%d%s", v & (1 << j) ? 1 : 0, j == 0 ? "\n" : (j % 4) ? "" : ".");
+                cli_printf("%d%s", m->value & (1 << j) ? 1 : 0, j == 0 ? "\n" : (j % 4) ? "" : ".");
             }
         }
     }
 
-    if (rc != SYMREG_RC_NO_MORE_REGS) {
-        cli_printf("%% %s\n", symreg_error_txt(rc));
-        goto do_exit;
-    }
-
-    cli_printf("%u match%s found\n", reg_cnt, reg_cnt != 1 ? "es" : "");
+    cli_printf("%u match%s found\n", cnt, cnt != 1 ? "es" : "");
 
 do_exit:
-    if (name) {
-        free(name);
+    for (i = 0; i < cnt; i++) {
+        free(matches[i].name);
     }
 
-    if ((rc = symreg_query_uninit(handle)) != MESA_RC_OK) {
-        cli_printf("%% %s\n", symreg_error_txt(rc));
+    free(matches);
+    free(buf);
+}
+
+void symreg_cli_addr_print(uint32_t addr)
+{
+    char          name[3 * (SYMREG_NAME_LEN_MAX + SYMREG_REPL_LEN_MAX + 1)];
+    unsigned long byte_addr = (((unsigned long)addr << 2) + SYMREG_DATA.io_origin1_offset);
+
+    if (!SYMREG_addr_lookup(byte_addr, name)) {
+        cli_printf("%% No register found at offset 0x%08x (address 0x%08lx)\n", addr, byte_addr);
+        return;
     }
 
-    return;
+    cli_printf("%-10s %-10s %s\n", "Offset", "Address", "Register");
+    cli_printf("0x%08x 0x%08lx %s\n", addr, byte_addr, name);
 }
 
 /******************************************************************************/
 // symreg_init()
 /******************************************************************************/
+/******************************************************************************/
+// SYMREG_ptr_unique()
+// Sorts an array of pointers and removes duplicates. Returns the new count.
+/******************************************************************************/
+static int SYMREG_qsort_ptr(const void *a, const void *b)
+{
+    return SYMREG_parent_cmp(*(const void *const *)a, *(const void *const *)b);
+}
+
+static uint32_t SYMREG_ptr_unique(const void **ptrs, uint32_t cnt)
+{
+    uint32_t i, n = 0;
+
+    qsort(ptrs, cnt, sizeof(*ptrs), SYMREG_qsort_ptr);
+    for (i = 0; i < cnt; i++) {
+        if (n == 0 || ptrs[i] != ptrs[n - 1]) {
+            ptrs[n++] = ptrs[i];
+        }
+    }
+
+    return n;
+}
+
+static int SYMREG_qsort_name(const void *a, const void *b)
+{
+    const symreg_idx_entry_t *e1 = a, *e2 = b;
+    int                      cmp;
+
+    if ((cmp = SYMREG_parent_cmp(e1->parent, e2->parent)) == 0 &&
+        (cmp = strcmp(e1->name, e2->name)) == 0) {
+        cmp = (e1->idx < e2->idx ? -1 : e1->idx > e2->idx ? 1 : 0);
+    }
+
+    return cmp;
+}
+
+static int SYMREG_qsort_addr(const void *a, const void *b)
+{
+    const symreg_idx_entry_t *e1 = a, *e2 = b;
+    int                      cmp;
+
+    if ((cmp = SYMREG_parent_cmp(e1->parent, e2->parent)) == 0 &&
+        (cmp = (e1->addr < e2->addr ? -1 : e1->addr > e2->addr ? 1 : 0)) == 0) {
+        cmp = (e1->idx < e2->idx ? -1 : e1->idx > e2->idx ? 1 : 0);
+    }
+
+    return cmp;
+}
+
+/******************************************************************************/
+// SYMREG_hash_add()
+// Adds the hash entry for a parent (#name is NULL) or a name starting at
+// name index position #pos.
+/******************************************************************************/
+static void SYMREG_hash_add(const void *parent, const char *name, uint32_t pos)
+{
+    symreg_hash_t *h;
+    uint32_t      i, end = pos;
+
+    // Count the entries of the range
+    while (++end < SYMREG_IDX.cnt && SYMREG_IDX.name[end].parent == parent &&
+           (name == NULL || strcmp(SYMREG_IDX.name[end].name, name) == 0)) {
+    }
+
+    for (i = SYMREG_hash(parent, SYMREG_name_hash(name)); ; i++) {
+        h = &SYMREG_IDX.hash[i & SYMREG_IDX.hash_mask];
+        if (h->parent == NULL) {
+            h->parent = parent;
+            h->name = name;
+            h->pos = pos;
+            h->cnt = (end - pos);
+            return;
+        }
+    }
+}
+
+/******************************************************************************/
+// SYMREG_idx_init()
+/******************************************************************************/
+static void SYMREG_idx_init(void)
+{
+    const mesa_symreg_reggrp_t *g;
+    const mesa_symreg_reg_t    *r;
+    const void                 **grps = NULL, **regs = NULL;
+    symreg_idx_entry_t         *e;
+    symreg_hash_t              *h;
+    uint32_t                   i, grps_cnt, regs_cnt = 0, cnt = SYMREG_DATA.targets_cnt, size;
+
+    // Collect the distinct register group and register arrays
+    if (SYMREG_DATA.targets_cnt == 0 ||
+        (grps = malloc(SYMREG_DATA.targets_cnt * sizeof(*grps))) == NULL) {
+        goto do_exit;
+    }
+
+    for (i = 0; i < SYMREG_DATA.targets_cnt; i++) {
+        grps[i] = SYMREG_DATA.targets[i].reggrps;
+    }
+
+    grps_cnt = SYMREG_ptr_unique(grps, SYMREG_DATA.targets_cnt);
+    for (i = 0; i < grps_cnt; i++) {
+        for (g = grps[i]; g->name != NULL; g++) {
+            regs_cnt++;
+        }
+    }
+
+    cnt += regs_cnt;
+    if ((regs = malloc((regs_cnt + 1) * sizeof(*regs))) == NULL) {
+        goto do_exit;
+    }
+
+    regs_cnt = 0;
+    for (i = 0; i < grps_cnt; i++) {
+        for (g = grps[i]; g->name != NULL; g++) {
+            regs[regs_cnt++] = g->regs;
+        }
+    }
+
+    regs_cnt = SYMREG_ptr_unique(regs, regs_cnt);
+    for (i = 0; i < regs_cnt; i++) {
+        for (r = regs[i]; r->name != NULL; r++) {
+            cnt++;
+        }
+    }
+
+    if ((SYMREG_IDX.name = malloc(cnt * sizeof(*e))) == NULL ||
+        (SYMREG_IDX.addr = malloc(cnt * sizeof(*e))) == NULL) {
+        free(SYMREG_IDX.name);
+        SYMREG_IDX.name = NULL;
+        goto do_exit;
+    }
+
+    e = SYMREG_IDX.name;
+    for (i = 0; i < SYMREG_DATA.targets_cnt; i++, e++) {
+        e->parent = SYMREG_DATA.targets;
+        e->name = SYMREG_DATA.targets[i].name;
+        e->addr = SYMREG_DATA.targets[i].base_addr;
+        e->idx = i;
+    }
+
+    for (i = 0; i < grps_cnt; i++) {
+        for (g = grps[i]; g->name != NULL; g++, e++) {
+            e->parent = grps[i];
+            e->name = g->name;
+            e->addr = g->base_addr;
+            e->idx = (g - (const mesa_symreg_reggrp_t *)grps[i]);
+        }
+    }
+
+    for (i = 0; i < regs_cnt; i++) {
+        for (r = regs[i]; r->name != NULL; r++, e++) {
+            e->parent = regs[i];
+            e->name = r->name;
+            e->addr = r->addr;
+            e->idx = (r - (const mesa_symreg_reg_t *)regs[i]);
+        }
+    }
+
+    memcpy(SYMREG_IDX.addr, SYMREG_IDX.name, cnt * sizeof(*e));
+    qsort(SYMREG_IDX.name, cnt, sizeof(*e), SYMREG_qsort_name);
+    qsort(SYMREG_IDX.addr, cnt, sizeof(*e), SYMREG_qsort_addr);
+
+    // Hash each parent and each distinct name within a parent. At most two
+    // hash entries are needed per index entry, keep the load factor below 50%.
+    for (size = 1; size < 4 * cnt; size *= 2) {
+    }
+
+    if ((SYMREG_IDX.hash = calloc(size, sizeof(*h))) == NULL) {
+        free(SYMREG_IDX.name);
+        free(SYMREG_IDX.addr);
+        SYMREG_IDX.name = NULL;
+        SYMREG_IDX.addr = NULL;
+        goto do_exit;
+    }
+
+    SYMREG_IDX.hash_mask = (size - 1);
+    SYMREG_IDX.cnt = cnt;
+    for (i = 0, e = SYMREG_IDX.name; i < cnt; i++, e++) {
+        if (i == 0 || e->parent != e[-1].parent) {
+            SYMREG_hash_add(e->parent, NULL, i);
+        }
+
+        if (i == 0 || e->parent != e[-1].parent || strcmp(e->name, e[-1].name) != 0) {
+            SYMREG_hash_add(e->parent, e->name, i);
+        }
+    }
+
+    T_D("Index: %u targets, %u groups, %u registers", SYMREG_DATA.targets_cnt, grps_cnt, regs_cnt);
+
+do_exit:
+    if (SYMREG_IDX.cnt == 0) {
+        T_E("Failed to build symreg index, using linear search");
+    }
+
+    free(grps);
+    free(regs);
+}
+
 static void symreg_init(void)
 {
     if (mesa_symreg_data_get(0, &SYMREG_DATA) != MESA_RC_OK) {
@@ -1002,6 +1668,8 @@ static void symreg_init(void)
         T_E("SYMREG_REPL_CNT_MAX name buffer is too small (%u > %u) - will cause memory overwrite!", SYMREG_DATA.name_len_max, SYMREG_NAME_LEN_MAX);
         T_E("This is a bug!");
     }
+
+    SYMREG_idx_init();
 }
 
 void mscc_appl_symreg_init(mscc_appl_init_t *init)
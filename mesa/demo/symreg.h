@@ -12,5 +12,6 @@ typedef enum {
 } symreg_func_t;
 
 void symreg_cli_regs_print(symreg_func_t func, char *pattern, uint32_t value);
+void symreg_cli_addr_print(uint32_t addr);
 
 #endif /* _MSCC_APPL_SYMREG_H_ */
@@ -0,0 +1,76 @@
+#!/usr/bin/env ruby
+
+# Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+# SPDX-License-Identifier: MIT
+
+require_relative 'libeasy/et'
+
+$ts = get_test_setup("mesa_pc_b2b_4x")
+
+#---------- Capabilities -----------------------------------------------------
+cap_check_exit("L2_XFLOW")
+
+#---------- Test parameters ----------------------------------------------------
+# Test: Bulk ingress flow configuration.
+# 1) Allocate more flows than the MESA layer converts at a time
+# 2) Map each flow to its own ingress counter using one bulk call and check all flows
+# 3) Unmap the counters using a list with an invalid flow in the middle and
+#    check that only the flows before the invalid flow are changed
+
+$flow_cnt = 20
+$err_idx = 10
+
+#---------- Configuration -----------------------------------------------------
+
+test "conf" do
+    $flows = []
+    $flow_cnt.times do
+        $flows << { id: $ts.dut.call("mesa_iflow_alloc"), cnt_id: $ts.dut.call("mesa_ingress_cnt_alloc", 1) }
+    end
+end
+
+def bulk_entry(flow, enable)
+    conf = $ts.dut.call("mesa_iflow_conf_get", flow[:id])
+    conf["cnt_enable"] = enable
+    conf["cnt_id"] = (enable ? flow[:cnt_id] : 0)
+    { "id" => flow[:id], "conf" => conf }
+end
+
+def bulk_check(txt, enabled)
+    test txt do
+        $flows.each_with_index do |flow, idx|
+            conf = $ts.dut.call("mesa_iflow_conf_get", flow[:id])
+            exp = enabled.call(idx)
+            if (conf["cnt_enable"] != exp or (exp and conf["cnt_id"] != flow[:cnt_id]))
+                t_e("flow #{flow[:id]}: cnt_enable: #{conf["cnt_enable"]}, cnt_id: #{conf["cnt_id"]}, expected cnt_enable: #{exp}")
+            end
+        end
+    end
+end
+
+#---------- Bulk testing ------------------------------------------------------
+
+test "bulk-set" do
+    entries = $flows.map { |flow| bulk_entry(flow, true) }
+    set_cnt = $ts.dut.call("mesa_iflow_conf_bulk_set", entries.size, entries)
+    if (set_cnt != $flow_cnt)
+        t_e("set_cnt: #{set_cnt}, expected: #{$flow_cnt}")
+    end
+end
+
+bulk_check("bulk-set-check", lambda { |idx| true })
+
+test "bulk-set-error" do
+    entries = $flows.map { |flow| bulk_entry(flow, false) }
+    entries[$err_idx]["id"] = 0
+    $ts.dut.call_err("mesa_iflow_conf_bulk_set", entries.size, entries)
+end
+
+bulk_check("bulk-set-error-check", lambda { |idx| idx >= $err_idx })
+
+test "cleanup" do
+    $flows.each do |flow|
+        $ts.dut.call("mesa_iflow_free", flow[:id])
+        $ts.dut.call("mesa_ingress_cnt_free", flow[:cnt_id])
+    end
+end
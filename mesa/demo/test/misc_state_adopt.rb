@@ -0,0 +1,65 @@
+#!/usr/bin/env ruby
+
+# Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+# SPDX-License-Identifier: MIT
+
+require_relative 'libeasy/et'
+
+# The API state is kept in this file (mesa-demo option '-P')
+$state_file = "/tmp/mesa-state"
+
+$ts = get_test_setup("mesa_pc_b2b_4x", {}, "-P #{$state_file}")
+
+#---------- Test parameters ----------------------------------------------------
+# Test: Adoption of the API state by a restarted application.
+# 1) Change the port VLAN configuration
+# 2) Restart mesa-demo using the same state file
+# 3) Check that the state was adopted: The configuration is kept and the ports stay up
+
+$vid = 100
+
+#---------- Configuration -----------------------------------------------------
+
+test "conf" do
+    $ts.dut.port_list.each do |port|
+        conf = $ts.dut.call("mesa_vlan_port_conf_get", port)
+        conf["pvid"] = $vid
+        $ts.dut.call("mesa_vlan_port_conf_set", port, conf)
+    end
+end
+
+#---------- Restart -----------------------------------------------------------
+
+test "restart" do
+    # SIGTERM releases the API state for adoption
+    $ts.dut.run("killall -TERM mesa-demo")
+    sleep(2)
+    $ts.dut.bg("api", "mesa-demo -f -P #{$state_file}")
+    sleep(5)
+end
+
+#---------- Adoption ----------------------------------------------------------
+
+test "adopted" do
+    status = $ts.dut.call("mesa_inst_persist_status_get")
+    if (!status["adopted"])
+        t_e("API state not adopted")
+    end
+    $ts.dut.port_list.each do |port|
+        conf = $ts.dut.call("mesa_vlan_port_conf_get", port)
+        if (conf["pvid"] != $vid)
+            t_e("port #{port}: pvid: #{conf["pvid"]}, expected: #{$vid}")
+        end
+        if (!$ts.dut.call("mesa_port_state_get", port))
+            t_e("port #{port} not operational")
+        end
+    end
+end
+
+test "cleanup" do
+    $ts.dut.port_list.each do |port|
+        conf = $ts.dut.call("mesa_vlan_port_conf_get", port)
+        conf["pvid"] = 1
+        $ts.dut.call("mesa_vlan_port_conf_set", port, conf)
+    end
+end
@@ -170,6 +170,54 @@ test "frame-io-afi-v2-slow" do
     check_cnt(port, prio)
 end
 
+test "frame-io-afi-v2-slow-rm" do
+    if (cap_get("AFI_V2") == 0)
+        break
+    end
+
+    port = $ts.dut.port_list[$idx_rx]
+    prio = 4
+    cnt = 100
+
+    t_i("allocate and hijack #{cnt} afi injections")
+    ids = []
+    cnt.times do
+        conf = {}
+        conf["port_no"] = port
+        conf["prio"] = prio
+        conf["masquerade_port_no"] = 0
+        id = $ts.dut.call("mesa_afi_slow_inj_alloc", conf)
+        frame_tx(port, prio, id, 64, false)
+        $ts.dut.call("mesa_afi_slow_inj_frm_hijack", id)
+        ids << id
+    end
+
+    t_i("free afi injections")
+    ids.each do |id|
+        $ts.dut.call("mesa_afi_slow_inj_free", id)
+    end
+
+    t_i("wait for removal events")
+    done = []
+    10.times do
+        loop do
+            ev = $ts.dut.call("mesa_afi_rm_event_get")
+            break if (!ev["valid"])
+            if (ev["fast"] or !ids.include?(ev["id"]) or done.include?(ev["id"]))
+                t_e("unexpected event: #{ev}")
+            elsif (!ev["removed"])
+                t_e("removal failed, id: #{ev["id"]}")
+            end
+            done << ev["id"]
+        end
+        break if (done.size >= cnt)
+        sleep(1)
+    end
+    if (done.size != cnt)
+        t_e("got #{done.size} removal events, expected #{cnt}")
+    end
+end
+
 test "frame-io-afi-v2-fast" do
     if (cap_get("AFI_V2") == 0)
         break
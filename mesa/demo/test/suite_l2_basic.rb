@@ -11,6 +11,7 @@ run %w{./check_wireing.rb}, {:name => "check_wireing@l2_basics", :abort_on_err =
 run %w{./l2_aggr.rb}
 run %w{./l2_evlan.rb}
 run %w{./l2_flood.rb}
+run %w{./l2_iflow_bulk.rb}
 run %w{./l2_igmp.rb}
 run %w{./l2_isolation.rb}
 run %w{./l2_mac_idx.rb}
@@ -321,8 +321,14 @@ typedef struct {
     char               module_name[TRACE_NAME_MAX];
     char               group_name[TRACE_NAME_MAX];
     mesa_trace_level_t level;
+    mesa_bool_t        clear;
+    mesa_bool_t        stream;
+    mesa_bool_t        bench;
 } trace_cli_req_t;
 
+// Print binary trace entries every fast poll
+static mesa_bool_t trace_bin_stream;
+
 static void trace_control(char *module_name, char *group_name, mesa_trace_level_t level, mesa_bool_t set)
 {
     mscc_appl_trace_module_t *module;
@@ -377,12 +383,66 @@ static void cli_cmd_debug_trace(cli_req_t *req)
     trace_control(mreq->module_name, mreq->group_name, mreq->level, req->set);
 }
 
+// Streamed binary trace is printed from the poll loop, outside any CLI session
+static int trace_bin_printf(const char *fmt, ...)
+{
+    va_list args;
+    int     rc;
+
+    va_start(args, fmt);
+    rc = vprintf(fmt, args);
+    va_end(args);
+    return rc;
+}
+
+static void cli_cmd_debug_trace_bin(cli_req_t *req)
+{
+    trace_cli_req_t        *mreq = req->module_req;
+    mesa_trace_bin_conf_t  conf;
+    mesa_trace_bin_bench_t bench;
+
+    if (mesa_trace_bin_conf_get(&conf) != MESA_RC_OK) {
+        cli_printf("Binary trace get failed\n");
+        return;
+    }
+    if (req->set) {
+        conf.enable = req->enable;
+        if (mesa_trace_bin_conf_set(&conf) != MESA_RC_OK) {
+            cli_printf("Binary trace set failed\n");
+            return;
+        }
+        if (!conf.enable) {
+            trace_bin_stream = 0;
+        }
+    }
+    if (mreq->bench) {
+        if (mesa_trace_bin_bench(100000, &bench) == MESA_RC_OK) {
+            cli_printf("Trace points: %u\n", bench.cnt);
+            cli_printf("Binary      : %u nsec\n", bench.bin_ns);
+            cli_printf("vsnprintf   : %u nsec\n", bench.printf_ns);
+        } else {
+            cli_printf("Binary trace benchmark failed\n");
+        }
+    } else if (mreq->stream) {
+        trace_bin_stream = 1;
+    } else if (!req->set || mreq->clear) {
+        trace_bin_stream = 0;
+        cli_printf("Binary trace: %s\n", conf.enable ? "enabled" : "disabled");
+        (void)mesa_trace_bin_print(cli_printf, mreq->clear);
+    }
+}
+
 static cli_cmd_t cli_cmd_table[] = {
     {
         "Debug Trace [<module>] [<group>] [off|error|info|debug|noise]",
         "Set or show the trace level for group",
         cli_cmd_debug_trace
     },
+    {
+        "Debug Binary-Trace [enable|disable] [clear|stream|bench]",
+        "Configure binary API trace, or show, stream or benchmark it",
+        cli_cmd_debug_trace_bin
+    },
 };
 
 static int cli_parm_wildcard(cli_req_t *req)
@@ -460,6 +520,26 @@ static int cli_parm_keyword(cli_req_t *req)
     return 0;
 }
 
+static int cli_parm_bin_keyword(cli_req_t *req)
+{
+    const char      *found;
+    trace_cli_req_t *mreq = req->module_req;
+
+    if ((found = cli_parse_find(req->cmd, req->stx)) == NULL)
+        return 1;
+
+    if (!strncmp(found, "clear", 5))
+        mreq->clear = 1;
+    else if (!strncmp(found, "stream", 6))
+        mreq->stream = 1;
+    else if (!strncmp(found, "bench", 5))
+        mreq->bench = 1;
+    else
+        cli_printf("no match:%s\n",found);
+
+    return 0;
+}
+
 static cli_parm_t cli_parm_table[] = {
     {
         "<module>",
@@ -485,6 +565,16 @@ static cli_parm_t cli_parm_table[] = {
         CLI_PARM_FLAG_NO_TXT | CLI_PARM_FLAG_SET,
         cli_parm_keyword
     },
+    {
+        "clear|stream|bench",
+        "clear   : Show and remove binary trace entries\n"
+        "stream  : Print new binary trace entries continuously\n"
+        "bench   : Measure binary trace point overhead\n"
+        "(default: Show binary trace entries)",
+        CLI_PARM_FLAG_NO_TXT,
+        cli_parm_bin_keyword,
+        cli_cmd_debug_trace_bin
+    },
 };
 
 static void trace_cli_init(void)
@@ -624,6 +714,12 @@ void mscc_appl_trace_init(mscc_appl_init_t *init)
         trace_cli_init();
         break;
 
+    case MSCC_INIT_CMD_POLL_FAST:
+        if (trace_bin_stream) {
+            (void)mesa_trace_bin_print(trace_bin_printf, 1);
+        }
+        break;
+
     default:
         break;
     }
@@ -52,6 +52,8 @@ enum_val = 0
 File.readlines(options[:hdr]).each do |l|
     cap_name = ""
     case l
+    when /MESA_CAP_LAST/
+        # Upper bound, not a capability
     when /(MESA_CAP_\w+)\s*=\s*(\d+)/
         enum_val = $2.to_i
         cap_name = $1
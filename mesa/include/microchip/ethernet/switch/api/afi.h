@@ -272,5 +272,23 @@ mesa_rc mesa_afi_port_stop(const mesa_inst_t inst,
                            mesa_port_no_t    port_no)
     CAP(AFI_V2);
 
+// AFI frame removal event
+typedef struct {
+    mesa_bool_t valid;   // TRUE if an event was returned
+    mesa_bool_t fast;    // TRUE if #id is a mesa_afi_fastid_t, FALSE if it is a mesa_afi_slowid_t
+    uint32_t    id;      // Fast or slow injection ID
+    mesa_bool_t removed; // TRUE if the frames were removed and the ID freed, FALSE if removal failed and the ID is still allocated
+} mesa_afi_rm_event_t CAP(AFI_V2);
+
+// Get AFI frame removal event.
+// On some targets, mesa_afi_fast_inj_free() and mesa_afi_slow_inj_free() only start the removal
+// of the injected frames. The removal is completed by mesa_poll_1sec() or by this function,
+// which may be called as often as desired. The ID is freed when the removal is completed.
+// Call this function until event->valid is FALSE.
+// event [OUT]  Removal event.
+mesa_rc mesa_afi_rm_event_get(const mesa_inst_t          inst,
+                              mesa_afi_rm_event_t *const event)
+    CAP(AFI_V2);
+
 #include <microchip/ethernet/hdr_end.h>
 #endif // _MICROCHIP_ETHERNET_SWITCH_API_AFI_
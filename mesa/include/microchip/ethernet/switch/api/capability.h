@@ -6,6 +6,7 @@
 #define _MICROCHIP_ETHERNET_SWITCH_API_CAPABILITY_
 
 #include <stdint.h>
+#include <microchip/ethernet/common.h>
 #include <microchip/ethernet/hdr_start.h>  // ALL INCLUDE ABOVE THIS LINE
 
 // MESA_CHIP_FAMILY, matching VTSS_CHIP_FAMILY, obsolete values 1,3,5 not shown
@@ -399,6 +400,8 @@ typedef enum {
     MESA_CAP_MRP = 2200,                    /**< Media Redundancy Protocol - IEC 62439-2 MRP */
     MESA_CAP_MRP_CNT,                       /**< Total count of MRPs */
 
+    // Must be last
+    MESA_CAP_LAST                           /**< Upper bound of capability values, not a capability */
 } mesa_cap_t;
 
 typedef struct mesa_state_s *mesa_inst_t;   /**< Opaque instance */
@@ -412,6 +415,24 @@ void mesa_cap_callback_add(mesa_inst_t inst, mesa_cap_callback_data_t *hook);
 uint32_t mesa_capability(mesa_inst_t inst, int cap);
 uint32_t mesa_port_cnt(mesa_inst_t inst);
 
+/** \brief Capability value */
+typedef struct {
+    mesa_cap_t cap;    /**< Capability */
+    uint32_t   value;  /**< Value, as returned by mesa_capability() */
+} mesa_cap_entry_t;
+
+// Get all capabilities fixed for the target in one call, for clients caching them.
+// Capabilities depending on the instance (e.g. MESA_CAP_MISC_CPU_TYPE) and
+// capabilities provided by a callback must be read using mesa_capability().
+// max   [IN]  Size of the entry array.
+// cnt   [OUT] Number of entries stored.
+// entry [OUT] Capability values, sorted by capability.
+// Returns MESA_RC_ERROR if the array is too small, cnt is then set to max.
+mesa_rc mesa_capability_export(mesa_inst_t inst,
+                               const uint32_t max,
+                               uint32_t *const cnt,
+                               mesa_cap_entry_t *const entry);
+
 #define MESA_CAP(expr) mesa_capability(NULL, expr)
 
 #include <microchip/ethernet/hdr_end.h>
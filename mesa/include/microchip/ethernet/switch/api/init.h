@@ -61,7 +61,9 @@ typedef enum {
 
 // Create structure
 typedef struct {
-    mesa_target_type_t target; // Target type
+    mesa_target_type_t target;     // Target type
+    void               *state_mem; // Persistent memory region for the API state or NULL to allocate it. See mesa_inst_persist_size_get()
+    uint32_t           state_size; // Size of state_mem in bytes
 } mesa_inst_create_t;
 
 // Initialize create structure for target.
@@ -80,6 +82,31 @@ mesa_rc mesa_inst_create(const mesa_inst_create_t *const create,
 // inst [IN] Target instance reference.
 mesa_rc mesa_inst_destroy(const mesa_inst_t inst);
 
+// Get the size of the persistent memory region needed for the API state.
+// The region starts with a versioned header followed by the API state.
+// When mesa_inst_create() is given a region holding a valid state released by
+// mesa_inst_destroy(), the state is adopted instead of created.
+// The state is only adopted if it was created by the same API build loaded at the same
+// address and the region is mapped at the same address, because the state holds function
+// pointers and pointers into itself.
+// size [OUT] Size of the region in bytes.
+mesa_rc mesa_inst_persist_size_get(uint32_t *const size);
+
+// Persistent state status
+typedef struct {
+    mesa_bool_t persistent; // The API state is located in a persistent memory region
+    mesa_bool_t adopted;    // The API state was adopted from the previous owner of the region
+} mesa_inst_persist_status_t;
+
+// Get persistent state status.
+// If the state has been adopted, the hardware and API state are already configured.
+// The application must call mesa_init_conf_set() to update the register access and
+// other callback functions, which does not access the hardware for an adopted state.
+// Reconfiguration and warm start synchronization can then be skipped.
+// status [OUT] Persistent state status.
+mesa_rc mesa_inst_persist_status_get(const mesa_inst_t          inst,
+                                     mesa_inst_persist_status_t *const status);
+
 // Register read function
 // chip_no [IN] Chip number, for targets with multiple chips
 // addr [IN]    Register address
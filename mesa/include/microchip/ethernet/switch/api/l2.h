@@ -710,6 +710,22 @@ mesa_rc mesa_iflow_conf_set(const mesa_inst_t      inst,
                             const mesa_iflow_id_t   id,
                             const mesa_iflow_conf_t *const conf);
 
+// Ingress flow ID and configuration
+typedef struct {
+    mesa_iflow_id_t   id;   // Ingress flow ID
+    mesa_iflow_conf_t conf; // Ingress flow configuration
+} mesa_iflow_entry_t;
+
+// Set configuration of a list of ingress flows.
+// The flows are applied in order, stopping at the first failure.
+// cnt [IN]      Length of 'entry'.
+// entry [IN]    List of flows to configure.
+// set_cnt [OUT] Number of flows configured.
+mesa_rc mesa_iflow_conf_bulk_set(const mesa_inst_t        inst,
+                                 const uint32_t           cnt,
+                                 const mesa_iflow_entry_t *entry,
+                                 uint32_t                 *const set_cnt);
+
 /* - Tag Control List ---------------------------------------------- */
 
 // TCE ID type
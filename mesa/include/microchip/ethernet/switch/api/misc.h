@@ -79,6 +79,32 @@ mesa_rc mesa_trace_conf_get(const mesa_trace_group_t  group,
 mesa_rc mesa_trace_conf_set(const mesa_trace_group_t  group,
                             const mesa_trace_conf_t   *const conf);
 
+// Binary trace configuration
+typedef struct {
+    mesa_bool_t enable; // Record debug and noise trace in per-thread binary ring buffers instead of calling mesa_callout_trace_printf()
+} mesa_trace_bin_conf_t;
+
+// Get binary trace configuration
+// conf [OUT]  Binary trace configuration.
+mesa_rc mesa_trace_bin_conf_get(mesa_trace_bin_conf_t *const conf);
+
+// Set binary trace configuration
+// conf [IN]  Binary trace configuration.
+mesa_rc mesa_trace_bin_conf_set(const mesa_trace_bin_conf_t *const conf);
+
+// Binary trace benchmark result
+typedef struct {
+    uint32_t cnt;       // Number of trace points recorded
+    uint32_t bin_ns;    // Average time per binary trace point [nsec]
+    uint32_t printf_ns; // Average time per trace point formatted using vsnprintf() [nsec]
+} mesa_trace_bin_bench_t;
+
+// Measure the overhead of binary and formatted trace points.
+// The trace points are recorded in a private ring buffer, so existing trace is not affected.
+// cnt [IN]     Number of trace points to record.
+// bench [OUT]  Benchmark result.
+mesa_rc mesa_trace_bin_bench(const uint32_t cnt, mesa_trace_bin_bench_t *const bench);
+
 // Trace callout function
 //
 // layer [IN]     Trace layer
@@ -199,6 +225,13 @@ mesa_rc mesa_debug_info_print(const mesa_inst_t         inst,
                               const mesa_debug_printf_t prntf,
                               const mesa_debug_info_t   *const info);
 
+// Print binary trace.
+// The entries of all thread ring buffers are formatted and printed in time stamp order.
+// prntf [IN]  Debug printf function.
+// clear [IN]  Remove the printed entries from the ring buffers.
+mesa_rc mesa_trace_bin_print(const mesa_debug_printf_t prntf,
+                             const mesa_bool_t         clear);
+
 /* - API protection functions -------------------------------------- */
 
 // API lock structure
@@ -263,6 +296,51 @@ mesa_rc mesa_reg_write_masked(const mesa_inst_t    inst,
                               const uint32_t       value,
                               const uint32_t       mask);
 
+/* - Register access profiling (for debugging only) ---------------- */
+
+// Register access profiling configuration
+typedef struct {
+    mesa_bool_t enable; // Count register accesses and access time per register group and per API function
+} mesa_reg_profile_conf_t;
+
+// Get register access profiling configuration.
+// conf [OUT]  Profiling configuration.
+mesa_rc mesa_reg_profile_conf_get(const mesa_inst_t       inst,
+                                  mesa_reg_profile_conf_t *const conf);
+
+// Set register access profiling configuration.
+// conf [IN]  Profiling configuration.
+mesa_rc mesa_reg_profile_conf_set(const mesa_inst_t             inst,
+                                  const mesa_reg_profile_conf_t *const conf);
+
+// Clear register access profiling counters.
+mesa_rc mesa_reg_profile_clear(const mesa_inst_t inst);
+
+// Register access profiling table
+typedef enum {
+    MESA_REG_PROFILE_TYPE_GROUP, // Counters per register target and group
+    MESA_REG_PROFILE_TYPE_FUNC,  // Counters per API function
+} mesa_reg_profile_type_t;
+
+// Register access profiling entry
+typedef struct {
+    const char *name;   // Target name or API function name
+    const char *group;  // Register group name, NULL for API functions
+    uint32_t   rd_cnt;  // Number of register reads
+    uint32_t   wr_cnt;  // Number of register writes
+    uint64_t   nsec;    // Accumulated access time [nsec]
+} mesa_reg_profile_entry_t;
+
+// Get register access profiling entry.
+// type [IN]   Profiling table.
+// idx [IN]    Entry index, starting from zero.
+// entry [OUT] Profiling entry. Unused entries have zero counters.
+// Returns an error if the index is beyond the last entry.
+mesa_rc mesa_reg_profile_get(const mesa_inst_t             inst,
+                             const mesa_reg_profile_type_t type,
+                             const uint32_t                idx,
+                             mesa_reg_profile_entry_t      *const entry);
+
 /* - Secondary chip if ------------------- */
 
 // Clear EXT0-1 interrupt sticky bits on secondary chip.
@@ -125,6 +125,11 @@ $methods_blacklist = [
     "mesa_callout_unlock",
     "mesa_vlan_trans_group_to_port_get",
     "mesa_vlan_trans_group_to_port_set",
+    "mesa_iflow_conf_bulk_set",
+    "mesa_aggr_port_members_set",
+    "mesa_mirror_ingress_ports_set",
+    "mesa_mirror_egress_ports_set",
+    "mesa_frer_mstream_alloc",
 ]
 
 $conv_methods = {}
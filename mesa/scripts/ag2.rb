@@ -100,6 +100,10 @@ $methods_blacklist = [
     "mesa_symreg_data_get",
     "mesa_debug_info_get",
     "mesa_debug_info_print",
+    "mesa_trace_bin_print",
+    "mesa_reg_profile_get",
+    "mesa_inst_get",
+    "mesa_inst_create",
     "mesa_macsec_dbg_reg_dump",
     "mesa_macsec_dbg_fcb_block_reg_dump",
     "mesa_macsec_dbg_frm_match_handling_ctrl_reg_dump",
@@ -110,6 +114,7 @@ $methods_blacklist = [
     "mesa_tx_timestamp_idx_alloc",
     "mesa_tod_set_ns_cnt_cb",
     "mesa_cap_callback_add",
+    "mesa_capability_export",
     "meba_phy_debug_info_print",
     "meba_phy_macsec_dbg_fcb_block_reg_dump",
     "meba_phy_macsec_dbg_fcb_block_reg_dump",
@@ -194,7 +194,8 @@ void mesa_cap_callback_add(mesa_inst_t inst, mesa_cap_callback_data_t *hook)
 #define MESA_EVENT_EXT_SYNC 5 /* Local definition of external synchronisation event ID */
 #define MESA_BIT(x) (1 << (x))
 
-uint32_t mesa_capability(mesa_inst_t inst, int cap)
+// Capability value for the target, FALSE if cap is not a MESA capability
+static mesa_bool_t mesa_cap_calc(mesa_inst_t inst, int cap, uint32_t *val)
 {
     uint32_t c = 0;
 
@@ -1924,23 +1925,121 @@ uint32_t mesa_capability(mesa_inst_t inst, int cap)
 #if defined(VTSS_ARCH_SPARX5)
         c = 1;
 #endif
+        break;
 
     default:
-        {
-            mesa_cap_callback_data_t *hook = NULL;
-            if (vtss_misc_appdata_get((vtss_inst_t)inst, (void**)&hook) == VTSS_RC_OK && hook != NULL) {
-                c = hook->cb(hook->inst, cap);
-            } else {
-                VTSS_E("Unknown capability: %d\n", cap);
-                MESA_ASSERT(0);
-            }
+        return FALSE;
+    }
+
+    *val = c;
+    return TRUE;
+}
+
+// Capabilities depending on the instance state or the chip revision are not cached
+static mesa_bool_t mesa_cap_inst(int cap)
+{
+    switch (cap) {
+    case MESA_CAP_MISC_CPU_TYPE:
+    case MESA_CAP_VOP_USED_AS_PTP_PROTOCOL:
+    case MESA_CAP_MEP_LBR_MCE_HW_SUPPORT:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+// Capability table, indexed by MESA_CAP_* value
+#define MESA_CAP_TABLE_SIZE MESA_CAP_LAST
+
+#define MESA_CAP_TYPE_UNKNOWN 0 // Not a MESA capability
+#define MESA_CAP_TYPE_CONST   1 // Fixed for the target, value in table
+#define MESA_CAP_TYPE_INST    2 // Computed on each call
+
+static uint32_t mesa_cap_val[MESA_CAP_TABLE_SIZE];
+static uint8_t  mesa_cap_type[MESA_CAP_TABLE_SIZE];
+static int      mesa_cap_ready;
+
+// The table only holds values fixed at compile time, so it is shared by all
+// instances and filling it twice from different threads is harmless.
+static void mesa_cap_table_init(void)
+{
+    uint32_t c;
+    int      cap;
+
+    for (cap = 0; cap < MESA_CAP_TABLE_SIZE; cap++) {
+        if (mesa_cap_inst(cap)) {
+            mesa_cap_type[cap] = MESA_CAP_TYPE_INST;
+        } else if (mesa_cap_calc(NULL, cap, &c)) {
+            mesa_cap_val[cap] = c;
+            mesa_cap_type[cap] = MESA_CAP_TYPE_CONST;
         }
-        break;
+    }
+    __atomic_store_n(&mesa_cap_ready, 1, __ATOMIC_RELEASE);
+}
+
+uint32_t mesa_capability(mesa_inst_t inst, int cap)
+{
+    mesa_cap_callback_data_t *hook = NULL;
+    uint32_t                 c = 0;
+
+    if (!__atomic_load_n(&mesa_cap_ready, __ATOMIC_ACQUIRE)) {
+        mesa_cap_table_init();
     }
 
+    if (cap >= 0 && cap < MESA_CAP_TABLE_SIZE) {
+        switch (mesa_cap_type[cap]) {
+        case MESA_CAP_TYPE_CONST:
+            return mesa_cap_val[cap];
+        case MESA_CAP_TYPE_INST:
+            (void)mesa_cap_calc(inst, cap, &c);
+            return c;
+        default:
+            break;
+        }
+    }
+
+    if (vtss_misc_appdata_get((vtss_inst_t)inst, (void**)&hook) == VTSS_RC_OK && hook != NULL) {
+        c = hook->cb(hook->inst, cap);
+    } else {
+        VTSS_E("Unknown capability: %d\n", cap);
+        MESA_ASSERT(0);
+    }
     return c;
 }
 
+mesa_rc mesa_capability_export(mesa_inst_t inst,
+                               const uint32_t max,
+                               uint32_t *const cnt,
+                               mesa_cap_entry_t *const entry)
+{
+    uint32_t n = 0;
+    int      cap;
+
+    if (cnt == NULL || (max != 0 && entry == NULL)) {
+        VTSS_E("illegal argument");
+        return MESA_RC_ERROR;
+    }
+
+    if (!__atomic_load_n(&mesa_cap_ready, __ATOMIC_ACQUIRE)) {
+        mesa_cap_table_init();
+    }
+
+    for (cap = 0; cap < MESA_CAP_TABLE_SIZE; cap++) {
+        if (mesa_cap_type[cap] != MESA_CAP_TYPE_CONST) {
+            continue;
+        }
+        if (n == max) {
+            *cnt = n;
+            return MESA_RC_ERROR;
+        }
+        entry[n].cap = cap;
+        entry[n].value = mesa_cap_val[cap];
+        n++;
+    }
+    *cnt = n;
+    return MESA_RC_OK;
+}
+
 uint32_t mesa_port_cnt(mesa_inst_t inst)
 {
     return mesa_capability(inst, MESA_CAP_PORT_CNT);
@@ -8,10 +8,16 @@
 #include "microchip/ethernet/switch/api/misc.h"
 #include "microchip/ethernet/switch/api/capability.h"
 
+// The export holds at most one entry per capability value
+#define CAP_EXPORT_MAX MESA_CAP_LAST
+
 int main(int argc, char *argv[]) {
     int i, cap;
+    uint32_t j, val, cnt = 0;
     void *handle;
     uint32_t (*capability)(mesa_inst_t, int);
+    mesa_rc (*capability_export)(mesa_inst_t, const uint32_t, uint32_t *const, mesa_cap_entry_t *const);
+    static mesa_cap_entry_t export[CAP_EXPORT_MAX];
 
     char *error;
 
@@ -32,9 +38,23 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
 
+    // The bulk export is optional, if present each value is checked against it
+    capability_export = dlsym(handle, "mesa_capability_export");
+    if (dlerror() == NULL && (*capability_export)(0, CAP_EXPORT_MAX, &cnt, export) != MESA_RC_OK) {
+        fputs("mesa_capability_export() failed\n", stderr);
+        exit(1);
+    }
+
     for (i = 2; i < argc; ++i) {
         cap = atoi(argv[i]);
-        printf("%d %u\n", cap, (*capability)(0, cap));
+        val = (*capability)(0, cap);
+        for (j = 0; j < cnt; j++) {
+            if (export[j].cap == cap && export[j].value != val) {
+                fprintf(stderr, "%d: mesa_capability() %u != mesa_capability_export() %u\n", cap, val, export[j].value);
+                exit(2);
+            }
+        }
+        printf("%d %u\n", cap, val);
         fflush(stdout);
     }
 
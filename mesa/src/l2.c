@@ -5,12 +5,30 @@
 #include <vtss_api.h>
 #include <mesa.h>
 
+// Port lists are converted a byte (eight ports) at a time
+static uint8_t mesa_port_byte_get(const mesa_bool_t *in, uint32_t cnt)
+{
+    uint8_t  byte = 0;
+    uint32_t i;
+
+    for (i = 0; i < cnt; i++) {
+        byte |= ((in[i] ? 1 : 0) << i);
+    }
+    return byte;
+}
+
 mesa_rc mesa_conv_uint8_t_to_mesa_port_list_t(const mesa_bool_t in[VTSS_PORT_ARRAY_SIZE], mesa_port_list_t *out)
 {
-    vtss_port_no_t port_no;
+    uint32_t i;
+    uint8_t  *p = out->_private;
 
-    for (port_no = 0; port_no < VTSS_PORTS; port_no++) {
-        mesa_port_list_set(out, port_no, in[port_no]);
+    mesa_port_list_clear(out);
+    for (i = 0; i < VTSS_PORTS / 8; i++) {
+        p[i] = mesa_port_byte_get(&in[i * 8], 8);
+    }
+    if (VTSS_PORTS % 8) {
+        // Last partial byte, only the ports below VTSS_PORTS are read
+        p[i] = mesa_port_byte_get(&in[i * 8], VTSS_PORTS % 8);
     }
     return VTSS_RC_OK;
 }
@@ -18,41 +36,104 @@ mesa_rc mesa_conv_uint8_t_to_mesa_port_list_t(const mesa_bool_t in[VTSS_PORT_ARR
 mesa_rc mesa_conv_mesa_port_list_t_to_uint8_t(const mesa_port_list_t *in, mesa_bool_t out[VTSS_PORT_ARRAY_SIZE])
 {
     vtss_port_no_t port_no;
+    uint8_t        byte = 0;
 
+    memset(out, 0, VTSS_PORTS * sizeof(mesa_bool_t));
     for (port_no = 0; port_no < VTSS_PORTS; port_no++) {
-        out[port_no] = mesa_port_list_get(in, port_no);
+        if ((port_no % 8) == 0 && (byte = in->_private[port_no / 8]) == 0) {
+            // Skip eight non-members
+            port_no += 7;
+            continue;
+        }
+        out[port_no] = ((byte >> (port_no % 8)) & 1);
     }
     return VTSS_RC_OK;
 }
 
-#if defined(VTSS_FEATURE_VCAP)
-#define VTSS_BF_GET(a, n)    ((a[(n)/8] & (1<<((n)%8))) ? 1 : 0)
-#define VTSS_BF_SET(a, n, v) do { if (v) { a[(n)/8] |= (1U<<((n)%8)); } else { a[(n)/8] &= ~(1U<<((n)%8)); }} while (0)
+// Clear the bits beyond VTSS_PORTS in the last byte of a port bitfield
+static void mesa_port_bf_mask(uint8_t *bf)
+{
+    if (VTSS_PORTS % 8) {
+        bf[VTSS_PORTS / 8] &= ((1 << (VTSS_PORTS % 8)) - 1);
+    }
+}
 
-mesa_rc mesa_conv2_vtss_vlan_trans_port2grp_conf_t_to_mesa_vlan_trans_port2grp_conf_t(const vtss_vlan_trans_port2grp_conf_t *in, mesa_vlan_trans_port2grp_conf_t *out)
+// The port bitfield has the same layout as the port list
+static void mesa_port_list_to_bf(const mesa_port_list_t *in, vtss_port_bf_t *out)
 {
-    vtss_port_no_t port_no;
-    mesa_bool_t    member[VTSS_PORT_ARRAY_SIZE];
+    memcpy(out->bf, in->_private, sizeof(out->bf));
+    mesa_port_bf_mask(out->bf);
+}
 
-    for (port_no = 0; port_no < VTSS_PORTS; port_no++) {
-        member[port_no] = VTSS_BF_GET(in->ports, port_no);
-    }
+mesa_rc mesa_aggr_port_members_set(const mesa_inst_t      inst,
+                                   const mesa_aggr_no_t   aggr_no,
+                                   const mesa_port_list_t *port_list)
+{
+#if defined(VTSS_FEATURE_LAYER2)
+    vtss_port_bf_t member;
 
-    return mesa_conv_uint8_t_to_mesa_port_list_t(member, &out->port_list);
+    mesa_port_list_to_bf(port_list, &member);
+    return vtss_aggr_port_members_set((const vtss_inst_t)inst, aggr_no, &member);
+#else
+    return MESA_RC_NOT_IMPLEMENTED;
+#endif
 }
 
-mesa_rc mesa_conv2_mesa_vlan_trans_port2grp_conf_t_to_vtss_vlan_trans_port2grp_conf_t(const mesa_vlan_trans_port2grp_conf_t *in, vtss_vlan_trans_port2grp_conf_t *out)
+mesa_rc mesa_mirror_ingress_ports_set(const mesa_inst_t      inst,
+                                      const mesa_port_list_t *port_list)
 {
-    mesa_rc        rc;
-    vtss_port_no_t port_no;
-    mesa_bool_t    member[VTSS_PORT_ARRAY_SIZE];
+#if defined(VTSS_FEATURE_LAYER2)
+    vtss_port_bf_t member;
 
-    if ((rc = mesa_conv_mesa_port_list_t_to_uint8_t(&in->port_list, member)) == VTSS_RC_OK) {
-        for (port_no = 0; port_no < VTSS_PORTS; port_no++) {
-            VTSS_BF_SET(out->ports, port_no, member[port_no]);
-        }
-    }
-    return rc;
+    mesa_port_list_to_bf(port_list, &member);
+    return vtss_mirror_ingress_ports_set((const vtss_inst_t)inst, &member);
+#else
+    return MESA_RC_NOT_IMPLEMENTED;
+#endif
+}
+
+mesa_rc mesa_mirror_egress_ports_set(const mesa_inst_t      inst,
+                                     const mesa_port_list_t *port_list)
+{
+#if defined(VTSS_FEATURE_LAYER2)
+    vtss_port_bf_t member;
+
+    mesa_port_list_to_bf(port_list, &member);
+    return vtss_mirror_egress_ports_set((const vtss_inst_t)inst, &member);
+#else
+    return MESA_RC_NOT_IMPLEMENTED;
+#endif
+}
+
+mesa_rc mesa_frer_mstream_alloc(const mesa_inst_t      inst,
+                                const mesa_port_list_t *port_list,
+                                mesa_frer_mstream_id_t *const id)
+{
+#if defined(VTSS_FEATURE_FRER)
+    vtss_port_bf_t member;
+
+    mesa_port_list_to_bf(port_list, &member);
+    return vtss_frer_mstream_alloc((const vtss_inst_t)inst, &member, id);
+#else
+    return MESA_RC_NOT_IMPLEMENTED;
+#endif
+}
+
+#if defined(VTSS_FEATURE_VCAP)
+// The VLAN translation port bitfield has the same layout as the port list
+mesa_rc mesa_conv2_vtss_vlan_trans_port2grp_conf_t_to_mesa_vlan_trans_port2grp_conf_t(const vtss_vlan_trans_port2grp_conf_t *in, mesa_vlan_trans_port2grp_conf_t *out)
+{
+    mesa_port_list_clear(&out->port_list);
+    memcpy(out->port_list._private, in->ports, sizeof(in->ports));
+    mesa_port_bf_mask(out->port_list._private);
+    return VTSS_RC_OK;
+}
+
+mesa_rc mesa_conv2_mesa_vlan_trans_port2grp_conf_t_to_vtss_vlan_trans_port2grp_conf_t(const mesa_vlan_trans_port2grp_conf_t *in, vtss_vlan_trans_port2grp_conf_t *out)
+{
+    memcpy(out->ports, in->port_list._private, sizeof(out->ports));
+    mesa_port_bf_mask(out->ports);
+    return VTSS_RC_OK;
 }
 
 mesa_rc mesa_conv2_vtss_vce_key_t_to_mesa_vce_key_t(const vtss_vce_key_t *in, mesa_vce_key_t *out)
@@ -253,3 +334,36 @@ mesa_rc mesa_vlan_trans_group_to_port_set(const mesa_inst_t inst, const mesa_vla
 #endif
 }
 
+
+// Flows are converted and applied this many at a time
+#define MESA_IFLOW_BULK_CNT 16
+
+mesa_rc mesa_iflow_conf_bulk_set(const mesa_inst_t        inst,
+                                 const uint32_t           cnt,
+                                 const mesa_iflow_entry_t *entry,
+                                 uint32_t                 *const set_cnt)
+{
+#if defined(VTSS_FEATURE_XFLOW)
+    mesa_rc            rc = VTSS_RC_OK;
+    vtss_iflow_entry_t buf[MESA_IFLOW_BULK_CNT];
+    uint32_t           i, n, done;
+
+    *set_cnt = 0;
+    while (rc == VTSS_RC_OK && *set_cnt < cnt) {
+        n = (cnt - *set_cnt);
+        if (n > MESA_IFLOW_BULK_CNT) {
+            n = MESA_IFLOW_BULK_CNT;
+        }
+        for (i = 0; i < n; i++) {
+            buf[i].id = entry[*set_cnt + i].id;
+            mesa_conv_mesa_iflow_conf_t_to_vtss_iflow_conf_t(&entry[*set_cnt + i].conf, &buf[i].conf);
+        }
+        rc = vtss_iflow_conf_bulk_set((const vtss_inst_t)inst, n, buf, &done);
+        *set_cnt += done;
+    }
+    return rc;
+#else
+    *set_cnt = 0;
+    return VTSS_RC_ERROR;
+#endif
+}